@@ -115,6 +115,10 @@ class V8_PLATFORM_EXPORT TraceWriter {
   static TraceWriter* CreateJSONTraceWriter(std::ostream& stream,
                                             const std::string& tag);
 
+  // Writes a packed binary stream with string-id interning instead of JSON.
+  // Considerably cheaper to produce; see trace-writer.h for the format.
+  static TraceWriter* CreateBinaryTraceWriter(std::ostream& stream);
+
  private:
   // Disallow copy and assign
   TraceWriter(const TraceWriter&) = delete;
@@ -257,6 +257,24 @@ class PageAllocator {
    * memory area brings the memory transparently back.
    */
   virtual bool DiscardSystemPages(void* address, size_t size) { return true; }
+
+  /**
+   * Hints the OS to back the given [address, address + length) range with
+   * huge pages if supported, e.g. via madvise(MADV_HUGEPAGE) on Linux. This
+   * is advisory only; returns whether the hint was accepted.
+   */
+  virtual bool AdviseHugePages(void* address, size_t length) { return false; }
+
+  /**
+   * Hints the OS that the [address, address + length) range contains pages
+   * whose contents may be identical to pages elsewhere in the system and may
+   * be transparently deduplicated, e.g. via madvise(MADV_MERGEABLE) on Linux
+   * with kernel same-page merging enabled. This is advisory only; returns
+   * whether the hint was accepted.
+   */
+  virtual bool AdviseMergeablePages(void* address, size_t length) {
+    return false;
+  }
 };
 
 /**
@@ -15,6 +15,7 @@
 namespace v8 {
 
 class HeapGraphNode;
+struct HeapObjectUpdate;
 struct HeapStatsUpdate;
 
 typedef uint32_t SnapshotObjectId;
@@ -470,6 +471,16 @@ class V8_EXPORT OutputStream {  // NOLINT
   virtual WriteResult WriteHeapStatsChunk(HeapStatsUpdate* data, int count) {
     return kAbort;
   }
+  /**
+   * Writes the next chunk of heap object delta data into the stream. See
+   * HeapProfiler::GetHeapObjectUpdates. Writing can be stopped by returning
+   * kAbort as function result. EndOfStream will not be called in case
+   * writing was aborted.
+   */
+  virtual WriteResult WriteHeapObjectUpdateChunk(HeapObjectUpdate* data,
+                                                 int count) {
+    return kAbort;
+  }
 };
 
 
@@ -744,6 +755,12 @@ class V8_EXPORT HeapProfiler {
   enum SamplingFlags {
     kSamplingNoFlags = 0,
     kSamplingForceGC = 1 << 0,
+    // Decay the effective sample rate of call stacks that have already
+    // delivered many samples, so that hot small-allocation sites do not
+    // dominate the profile and rare sites stay at the full configured rate.
+    // Reported counts remain unbiased: retained samples are weighted by the
+    // inverse of their retention probability.
+    kSamplingAdaptiveSiteRates = 1 << 1,
   };
 
   typedef std::unordered_set<const v8::PersistentBase<v8::Value>*>
@@ -868,6 +885,22 @@ class V8_EXPORT HeapProfiler {
   SnapshotObjectId GetHeapStats(OutputStream* stream,
                                 int64_t* timestamp_us = nullptr);
 
+  /**
+   * Reports every heap object that was allocated, freed or resized since the
+   * previous call as a stream of HeapObjectUpdate structure instances, via
+   * OutputStream::WriteHeapObjectUpdateChunk. A size of 0 means the object
+   * with that id is gone. The first call reports every live object and
+   * establishes the baseline; subsequent calls cost one heap walk plus
+   * output proportional to the churn, so unlike a full snapshot no object
+   * graph is built in memory. Edges are not reported; take a full snapshot
+   * of the ids in question to inspect retainers. The return value is the
+   * last seen heap object Id.
+   *
+   * StartTrackingHeapObjects must be called before the first call to this
+   * method.
+   */
+  SnapshotObjectId GetHeapObjectUpdates(OutputStream* stream);
+
   /**
    * Stops tracking of heap objects population statistics, cleans up all
    * collected data. StartHeapObjectsTracking must be called again prior to
@@ -1044,6 +1077,16 @@ struct HeapStatsUpdate {
   uint32_t size;  // New value of size field for the interval with this index.
 };
 
+/**
+ * A struct for exporting per-object heap deltas from V8, using "push" model.
+ * See HeapProfiler::GetHeapObjectUpdates.
+ */
+struct HeapObjectUpdate {
+  HeapObjectUpdate(SnapshotObjectId id, uint32_t size) : id(id), size(size) {}
+  SnapshotObjectId id;  // Id of the object that was added, removed or resized.
+  uint32_t size;  // New size of the object; 0 if the object is gone.
+};
+
 #define CODE_EVENTS_LIST(V) \
   V(Builtin)                \
   V(Callback)               \
@@ -1854,6 +1854,26 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Callback receiving a chunk of the streaming Stringify output. The chunk
+   * handle is only valid for the duration of the callback; its backing store
+   * is reused for subsequent chunks. The callback must not re-enter V8.
+   */
+  typedef void (*StringifyChunkCallback)(Local<String> chunk, void* data);
+
+  /**
+   * Stringifies |json_object| as Stringify does, but delivers the result in
+   * chunks through |callback| instead of building a single result string.
+   * This bounds peak memory when serializing large values and allows results
+   * longer than the maximum string length.
+   *
+   * \return Just(true) if output was produced, Just(false) if the value is
+   *   not JSON-serializable (as for undefined), Nothing on exception.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> Stringify(
+      Local<Context> context, Local<Value> json_object, Local<String> gap,
+      StringifyChunkCallback callback, void* data);
 };
 
 /**
@@ -1966,6 +1986,15 @@ class V8_EXPORT ValueSerializer {
                     uint32_t transfer_id,
                     Local<SharedArrayBuffer> shared_array_buffer));
 
+  /**
+   * Marks a String as having its contents transferred out of band, so that
+   * only a reference is written into the buffer. Pass the corresponding
+   * String in the deserializing context to ValueDeserializer::TransferString.
+   * Useful for avoiding a copy of large strings whose contents the embedder
+   * can convey by other means (e.g. shared memory).
+   */
+  void TransferString(uint32_t transfer_id, Local<String> string);
+
   /**
    * Indicate whether to treat ArrayBufferView objects as host objects,
    * i.e. pass them to Delegate::WriteHostObject. This should not be
@@ -2060,6 +2089,12 @@ class V8_EXPORT ValueDeserializer {
   void TransferSharedArrayBuffer(uint32_t id,
                                  Local<SharedArrayBuffer> shared_array_buffer);
 
+  /**
+   * Accepts the string corresponding to the one passed previously to
+   * ValueSerializer::TransferString.
+   */
+  void TransferString(uint32_t transfer_id, Local<String> string);
+
   /**
    * Must be called before ReadHeader to enable support for reading the legacy
    * wire format (i.e., which predates this being shipped).
@@ -6038,6 +6073,17 @@ class V8_EXPORT ObjectTemplate : public Template {
   V8_DEPRECATE_SOON("Use maybe version", Local<Object> NewInstance());
   V8_WARN_UNUSED_RESULT MaybeLocal<Object> NewInstance(Local<Context> context);
 
+  /**
+   * Creates count instances of this template in one batch and returns them
+   * as an array. When the instances carry no per-instance template state
+   * (no template properties, accessors, interceptors or access checks),
+   * they are carved out of contiguous allocation blocks, which is
+   * considerably faster than calling NewInstance in a loop; otherwise this
+   * falls back to instance-by-instance creation.
+   */
+  V8_WARN_UNUSED_RESULT MaybeLocal<Array> NewInstanceBatch(
+      Local<Context> context, size_t count);
+
   /**
    * Sets an accessor on the object template.
    *
@@ -6706,6 +6752,19 @@ typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
                                         size_t initial_heap_limit);
 
+/**
+ * This callback is invoked when the amount of external memory registered
+ * through AdjustAmountOfExternalAllocatedMemory exceeds its limit, before V8
+ * responds with a garbage collection. The embedder can relieve the pressure
+ * by freeing cheaply reclaimable external allocations (e.g. caches) and
+ * reporting them with a negative delta to
+ * AdjustAmountOfExternalAllocatedMemory; if the external memory count drops
+ * back under the limit this way, the garbage collection is skipped.
+ */
+typedef void (*ExternalMemoryPressureCallback)(void* data,
+                                               int64_t external_memory,
+                                               int64_t external_memory_limit);
+
 /**
  * Collection of V8 heap information.
  *
@@ -7488,6 +7547,17 @@ class V8_EXPORT Isolate {
    */
   void MemoryPressureNotification(MemoryPressureLevel level);
 
+  /**
+   * Sets a budget for garbage collection pauses. While a budget is active,
+   * full garbage collections triggered by heuristics are decomposed into
+   * incremental steps that are bounded by the budget, and follow-up
+   * collections are deferred until the embedder signals an idle window
+   * through IdleNotificationDeadline(). Collections that are required for
+   * correctness, e.g. on allocation failure, or that are explicitly
+   * requested ignore the budget. Pass zero to clear an active budget.
+   */
+  void SetGCPauseBudget(double budget_in_ms);
+
   /**
    * Methods below this point require holding a lock (using Locker) in
    * a multi-threaded environment.
@@ -7619,6 +7689,17 @@ class V8_EXPORT Isolate {
   void GetStackSample(const RegisterState& state, void** frames,
                       size_t frames_limit, SampleInfo* sample_info);
 
+  /**
+   * Returns the accumulated wall-clock time in microseconds that this
+   * isolate has spent in the given VM state. Only accumulates while V8 runs
+   * with --vm-state-times; returns 0 otherwise. Snapshotting these counters
+   * before and after a unit of work attributes its time to script execution,
+   * parsing, compilation, garbage collection and external callbacks at a
+   * fraction of the overhead of --runtime-call-stats. Must be called from
+   * outside of script execution for consistent results.
+   */
+  int64_t GetTimeSpentInVMState(StateTag state);
+
   /**
    * Adjusts the amount of registered external memory. Used to give V8 an
    * indication of the amount of externally allocated memory that is kept alive
@@ -8022,6 +8103,19 @@ class V8_EXPORT Isolate {
    */
   void LowMemoryNotification();
 
+  /**
+   * Resets the per-isolate caches that accumulate while running code, so
+   * that an isolate kept in a pool starts its next workload from a state
+   * close to a freshly deserialized one: the compilation cache, the IC
+   * stub caches and internal lookup caches are dropped and all
+   * reclaimable memory is collected. Live contexts and global handles
+   * are not disposed; the embedder must release those first. This is
+   * considerably cheaper than disposing the isolate and creating a new
+   * one, but it is a best-effort reset, not an isolation boundary:
+   * objects still reachable from embedder handles survive.
+   */
+  void ClearCachesForReuse();
+
   /**
    * Optional notification that a context has been disposed. V8 uses
    * these notifications to guide the GC heuristic. Returns the number
@@ -8168,6 +8262,14 @@ class V8_EXPORT Isolate {
   void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  /**
+   * Set a callback to invoke before V8 responds to external memory pressure
+   * with a garbage collection, giving the embedder a chance to release
+   * freeable external allocations first. Pass nullptr to clear the callback.
+   */
+  void SetExternalMemoryPressureCallback(
+      ExternalMemoryPressureCallback callback, void* data);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
@@ -8359,6 +8461,24 @@ class V8_EXPORT V8 {
   static void SetNativesDataBlob(StartupData* startup_blob);
   static void SetSnapshotDataBlob(StartupData* startup_blob);
 
+  /**
+   * Creates a snapshot blob that additionally contains an
+   * already-initialized context.
+   *
+   * Runs |initialization_source| in a fresh context created from
+   * |existing_blob| and serializes the resulting context into the returned
+   * blob at context index 0. Isolates created from the returned blob can
+   * instantiate clones of the initialized context cheaply through
+   * Context::FromSnapshot(isolate, 0) instead of re-running the script.
+   * The default context of the returned blob is not polluted by the
+   * script.
+   *
+   * Returns {nullptr, 0} if the initialization script throws. The caller
+   * acquires ownership of the data array in the return value.
+   */
+  static StartupData CaptureContextSnapshotDataBlob(
+      StartupData existing_blob, const char* initialization_source);
+
   /** Set the callback to invoke in case of Dcheck failures. */
   static void SetDcheckErrorHandler(DcheckErrorCallback that);
 
@@ -9070,6 +9190,16 @@ class V8_EXPORT Context {
    */
   uint32_t GetNumberOfEmbedderDataFields();
 
+  /**
+   * Returns an estimate of the number of bytes allocated on the V8 heap on
+   * behalf of this context since it was created. The estimate is maintained
+   * by sampling allocations and only updated when V8 runs with
+   * --per-context-accounting; without the flag zero is returned. The counter
+   * measures cumulative allocation, not live memory: bytes are not
+   * subtracted when objects become unreachable.
+   */
+  size_t GetAllocatedBytesEstimate();
+
   /**
    * Gets the embedder data with the given index, which must have been set by a
    * previous call to SetEmbedderData with the same index.
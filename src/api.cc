@@ -856,6 +856,66 @@ StartupData SnapshotCreator::CreateBlob(
   return result;
 }
 
+namespace {
+
+// Runs |utf8_source| in |context|. Used to execute the initialization
+// script when capturing a context snapshot.
+bool RunInitializationScript(Isolate* isolate, Local<Context> context,
+                             const char* utf8_source, const char* name) {
+  Context::Scope context_scope(context);
+  TryCatch try_catch(isolate);
+  Local<String> source_string;
+  if (!String::NewFromUtf8(isolate, utf8_source, NewStringType::kNormal)
+           .ToLocal(&source_string)) {
+    return false;
+  }
+  Local<String> resource_name =
+      String::NewFromUtf8(isolate, name, NewStringType::kNormal)
+          .ToLocalChecked();
+  ScriptOrigin origin(resource_name);
+  ScriptCompiler::Source source(source_string, origin);
+  Local<Script> script;
+  if (!ScriptCompiler::Compile(context, &source).ToLocal(&script)) return false;
+  if (script->Run(context).IsEmpty()) return false;
+  CHECK(!try_catch.HasCaught());
+  return true;
+}
+
+}  // namespace
+
+StartupData V8::CaptureContextSnapshotDataBlob(
+    StartupData existing_blob, const char* initialization_source) {
+  CHECK(existing_blob.raw_size > 0 && existing_blob.data != nullptr);
+  CHECK_NOT_NULL(initialization_source);
+  // Use following steps to capture an initialized context:
+  //  - Create a new isolate from the existing blob.
+  //  - Create a new context and run the initialization script in it. The
+  //    context is added to the blob so that it can later be deserialized
+  //    with Context::FromSnapshot, which is much cheaper than re-running
+  //    the script.
+  //  - Create another new context. This context stays unpolluted and
+  //    becomes the default context of the new blob.
+  StartupData result = {nullptr, 0};
+  {
+    SnapshotCreator snapshot_creator(nullptr, &existing_blob);
+    Isolate* isolate = snapshot_creator.GetIsolate();
+    {
+      HandleScope scope(isolate);
+      Local<Context> context = Context::New(isolate);
+      if (!RunInitializationScript(isolate, context, initialization_source,
+                                   "<initialization>")) {
+        return result;
+      }
+      size_t index = snapshot_creator.AddContext(context);
+      CHECK_EQ(0u, index);
+      snapshot_creator.SetDefaultContext(Context::New(isolate));
+    }
+    result = snapshot_creator.CreateBlob(
+        SnapshotCreator::FunctionCodeHandling::kKeep);
+  }
+  return result;
+}
+
 void V8::SetDcheckErrorHandler(DcheckErrorCallback that) {
   v8::base::SetDcheckFunction(that);
 }
@@ -1230,6 +1290,12 @@ uint32_t Context::GetNumberOfEmbedderDataFields() {
       i::EmbedderDataArray::cast(context->embedder_data())->length());
 }
 
+size_t Context::GetAllocatedBytesEstimate() {
+  i::Handle<i::Context> context = Utils::OpenHandle(this);
+  CHECK(context->IsNativeContext());
+  return context->GetSampledAllocatedBytes();
+}
+
 v8::Local<v8::Value> Context::SlowGetEmbedderData(int index) {
   const char* location = "v8::Context::GetEmbedderData()";
   i::Handle<i::EmbedderDataArray> data =
@@ -3030,6 +3096,38 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+namespace {
+
+struct StringifyChunkSink {
+  JSON::StringifyChunkCallback callback;
+  void* data;
+};
+
+void ForwardStringifyChunk(i::Handle<i::String> chunk, void* data) {
+  StringifyChunkSink* sink = static_cast<StringifyChunkSink*>(data);
+  sink->callback(Utils::ToLocal(chunk), sink->data);
+}
+
+}  // namespace
+
+Maybe<bool> JSON::Stringify(Local<Context> context, Local<Value> json_object,
+                            Local<String> gap, StringifyChunkCallback callback,
+                            void* data) {
+  auto isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(isolate, context, JSON, Stringify, Nothing<bool>(), i::HandleScope);
+  i::Handle<i::Object> object = Utils::OpenHandle(*json_object);
+  i::Handle<i::Object> replacer = isolate->factory()->undefined_value();
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  StringifyChunkSink sink = {callback, data};
+  Maybe<bool> result = i::JsonStringifyToCallback(
+      isolate, object, replacer, gap_string, &ForwardStringifyChunk, &sink);
+  has_pending_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 Maybe<bool> ValueSerializer::Delegate::WriteHostObject(Isolate* v8_isolate,
@@ -3120,6 +3218,11 @@ void ValueSerializer::TransferSharedArrayBuffer(
       transfer_id, Utils::OpenHandle(*shared_array_buffer));
 }
 
+void ValueSerializer::TransferString(uint32_t transfer_id,
+                                     Local<String> string) {
+  private_->serializer.TransferString(transfer_id, Utils::OpenHandle(*string));
+}
+
 void ValueSerializer::WriteUint32(uint32_t value) {
   private_->serializer.WriteUint32(value);
 }
@@ -3267,6 +3370,13 @@ void ValueDeserializer::TransferSharedArrayBuffer(
       transfer_id, Utils::OpenHandle(*shared_array_buffer));
 }
 
+void ValueDeserializer::TransferString(uint32_t transfer_id,
+                                       Local<String> string) {
+  CHECK(!private_->has_aborted);
+  private_->deserializer.TransferString(transfer_id,
+                                        Utils::OpenHandle(*string));
+}
+
 bool ValueDeserializer::ReadUint32(uint32_t* value) {
   return private_->deserializer.ReadUint32(value);
 }
@@ -6311,6 +6421,51 @@ MaybeLocal<v8::Object> ObjectTemplate::NewInstance(Local<Context> context) {
 }
 
 
+MaybeLocal<v8::Array> ObjectTemplate::NewInstanceBatch(Local<Context> context,
+                                                       size_t count) {
+  PREPARE_FOR_EXECUTION(context, ObjectTemplate, NewInstanceBatch, Array);
+  auto self = Utils::OpenHandle(this);
+  CHECK_LE(count, static_cast<size_t>(i::FixedArray::kMaxLength));
+  int length = static_cast<int>(count);
+  i::Handle<i::FixedArray> instances =
+      isolate->factory()->NewFixedArray(length);
+  if (length > 0) {
+    i::Handle<i::JSObject> first;
+    has_pending_exception =
+        !i::ApiNatives::InstantiateObject(isolate, self).ToHandle(&first);
+    RETURN_ON_FAILED_EXECUTION(Array);
+    instances->set(0, *first);
+    i::Handle<i::Map> map(first->map(), isolate);
+    if (length > 1) {
+      if ((map->instance_type() == i::JS_OBJECT_TYPE ||
+           map->instance_type() == i::JS_API_OBJECT_TYPE) &&
+          map->NumberOfOwnDescriptors() == 0 && !map->is_dictionary_map() &&
+          !map->is_access_check_needed() && !map->has_named_interceptor() &&
+          !map->has_indexed_interceptor() &&
+          first->elements() ==
+              i::ReadOnlyRoots(isolate).empty_fixed_array()) {
+        // The remaining instances are indistinguishable from the first one,
+        // so they can be carved out of contiguous blocks.
+        isolate->factory()->NewJSObjectBatchFromMap(map, length - 1,
+                                                    instances, 1);
+      } else {
+        for (int i = 1; i < length; i++) {
+          i::Handle<i::JSObject> instance;
+          has_pending_exception =
+              !i::ApiNatives::InstantiateObject(isolate, self)
+                   .ToHandle(&instance);
+          RETURN_ON_FAILED_EXECUTION(Array);
+          instances->set(i, *instance);
+        }
+      }
+    }
+  }
+  i::Handle<i::JSArray> result =
+      isolate->factory()->NewJSArrayWithElements(instances);
+  RETURN_ESCAPED(Utils::ToLocal(result));
+}
+
+
 Local<v8::Object> ObjectTemplate::NewInstance() {
   auto context = ContextFromNeverReadOnlySpaceObject(Utils::OpenHandle(this));
   RETURN_TO_LOCAL_UNCHECKED(NewInstance(context), Object);
@@ -8552,6 +8707,12 @@ void Isolate::GetStackSample(const RegisterState& state, void** frames,
   sample_info->external_callback_entry = nullptr;
 }
 
+int64_t Isolate::GetTimeSpentInVMState(StateTag state) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (state < JS || state > IDLE) return 0;
+  return isolate->vm_state_time_stats()->GetTimeInMicroseconds(state);
+}
+
 size_t Isolate::NumberOfPhantomHandleResetsSinceLastCall() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   size_t result = isolate->global_handles()->NumberOfPhantomHandleResets();
@@ -8697,6 +8858,11 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   return isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
+void Isolate::ClearCachesForReuse() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->ClearCachesForReuse();
+}
+
 void Isolate::LowMemoryNotification() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   {
@@ -8751,6 +8917,11 @@ void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   isolate->allocator()->MemoryPressureNotification(level);
 }
 
+void Isolate::SetGCPauseBudget(double budget_in_ms) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetGCPauseBudget(budget_in_ms);
+}
+
 void Isolate::EnableMemorySavingsMode() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   isolate->EnableMemorySavingsMode();
@@ -8842,6 +9013,12 @@ void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
 }
 
+void Isolate::SetExternalMemoryPressureCallback(
+    v8::ExternalMemoryPressureCallback callback, void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->SetExternalMemoryPressureCallback(callback, data);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
@@ -10409,6 +10586,11 @@ SnapshotObjectId HeapProfiler::GetHeapStats(OutputStream* stream,
   return heap_profiler->PushHeapObjectsStats(stream, timestamp_us);
 }
 
+SnapshotObjectId HeapProfiler::GetHeapObjectUpdates(OutputStream* stream) {
+  i::HeapProfiler* heap_profiler = reinterpret_cast<i::HeapProfiler*>(this);
+  return heap_profiler->PushHeapObjectUpdates(stream);
+}
+
 bool HeapProfiler::StartSamplingHeapProfiler(uint64_t sample_interval,
                                              int stack_depth,
                                              SamplingFlags flags) {
@@ -330,7 +330,7 @@ class HandleScopeImplementer {
   explicit HandleScopeImplementer(Isolate* isolate)
       : isolate_(isolate),
         microtask_context_(nullptr),
-        spare_(nullptr),
+        spare_block_count_(0),
         call_depth_(0),
         microtasks_depth_(0),
         microtasks_suppressions_(0),
@@ -344,7 +344,9 @@ class HandleScopeImplementer {
   }
 
   ~HandleScopeImplementer() {
-    DeleteArray(spare_);
+    for (int i = 0; i < spare_block_count_; ++i) {
+      DeleteArray(spare_blocks_[i]);
+    }
   }
 
   // Threading support for handle data.
@@ -416,8 +418,11 @@ class HandleScopeImplementer {
 
   void ReturnBlock(Address* block) {
     DCHECK_NOT_NULL(block);
-    if (spare_ != nullptr) DeleteArray(spare_);
-    spare_ = block;
+    if (spare_block_count_ < kMaxSpareBlocks) {
+      spare_blocks_[spare_block_count_++] = block;
+    } else {
+      DeleteArray(block);
+    }
   }
 
  private:
@@ -427,7 +432,8 @@ class HandleScopeImplementer {
     saved_contexts_.detach();
     microtask_context_ = nullptr;
     entered_context_count_during_microtasks_ = 0;
-    spare_ = nullptr;
+    // The archived copy retains ownership of the spare blocks.
+    spare_block_count_ = 0;
     last_handle_before_deferred_block_ = nullptr;
     call_depth_ = 0;
   }
@@ -441,10 +447,10 @@ class HandleScopeImplementer {
     blocks_.free();
     entered_contexts_.free();
     saved_contexts_.free();
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
-      spare_ = nullptr;
+    for (int i = 0; i < spare_block_count_; ++i) {
+      DeleteArray(spare_blocks_[i]);
     }
+    spare_block_count_ = 0;
     DCHECK_EQ(call_depth_, 0);
   }
 
@@ -458,7 +464,11 @@ class HandleScopeImplementer {
   // Used as a stack to keep track of saved contexts.
   DetachableVector<Context*> saved_contexts_;
   Context* microtask_context_;
-  Address* spare_;
+  // Recycled handle blocks, retained up to kMaxSpareBlocks deep so that
+  // scopes repeatedly growing by several blocks don't churn the allocator.
+  static const int kMaxSpareBlocks = 8;
+  Address* spare_blocks_[kMaxSpareBlocks];
+  int spare_block_count_;
   int call_depth_;
   int microtasks_depth_;
   int microtasks_suppressions_;
@@ -556,11 +566,9 @@ void HandleScopeImplementer::LeaveMicrotaskContext() {
 
 // If there's a spare block, use it for growing the current scope.
 internal::Address* HandleScopeImplementer::GetSpareOrNewBlock() {
-  internal::Address* block =
-      (spare_ != nullptr) ? spare_
-                          : NewArray<internal::Address>(kHandleBlockSize);
-  spare_ = nullptr;
-  return block;
+  return (spare_block_count_ > 0)
+             ? spare_blocks_[--spare_block_count_]
+             : NewArray<internal::Address>(kHandleBlockSize);
 }
 
 void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
@@ -585,10 +593,11 @@ void HandleScopeImplementer::DeleteExtensions(internal::Address* prev_limit) {
 #ifdef ENABLE_HANDLE_ZAPPING
     internal::HandleScope::ZapRange(block_start, block_limit);
 #endif
-    if (spare_ != nullptr) {
-      DeleteArray(spare_);
+    if (spare_block_count_ < kMaxSpareBlocks) {
+      spare_blocks_[spare_block_count_++] = block_start;
+    } else {
+      DeleteArray(block_start);
     }
-    spare_ = block_start;
   }
   DCHECK((blocks_.empty() && prev_limit == nullptr) ||
          (!blocks_.empty() && prev_limit != nullptr));
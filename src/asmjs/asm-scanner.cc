@@ -270,8 +270,11 @@ void AsmJsScanner::ConsumeIdentifier(uc32 ch) {
 }
 
 void AsmJsScanner::ConsumeNumber(uc32 ch) {
-  std::string number;
-  number = ch;
+  // Reuse the backing store of {number_string_} across tokens to avoid a
+  // heap allocation per numeric literal.
+  std::string& number = number_string_;
+  number.clear();
+  number.push_back(static_cast<char>(ch));
   bool has_dot = ch == '.';
   bool has_prefix = false;
   for (;;) {
@@ -306,6 +309,28 @@ void AsmJsScanner::ConsumeNumber(uc32 ch) {
     token_ = '.';
     return;
   }
+  // Fast path for small decimal constants, by far the most common numeric
+  // literals; they need no leading-zero treatment (a leading zero would make
+  // an implicit octal literal) and nine digits cannot exceed the uint32
+  // range.
+  if (!has_dot && !has_prefix && number.size() <= 9 && number[0] >= '1' &&
+      number[0] <= '9') {
+    uint32_t value = 0;
+    bool all_digits = true;
+    for (char c : number) {
+      if (c < '0' || c > '9') {
+        all_digits = false;
+        break;
+      }
+      value = value * 10 + (c - '0');
+    }
+    if (all_digits) {
+      double_value_ = value;
+      unsigned_value_ = value;
+      token_ = kUnsigned;
+      return;
+    }
+  }
   // Decode numbers.
   double_value_ = StringToDouble(
       Vector<const uint8_t>::cast(VectorOf(number)),
@@ -145,6 +145,7 @@ class V8_EXPORT_PRIVATE AsmJsScanner {
   size_t next_position_;       // Only set when in {rewind} state.
   bool rewind_;
   std::string identifier_string_;
+  std::string number_string_;  // Scratch buffer for ConsumeNumber.
   bool in_local_scope_;
   std::unordered_map<std::string, token_t> local_names_;
   std::unordered_map<std::string, token_t> global_names_;
@@ -272,6 +272,15 @@ class AstStringConstants final {
   DISALLOW_COPY_AND_ASSIGN(AstStringConstants);
 };
 
+// Interned strings live in the parse zone and die with it; the only state
+// shared across parses is the isolate's AstStringConstants, whose
+// pre-hashed table seeds string_table_ below, so common identifiers are
+// never re-hashed or re-copied. Sharing arbitrary AstRawStrings across
+// parses would not work: Internalize() mutates them with a heap pointer,
+// parses run concurrently on background threads, and their backing bytes
+// are zone memory. The character hash itself is a sequential chain that
+// must match the runtime's string hash, so it cannot be batch-vectorized
+// independently here.
 class AstValueFactory {
  public:
   AstValueFactory(Zone* zone, const AstStringConstants* string_constants,
@@ -642,6 +642,14 @@ void DeclarationScope::AttachOuterScopeInfo(ParseInfo* info, Isolate* isolate) {
   }
 }
 
+// Note that resolution is already on-demand with respect to laziness: this
+// only sees the scopes whose ASTs were built by the current parse. Inner
+// functions that were skipped by the preparser have been reduced to their
+// migrated unresolved proxies (AnalyzePartially/ResetAfterPreparsing) and
+// are analyzed again, from scratch, when they are re-parsed at their first
+// compilation. Deferring resolution of eagerly parsed inner functions as
+// well would require keeping their zone-allocated ASTs alive past this
+// compile, which would cost far more memory than resolution costs time.
 bool DeclarationScope::Analyze(ParseInfo* info) {
   RuntimeCallTimerScope runtimeTimer(
       info->runtime_call_stats(),
@@ -2169,6 +2177,16 @@ void Scope::AllocateStackSlot(Variable* var) {
 }
 
 
+// Every context-allocated variable occupies its slot for the lifetime of
+// the context, even if all reads happen shortly after the closure is
+// created. Trimming such slots later is not just a matter of marking them
+// here: a variable is context-allocated precisely because some inner
+// closure references it, so proving that its last read precedes a program
+// point would require a liveness analysis across all inner functions
+// (which may not even have been parsed yet under lazy compilation), and
+// slot indices are baked into the bytecode of every closure sharing the
+// context, so a trimmed context could only drop a suffix of slots (in the
+// style of Heap::RightTrimFixedArray), never renumber survivors.
 void Scope::AllocateHeapSlot(Variable* var) {
   var->AllocateTo(VariableLocation::CONTEXT, num_heap_slots_++);
 }
@@ -28,15 +28,21 @@ size_t BoundedPageAllocator::size() const { return region_allocator_.size(); }
 void* BoundedPageAllocator::AllocatePages(void* hint, size_t size,
                                           size_t alignment,
                                           PageAllocator::Permission access) {
-  MutexGuard guard(&mutex_);
   CHECK(IsAligned(alignment, region_allocator_.page_size()));
 
   // Region allocator does not support alignments bigger than it's own
   // allocation alignment.
   CHECK_LE(alignment, allocate_page_size_);
 
-  // TODO(ishell): Consider using randomized version here.
-  Address address = region_allocator_.AllocateRegion(size);
+  Address address;
+  {
+    // Hold the mutex only for the region bookkeeping. The permission change
+    // below is a syscall and the region is not visible to any other thread
+    // until this function returns, so it does not need the lock.
+    MutexGuard guard(&mutex_);
+    // TODO(ishell): Consider using randomized version here.
+    address = region_allocator_.AllocateRegion(size);
+  }
   if (address == RegionAllocator::kAllocationFailure) {
     return nullptr;
   }
@@ -51,8 +57,11 @@ bool BoundedPageAllocator::AllocatePagesAt(Address address, size_t size,
   CHECK(IsAligned(size, allocate_page_size_));
   CHECK(region_allocator_.contains(address, size));
 
-  if (!region_allocator_.AllocateRegionAt(address, size)) {
-    return false;
+  {
+    MutexGuard guard(&mutex_);
+    if (!region_allocator_.AllocateRegionAt(address, size)) {
+      return false;
+    }
   }
   CHECK(page_allocator_->SetPermissions(reinterpret_cast<void*>(address), size,
                                         access));
@@ -60,13 +69,20 @@ bool BoundedPageAllocator::AllocatePagesAt(Address address, size_t size,
 }
 
 bool BoundedPageAllocator::FreePages(void* raw_address, size_t size) {
-  MutexGuard guard(&mutex_);
-
   Address address = reinterpret_cast<Address>(raw_address);
-  size_t freed_size = region_allocator_.FreeRegion(address);
-  if (freed_size != size) return false;
+  {
+    // Validate the region before dropping its permissions so that a bogus
+    // |raw_address| or |size| cannot revoke access to somebody else's region.
+    MutexGuard guard(&mutex_);
+    if (region_allocator_.CheckRegion(address) != size) return false;
+  }
+  // The region is still owned by the caller at this point, so the permissions
+  // can be dropped outside the lock. Only then is the region given back, as
+  // another thread may reallocate it the moment it is freed.
   CHECK(page_allocator_->SetPermissions(raw_address, size,
                                         PageAllocator::kNoAccess));
+  MutexGuard guard(&mutex_);
+  CHECK_EQ(size, region_allocator_.FreeRegion(address));
   return true;
 }
 
@@ -115,5 +131,13 @@ bool BoundedPageAllocator::DiscardSystemPages(void* address, size_t size) {
   return page_allocator_->DiscardSystemPages(address, size);
 }
 
+bool BoundedPageAllocator::AdviseHugePages(void* address, size_t length) {
+  return page_allocator_->AdviseHugePages(address, length);
+}
+
+bool BoundedPageAllocator::AdviseMergeablePages(void* address, size_t length) {
+  return page_allocator_->AdviseMergeablePages(address, length);
+}
+
 }  // namespace base
 }  // namespace v8
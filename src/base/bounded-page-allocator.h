@@ -22,7 +22,10 @@ namespace base {
 //    displacement on certain 64-bit platforms.
 // Bounded page allocator uses other page allocator instance for doing actual
 // page allocations.
-// The implementation is thread-safe.
+// The implementation is thread-safe. The mutex guards only the region
+// bookkeeping; page permission changes are syscalls and are performed outside
+// of it, which keeps concurrent allocating threads (e.g. parallel Wasm
+// compilation) from serializing behind each other's kernel calls.
 class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
  public:
   typedef uintptr_t Address;
@@ -67,6 +70,10 @@ class V8_BASE_EXPORT BoundedPageAllocator : public v8::PageAllocator {
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool AdviseHugePages(void* address, size_t length) override;
+
+  bool AdviseMergeablePages(void* address, size_t length) override;
+
  private:
   v8::base::Mutex mutex_;
   const size_t allocate_page_size_;
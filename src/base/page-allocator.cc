@@ -62,5 +62,13 @@ bool PageAllocator::DiscardSystemPages(void* address, size_t size) {
   return base::OS::DiscardSystemPages(address, size);
 }
 
+bool PageAllocator::AdviseHugePages(void* address, size_t length) {
+  return base::OS::AdviseHugePages(address, length);
+}
+
+bool PageAllocator::AdviseMergeablePages(void* address, size_t length) {
+  return base::OS::AdviseMergeablePages(address, length);
+}
+
 }  // namespace base
 }  // namespace v8
@@ -38,6 +38,10 @@ class V8_BASE_EXPORT PageAllocator
 
   bool DiscardSystemPages(void* address, size_t size) override;
 
+  bool AdviseHugePages(void* address, size_t length) override;
+
+  bool AdviseMergeablePages(void* address, size_t length) override;
+
  private:
   const size_t allocate_page_size_;
   const size_t commit_page_size_;
@@ -375,6 +375,31 @@ bool OS::DiscardSystemPages(void* address, size_t size) {
   return ret == 0;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_HUGEPAGE)
+  // Encourage the kernel to back the range with transparent huge pages. This
+  // is advisory; the kernel only collapses fully resident, properly aligned
+  // 2 MB regions.
+  return madvise(address, size, MADV_HUGEPAGE) == 0;
+#else
+  return false;
+#endif
+}
+
+// static
+bool OS::AdviseMergeablePages(void* address, size_t size) {
+#if V8_OS_LINUX && defined(MADV_MERGEABLE)
+  // Let kernel same-page merging deduplicate identical pages in this range
+  // with identical pages elsewhere in the system. Only effective when KSM is
+  // enabled on the host; a write to a merged page triggers an ordinary
+  // copy-on-write break.
+  return madvise(address, size, MADV_MERGEABLE) == 0;
+#else
+  return false;
+#endif
+}
+
 // static
 bool OS::HasLazyCommits() {
 #if V8_OS_AIX || V8_OS_LINUX || V8_OS_MACOSX
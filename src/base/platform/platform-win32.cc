@@ -882,6 +882,19 @@ bool OS::SetPermissions(void* address, size_t size, MemoryPermission access) {
   return VirtualAlloc(address, size, MEM_COMMIT, protect) != nullptr;
 }
 
+// static
+bool OS::AdviseHugePages(void* address, size_t size) {
+  // Windows has no equivalent of MADV_HUGEPAGE; large pages require
+  // SeLockMemoryPrivilege and non-pageable allocations.
+  return false;
+}
+
+// static
+bool OS::AdviseMergeablePages(void* address, size_t size) {
+  // Windows has no equivalent of MADV_MERGEABLE.
+  return false;
+}
+
 // static
 bool OS::DiscardSystemPages(void* address, size_t size) {
   // On Windows, discarded pages are not returned to the system immediately and
@@ -276,6 +276,15 @@ class V8_BASE_EXPORT OS {
   V8_WARN_UNUSED_RESULT static bool DiscardSystemPages(void* address,
                                                        size_t size);
 
+  // Hints the OS to back the given range with transparent huge pages if
+  // supported. Advisory only; returns whether the hint was accepted.
+  static bool AdviseHugePages(void* address, size_t size);
+
+  // Hints the OS that the given range may contain pages identical to pages
+  // elsewhere and may be transparently deduplicated if supported. Advisory
+  // only; returns whether the hint was accepted.
+  static bool AdviseMergeablePages(void* address, size_t size);
+
   static const int msPerSecond = 1000;
 
 #if V8_OS_POSIX
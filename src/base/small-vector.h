@@ -0,0 +1,110 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_BASE_SMALL_VECTOR_H_
+#define V8_BASE_SMALL_VECTOR_H_
+
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "src/base/logging.h"
+#include "src/base/macros.h"
+
+namespace v8 {
+namespace base {
+
+// Minimal dynamic array with in-object storage for the first {kInlineSize}
+// elements. Growing past that falls back to malloc'ed storage. Only trivially
+// copyable and trivially destructible element types are supported, which
+// allows growth by plain memcpy and destruction without element visits.
+template <typename T, size_t kInlineSize>
+class SmallVector {
+  static_assert(kInlineSize > 0, "inline storage must not be empty");
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SmallVector only supports trivially copyable types");
+  static_assert(std::is_trivially_destructible<T>::value,
+                "SmallVector only supports trivially destructible types");
+
+ public:
+  SmallVector() = default;
+  ~SmallVector() {
+    if (is_big()) free(begin_);
+  }
+
+  T* data() { return begin_; }
+  const T* data() const { return begin_; }
+
+  T* begin() { return begin_; }
+  const T* begin() const { return begin_; }
+
+  T* end() { return end_; }
+  const T* end() const { return end_; }
+
+  T& back() {
+    DCHECK_NE(0, size());
+    return end_[-1];
+  }
+
+  T& operator[](size_t index) {
+    DCHECK_GT(size(), index);
+    return begin_[index];
+  }
+
+  size_t size() const { return end_ - begin_; }
+  bool empty() const { return end_ == begin_; }
+
+  template <typename... Args>
+  void emplace_back(Args&&... args) {
+    if (V8_UNLIKELY(end_ == end_of_storage_)) Grow();
+    new (end_) T(std::forward<Args>(args)...);
+    ++end_;
+  }
+
+  void push_back(T x) { emplace_back(std::move(x)); }
+
+  void pop_back(size_t count = 1) {
+    DCHECK_GE(size(), count);
+    end_ -= count;
+  }
+
+  void clear() { end_ = begin_; }
+
+ private:
+  V8_NOINLINE void Grow() {
+    size_t in_use = end_ - begin_;
+    size_t new_capacity = 2 * (end_of_storage_ - begin_);
+    T* new_storage = reinterpret_cast<T*>(malloc(sizeof(T) * new_capacity));
+    CHECK_NOT_NULL(new_storage);
+    memcpy(new_storage, begin_, sizeof(T) * in_use);
+    if (is_big()) free(begin_);
+    begin_ = new_storage;
+    end_ = new_storage + in_use;
+    end_of_storage_ = new_storage + new_capacity;
+  }
+
+  bool is_big() const { return begin_ != inline_storage_begin(); }
+
+  T* inline_storage_begin() {
+    return reinterpret_cast<T*>(&inline_storage_);
+  }
+  const T* inline_storage_begin() const {
+    return reinterpret_cast<const T*>(&inline_storage_);
+  }
+
+  typename std::aligned_storage<sizeof(T) * kInlineSize, alignof(T)>::type
+      inline_storage_;
+  T* begin_ = inline_storage_begin();
+  T* end_ = begin_;
+  T* end_of_storage_ = begin_ + kInlineSize;
+
+  DISALLOW_COPY_AND_ASSIGN(SmallVector);
+};
+
+}  // namespace base
+}  // namespace v8
+
+#endif  // V8_BASE_SMALL_VECTOR_H_
@@ -5966,6 +5966,7 @@ Genesis::Genesis(
   }
 
   native_context()->ResetErrorsThrown();
+  native_context()->ResetSampledAllocatedBytes();
   result_ = native_context();
 }
 
@@ -378,6 +378,89 @@ Node* ArrayBuiltinsAssembler::FindProcessor(Node* k_value, Node* k) {
     return a();
   }
 
+  void ArrayBuiltinsAssembler::TryTypedArrayMapMathUnary(
+      TNode<Context> context, TNode<Object> receiver, Node* callbackfn,
+      CodeStubArguments* args, Label* bailout) {
+    // The Math builtins recognized below ignore their receiver and any
+    // arguments beyond the first and cannot run user code, so mapping them
+    // over a Float64Array can be performed directly on the backing store.
+    // The operations are the same ones TurboFan uses when inlining the Math
+    // builtins, so the results are bit-identical to the generic path.
+    GotoIf(TaggedIsSmi(receiver), bailout);
+    GotoIfNot(IsJSTypedArray(CAST(receiver)), bailout);
+    TNode<JSTypedArray> source = CAST(receiver);
+    GotoIf(IsDetachedBuffer(LoadJSArrayBufferViewBuffer(source)), bailout);
+    GotoIfNot(
+        Word32Equal(LoadElementsKind(source), Int32Constant(FLOAT64_ELEMENTS)),
+        bailout);
+
+    GotoIf(TaggedIsSmi(callbackfn), bailout);
+    GotoIfNot(IsJSFunction(CAST(callbackfn)), bailout);
+    TNode<SharedFunctionInfo> shared = CAST(LoadObjectField(
+        CAST(callbackfn), JSFunction::kSharedFunctionInfoOffset));
+    TNode<Object> function_data =
+        LoadObjectField(shared, SharedFunctionInfo::kFunctionDataOffset);
+    GotoIfNot(TaggedIsSmi(function_data), bailout);
+    TNode<Smi> builtin_id = CAST(function_data);
+    TNode<BoolT> is_sqrt =
+        SmiEqual(builtin_id, SmiConstant(Builtins::kMathSqrt));
+    TNode<BoolT> is_exp = SmiEqual(builtin_id, SmiConstant(Builtins::kMathExp));
+    TNode<BoolT> is_log = SmiEqual(builtin_id, SmiConstant(Builtins::kMathLog));
+    GotoIfNot(Word32Or(Word32Or(is_sqrt, is_exp), is_log), bailout);
+
+    // Guard both checks of the TypedArraySpeciesCreate fast case, so that
+    // creating the result array cannot run user code either.
+    GotoIf(IsTypedArraySpeciesProtectorCellInvalid(), bailout);
+    GotoIfNot(IsPrototypeTypedArrayPrototype(context, LoadMap(source)),
+              bailout);
+
+    TNode<Smi> length = LoadJSTypedArrayLength(source);
+    TypedArrayBuiltinsAssembler typedarray_asm(state());
+    TNode<JSTypedArray> result = typedarray_asm.TypedArraySpeciesCreateByLength(
+        context, source, length, "%TypedArray%.prototype.map");
+    // No user code has run, so the source cannot have been detached and the
+    // result has the default map.
+    CSA_ASSERT(this, Word32BinaryNot(IsDetachedBuffer(
+                         LoadJSArrayBufferViewBuffer(source))));
+    CSA_ASSERT(this, Word32Equal(LoadElementsKind(result),
+                                 Int32Constant(FLOAT64_ELEMENTS)));
+
+    TNode<IntPtrT> source_data =
+        UncheckedCast<IntPtrT>(typedarray_asm.LoadDataPtr(source));
+    TNode<IntPtrT> result_data =
+        UncheckedCast<IntPtrT>(typedarray_asm.LoadDataPtr(result));
+    TNode<IntPtrT> byte_length = TimesDoubleSize(SmiUntag(length));
+
+    Label do_sqrt(this), do_exp(this), do_log(this), done(this);
+    GotoIf(is_sqrt, &do_sqrt);
+    Branch(is_exp, &do_exp, &do_log);
+
+    auto map_elements =
+        [&](std::function<TNode<Float64T>(TNode<Float64T>)> op) {
+          BuildFastLoop(IntPtrConstant(0), byte_length,
+                        [&](Node* offset) {
+                          TNode<Float64T> value = UncheckedCast<Float64T>(
+                              Load(MachineType::Float64(), source_data,
+                                   offset));
+                          StoreNoWriteBarrier(MachineRepresentation::kFloat64,
+                                              result_data, offset, op(value));
+                        },
+                        kDoubleSize, INTPTR_PARAMETERS,
+                        IndexAdvanceMode::kPost);
+          Goto(&done);
+        };
+
+    BIND(&do_sqrt);
+    map_elements([&](TNode<Float64T> value) { return Float64Sqrt(value); });
+    BIND(&do_exp);
+    map_elements([&](TNode<Float64T> value) { return Float64Exp(value); });
+    BIND(&do_log);
+    map_elements([&](TNode<Float64T> value) { return Float64Log(value); });
+
+    BIND(&done);
+    args->PopAndReturn(result);
+  }
+
   void ArrayBuiltinsAssembler::NullPostLoopAction() {}
 
   void ArrayBuiltinsAssembler::FillFixedArrayWithSmiZero(
@@ -2764,6 +2847,10 @@ TF_BUILTIN(TypedArrayPrototypeMap, ArrayBuiltinsAssembler) {
   Node* callbackfn = args.GetOptionalArgumentValue(0);
   Node* this_arg = args.GetOptionalArgumentValue(1);
 
+  Label generic(this);
+  TryTypedArrayMapMathUnary(context, receiver, callbackfn, &args, &generic);
+
+  BIND(&generic);
   InitIteratingArrayBuiltinBody(context, receiver, callbackfn, this_arg, argc);
 
   GenerateIteratingTypedArrayBuiltinBody(
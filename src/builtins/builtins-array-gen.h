@@ -66,6 +66,14 @@ class ArrayBuiltinsAssembler : public CodeStubAssembler {
   // See tc39.github.io/ecma262/#sec-%typedarray%.prototype.map.
   Node* TypedArrayMapProcessor(Node* k_value, Node* k);
 
+  // Fast path for mapping one of the side-effect-free unary Math builtins
+  // over a Float64Array: applies the operation directly to the backing store
+  // instead of calling back into JS for every element. Jumps to {bailout} if
+  // the receiver, callback or species setup does not qualify.
+  void TryTypedArrayMapMathUnary(TNode<Context> context,
+                                 TNode<Object> receiver, Node* callbackfn,
+                                 CodeStubArguments* args, Label* bailout);
+
   void NullPostLoopAction();
 
   // Uses memset to effectively initialize the given FixedArray with Smi zeroes.
@@ -289,7 +289,13 @@ void CallOrConstructBuiltinsAssembler::CallOrConstructWithSpread(
                    SmiConstant(Isolate::kProtectorInvalid)),
          &if_generic);
   {
-    // The fast-path accesses the {spread} elements directly.
+    // The fast-path accesses the {spread} elements directly, i.e. the
+    // protector and map checks above are the only validation; the actual
+    // arguments are then pushed by a tight machine loop over the FixedArray
+    // in CallOrConstructVarargs. Note that the loop cannot degenerate into a
+    // straight memcpy even for packed {spread}s, since the same stub also
+    // serves holey arrays (and runtime-created lists) and must rewrite holes
+    // to undefined while copying.
     TNode<Int32T> spread_kind = LoadMapElementsKind(spread_map);
     var_elements_kind = spread_kind;
     var_length =
@@ -607,6 +607,11 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
       TNode<TableType> table, TNode<IntPtrT> index, Label* if_end);
 
   // Specialization for Smi.
+  // The hash is computed inline from the untagged value, without creating an
+  // identity hash or calling into the runtime. Note that it must agree with
+  // what Object::GetOrCreateHash computes for Smis on the C++ side, since the
+  // same table is probed from both; this is why the value bits are fed
+  // through ComputeUnseededHash rather than used as the hash directly.
   // The {result} variable will contain the entry index if the key was found,
   // or the hash code otherwise.
   template <typename CollectionType>
@@ -640,6 +645,8 @@ class CollectionsBuiltinsAssembler : public BaseCollectionsAssembler {
                                              Label* not_found);
 
   // Specialization for string.
+  // The cached hash is loaded directly from the name hash field; only strings
+  // whose hash has never been computed fall back to the runtime.
   // The {result} variable will contain the entry index if the key was found,
   // or the hash code otherwise.
   template <typename CollectionType>
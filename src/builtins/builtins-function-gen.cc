@@ -34,6 +34,13 @@ TF_BUILTIN(FastFunctionPrototypeBind, CodeStubAssembler) {
         Word32Or(InstanceTypeEqual(instance_type, JS_FUNCTION_TYPE),
                  InstanceTypeEqual(instance_type, JS_BOUND_FUNCTION_TYPE)),
         &slow);
+    // Re-binding a bound function that is not a constructor must go through
+    // the runtime, where Factory::NewJSBoundFunction flattens the bound
+    // function chain and the "length" and "name" properties are set up
+    // eagerly from the original target.
+    GotoIf(Word32And(InstanceTypeEqual(instance_type, JS_BOUND_FUNCTION_TYPE),
+                     Word32BinaryNot(IsConstructorMap(receiver_map))),
+           &slow);
   }
 
   // Disallow binding of slow-mode functions. We need to figure out whether the
@@ -485,6 +485,11 @@ class DeletePropertyBaseAssembler : public AccessorAssembler {
         GetNumberOfDeletedElements<NameDictionary>(properties);
     TNode<Smi> new_deleted = SmiAdd(num_deleted, SmiConstant(1));
     SetNumberOfDeletedElements<NameDictionary>(properties, new_deleted);
+    // Removing an entry invalidates the cached iteration indices
+    // (see BaseNameDictionary::InvalidateCachedIterationIndices).
+    StoreFixedArrayElement(properties,
+                           NameDictionary::kCachedIterationIndicesIndex,
+                           SmiConstant(0), SKIP_WRITE_BARRIER);
 
     // Shrink the dictionary if necessary (see NameDictionary::Shrink).
     Label shrinking_done(this);
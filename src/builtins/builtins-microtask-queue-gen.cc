@@ -462,7 +462,15 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
   TNode<Context> current_context = GetCurrentContext();
   TNode<MicrotaskQueue> microtask_queue = GetDefaultMicrotaskQueue();
 
-  Label init_queue_loop(this), done_init_queue_loop(this);
+  // Remember the backing store of the last queue we drained, so that it can
+  // be reinstalled once the queue runs dry. Otherwise every pump cycle starts
+  // over from the minimal capacity and re-grows the queue through a series of
+  // allocations and copies.
+  TVARIABLE(FixedArray, var_drained_queue, EmptyFixedArrayConstant());
+  TVARIABLE(IntPtrT, var_drained_count, IntPtrConstant(0));
+
+  Label init_queue_loop(this, {&var_drained_queue, &var_drained_count}),
+      done_init_queue_loop(this);
   Goto(&init_queue_loop);
   BIND(&init_queue_loop);
   {
@@ -481,6 +489,23 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
     SetQueuedMicrotasks(microtask_queue, EmptyFixedArrayConstant());
     SetPendingMicrotaskCount(microtask_queue, IntPtrConstant(0));
 
+    // Remember regular-sized backing stores for reuse. Stores in large
+    // object space are dropped, so that an occasional spike of microtasks
+    // doesn't retain an oversized queue forever.
+    Label remember_queue(this),
+        queue_remembered(this, {&var_drained_queue, &var_drained_count});
+    Branch(IntPtrLessThanOrEqual(LoadAndUntagFixedArrayBaseLength(queue),
+                                 IntPtrConstant(FixedArray::kMaxRegularLength)),
+           &remember_queue, &queue_remembered);
+
+    BIND(&remember_queue);
+    {
+      var_drained_queue = queue;
+      var_drained_count = num_tasks;
+      Goto(&queue_remembered);
+    }
+
+    BIND(&queue_remembered);
     Goto(&loop);
     BIND(&loop);
     {
@@ -496,6 +521,19 @@ TF_BUILTIN(RunMicrotasks, MicrotaskQueueBuiltinsAssembler) {
 
   BIND(&done_init_queue_loop);
   {
+    // Reinstall the last drained backing store as the empty queue, after
+    // clearing out the stale microtask references so they don't keep their
+    // referents alive until the next pump.
+    Label no_queue_to_reuse(this);
+    GotoIf(WordEqual(var_drained_queue.value(), EmptyFixedArrayConstant()),
+           &no_queue_to_reuse);
+    FillFixedArrayWithValue(PACKED_ELEMENTS, var_drained_queue.value(),
+                            IntPtrConstant(0), var_drained_count.value(),
+                            RootIndex::kUndefinedValue);
+    SetQueuedMicrotasks(microtask_queue, var_drained_queue.value());
+    Goto(&no_queue_to_reuse);
+
+    BIND(&no_queue_to_reuse);
     // Reset the "current microtask" on the isolate.
     StoreRoot(RootIndex::kCurrentMicrotask, UndefinedConstant());
     Return(UndefinedConstant());
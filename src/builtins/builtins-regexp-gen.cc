@@ -158,6 +158,16 @@ void RegExpBuiltinsAssembler::StoreLastIndex(Node* context, Node* regexp,
   }
 }
 
+// Materializes the JSRegExpResult (and, for named captures, the groups
+// object) from the match positions in {match_info}. This is the only
+// allocating step of a successful exec; callers that merely need match
+// positions (test, search, split, the replace fast paths) skip it and
+// consume RegExpPrototypeExecBodyWithoutResult directly, which leaves the
+// positions in the reusable RegExpLastMatchInfo buffer. Selecting the
+// non-materializing variant automatically for user calls to exec would
+// require the compiler to prove that only index/capture slots of the result
+// are read and that no other regexp operation clobbers the last-match-info
+// buffer before those reads; neither analysis exists today.
 TNode<JSRegExpResult> RegExpBuiltinsAssembler::ConstructNewResultFromMatchInfo(
     TNode<Context> context, TNode<JSReceiver> maybe_regexp,
     TNode<RegExpMatchInfo> match_info, TNode<String> string) {
@@ -446,8 +456,9 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
   }
 
   // Check that the irregexp code has been generated for the actual string
-  // encoding. If it has, the field contains a code object; and otherwise it
-  // contains the uninitialized sentinel as a smi.
+  // encoding. If it has, the field contains a code object or (with
+  // --regexp-tier-up) bytecode; otherwise it contains the uninitialized
+  // sentinel as a smi.
 #ifdef DEBUG
   {
     Label next(this);
@@ -460,6 +471,9 @@ TNode<HeapObject> RegExpBuiltinsAssembler::RegExpExecInternal(
 #endif
 
   GotoIf(TaggedIsSmi(var_code.value()), &runtime);
+  // With --regexp-tier-up, the code field can also hold Irregexp bytecode for
+  // not-yet-hot regexps; the interpreter is only reachable through runtime.
+  GotoIfNot(HasInstanceType(CAST(var_code.value()), CODE_TYPE), &runtime);
   TNode<Code> code = CAST(var_code.value());
 
   Label if_success(this), if_exception(this, Label::kDeferred);
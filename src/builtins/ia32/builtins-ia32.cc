@@ -824,6 +824,20 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
 
   Register closure = edi;
 
+  // The bytecode array could have been flushed from the shared function info,
+  // if so, call into CompileLazy. The bytecode array itself is loaded only
+  // after the frame has been pushed, since kInterpreterBytecodeArrayRegister
+  // aliases the closure register on ia32, so check using scratch registers
+  // here and spill the argument count around the check.
+  Label compile_lazy;
+  __ push(eax);
+  __ mov(eax, FieldOperand(closure, JSFunction::kSharedFunctionInfoOffset));
+  __ mov(eax, FieldOperand(eax, SharedFunctionInfo::kFunctionDataOffset));
+  GetSharedFunctionInfoBytecode(masm, eax, ecx);
+  __ CmpObjectType(eax, BYTECODE_ARRAY_TYPE, ecx);
+  __ pop(eax);
+  __ j(not_equal, &compile_lazy);
+
   Register feedback_vector = ecx;
   Label push_stack_frame;
   // Load feedback vector and check if it is valid. If valid, check for
@@ -967,6 +981,10 @@ void Builtins::Generate_InterpreterEntryTrampoline(MacroAssembler* masm) {
   LeaveInterpreterFrame(masm, edx, ecx);
   __ VerifyRootRegister();
   __ ret(0);
+
+  __ bind(&compile_lazy);
+  GenerateTailCallToReturnedCode(masm, Runtime::kCompileLazy);
+  __ int3();  // Should not return.
 }
 
 
@@ -3467,6 +3467,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
   StoreFixedArrayElement(result, NameDictionary::kObjectHashIndex,
                          SmiConstant(PropertyArray::kNoHashSentinel),
                          SKIP_WRITE_BARRIER);
+  StoreFixedArrayElement(result, NameDictionary::kCachedIterationIndicesIndex,
+                         zero, SKIP_WRITE_BARRIER);
 
   // Initialize NameDictionary elements.
   TNode<WordT> result_word = BitcastTaggedToWord(result);
@@ -4876,6 +4878,24 @@ void CodeStubAssembler::CopyFixedArrayElements(
   DCHECK(!IsFixedTypedArrayElementsKind(from_kind));
   DCHECK(!IsFixedTypedArrayElementsKind(to_kind));
 
+  if (from_kind == to_kind &&
+      convert_holes == HoleConversionMode::kDontConvert) {
+    // Copying between arrays of the same elements kind needs no per-element
+    // representation or hole checks: delegate to the bulk CopyElements, which
+    // uses memcpy whenever the write barrier can be elided (in particular for
+    // freshly allocated new space targets) and otherwise falls back to an
+    // element-wise copy with the requested barrier mode.
+    if (element_count != capacity) {
+      FillFixedArrayWithValue(to_kind, to_array, element_count, capacity,
+                              RootIndex::kTheHoleValue, mode);
+    }
+    CopyElements(to_kind, CAST(to_array), IntPtrConstant(0), CAST(from_array),
+                 ParameterToIntPtr(first_element, mode),
+                 ParameterToIntPtr(element_count, mode), barrier_mode);
+    Comment("] CopyFixedArrayElements");
+    return;
+  }
+
   Label done(this);
   bool from_double_elements = IsDoubleElementsKind(from_kind);
   bool to_double_elements = IsDoubleElementsKind(to_kind);
@@ -6841,6 +6861,23 @@ TNode<String> CodeStubAssembler::SubString(TNode<String> string,
                             IntPtrConstant(SlicedString::kMinLength)),
              &next);
 
+      // A slice pins {direct_string} in its entirety; when the substring is
+      // short and the backing string is at least SlicedString::kTrimRatio
+      // times longer, copying retains far less memory. This mirrors the
+      // policy in Factory::NewProperSubString.
+      Label make_slice(this);
+      GotoIf(IntPtrGreaterThan(substr_length,
+                               IntPtrConstant(SlicedString::kMaxTrimmedLength)),
+             &make_slice);
+      GotoIf(IntPtrLessThan(
+                 substr_length,
+                 Signed(WordSar(LoadStringLengthAsWord(direct_string),
+                                IntPtrConstant(
+                                    WhichPowerOf2(SlicedString::kTrimRatio))))),
+             &next);
+      Goto(&make_slice);
+      BIND(&make_slice);
+
       // Allocate new sliced string.
 
       Counters* counters = isolate()->counters();
@@ -8600,6 +8637,11 @@ void CodeStubAssembler::Add(TNode<Dictionary> dictionary, TNode<Name> key,
 
   SetNextEnumerationIndex<Dictionary>(dictionary, new_enum_index);
   SetNumberOfElements<Dictionary>(dictionary, new_nof);
+  // Adding an entry invalidates the cached iteration indices
+  // (see BaseNameDictionary::InvalidateCachedIterationIndices).
+  StoreFixedArrayElement(dictionary,
+                         Dictionary::kCachedIterationIndicesIndex,
+                         SmiConstant(0), SKIP_WRITE_BARRIER);
 
   TVARIABLE(IntPtrT, var_key_index);
   FindInsertionEntry<Dictionary>(dictionary, key, &var_key_index);
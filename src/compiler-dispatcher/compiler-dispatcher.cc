@@ -86,7 +86,9 @@ base::Optional<CompilerDispatcher::JobId> CompilerDispatcher::Enqueue(
   return base::make_optional(id);
 }
 
-bool CompilerDispatcher::IsEnabled() const { return FLAG_compiler_dispatcher; }
+bool CompilerDispatcher::IsEnabled() const {
+  return FLAG_compiler_dispatcher || FLAG_compile_hints != nullptr;
+}
 
 bool CompilerDispatcher::IsEnqueued(Handle<SharedFunctionInfo> function) const {
   if (jobs_.empty()) return false;
@@ -226,6 +226,22 @@ void OptimizingCompileDispatcher::InstallOptimizedFunctions() {
   }
 }
 
+bool OptimizingCompileDispatcher::IsQueueAvailableForContext(
+    Context* native_context) {
+  const int quota = FLAG_concurrent_recompilation_context_quota;
+  base::MutexGuard access_input_queue(&input_queue_mutex_);
+  if (input_queue_length_ >= input_queue_capacity_) return false;
+  if (quota <= 0) return true;
+  int occupied = 0;
+  for (int i = 0; i < input_queue_length_; i++) {
+    OptimizedCompilationJob* job = input_queue_[InputQueueIndex(i)];
+    if (job->compilation_info()->native_context() == native_context) {
+      if (++occupied >= quota) return false;
+    }
+  }
+  return true;
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     OptimizedCompilationJob* job) {
   DCHECK(IsQueueAvailable());
@@ -18,6 +18,7 @@
 namespace v8 {
 namespace internal {
 
+class Context;
 class OptimizedCompilationJob;
 class SharedFunctionInfo;
 
@@ -49,6 +50,12 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
     return input_queue_length_ < input_queue_capacity_;
   }
 
+  // Like IsQueueAvailable, but additionally enforces the per-context quota
+  // (--concurrent-recompilation-context-quota): returns false if the given
+  // native context already occupies its maximum share of queue slots, so that
+  // an optimization burst in one context cannot monopolize the queue.
+  bool IsQueueAvailableForContext(Context* native_context);
+
   static bool Enabled() { return FLAG_concurrent_recompilation; }
 
  private:
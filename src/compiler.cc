@@ -13,6 +13,7 @@
 #include "src/ast/prettyprinter.h"
 #include "src/ast/scopes.h"
 #include "src/base/optional.h"
+#include "src/base/platform/platform.h"
 #include "src/bootstrapper.h"
 #include "src/compilation-cache.h"
 #include "src/compiler-dispatcher/compiler-dispatcher.h"
@@ -599,19 +600,18 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Code> GetCodeFromOptimizedCodeCache(
       RuntimeCallCounterId::kCompileGetFromOptimizedCodeMap);
   Handle<SharedFunctionInfo> shared(function->shared(), function->GetIsolate());
   DisallowHeapAllocation no_gc;
-  if (osr_offset.IsNone()) {
-    if (function->feedback_cell()->value()->IsFeedbackVector()) {
-      FeedbackVector* feedback_vector = function->feedback_vector();
-      feedback_vector->EvictOptimizedCodeMarkedForDeoptimization(
-          function->shared(), "GetCodeFromOptimizedCodeCache");
-      Code code = feedback_vector->optimized_code();
-
-      if (!code.is_null()) {
-        // Caching of optimized code enabled and optimized code found.
-        DCHECK(!code->marked_for_deoptimization());
-        DCHECK(function->shared()->is_compiled());
-        return Handle<Code>(code, feedback_vector->GetIsolate());
-      }
+  if (function->feedback_cell()->value()->IsFeedbackVector()) {
+    FeedbackVector* feedback_vector = function->feedback_vector();
+    feedback_vector->EvictOptimizedCodeMarkedForDeoptimization(
+        function->shared(), "GetCodeFromOptimizedCodeCache");
+    Code code = osr_offset.IsNone() ? feedback_vector->optimized_code()
+                                    : feedback_vector->osr_code(osr_offset);
+
+    if (!code.is_null()) {
+      // Caching of optimized code enabled and optimized code found.
+      DCHECK(!code->marked_for_deoptimization());
+      DCHECK(function->shared()->is_compiled());
+      return Handle<Code>(code, feedback_vector->GetIsolate());
     }
   }
   return MaybeHandle<Code>();
@@ -645,10 +645,15 @@ void InsertCodeIntoOptimizedCodeCache(
   Handle<SharedFunctionInfo> shared(function->shared(), function->GetIsolate());
   Handle<Context> native_context(function->context()->native_context(),
                                  function->GetIsolate());
+  Handle<FeedbackVector> vector =
+      handle(function->feedback_vector(), function->GetIsolate());
   if (compilation_info->osr_offset().IsNone()) {
-    Handle<FeedbackVector> vector =
-        handle(function->feedback_vector(), function->GetIsolate());
     FeedbackVector::SetOptimizedCode(vector, code);
+  } else {
+    // Cache OSR code keyed by the entry bytecode offset, so that a loop that
+    // deoptimizes on a rare path and becomes hot again does not pay for a
+    // full recompile.
+    FeedbackVector::SetOsrCode(vector, compilation_info->osr_offset(), code);
   }
 }
 
@@ -682,7 +687,8 @@ bool GetOptimizedCodeNow(OptimizedCompilationJob* job, Isolate* isolate) {
 
 bool GetOptimizedCodeLater(OptimizedCompilationJob* job, Isolate* isolate) {
   OptimizedCompilationInfo* compilation_info = job->compilation_info();
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailableForContext(
+          compilation_info->native_context())) {
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       compilation_info->closure()->ShortPrint();
@@ -1125,6 +1131,16 @@ bool Compiler::Compile(Handle<SharedFunctionInfo> shared_info,
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.CompileCode");
   AggregatedHistogramTimerScope timer(isolate->counters()->compile_lazy());
 
+  if (V8_UNLIKELY(FLAG_compile_hints_out != nullptr)) {
+    // Record that this function was needed, so that a later run started with
+    // --compile-hints can compile it on the dispatcher ahead of the call.
+    FILE* file = base::OS::FOpen(FLAG_compile_hints_out, "a");
+    if (file != nullptr) {
+      base::OS::FPrint(file, "%d\n", shared_info->StartPosition());
+      fclose(file);
+    }
+  }
+
   // Set up parse info.
   ParseInfo parse_info(isolate, shared_info);
   parse_info.set_lazy_compile();
@@ -1712,8 +1728,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     // First check per-isolate compilation cache.
     maybe_result = compilation_cache->LookupScript(
         source, script_details.name_obj, script_details.line_offset,
-        script_details.column_offset, origin_options, isolate->native_context(),
-        language_mode);
+        script_details.column_offset, origin_options, language_mode);
     if (!maybe_result.is_null()) {
       compile_timer.set_hit_isolate_cache();
     } else if (can_consume_code_cache) {
@@ -1730,8 +1745,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
               .ToHandle(&inner_result)) {
         // Promote to per-isolate compilation cache.
         DCHECK(inner_result->is_compiled());
-        compilation_cache->PutScript(source, isolate->native_context(),
-                                     language_mode, inner_result);
+        compilation_cache->PutScript(source, language_mode, inner_result);
         Handle<Script> script(Script::cast(inner_result->script()), isolate);
         maybe_result = inner_result;
       } else {
@@ -1758,8 +1772,7 @@ MaybeHandle<SharedFunctionInfo> Compiler::GetSharedFunctionInfoForScript(
     Handle<SharedFunctionInfo> result;
     if (extension == nullptr && maybe_result.ToHandle(&result)) {
       DCHECK(result->is_compiled());
-      compilation_cache->PutScript(source, isolate->native_context(),
-                                   language_mode, result);
+      compilation_cache->PutScript(source, language_mode, result);
     } else if (maybe_result.is_null() && natives != EXTENSION_CODE &&
                natives != NATIVES_CODE) {
       isolate->ReportPendingMessages();
@@ -1871,7 +1884,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
       compilation_cache->LookupScript(
           source, script_details.name_obj, script_details.line_offset,
           script_details.column_offset, origin_options,
-          isolate->native_context(), parse_info->language_mode());
+          parse_info->language_mode());
   if (!maybe_result.is_null()) {
     compile_timer.set_hit_isolate_cache();
   }
@@ -1904,8 +1917,7 @@ Compiler::GetSharedFunctionInfoForStreamedScript(
     // Add compiled code to the isolate cache.
     Handle<SharedFunctionInfo> result;
     if (maybe_result.ToHandle(&result)) {
-      compilation_cache->PutScript(source, isolate->native_context(),
-                                   parse_info->language_mode(), result);
+      compilation_cache->PutScript(source, parse_info->language_mode(), result);
     }
   }
 
@@ -320,6 +320,14 @@ class V8_EXPORT_PRIVATE BackgroundCompileTask {
   // Creates a new task that when run will parse and compile the streamed
   // script associated with |data| and can be finalized with
   // Compiler::GetSharedFunctionInfoForStreamedScript.
+  //
+  // Running the task covers the whole unoptimized pipeline on the worker
+  // thread: parsing, scope analysis (Rewriter and DeclarationScope::Analyze)
+  // and bytecode generation for the top-level function and all eagerly
+  // compiled inner functions, via the UnoptimizedCompilationJob execute
+  // phase. Finalization on the main thread is limited to heap publication:
+  // internalizing AST values, creating SharedFunctionInfos and ScopeInfos,
+  // and copying the generated bytecode into BytecodeArrays.
   // Note: does not take ownership of |data|.
   BackgroundCompileTask(ScriptStreamingData* data, Isolate* isolate);
   ~BackgroundCompileTask();
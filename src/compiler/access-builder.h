@@ -315,6 +315,7 @@ class V8_EXPORT_PRIVATE AccessBuilder final
   static FieldAccess ForDictionaryMaxNumberKey();
   static FieldAccess ForDictionaryNextEnumerationIndex();
   static FieldAccess ForDictionaryObjectHashIndex();
+  static FieldAccess ForDictionaryCachedIterationIndices();
 
  private:
   DISALLOW_IMPLICIT_CONSTRUCTORS(AccessBuilder);
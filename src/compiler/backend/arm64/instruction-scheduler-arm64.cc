@@ -456,8 +456,10 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
 
     case kArm64Float32Add:
     case kArm64Float32Sub:
+    case kArm64Float32Mul:
     case kArm64Float64Add:
     case kArm64Float64Sub:
+    case kArm64Float64Mul:
       return 5;
 
     case kArm64Float32Abs:
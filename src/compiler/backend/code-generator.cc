@@ -1077,7 +1077,7 @@ int CodeGenerator::BuildTranslation(Instruction* instr, int pc_offset,
   int deoptimization_id = static_cast<int>(deoptimization_states_.size());
 
   deoptimization_states_.push_back(new (zone()) DeoptimizationState(
-      descriptor->bailout_id(), translation.index(), pc_offset, entry.kind(),
+      descriptor->bailout_id(), translation.Finish(), pc_offset, entry.kind(),
       entry.reason()));
 
   return deoptimization_id;
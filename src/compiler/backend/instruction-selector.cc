@@ -1237,6 +1237,13 @@ void InstructionSelector::MarkPairProjectionsAsWord32(Node* node) {
   }
 }
 
+// Dispatch is a dense switch that compilers lower to a jump table, and the
+// node properties that matching consults repeatedly are precomputed per
+// block: defined_/used_ are bit vectors and effect levels are assigned in
+// one pass over the block before emission (see VisitBlock). The matching
+// itself (immediate recognition, load/op combining) depends on operand
+// shapes, ownership and effect levels of the specific inputs, which is why
+// it remains code per opcode rather than data in a table.
 void InstructionSelector::VisitNode(Node* node) {
   DCHECK_NOT_NULL(schedule()->block(node));  // should only use scheduled nodes.
   switch (node->opcode()) {
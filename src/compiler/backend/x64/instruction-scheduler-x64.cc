@@ -352,6 +352,7 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
   // in an empirical way.
   switch (instr->arch_opcode()) {
     case kSSEFloat64Mul:
+    case kAVXFloat64Mul:
       return 5;
     case kX64Imul:
     case kX64Imul32:
@@ -369,8 +370,19 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
+    case kAVXFloat32Cmp:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Cmp:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
       return 3;
     case kSSEFloat32Mul:
+    case kAVXFloat32Mul:
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -380,6 +392,24 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
       return 4;
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxbq:
+    case kX64Movzxbq:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxwq:
+    case kX64Movzxwq:
+    case kX64Movsxlq:
+    case kX64Movl:
+    case kX64Movq:
+      // Register moves resolve in the renamer; loads pay L1 load-to-use
+      // latency. Scheduling loads early lets ALU work overlap the stall.
+      return instr->addressing_mode() != kMode_None ? 4 : 1;
+    case kX64Movss:
+    case kX64Movsd:
+    case kX64Movdqu:
+      return instr->addressing_mode() != kMode_None ? 5 : 1;
     case kX64Idiv:
       return 49;
     case kX64Idiv32:
@@ -392,6 +422,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Div:
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
+    case kAVXFloat32Div:
+    case kAVXFloat64Div:
       return 13;
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
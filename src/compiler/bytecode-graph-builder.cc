@@ -776,6 +776,19 @@ void BytecodeGraphBuilder::RemoveMergeEnvironmentsBeforeOffset(
 // We will iterate through the OSR loop, then its parent, and so on
 // until we have reached the outmost loop containing the OSR loop. We do
 // not generate nodes for anything before the outermost loop.
+//
+// The entry environment built here (OsrValue nodes for every register,
+// see FillWithOsrValues) cannot be cached across compilations of the
+// same (function, osr offset): environments consist of graph nodes that
+// live in this compilation's zone and are consumed by loop peeling
+// below, so there is nothing reusable once the compile finishes. What is
+// cached between OSR requests is the end product - the OSR'd code on the
+// feedback vector's OSR slot - which makes repeated compiles of the same
+// loop the exception (deopt or eviction), not the rule. At runtime,
+// entry materialization is likewise already direct: the generated code's
+// OSR entry reads the interpreter frame's registers in place via the
+// OsrValue linkage slots rather than going through a deoptimizer-style
+// translation.
 void BytecodeGraphBuilder::AdvanceToOsrEntryAndPeelLoops(
     interpreter::BytecodeArrayIterator* iterator,
     SourcePositionTableIterator* source_position_iterator) {
@@ -1362,6 +1375,19 @@ void BytecodeGraphBuilder::VisitLdaNamedPropertyNoFeedback() {
   environment()->BindAccumulator(node, Environment::kAttachFrameState);
 }
 
+void BytecodeGraphBuilder::VisitLdaInObjectProperty() {
+  // The static offset is an interpreter-only shortcut; in optimized code the
+  // named load is lowered by the usual feedback-free path.
+  PrepareEagerCheckpoint();
+  Node* object =
+      environment()->LookupRegister(bytecode_iterator().GetRegisterOperand(0));
+  Handle<Name> name(
+      Name::cast(bytecode_iterator().GetConstantForIndexOperand(1)), isolate());
+  const Operator* op = javascript()->LoadNamed(name, VectorSlotPair());
+  Node* node = NewNode(op, object);
+  environment()->BindAccumulator(node, Environment::kAttachFrameState);
+}
+
 void BytecodeGraphBuilder::VisitLdaKeyedProperty() {
   PrepareEagerCheckpoint();
   Node* key = environment()->LookupAccumulator();
@@ -2790,6 +2816,19 @@ void BytecodeGraphBuilder::VisitReturn() {
       bytecode_iterator().current_offset()));
 }
 
+void BytecodeGraphBuilder::VisitReturnUndefined() {
+  environment()->BindAccumulator(jsgraph()->UndefinedConstant());
+  BuildReturn(bytecode_analysis()->GetInLivenessFor(
+      bytecode_iterator().current_offset()));
+}
+
+void BytecodeGraphBuilder::VisitReturnSmi() {
+  environment()->BindAccumulator(
+      jsgraph()->Constant(bytecode_iterator().GetImmediateOperand(0)));
+  BuildReturn(bytecode_analysis()->GetInLivenessFor(
+      bytecode_iterator().current_offset()));
+}
+
 void BytecodeGraphBuilder::VisitDebugger() {
   PrepareEagerCheckpoint();
   Node* call = NewNode(javascript()->Debugger());
@@ -717,6 +717,22 @@ void ReduceNode(const Operator* op, EscapeAnalysisTracker::Scope* current,
       }
       break;
     }
+    case IrOpcode::kObjectIsSmi: {
+      Node* object = current->ValueInput(0);
+      const VirtualObject* vobject = current->GetVirtualObject(object);
+      // A tracked virtual object is the result of an Allocate node and can
+      // therefore never be a Smi. Folding the predicate keeps allocations
+      // that flow into such checks (typically from inlined helpers that only
+      // inspect their argument) scalar-replaceable. The type inhabitance
+      // check mirrors the one in the kReferenceEqual case above.
+      if (vobject && !vobject->HasEscaped() &&
+          !NodeProperties::GetType(object).IsNone()) {
+        current->SetReplacement(jsgraph->FalseConstant());
+      } else {
+        current->SetEscaped(object);
+      }
+      break;
+    }
     case IrOpcode::kCheckMaps: {
       CheckMapsParameters params = CheckMapsParametersOf(op);
       Node* checked = current->ValueInput(0);
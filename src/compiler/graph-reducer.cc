@@ -2,9 +2,12 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
 #include <functional>
+#include <iomanip>
 #include <limits>
 
+#include "src/base/platform/elapsed-timer.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/graph-reducer.h"
 #include "src/compiler/node.h"
@@ -31,7 +34,9 @@ GraphReducer::GraphReducer(Zone* zone, Graph* graph, Node* dead)
       state_(graph, 4),
       reducers_(zone),
       revisit_(zone),
-      stack_(zone) {
+      batch_(zone),
+      stack_(zone),
+      reducer_stats_(zone) {
   if (dead != nullptr) {
     NodeProperties::SetType(dead_, Type::None());
   }
@@ -42,20 +47,44 @@ GraphReducer::~GraphReducer() = default;
 
 void GraphReducer::AddReducer(Reducer* reducer) {
   reducers_.push_back(reducer);
+  reducer_stats_.push_back(ReducerStats());
 }
 
 
 void GraphReducer::ReduceNode(Node* node) {
   DCHECK(stack_.empty());
   DCHECK(revisit_.empty());
+  DCHECK(batch_.empty());
   Push(node);
   for (;;) {
     if (!stack_.empty()) {
       // Process the node on the top of the stack, potentially pushing more or
       // popping the node off the stack.
       ReduceTop();
+    } else if (!batch_.empty()) {
+      // Consume the current batch of revisits in ascending node id order.
+      Node* const node = batch_.back();
+      batch_.pop_back();
+      if (state_.Get(node) == State::kRevisit) {
+        // state can change while in queue.
+        Push(node);
+      }
     } else if (!revisit_.empty()) {
       // If the stack becomes empty, revisit any nodes in the revisit queue.
+      if (FLAG_turbo_batch_reductions) {
+        // Nodes are laid out linearly in the graph zone, so processing the
+        // current generation of revisits in ascending node id order touches
+        // memory much more predictably than discovery order does on large
+        // graphs. Revisits queued while the batch drains form the next
+        // generation.
+        do {
+          batch_.push_back(revisit_.front());
+          revisit_.pop();
+        } while (!revisit_.empty());
+        std::sort(batch_.begin(), batch_.end(),
+                  [](Node* a, Node* b) { return a->id() > b->id(); });
+        continue;
+      }
       Node* const node = revisit_.front();
       revisit_.pop();
       if (state_.Get(node) == State::kRevisit) {
@@ -71,18 +100,48 @@ void GraphReducer::ReduceNode(Node* node) {
     }
   }
   DCHECK(revisit_.empty());
+  DCHECK(batch_.empty());
   DCHECK(stack_.empty());
 }
 
 
-void GraphReducer::ReduceGraph() { ReduceNode(graph()->end()); }
+void GraphReducer::ReduceGraph() {
+  ReduceNode(graph()->end());
+  if (V8_UNLIKELY(FLAG_turbo_reducer_stats)) PrintReducerStats();
+}
+
+
+void GraphReducer::PrintReducerStats() const {
+  StdoutStream os;
+  os << "--- Graph reducer statistics (" << graph()->NodeCount()
+     << " nodes) ---" << std::endl;
+  for (size_t i = 0; i < reducers_.size(); ++i) {
+    ReducerStats const& stats = reducer_stats_[i];
+    os << std::setw(40) << reducers_[i]->reducer_name() << ": "
+       << std::setw(8) << stats.calls << " calls, " << std::setw(8)
+       << stats.changes << " changes, " << std::fixed << std::setprecision(3)
+       << stats.elapsed.InMillisecondsF() << "ms" << std::endl;
+  }
+}
 
 
 Reduction GraphReducer::Reduce(Node* const node) {
+  bool const collect_stats = V8_UNLIKELY(FLAG_turbo_reducer_stats);
   auto skip = reducers_.end();
   for (auto i = reducers_.begin(); i != reducers_.end();) {
     if (i != skip) {
-      Reduction reduction = (*i)->Reduce(node);
+      Reduction reduction;
+      if (collect_stats) {
+        base::ElapsedTimer timer;
+        timer.Start();
+        reduction = (*i)->Reduce(node);
+        ReducerStats& stats = reducer_stats_[i - reducers_.begin()];
+        stats.elapsed += timer.Elapsed();
+        stats.calls++;
+        if (reduction.Changed()) stats.changes++;
+      } else {
+        reduction = (*i)->Reduce(node);
+      }
       if (!reduction.Changed()) {
         // No change from this reducer.
       } else if (reduction.replacement() == node) {
@@ -118,7 +177,10 @@ Reduction GraphReducer::Reduce(Node* const node) {
 
 
 void GraphReducer::ReduceTop() {
-  NodeState& entry = stack_.top();
+  // Work with a copy and an index: growing the stack in Recurse would
+  // invalidate a reference to the entry.
+  size_t const entry_index = stack_.size() - 1;
+  NodeState const entry = stack_.back();
   Node* node = entry.node;
   DCHECK_EQ(State::kOnStack, state_.Get(node));
 
@@ -131,14 +193,14 @@ void GraphReducer::ReduceTop() {
   for (int i = start; i < node_inputs.count(); ++i) {
     Node* input = node_inputs[i];
     if (input != node && Recurse(input)) {
-      entry.input_index = i + 1;
+      stack_[entry_index].input_index = i + 1;
       return;
     }
   }
   for (int i = 0; i < start; ++i) {
     Node* input = node_inputs[i];
     if (input != node && Recurse(input)) {
-      entry.input_index = i + 1;
+      stack_[entry_index].input_index = i + 1;
       return;
     }
   }
@@ -160,7 +222,7 @@ void GraphReducer::ReduceTop() {
     for (int i = 0; i < node_inputs.count(); ++i) {
       Node* input = node_inputs[i];
       if (input != node && Recurse(input)) {
-        entry.input_index = i + 1;
+        stack_[entry_index].input_index = i + 1;
         return;
       }
     }
@@ -260,16 +322,16 @@ void GraphReducer::ReplaceWithValue(Node* node, Node* value, Node* effect,
 
 
 void GraphReducer::Pop() {
-  Node* node = stack_.top().node;
+  Node* node = stack_.back().node;
   state_.Set(node, State::kVisited);
-  stack_.pop();
+  stack_.pop_back();
 }
 
 
 void GraphReducer::Push(Node* const node) {
   DCHECK_NE(State::kOnStack, state_.Get(node));
   state_.Set(node, State::kOnStack);
-  stack_.push({node, 0});
+  stack_.push_back({node, 0});
 }
 
 
@@ -6,6 +6,7 @@
 #define V8_COMPILER_GRAPH_REDUCER_H_
 
 #include "src/base/compiler-specific.h"
+#include "src/base/platform/time.h"
 #include "src/compiler/node-marker.h"
 #include "src/globals.h"
 #include "src/zone/zone-containers.h"
@@ -148,6 +149,14 @@ class V8_EXPORT_PRIVATE GraphReducer
     int input_index;
   };
 
+  // Per-reducer statistics, collected with --turbo-reducer-stats. Parallel
+  // to {reducers_}.
+  struct ReducerStats {
+    size_t calls = 0;
+    size_t changes = 0;
+    base::TimeDelta elapsed;
+  };
+
   // Reduce a single node.
   Reduction Reduce(Node* const);
   // Reduce the node on top of the stack.
@@ -175,12 +184,19 @@ class V8_EXPORT_PRIVATE GraphReducer
   bool Recurse(Node* node);
   void Revisit(Node* node) final;
 
+  // Print the statistics collected with --turbo-reducer-stats.
+  void PrintReducerStats() const;
+
   Graph* const graph_;
   Node* const dead_;
   NodeMarker<State> state_;
   ZoneVector<Reducer*> reducers_;
   ZoneQueue<Node*> revisit_;
-  ZoneStack<NodeState> stack_;
+  // Current generation of revisits, consumed in ascending NodeId order when
+  // --turbo-batch-reductions is enabled (see ReduceNode).
+  ZoneSmallVector<Node*, 32> batch_;
+  ZoneSmallVector<NodeState, 64> stack_;
+  ZoneVector<ReducerStats> reducer_stats_;
 
   DISALLOW_COPY_AND_ASSIGN(GraphReducer);
 };
@@ -2867,54 +2867,79 @@ Reduction JSCallReducer::ReduceCallApiFunction(
 
   Handle<FunctionTemplateInfo> function_template_info(
       FunctionTemplateInfo::cast(shared.object()->function_data()), isolate());
+  if (function_template_info->call_code()->IsUndefined(isolate())) {
+    return NoChange();
+  }
 
   // CallApiCallbackStub expects the target in a register, so we count it out,
   // and counts the receiver as an implicit argument, so we count the receiver
   // out too.
   if (argc > CallApiCallbackStub::kArgMax) return NoChange();
 
-  // Infer the {receiver} maps, and check if we can inline the API function
-  // callback based on those.
-  ZoneHandleSet<Map> receiver_maps;
-  NodeProperties::InferReceiverMapsResult result =
-      NodeProperties::InferReceiverMaps(broker(), receiver, effect,
-                                        &receiver_maps);
-  if (result == NodeProperties::kNoReceiverMaps) return NoChange();
-  for (Handle<Map> map : receiver_maps) {
-    MapRef receiver_map(broker(), map);
-    if (!receiver_map.IsJSObjectMap() ||
-        (!function_template_info->accept_any_receiver() &&
-         receiver_map.is_access_check_needed())) {
-      return NoChange();
+  Node* holder;
+  if (function_template_info->accept_any_receiver() &&
+      function_template_info->signature()->IsUndefined(isolate())) {
+    // The API function accepts any kind of {receiver}, so there is no need
+    // to infer the {receiver} maps: with the "accept any receiver" bit set
+    // no access check is required, and without a signature every receiver is
+    // compatible and doubles as the {holder}. The {receiver} only needs to
+    // be converted to a JSReceiver if it can still be a primitive here.
+    if (NodeProperties::CanBePrimitive(broker(), receiver, effect)) {
+      receiver = holder = effect = graph()->NewNode(
+          simplified()->ConvertReceiver(p.convert_mode()), receiver,
+          jsgraph()->Constant(native_context().global_proxy_object()), effect,
+          control);
+    } else {
+      holder = receiver;
     }
-    // In case of unreliable {receiver} information, the {receiver_maps}
-    // must all be stable in order to consume the information.
-    if (result == NodeProperties::kUnreliableReceiverMaps) {
-      if (!receiver_map.is_stable()) return NoChange();
+  } else {
+    // Infer the {receiver} maps, and check if we can inline the API function
+    // callback based on those.
+    ZoneHandleSet<Map> receiver_maps;
+    NodeProperties::InferReceiverMapsResult result =
+        NodeProperties::InferReceiverMaps(broker(), receiver, effect,
+                                          &receiver_maps);
+    if (result == NodeProperties::kNoReceiverMaps) return NoChange();
+    for (Handle<Map> map : receiver_maps) {
+      MapRef receiver_map(broker(), map);
+      if (!receiver_map.IsJSObjectMap() ||
+          (!function_template_info->accept_any_receiver() &&
+           receiver_map.is_access_check_needed())) {
+        return NoChange();
+      }
+      // In case of unreliable {receiver} information, the {receiver_maps}
+      // must all be stable in order to consume the information.
+      if (result == NodeProperties::kUnreliableReceiverMaps) {
+        if (!receiver_map.is_stable()) return NoChange();
+      }
     }
-  }
 
-  // See if we can constant-fold the compatible receiver checks.
-  CallOptimization call_optimization(isolate(), function_template_info);
-  if (!call_optimization.is_simple_api_call()) return NoChange();
-  CallOptimization::HolderLookup lookup;
-  Handle<JSObject> api_holder =
-      call_optimization.LookupHolderOfExpectedType(receiver_maps[0], &lookup);
-  if (lookup == CallOptimization::kHolderNotFound) return NoChange();
-  for (size_t i = 1; i < receiver_maps.size(); ++i) {
-    CallOptimization::HolderLookup lookupi;
-    Handle<JSObject> holder = call_optimization.LookupHolderOfExpectedType(
-        receiver_maps[i], &lookupi);
-    if (lookup != lookupi) return NoChange();
-    if (!api_holder.is_identical_to(holder)) return NoChange();
-  }
+    // See if we can constant-fold the compatible receiver checks.
+    CallOptimization call_optimization(isolate(), function_template_info);
+    if (!call_optimization.is_simple_api_call()) return NoChange();
+    CallOptimization::HolderLookup lookup;
+    Handle<JSObject> api_holder =
+        call_optimization.LookupHolderOfExpectedType(receiver_maps[0], &lookup);
+    if (lookup == CallOptimization::kHolderNotFound) return NoChange();
+    for (size_t i = 1; i < receiver_maps.size(); ++i) {
+      CallOptimization::HolderLookup lookupi;
+      Handle<JSObject> holderi = call_optimization.LookupHolderOfExpectedType(
+          receiver_maps[i], &lookupi);
+      if (lookup != lookupi) return NoChange();
+      if (!api_holder.is_identical_to(holderi)) return NoChange();
+    }
 
-  // Install stability dependencies for unreliable {receiver_maps}.
-  if (result == NodeProperties::kUnreliableReceiverMaps) {
-    for (Handle<Map> map : receiver_maps) {
-      MapRef receiver_map(broker(), map);
-      dependencies()->DependOnStableMap(receiver_map);
+    // Install stability dependencies for unreliable {receiver_maps}.
+    if (result == NodeProperties::kUnreliableReceiverMaps) {
+      for (Handle<Map> map : receiver_maps) {
+        MapRef receiver_map(broker(), map);
+        dependencies()->DependOnStableMap(receiver_map);
+      }
     }
+
+    holder = lookup == CallOptimization::kHolderFound
+                 ? jsgraph()->HeapConstant(api_holder)
+                 : receiver;
   }
 
   // Load the {target}s context.
@@ -2937,9 +2962,6 @@ Reduction JSCallReducer::ReduceCallApiFunction(
       cid.GetStackParameterCount() + argc + 1 /* implicit receiver */,
       CallDescriptor::kNeedsFrameState);
   ApiFunction api_function(v8::ToCData<Address>(call_handler_info->callback()));
-  Node* holder = lookup == CallOptimization::kHolderFound
-                     ? jsgraph()->HeapConstant(api_holder)
-                     : receiver;
   ExternalReference function_reference = ExternalReference::Create(
       &api_function, ExternalReference::DIRECT_API_CALL);
   node->InsertInput(graph()->zone(), 0,
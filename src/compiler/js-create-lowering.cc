@@ -1384,10 +1384,12 @@ Reduction JSCreateLowering::ReduceJSCreateObject(Node* node) {
             jsgraph()->SmiConstant(PropertyDetails::kInitialIndex));
     a.Store(AccessBuilder::ForDictionaryObjectHashIndex(),
             jsgraph()->SmiConstant(PropertyArray::kNoHashSentinel));
+    a.Store(AccessBuilder::ForDictionaryCachedIterationIndices(),
+            jsgraph()->SmiConstant(0));
     // Initialize the Properties fields.
     Node* undefined = jsgraph()->UndefinedConstant();
     STATIC_ASSERT(NameDictionary::kElementsStartIndex ==
-                  NameDictionary::kObjectHashIndex + 1);
+                  NameDictionary::kCachedIterationIndicesIndex + 1);
     for (int index = NameDictionary::kElementsStartIndex; index < length;
          index++) {
       a.Store(AccessBuilder::ForFixedArraySlot(index, kNoWriteBarrier),
@@ -1578,12 +1578,62 @@ void JSHeapBroker::SerializeShareableObjects() {
     }
   }
 
+  // Immortal immutable roots, i.e. the maps, strings and oddballs below,
+  // never change, so their data can be shared across compilations as well.
+  Factory* const f = isolate()->factory();
+  GetOrCreateData(f->arguments_marker_map());
+  GetOrCreateData(f->bigint_string());
+  GetOrCreateData(f->block_context_map());
+  GetOrCreateData(f->boolean_map());
+  GetOrCreateData(f->boolean_string());
+  GetOrCreateData(f->catch_context_map());
+  GetOrCreateData(f->empty_fixed_array());
+  GetOrCreateData(f->empty_string());
+  GetOrCreateData(f->eval_context_map());
+  GetOrCreateData(f->false_string());
+  GetOrCreateData(f->false_value());
+  GetOrCreateData(f->fixed_array_map());
+  GetOrCreateData(f->fixed_cow_array_map());
+  GetOrCreateData(f->fixed_double_array_map());
+  GetOrCreateData(f->function_context_map());
+  GetOrCreateData(f->function_string());
+  GetOrCreateData(f->heap_number_map());
+  GetOrCreateData(f->length_string());
+  GetOrCreateData(f->many_closures_cell_map());
+  GetOrCreateData(f->minus_zero_value());
+  GetOrCreateData(f->mutable_heap_number_map());
+  GetOrCreateData(f->name_dictionary_map());
+  GetOrCreateData(f->NaN_string());
+  GetOrCreateData(f->null_map());
+  GetOrCreateData(f->null_string());
+  GetOrCreateData(f->null_value());
+  GetOrCreateData(f->number_string());
+  GetOrCreateData(f->object_string());
+  GetOrCreateData(f->one_pointer_filler_map());
+  GetOrCreateData(f->optimized_out());
+  GetOrCreateData(f->optimized_out_map());
+  GetOrCreateData(f->property_array_map());
+  GetOrCreateData(f->sloppy_arguments_elements_map());
+  GetOrCreateData(f->stale_register());
+  GetOrCreateData(f->stale_register_map());
+  GetOrCreateData(f->string_string());
+  GetOrCreateData(f->symbol_string());
+  GetOrCreateData(f->termination_exception_map());
+  GetOrCreateData(f->the_hole_map());
+  GetOrCreateData(f->the_hole_value());
+  GetOrCreateData(f->true_string());
+  GetOrCreateData(f->true_value());
+  GetOrCreateData(f->undefined_map());
+  GetOrCreateData(f->undefined_string());
+  GetOrCreateData(f->undefined_value());
+  GetOrCreateData(f->uninitialized_map());
+  GetOrCreateData(f->with_context_map());
+  GetOrCreateData(f->zero_string());
+
   for (RefsMap::Entry* p = refs_->Start(); p != nullptr; p = refs_->Next(p)) {
     CHECK(IsShareable(p->value->object(), isolate()));
   }
 
-  // TODO(mslekova):
-  // Serialize root objects (from factory).
   compiler_cache()->SetSnapshot(refs_);
   current_zone_ = broker_zone_;
 }
@@ -1634,56 +1684,6 @@ void JSHeapBroker::SerializeStandardObjects() {
 
   Factory* const f = isolate()->factory();
 
-  // Maps, strings, oddballs
-  GetOrCreateData(f->arguments_marker_map());
-  GetOrCreateData(f->bigint_string());
-  GetOrCreateData(f->block_context_map());
-  GetOrCreateData(f->boolean_map());
-  GetOrCreateData(f->boolean_string());
-  GetOrCreateData(f->catch_context_map());
-  GetOrCreateData(f->empty_fixed_array());
-  GetOrCreateData(f->empty_string());
-  GetOrCreateData(f->eval_context_map());
-  GetOrCreateData(f->false_string());
-  GetOrCreateData(f->false_value());
-  GetOrCreateData(f->fixed_array_map());
-  GetOrCreateData(f->fixed_cow_array_map());
-  GetOrCreateData(f->fixed_double_array_map());
-  GetOrCreateData(f->function_context_map());
-  GetOrCreateData(f->function_string());
-  GetOrCreateData(f->heap_number_map());
-  GetOrCreateData(f->length_string());
-  GetOrCreateData(f->many_closures_cell_map());
-  GetOrCreateData(f->minus_zero_value());
-  GetOrCreateData(f->mutable_heap_number_map());
-  GetOrCreateData(f->name_dictionary_map());
-  GetOrCreateData(f->NaN_string());
-  GetOrCreateData(f->null_map());
-  GetOrCreateData(f->null_string());
-  GetOrCreateData(f->null_value());
-  GetOrCreateData(f->number_string());
-  GetOrCreateData(f->object_string());
-  GetOrCreateData(f->one_pointer_filler_map());
-  GetOrCreateData(f->optimized_out());
-  GetOrCreateData(f->optimized_out_map());
-  GetOrCreateData(f->property_array_map());
-  GetOrCreateData(f->sloppy_arguments_elements_map());
-  GetOrCreateData(f->stale_register());
-  GetOrCreateData(f->stale_register_map());
-  GetOrCreateData(f->string_string());
-  GetOrCreateData(f->symbol_string());
-  GetOrCreateData(f->termination_exception_map());
-  GetOrCreateData(f->the_hole_map());
-  GetOrCreateData(f->the_hole_value());
-  GetOrCreateData(f->true_string());
-  GetOrCreateData(f->true_value());
-  GetOrCreateData(f->undefined_map());
-  GetOrCreateData(f->undefined_string());
-  GetOrCreateData(f->undefined_value());
-  GetOrCreateData(f->uninitialized_map());
-  GetOrCreateData(f->with_context_map());
-  GetOrCreateData(f->zero_string());
-
   // Protector cells
   GetOrCreateData(f->array_buffer_neutering_protector())
       ->AsPropertyCell()
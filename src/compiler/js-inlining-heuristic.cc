@@ -8,6 +8,7 @@
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/simplified-operator.h"
+#include "src/feedback-vector-inl.h"
 #include "src/objects-inl.h"
 #include "src/optimized-compilation-info.h"
 
@@ -677,9 +678,42 @@ Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate,
                        num_calls + 1, calls);
   ReplaceWithValue(node, value, effect, control);
 
+  // When the invocation counts identify one target as receiving almost all
+  // of the calls, only inline that target; the cloned calls to the minority
+  // targets remain direct calls behind the dispatch, so we avoid the code
+  // bloat of expanding every target without giving up the dominant one.
+  int dominant_index = -1;
+  if (!small_function && FLAG_polymorphic_inlining_dominance > 0) {
+    int64_t total_count = 0;
+    int64_t dominant_count = 0;
+    for (int i = 0; i < num_calls; ++i) {
+      Handle<JSFunction> function = candidate.functions[i];
+      if (function.is_null() || !function->has_feedback_vector()) {
+        total_count = 0;
+        break;
+      }
+      int64_t const count = function->feedback_vector()->invocation_count();
+      total_count += count;
+      if (count > dominant_count) {
+        dominant_count = count;
+        dominant_index = i;
+      }
+    }
+    if (total_count == 0 || dominant_index < 0 ||
+        !candidate.can_inline_function[dominant_index] ||
+        dominant_count * 100 <
+            FLAG_polymorphic_inlining_dominance * total_count) {
+      dominant_index = -1;
+    } else {
+      TRACE("Only inlining dominant target %d at call site #%d:%s\n",
+            dominant_index, node->id(), node->op()->mnemonic());
+    }
+  }
+
   // Inline the individual, cloned call sites.
   for (int i = 0; i < num_calls; ++i) {
     Node* node = calls[i];
+    if (dominant_index >= 0 && i != dominant_index) continue;
     if (small_function ||
         (candidate.can_inline_function[i] &&
          cumulative_count_ < FLAG_max_inlined_bytecode_size_cumulative)) {
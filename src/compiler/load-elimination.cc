@@ -121,6 +121,12 @@ Reduction LoadElimination::Reduce(Node* node) {
       return ReduceStoreElement(node);
     case IrOpcode::kTransitionAndStoreElement:
       return ReduceTransitionAndStoreElement(node);
+    case IrOpcode::kTransitionAndStoreNumberElement:
+      return ReduceTransitionAndStoreNumberElement(node);
+    case IrOpcode::kTransitionAndStoreNonNumberElement:
+      return ReduceTransitionAndStoreNonNumberElement(node);
+    case IrOpcode::kStoreSignedSmallElement:
+      return ReduceStoreSignedSmallElement(node);
     case IrOpcode::kStoreTypedElement:
       return ReduceStoreTypedElement(node);
     case IrOpcode::kEffectPhi:
@@ -784,6 +790,60 @@ Reduction LoadElimination::ReduceTransitionAndStoreElement(Node* node) {
   return UpdateState(node, state);
 }
 
+Reduction LoadElimination::ReduceTransitionAndStoreNumberElement(Node* node) {
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  Handle<Map> double_map(DoubleMapParameterOf(node->op()));
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  AbstractState const* state = node_states_.Get(effect);
+  if (state == nullptr) return NoChange();
+
+  // The store may transition the {object} to its double elements map.
+  ZoneHandleSet<Map> object_maps;
+  if (state->LookupMaps(object, &object_maps)) {
+    object_maps.insert(double_map, zone());
+    state = state->KillMaps(object, zone());
+    state = state->SetMaps(object, object_maps, zone());
+  }
+  // Kill the elements as well.
+  state = state->KillField(object, FieldIndexOf(JSObject::kElementsOffset),
+                           MaybeHandle<Name>(), zone());
+  return UpdateState(node, state);
+}
+
+Reduction LoadElimination::ReduceTransitionAndStoreNonNumberElement(
+    Node* node) {
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  Handle<Map> fast_map(FastMapParameterOf(node->op()));
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  AbstractState const* state = node_states_.Get(effect);
+  if (state == nullptr) return NoChange();
+
+  // The store may transition the {object} to its fast elements map.
+  ZoneHandleSet<Map> object_maps;
+  if (state->LookupMaps(object, &object_maps)) {
+    object_maps.insert(fast_map, zone());
+    state = state->KillMaps(object, zone());
+    state = state->SetMaps(object, object_maps, zone());
+  }
+  // Kill the elements as well.
+  state = state->KillField(object, FieldIndexOf(JSObject::kElementsOffset),
+                           MaybeHandle<Name>(), zone());
+  return UpdateState(node, state);
+}
+
+Reduction LoadElimination::ReduceStoreSignedSmallElement(Node* node) {
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  AbstractState const* state = node_states_.Get(effect);
+  if (state == nullptr) return NoChange();
+
+  // The store does not transition the {object}, but it does write into its
+  // elements backing store, so the elements need to be reloaded afterwards.
+  state = state->KillField(object, FieldIndexOf(JSObject::kElementsOffset),
+                           MaybeHandle<Name>(), zone());
+  return UpdateState(node, state);
+}
+
 Reduction LoadElimination::ReduceLoadField(Node* node) {
   FieldAccess const& access = FieldAccessOf(node->op());
   Node* object = NodeProperties::GetValueInput(node, 0);
@@ -1143,6 +1203,25 @@ LoadElimination::AbstractState const* LoadElimination::ComputeLoopState(
             }
             break;
           }
+          case IrOpcode::kTransitionAndStoreNumberElement:
+          case IrOpcode::kTransitionAndStoreNonNumberElement: {
+            Node* const object = NodeProperties::GetValueInput(current, 0);
+            // Invalidate what we know about the {object}s map.
+            state = state->KillMaps(object, zone());
+            // Kill the elements as well.
+            state = state->KillField(object,
+                                     FieldIndexOf(JSObject::kElementsOffset),
+                                     MaybeHandle<Name>(), zone());
+            break;
+          }
+          case IrOpcode::kStoreSignedSmallElement: {
+            Node* const object = NodeProperties::GetValueInput(current, 0);
+            // No transition, but the elements backing store is written.
+            state = state->KillField(object,
+                                     FieldIndexOf(JSObject::kElementsOffset),
+                                     MaybeHandle<Name>(), zone());
+            break;
+          }
           case IrOpcode::kStoreElement: {
             Node* const object = NodeProperties::GetValueInput(current, 0);
             Node* const index = NodeProperties::GetValueInput(current, 1);
@@ -248,6 +248,9 @@ class V8_EXPORT_PRIVATE LoadElimination final
   Reduction ReduceLoadElement(Node* node);
   Reduction ReduceStoreElement(Node* node);
   Reduction ReduceTransitionAndStoreElement(Node* node);
+  Reduction ReduceTransitionAndStoreNumberElement(Node* node);
+  Reduction ReduceTransitionAndStoreNonNumberElement(Node* node);
+  Reduction ReduceStoreSignedSmallElement(Node* node);
   Reduction ReduceStoreTypedElement(Node* node);
   Reduction ReduceEffectPhi(Node* node);
   Reduction ReduceStart(Node* node);
@@ -0,0 +1,161 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/node-properties.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Effect chain nodes which cannot invalidate a previously executed load or
+// map check. Any other node with an effect output makes the containing loop
+// unsafe for load hoisting.
+bool IsReadOnlyEffectNode(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kEffectPhi:
+    case IrOpcode::kCheckpoint:
+    case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckMaps:
+    case IrOpcode::kLoadField:
+    case IrOpcode::kLoadElement:
+    case IrOpcode::kLoadTypedElement:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+LoopInvariantCodeMotion::LoopInvariantCodeMotion(Graph* graph,
+                                                 LoopTree* loop_tree,
+                                                 Zone* tmp_zone)
+    : graph_(graph),
+      loop_tree_(loop_tree),
+      tmp_zone_(tmp_zone),
+      hoisted_to_(tmp_zone) {}
+
+void LoopInvariantCodeMotion::Run() {
+  // Process inner loops before their enclosing loops, so that a node hoisted
+  // out of an inner loop can be hoisted further if it is also invariant in
+  // the outer loop.
+  ZoneVector<LoopTree::Loop*> loops(tmp_zone_);
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    loops.push_back(loop);
+  }
+  for (size_t i = 0; i < loops.size(); i++) {
+    for (LoopTree::Loop* child : loops[i]->children()) {
+      loops.push_back(child);
+    }
+  }
+  for (size_t i = loops.size(); i > 0; i--) {
+    HoistInvariantNodes(loops[i - 1]);
+  }
+}
+
+bool LoopInvariantCodeMotion::IsInsideLoop(LoopTree::Loop* loop, Node* node) {
+  auto it = hoisted_to_.find(node);
+  LoopTree::Loop* containing =
+      it != hoisted_to_.end() ? it->second : loop_tree_->ContainingLoop(node);
+  for (; containing != nullptr; containing = containing->parent()) {
+    if (containing == loop) return true;
+  }
+  return false;
+}
+
+bool LoopInvariantCodeMotion::LoopHasWritesOrCalls(LoopTree::Loop* loop) {
+  for (Node* node : loop_tree_->LoopNodes(loop)) {
+    if (node->op()->EffectOutputCount() > 0 && !IsReadOnlyEffectNode(node)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void LoopInvariantCodeMotion::HoistInvariantNodes(LoopTree::Loop* loop) {
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+
+  // Find the unique effect phi merging the effect chain at the loop header;
+  // without one there is nothing on the effect chain to hoist.
+  Node* effect_phi = nullptr;
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    if (node->opcode() != IrOpcode::kEffectPhi) continue;
+    if (NodeProperties::GetControlInput(node) != loop_node) continue;
+    if (effect_phi != nullptr) return;
+    effect_phi = node;
+  }
+  if (effect_phi == nullptr) return;
+
+  bool const has_writes = LoopHasWritesOrCalls(loop);
+
+  // Hoist until a fixed point is reached, since hoisting a bounds check can
+  // make the load consuming its result invariant as well.
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (Node* node : loop_tree_->LoopNodes(loop)) {
+      if (!IsInsideLoop(loop, node)) continue;  // Already hoisted.
+      switch (node->opcode()) {
+        case IrOpcode::kCheckBounds:
+          break;
+        case IrOpcode::kCheckMaps:
+        case IrOpcode::kLoadField:
+        case IrOpcode::kLoadElement:
+        case IrOpcode::kLoadTypedElement:
+          // Loads and map checks can only move out of loops that contain no
+          // effects which could invalidate them.
+          if (has_writes) continue;
+          break;
+        default:
+          continue;
+      }
+      DCHECK_EQ(1, node->op()->EffectInputCount());
+      DCHECK_EQ(0, node->op()->ControlOutputCount());
+      // Only the head of the iteration's effect chain may move: a load that
+      // is ordered after an in-loop check purely via the effect chain must
+      // not float above its guard. Hoisting rewires the successor's effect
+      // input to the effect phi, so a guarded chain is still peeled node by
+      // node across fixed-point rounds, and peeling from the head keeps the
+      // original order on the loop entry chain.
+      if (NodeProperties::GetEffectInput(node) != effect_phi) continue;
+      bool invariant = true;
+      for (Edge edge : node->input_edges()) {
+        if (!NodeProperties::IsValueEdge(edge)) continue;
+        if (IsInsideLoop(loop, edge.to())) {
+          invariant = false;
+          break;
+        }
+      }
+      if (!invariant) continue;
+      Hoist(node, effect_phi, loop_node);
+      hoisted_to_[node] = loop->parent();
+      changed = true;
+    }
+  }
+}
+
+void LoopInvariantCodeMotion::Hoist(Node* node, Node* effect_phi,
+                                    Node* loop_node) {
+  // Unlink {node} from the effect chain inside the loop.
+  Node* effect_input = NodeProperties::GetEffectInput(node);
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect_input);
+  }
+
+  // Splice {node} into the effect chain on the loop entry path, right before
+  // the loop's effect phi, and move it under the loop entry control.
+  Node* entry_effect = effect_phi->InputAt(kAssumedLoopEntryIndex);
+  NodeProperties::ReplaceEffectInput(node, entry_effect);
+  effect_phi->ReplaceInput(kAssumedLoopEntryIndex, node);
+  NodeProperties::ReplaceControlInput(
+      node, loop_node->InputAt(kAssumedLoopEntryIndex));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
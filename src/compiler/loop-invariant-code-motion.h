@@ -0,0 +1,49 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/globals.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Hoists loop-invariant nodes on the effect chain out of loops. Pure nodes
+// are already moved out of loops by the scheduler, so this pass only deals
+// with nodes that are threaded through the effect chain: bounds checks whose
+// inputs are defined outside the loop are hoisted unconditionally (hoisting
+// an eager check only moves the potential deoptimization to the checkpoint
+// before the loop), while invariant loads and map checks are hoisted only
+// out of loops whose bodies contain no writes or calls that could invalidate
+// them.
+class V8_EXPORT_PRIVATE LoopInvariantCodeMotion {
+ public:
+  LoopInvariantCodeMotion(Graph* graph, LoopTree* loop_tree, Zone* tmp_zone);
+
+  void Run();
+
+ private:
+  void HoistInvariantNodes(LoopTree::Loop* loop);
+  bool IsInsideLoop(LoopTree::Loop* loop, Node* node);
+  bool LoopHasWritesOrCalls(LoopTree::Loop* loop);
+  void Hoist(Node* node, Node* effect_phi, Node* loop_node);
+
+  Graph* const graph_;
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  // Records the loop (possibly none) a node has been moved into, overriding
+  // the static loop membership computed by the loop finder.
+  ZoneMap<Node*, LoopTree::Loop*> hoisted_to_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
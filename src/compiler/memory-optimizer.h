@@ -28,7 +28,16 @@ typedef uint32_t NodeId;
 // Lowers all simplified memory access and allocation related nodes (i.e.
 // Allocate, LoadField, StoreField and friends) to machine operators.
 // Performs allocation folding and store write barrier elimination
-// implicitly.
+// implicitly:
+//
+// Consecutive young-generation allocations on the same effect chain are
+// folded into one allocation group with a single size-summed bump-pointer
+// check; the reservation size node of the first allocation is patched as
+// further allocations join the group (see --turbo-allocation-folding, on by
+// default). Initializing stores into objects of a new-space allocation group
+// skip the write barrier entirely, since the group provably lives in new
+// space; this also survives control-flow merges as long as all incoming
+// states agree on the group (see MergeStates).
 class MemoryOptimizer final {
  public:
   enum class AllocationFolding { kDoAllocationFolding, kDontAllocationFolding };
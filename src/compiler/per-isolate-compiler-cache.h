@@ -21,7 +21,8 @@ class ObjectData;
 
 // This class serves as a per-isolate container of data that should be
 // persisted between compiler runs. For now it stores the code builtins
-// so they are not serialized on each compiler run.
+// and the immortal immutable roots (maps, strings and oddballs) so they
+// are not serialized on each compiler run.
 class PerIsolateCompilerCache : public ZoneObject {
  public:
   explicit PerIsolateCompilerCache(Zone* zone)
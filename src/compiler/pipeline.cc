@@ -52,6 +52,7 @@
 #include "src/compiler/js-typed-lowering.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
 #include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/machine-graph-verifier.h"
@@ -993,6 +994,16 @@ void PipelineCompilationJob::RegisterWeakObjectsInOptimizedCode(
   code->set_can_have_weak_objects(true);
 }
 
+// Phases are deliberately executed back-to-back on a single thread. Running
+// independent-looking phases concurrently within one compilation is not sound
+// in the current architecture: all graph phases mutate the one shared Graph
+// and allocate from the compilation's graph zone (Zone is not thread-safe),
+// GraphReducer revisitation and NodeMarker generations assume a single
+// mutator, and instruction selection emits into a single InstructionSequence
+// with global virtual register numbering. Lowering single-function
+// optimization latency therefore has to come from making individual phases
+// cheaper or fusing reducers into a shared GraphReducer run (see
+// LoadEliminationPhase), not from threading within the pipeline.
 template <typename Phase>
 void PipelineImpl::Run() {
   PipelineRunScope scope(this->data_, Phase::phase_name());
@@ -1274,6 +1285,21 @@ struct LoopPeelingPhase {
   }
 };
 
+struct LoopInvariantCodeMotionPhase {
+  static const char* phase_name() { return "loop invariant code motion"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    LoopInvariantCodeMotion(data->graph(), loop_tree, temp_zone).Run();
+  }
+};
+
 struct LoopExitEliminationPhase {
   static const char* phase_name() { return "loop exit elimination"; }
 
@@ -1946,6 +1972,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
     Run<LoadEliminationPhase>();
     RunPrintAndVerify(LoadEliminationPhase::phase_name());
   }
+
+  if (FLAG_turbo_licm) {
+    Run<LoopInvariantCodeMotionPhase>();
+    RunPrintAndVerify(LoopInvariantCodeMotionPhase::phase_name());
+  }
   data->DeleteTyper();
 
   if (FLAG_turbo_escape) {
@@ -1990,6 +2021,15 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   Run<EffectControlLinearizationPhase>();
   RunPrintAndVerify(EffectControlLinearizationPhase::phase_name(), true);
 
+  // Note: this is the earliest point at which a superword-level vectorization
+  // pass could run, since typed-array accesses only become plain machine
+  // loads and stores during effect control linearization. Packing adjacent
+  // scalar accesses into the existing 128-bit SIMD operators is not viable
+  // yet: the machine operator set has no two-lane double support (F64x2), and
+  // JavaScript-derived graphs interleave accesses with bounds checks and
+  // deopt points that defeat the adjacency and alias analysis such a pass
+  // needs.
+
   if (FLAG_turbo_store_elimination) {
     Run<StoreStoreEliminationPhase>();
     RunPrintAndVerify(StoreStoreEliminationPhase::phase_name(), true);
@@ -2760,7 +2800,17 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
                                        data->register_allocation_data());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  // The fast allocation mode trades some code quality around deferred code
+  // for compile time by skipping live range splintering. Fall back to the
+  // full preprocessing when there are enough live ranges that splintering is
+  // likely to pay for itself.
+  bool preprocess_ranges =
+      FLAG_turbo_preprocess_ranges &&
+      !(info()->is_fast_register_allocation_enabled() &&
+        data->register_allocation_data()->live_ranges().size() <=
+            static_cast<size_t>(FLAG_turbo_fast_regalloc_range_limit));
+
+  if (preprocess_ranges) {
     Run<SplinterLiveRangesPhase>();
     if (info()->trace_turbo_json_enabled() &&
         !data->MayHaveUnverifiableGraph()) {
@@ -2776,7 +2826,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (preprocess_ranges) {
     Run<MergeSplintersPhase>();
   }
 
@@ -1197,6 +1197,22 @@ void Scheduler::PropagateImmediateDominators(BasicBlock* block) {
 void Scheduler::GenerateImmediateDominatorTree() {
   TRACE("--- IMMEDIATE BLOCK DOMINATORS -----------------------------\n");
 
+  // Blocks that unconditionally deoptimize or throw execute at most once (or
+  // only on exceptional paths), so treat them as deferred even when the
+  // branch leading to them carried no hint; the assembly order then moves
+  // them behind the hot code. This is restricted to single-predecessor blocks
+  // because the register allocator requires every predecessor of a deferred
+  // merge block to be deferred as well (see
+  // InstructionSequence::ValidateDeferredBlockEntryPaths).
+  for (BasicBlock* block : *schedule_->all_blocks()) {
+    if (block->deferred()) continue;
+    if (block->PredecessorCount() != 1) continue;
+    if (block->control() == BasicBlock::kDeoptimize ||
+        block->control() == BasicBlock::kThrow) {
+      block->set_deferred(true);
+    }
+  }
+
   // Seed start block to be the first dominator.
   schedule_->start()->set_dominator_depth(0);
 
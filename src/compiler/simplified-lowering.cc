@@ -1199,6 +1199,14 @@ class RepresentationSelector {
     return changer_->Float64OperatorFor(node->opcode());
   }
 
+  // Picks the cheapest write barrier the stored value admits: none for
+  // values that are provably Smis by representation or immortal immovable
+  // roots (which includes the immortal maps), and the map barrier for map
+  // word stores. A SignedSmall value *type* alone is not enough to elide:
+  // with a plain tagged representation the value may still be a boxed
+  // HeapNumber. Barriers for stores into freshly allocated objects are
+  // removed later, by MemoryOptimizer::ComputeWriteBarrierKind, which
+  // tracks allocations along the effect chain.
   WriteBarrierKind WriteBarrierKindFor(
       BaseTaggedness base_taggedness,
       MachineRepresentation field_representation, Type field_type,
@@ -512,5 +512,30 @@ void Context::IncrementErrorsThrown() {
 
 int Context::GetErrorsThrown() { return errors_thrown()->value(); }
 
+void Context::ResetSampledAllocatedBytes() {
+  DCHECK(IsNativeContext());
+  set_sampled_allocated_kilobytes(Smi::FromInt(0));
+}
+
+void Context::AddSampledAllocatedBytes(size_t bytes) {
+  DCHECK(IsNativeContext());
+  Object* raw = get(SAMPLED_ALLOCATED_KILOBYTES_INDEX);
+  // The slot is only initialized once bootstrapping has finished.
+  if (!raw->IsSmi()) return;
+  int delta = static_cast<int>(bytes / KB);
+  int previous_value = Smi::ToInt(raw);
+  int new_value = previous_value <= Smi::kMaxValue - delta
+                      ? previous_value + delta
+                      : Smi::kMaxValue;
+  set_sampled_allocated_kilobytes(Smi::FromInt(new_value));
+}
+
+size_t Context::GetSampledAllocatedBytes() {
+  DCHECK(IsNativeContext());
+  Object* raw = get(SAMPLED_ALLOCATED_KILOBYTES_INDEX);
+  if (!raw->IsSmi()) return 0;
+  return static_cast<size_t>(Smi::ToInt(raw)) * KB;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -279,6 +279,7 @@ enum ContextLookupFlags {
     initial_regexp_string_iterator_prototype_map)                              \
   V(REGEXP_RESULT_MAP_INDEX, Map, regexp_result_map)                           \
   V(REGEXP_PROTOTYPE_INDEX, JSObject, regexp_prototype)                        \
+  V(SAMPLED_ALLOCATED_KILOBYTES_INDEX, Smi, sampled_allocated_kilobytes)       \
   V(SCRIPT_CONTEXT_TABLE_INDEX, ScriptContextTable, script_context_table)      \
   V(SECURITY_TOKEN_INDEX, Object, security_token)                              \
   V(SERIALIZED_OBJECTS, FixedArray, serialized_objects)                        \
@@ -491,6 +492,14 @@ class Context : public FixedArray, public NeverReadOnlySpaceObject {
   void IncrementErrorsThrown();
   int GetErrorsThrown();
 
+  // Sampled estimate of the bytes allocated on behalf of this native
+  // context, maintained by ContextAccountingObserver when
+  // --per-context-accounting is enabled. The counter is kept in KB so that
+  // it stays a Smi on 32-bit targets; it saturates instead of wrapping.
+  void ResetSampledAllocatedBytes();
+  void AddSampledAllocatedBytes(size_t bytes);
+  size_t GetSampledAllocatedBytes();
+
   // Direct slot access.
   inline void set_scope_info(ScopeInfo* scope_info);
   inline Context* previous();
@@ -35,36 +35,26 @@ StatsCounterThreadSafe::StatsCounterThreadSafe(Counters* counters,
 
 void StatsCounterThreadSafe::Set(int Value) {
   if (ptr_) {
-    base::MutexGuard Guard(&mutex_);
+    value_.store(Value, std::memory_order_relaxed);
     SetLoc(ptr_, Value);
   }
 }
 
-void StatsCounterThreadSafe::Increment() {
-  if (ptr_) {
-    base::MutexGuard Guard(&mutex_);
-    IncrementLoc(ptr_);
-  }
-}
+void StatsCounterThreadSafe::Increment() { Increment(1); }
 
 void StatsCounterThreadSafe::Increment(int value) {
   if (ptr_) {
-    base::MutexGuard Guard(&mutex_);
-    IncrementLoc(ptr_, value);
+    int total = value_.fetch_add(value, std::memory_order_relaxed) + value;
+    SetLoc(ptr_, total);
   }
 }
 
-void StatsCounterThreadSafe::Decrement() {
-  if (ptr_) {
-    base::MutexGuard Guard(&mutex_);
-    DecrementLoc(ptr_);
-  }
-}
+void StatsCounterThreadSafe::Decrement() { Decrement(1); }
 
 void StatsCounterThreadSafe::Decrement(int value) {
   if (ptr_) {
-    base::MutexGuard Guard(&mutex_);
-    DecrementLoc(ptr_, value);
+    int total = value_.fetch_sub(value, std::memory_order_relaxed) - value;
+    SetLoc(ptr_, total);
   }
 }
 
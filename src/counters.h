@@ -5,6 +5,8 @@
 #ifndef V8_COUNTERS_H_
 #define V8_COUNTERS_H_
 
+#include <atomic>
+
 #include "include/v8.h"
 #include "src/allocation.h"
 #include "src/base/atomic-utils.h"
@@ -179,7 +181,12 @@ class StatsCounter : public StatsCounterBase {
   bool lookup_done_;
 };
 
-// Thread safe version of StatsCounter.
+// Thread safe version of StatsCounter. Updates accumulate in a lock-free
+// internal aggregate whose current value is published to the stats table
+// location after every change, so frequently bumped counters (e.g. wasm
+// code size updates during parallel compilation) do not serialize on a
+// mutex. Racing publications may transiently expose a slightly stale
+// total; the next update repairs it.
 class StatsCounterThreadSafe : public StatsCounterBase {
  public:
   void Set(int Value);
@@ -197,9 +204,12 @@ class StatsCounterThreadSafe : public StatsCounterBase {
   friend class Counters;
 
   StatsCounterThreadSafe(Counters* counters, const char* name);
-  void Reset() { ptr_ = FindLocationInStatsTable(); }
+  void Reset() {
+    ptr_ = FindLocationInStatsTable();
+    if (ptr_) SetLoc(ptr_, value_.load(std::memory_order_relaxed));
+  }
 
-  base::Mutex mutex_;
+  std::atomic<int> value_{0};
 
   DISALLOW_IMPLICIT_CONSTRUCTORS(StatsCounterThreadSafe);
 };
@@ -1172,7 +1182,7 @@ class RuntimeCallTimerScope {
   HR(background_scavenger, V8.GCBackgroundScavenger, 0, 10000, 101)            \
   HR(background_sweeping, V8.GCBackgroundSweeping, 0, 10000, 101)              \
   HR(detached_context_age_in_gc, V8.DetachedContextAgeInGC, 0, 20, 21)         \
-  HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 6, 6)              \
+  HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 9, 9)              \
   HR(errors_thrown_per_context, V8.ErrorsThrownPerContext, 0, 200, 20)         \
   HR(debug_feature_usage, V8.DebugFeatureUsage, 1, 7, 7)                       \
   HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0, 21, 22)     \
@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <cmath>
 #include <fstream>
 #include <unordered_map>
 #include <utility>
@@ -27,6 +28,7 @@
 #include "src/base/platform/time.h"
 #include "src/base/sys-info.h"
 #include "src/basic-block-profiler.h"
+#include "src/counters.h"
 #include "src/d8-console.h"
 #include "src/d8-platforms.h"
 #include "src/d8.h"
@@ -2778,6 +2780,15 @@ bool Shell::SetOptions(int argc, char* argv[]) {
     } else if (strcmp(argv[i], "--stress-deopt") == 0) {
       options.stress_deopt = true;
       argv[i] = nullptr;
+    } else if (strcmp(argv[i], "--bench") == 0) {
+      if (options.bench_runs == 0) options.bench_runs = 10;
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-runs=", 13) == 0) {
+      options.bench_runs = atoi(argv[i] + 13);
+      argv[i] = nullptr;
+    } else if (strncmp(argv[i], "--bench-warmup=", 15) == 0) {
+      options.bench_warmup_runs = atoi(argv[i] + 15);
+      argv[i] = nullptr;
     } else if (strcmp(argv[i], "--stress-background-compile") == 0) {
       options.stress_background_compile = true;
       argv[i] = nullptr;
@@ -2933,6 +2944,106 @@ bool Shell::SetOptions(int argc, char* argv[]) {
   return true;
 }
 
+namespace {
+
+// Wall time spent between GC prologue and epilogue callbacks, accumulated for
+// the current --bench iteration. Incremental marking steps outside the atomic
+// pause are not covered.
+double bench_gc_time_ms = 0;
+base::TimeTicks bench_gc_start;
+
+void BenchGCPrologueCallback(Isolate* isolate, GCType type,
+                             GCCallbackFlags flags) {
+  bench_gc_start = base::TimeTicks::HighResolutionNow();
+}
+
+void BenchGCEpilogueCallback(Isolate* isolate, GCType type,
+                             GCCallbackFlags flags) {
+  bench_gc_time_ms +=
+      (base::TimeTicks::HighResolutionNow() - bench_gc_start).InMillisecondsF();
+}
+
+// Sums the time of all runtime call stats counters whose name starts with
+// |prefix|. Only meaningful when --runtime-call-stats is enabled; returns 0
+// otherwise since no timers run.
+double SumRuntimeCallStatsMs(i::Isolate* i_isolate, const char* prefix) {
+  i::RuntimeCallStats* stats = i_isolate->counters()->runtime_call_stats();
+  const size_t prefix_length = strlen(prefix);
+  double ms = 0;
+  for (int i = 0; i < i::RuntimeCallStats::kNumberOfCounters; i++) {
+    i::RuntimeCallCounter* counter = stats->GetCounter(i);
+    if (strncmp(counter->name(), prefix, prefix_length) == 0) {
+      ms += counter->time().InMillisecondsF();
+    }
+  }
+  return ms;
+}
+
+}  // namespace
+
+int Shell::RunBenchmark(Isolate* isolate, int argc, char* argv[]) {
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  isolate->AddGCPrologueCallback(BenchGCPrologueCallback);
+  isolate->AddGCEpilogueCallback(BenchGCEpilogueCallback);
+
+  const int warmup_runs = Max(options.bench_warmup_runs, 0);
+  const int total_runs = warmup_runs + options.bench_runs;
+  std::vector<double> samples;
+  double gc_ms = 0;
+  double compile_ms = 0;
+  int result = 0;
+  for (int i = 0; i < total_runs && result == 0; i++) {
+    const bool warmup = i < warmup_runs;
+    printf("============ Bench %s %d/%d ============\n",
+           warmup ? "warmup" : "run", warmup ? i + 1 : i + 1 - warmup_runs,
+           warmup ? warmup_runs : options.bench_runs);
+    bench_gc_time_ms = 0;
+    const double compile_ms_before = SumRuntimeCallStatsMs(i_isolate, "Compile");
+    const base::TimeTicks start = base::TimeTicks::HighResolutionNow();
+    result = RunMain(isolate, argc, argv, i == total_runs - 1);
+    const double elapsed_ms =
+        (base::TimeTicks::HighResolutionNow() - start).InMillisecondsF();
+    if (!warmup) {
+      samples.push_back(elapsed_ms);
+      gc_ms += bench_gc_time_ms;
+      compile_ms += SumRuntimeCallStatsMs(i_isolate, "Compile") - compile_ms_before;
+    }
+  }
+
+  isolate->RemoveGCPrologueCallback(BenchGCPrologueCallback);
+  isolate->RemoveGCEpilogueCallback(BenchGCEpilogueCallback);
+  if (result != 0 || samples.empty()) return result;
+
+  std::sort(samples.begin(), samples.end());
+  const int runs = static_cast<int>(samples.size());
+  double total_ms = 0;
+  for (double sample : samples) total_ms += sample;
+  const double mean = total_ms / runs;
+  const double median = runs % 2 == 1
+                            ? samples[runs / 2]
+                            : (samples[runs / 2 - 1] + samples[runs / 2]) / 2;
+  double variance = 0;
+  for (double sample : samples) {
+    variance += (sample - mean) * (sample - mean);
+  }
+  const double stddev = runs > 1 ? std::sqrt(variance / (runs - 1)) : 0;
+
+  printf("============ Benchmark statistics ============\n");
+  printf("runs: %d (+%d warmup)\n", runs, warmup_runs);
+  printf("mean: %.3f ms  median: %.3f ms  stddev: %.3f ms\n", mean, median,
+         stddev);
+  printf("min: %.3f ms  max: %.3f ms\n", samples.front(), samples.back());
+  printf("gc: %.3f ms/run (%.1f%% of mean)\n", gc_ms / runs,
+         mean > 0 ? gc_ms / runs / mean * 100 : 0);
+  if (i::FLAG_runtime_stats) {
+    printf("compile: %.3f ms/run (%.1f%% of mean)\n", compile_ms / runs,
+           mean > 0 ? compile_ms / runs / mean * 100 : 0);
+  } else {
+    printf("compile: pass --runtime-call-stats to measure\n");
+  }
+  return result;
+}
+
 int Shell::RunMain(Isolate* isolate, int argc, char* argv[], bool last_run) {
   for (int i = 1; i < options.num_isolates; ++i) {
     options.isolate_sources[i].StartExecuteInThread();
@@ -3468,6 +3579,8 @@ int Shell::Main(int argc, char* argv[]) {
         bool last_run = i == options.stress_runs - 1;
         result = RunMain(isolate, argc, argv, last_run);
       }
+    } else if (options.bench_runs > 0) {
+      result = RunBenchmark(isolate, argc, argv);
     } else if (options.code_cache_options !=
                ShellOptions::CodeCacheOptions::kNoProduceCache) {
       printf("============ Run: Produce code cache ============\n");
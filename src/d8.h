@@ -385,6 +385,8 @@ class ShellOptions {
   int read_from_tcp_port;
   bool enable_os_system = false;
   bool quiet_load = false;
+  int bench_runs = 0;
+  int bench_warmup_runs = 1;
   int thread_pool_size = 0;
   std::vector<const char*> arguments;
   bool include_arguments = true;
@@ -411,6 +413,9 @@ class Shell : public i::AllStatic {
   static Local<String> ReadFile(Isolate* isolate, const char* name);
   static Local<Context> CreateEvaluationContext(Isolate* isolate);
   static int RunMain(Isolate* isolate, int argc, char* argv[], bool last_run);
+  // Runs the scripts --bench-warmup + --bench-runs times in the same isolate
+  // and prints timing statistics over the non-warmup iterations.
+  static int RunBenchmark(Isolate* isolate, int argc, char* argv[]);
   static int Main(int argc, char* argv[]);
   static void Exit(int exit_code);
   static void OnExit(Isolate* isolate);
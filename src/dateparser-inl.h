@@ -12,9 +12,51 @@
 namespace v8 {
 namespace internal {
 
+template <typename Char>
+bool DateParser::TryParseIsoTimestamp(Vector<Char> str, FixedArray* output) {
+  static const char kPattern[] = "0000-00-00T00:00:00.000Z";
+  const int kLength = 24;
+  if (str.length() != kLength) return false;
+  for (int i = 0; i < kLength; i++) {
+    Char c = str[i];
+    if (kPattern[i] == '0') {
+      if (c < '0' || c > '9') return false;
+    } else if (c != static_cast<Char>(kPattern[i])) {
+      return false;
+    }
+  }
+  int year = (str[0] - '0') * 1000 + (str[1] - '0') * 100 +
+             (str[2] - '0') * 10 + (str[3] - '0');
+  int month = (str[5] - '0') * 10 + (str[6] - '0');
+  int day = (str[8] - '0') * 10 + (str[9] - '0');
+  int hour = (str[11] - '0') * 10 + (str[12] - '0');
+  int minute = (str[14] - '0') * 10 + (str[15] - '0');
+  int second = (str[17] - '0') * 10 + (str[18] - '0');
+  int millisecond =
+      (str[20] - '0') * 100 + (str[21] - '0') * 10 + (str[22] - '0');
+  if (!DayComposer::IsMonth(month) || !DayComposer::IsDay(day)) return false;
+  if (!TimeComposer::IsHour(hour) || !TimeComposer::IsMinute(minute) ||
+      !TimeComposer::IsSecond(second)) {
+    // A 24th hour is allowed if minutes, seconds, and milliseconds are 0.
+    if (hour != 24 || minute != 0 || second != 0 || millisecond != 0) {
+      return false;
+    }
+  }
+  output->set(YEAR, Smi::FromInt(year));
+  output->set(MONTH, Smi::FromInt(month - 1));  // 0-based
+  output->set(DAY, Smi::FromInt(day));
+  output->set(HOUR, Smi::FromInt(hour));
+  output->set(MINUTE, Smi::FromInt(minute));
+  output->set(SECOND, Smi::FromInt(second));
+  output->set(MILLISECOND, Smi::FromInt(millisecond));
+  output->set(UTC_OFFSET, Smi::FromInt(0));  // 'Z' is UTC.
+  return true;
+}
+
 template <typename Char>
 bool DateParser::Parse(Isolate* isolate, Vector<Char> str, FixedArray* out) {
   DCHECK(out->length() >= OUTPUT_SIZE);
+  if (TryParseIsoTimestamp(str, out)) return true;
   InputReader<Char> in(str);
   DateStringTokenizer<Char> scanner(&in);
   TimeZoneComposer tz;
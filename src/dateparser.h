@@ -354,6 +354,15 @@ class DateParser : public AllStatic {
   static DateParser::DateToken ParseES5DateTime(
       DateStringTokenizer<Char>* scanner, DayComposer* day, TimeComposer* time,
       TimeZoneComposer* tz);
+
+  // Fast path for the fixed-layout "YYYY-MM-DDTHH:mm:ss.sssZ" timestamps
+  // that Date.prototype.toISOString produces and that dominate
+  // machine-generated data. Extracts the fields positionally and fills the
+  // output array, returning false (with the output untouched) on any layout
+  // or range mismatch so that the caller falls back to the tokenizing
+  // parser.
+  template <typename Char>
+  static bool TryParseIsoTimestamp(Vector<Char> str, FixedArray* output);
 };
 
 
@@ -602,6 +602,16 @@ std::unique_ptr<Coverage> Coverage::Collect(
   return result;
 }
 
+// Note on overhead: the precise and block modes are inherently incompatible
+// with production throughput, not just by implementation choice. Their
+// counters live in feedback vectors and coverage infos, which optimized code
+// does not update, so enabling them must deoptimize everything and keep
+// functions in lower tiers. A sampled variant would not help: rotating the
+// sampled set requires the same global deoptimization per rotation. For
+// always-on, low-overhead measurement use kBestEffort, which reads the
+// invocation counts that the interpreter maintains anyway and neither
+// deoptimizes nor pins feedback vectors (with the caveat that invocations of
+// fully optimized functions are not counted).
 void Coverage::SelectMode(Isolate* isolate, debug::Coverage::Mode mode) {
   switch (mode) {
     case debug::Coverage::kBestEffort:
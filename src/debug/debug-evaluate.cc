@@ -6,6 +6,7 @@
 
 #include "src/accessors.h"
 #include "src/assembler-inl.h"
+#include "src/compilation-cache.h"
 #include "src/compiler.h"
 #include "src/contexts.h"
 #include "src/debug/debug-frames.h"
@@ -21,6 +22,33 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// While a debugger is attached the isolate's compilation cache is disabled
+// (see Debug::UpdateState), which makes every Runtime.evaluate recompile its
+// expression from scratch. Monitoring agents evaluate the same watch
+// expressions over and over, so re-enable the cache around the compilation
+// of a global debug-evaluate source; the resulting SharedFunctionInfo is
+// context-independent and safe to reuse.
+class EnableCompilationCacheScope {
+ public:
+  explicit EnableCompilationCacheScope(Isolate* isolate) : isolate_(isolate) {
+    was_enabled_ = isolate_->compilation_cache()->IsEnabled();
+    isolate_->compilation_cache()->Enable();
+  }
+  ~EnableCompilationCacheScope() {
+    // Disable() would clear the cache and with it the entry just inserted;
+    // keep the entries so the next evaluation of the same expression hits.
+    if (!was_enabled_) isolate_->compilation_cache()->DisableAndKeepEntries();
+  }
+
+ private:
+  Isolate* isolate_;
+  bool was_enabled_;
+};
+
+}  // namespace
+
 MaybeHandle<Object> DebugEvaluate::Global(Isolate* isolate,
                                           Handle<String> source,
                                           bool throw_on_side_effect) {
@@ -29,12 +57,15 @@ MaybeHandle<Object> DebugEvaluate::Global(Isolate* isolate,
 
   Handle<Context> context = isolate->native_context();
   ScriptOriginOptions origin_options(false, true);
-  MaybeHandle<SharedFunctionInfo> maybe_function_info =
-      Compiler::GetSharedFunctionInfoForScript(
-          isolate, source,
-          Compiler::ScriptDetails(isolate->factory()->empty_string()),
-          origin_options, nullptr, nullptr, ScriptCompiler::kNoCompileOptions,
-          ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE);
+  MaybeHandle<SharedFunctionInfo> maybe_function_info;
+  {
+    EnableCompilationCacheScope enable_cache_scope(isolate);
+    maybe_function_info = Compiler::GetSharedFunctionInfoForScript(
+        isolate, source,
+        Compiler::ScriptDetails(isolate->factory()->empty_string()),
+        origin_options, nullptr, nullptr, ScriptCompiler::kNoCompileOptions,
+        ScriptCompiler::kNoCacheNoReason, NOT_NATIVES_CODE);
+  }
 
   Handle<SharedFunctionInfo> shared_info;
   if (!maybe_function_info.ToHandle(&shared_info)) return MaybeHandle<Object>();
@@ -426,6 +457,7 @@ bool BytecodeHasNoSideEffect(interpreter::Bytecode bytecode) {
     case Bytecode::kLdaGlobal:
     case Bytecode::kLdaNamedProperty:
     case Bytecode::kLdaNamedPropertyNoFeedback:
+    case Bytecode::kLdaInObjectProperty:
     case Bytecode::kLdaKeyedProperty:
     case Bytecode::kLdaGlobalInsideTypeof:
     case Bytecode::kLdaLookupSlotInsideTypeof:
@@ -513,6 +545,8 @@ bool BytecodeHasNoSideEffect(interpreter::Bytecode bytecode) {
     case Bytecode::kCallJSRuntime:
     case Bytecode::kStackCheck:
     case Bytecode::kReturn:
+    case Bytecode::kReturnUndefined:
+    case Bytecode::kReturnSmi:
     case Bytecode::kSetPendingMessage:
       return true;
     default:
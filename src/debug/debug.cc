@@ -261,7 +261,9 @@ DebugBreakType BreakIterator::GetDebugBreakType() {
 
   if (bytecode == interpreter::Bytecode::kDebugger) {
     return DEBUGGER_STATEMENT;
-  } else if (bytecode == interpreter::Bytecode::kReturn) {
+  } else if (bytecode == interpreter::Bytecode::kReturn ||
+             bytecode == interpreter::Bytecode::kReturnUndefined ||
+             bytecode == interpreter::Bytecode::kReturnSmi) {
     return DEBUG_BREAK_SLOT_AT_RETURN;
   } else if (bytecode == interpreter::Bytecode::kSuspendGenerator) {
     return DEBUG_BREAK_SLOT_AT_SUSPEND;
@@ -9,6 +9,7 @@
 #include "src/accessors.h"
 #include "src/assembler-inl.h"
 #include "src/ast/prettyprinter.h"
+#include "src/base/functional.h"
 #include "src/callable.h"
 #include "src/counters.h"
 #include "src/disasm.h"
@@ -1947,6 +1948,40 @@ int32_t TranslationIterator::Next() {
 
 bool TranslationIterator::HasNext() const { return index_ < buffer_->length(); }
 
+int TranslationBuffer::FinishTranslation(int index) {
+  if (!FLAG_turbo_dedupe_translations) return index;
+  int const length = CurrentIndex() - index;
+  size_t hash = 0;
+  auto it = contents_.Find(static_cast<size_t>(index));
+  for (int i = 0; i < length; ++i, ++it) {
+    hash = base::hash_combine(hash, *it);
+  }
+  uint32_t const key = static_cast<uint32_t>(hash);
+  auto entry = dedup_map_.find(key);
+  if (entry == dedup_map_.end()) {
+    dedup_map_.insert({key, std::make_pair(index, length)});
+    return index;
+  }
+  if (entry->second.second == length &&
+      RangeEquals(entry->second.first, index, length)) {
+    // Drop the just-written bytes and share the earlier identical copy.
+    contents_.Rewind(static_cast<size_t>(index));
+    return entry->second.first;
+  }
+  // Hash collision with a different translation; keep this one as is.
+  return index;
+}
+
+bool TranslationBuffer::RangeEquals(int index, int other_index,
+                                    int length) const {
+  auto a = contents_.Find(static_cast<size_t>(index));
+  auto b = contents_.Find(static_cast<size_t>(other_index));
+  for (int i = 0; i < length; ++i, ++a, ++b) {
+    if (*a != *b) return false;
+  }
+  return true;
+}
+
 Handle<ByteArray> TranslationBuffer::CreateByteArray(Factory* factory) {
   Handle<ByteArray> result = factory->NewByteArray(CurrentIndex(), TENURED);
   contents_.CopyTo(result->GetDataStartAddress());
@@ -21,6 +21,7 @@
 #include "src/objects/shared-function-info.h"
 #include "src/source-position.h"
 #include "src/zone/zone-chunk-list.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -880,15 +881,27 @@ class DeoptimizerData {
 
 class TranslationBuffer {
  public:
-  explicit TranslationBuffer(Zone* zone) : contents_(zone) {}
+  explicit TranslationBuffer(Zone* zone) : contents_(zone), dedup_map_(zone) {}
 
   int CurrentIndex() const { return static_cast<int>(contents_.size()); }
   void Add(int32_t value);
 
+  // Called when the translation that started at {index} is complete. If an
+  // identical byte sequence was recorded before, the new bytes are dropped
+  // and the index of the earlier copy is returned instead. Inlining-heavy
+  // code produces many identical translations (e.g. several eager checks at
+  // the same bytecode position), so sharing them significantly shrinks the
+  // deoptimization data attached to the code object.
+  int FinishTranslation(int index);
+
   Handle<ByteArray> CreateByteArray(Factory* factory);
 
  private:
+  bool RangeEquals(int index, int other_index, int length) const;
+
   ZoneChunkList<uint8_t> contents_;
+  // Maps a hash of a translation's byte sequence to its (index, length).
+  ZoneUnorderedMap<uint32_t, std::pair<int, int>> dedup_map_;
 };
 
 class TranslationIterator {
@@ -957,6 +970,11 @@ class Translation {
 
   int index() const { return index_; }
 
+  // Completes the translation and returns the index at which it can be found
+  // in the buffer, which is the index of an earlier identical translation if
+  // the buffer deduplicated this one. No commands may be added afterwards.
+  int Finish() { return buffer_->FinishTranslation(index_); }
+
   // Commands.
   void BeginInterpretedFrame(BailoutId bytecode_offset, int literal_id,
                              unsigned height, int return_value_offset,
@@ -2350,11 +2350,13 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
           // similar operation for result.
           auto elements = FixedDoubleArray::cast(receiver->elements());
 
+          // The hole is encoded as a NaN representation and the search value
+          // is not NaN, so hole slots can never compare equal; comparing the
+          // raw double directly avoids a per-element hole check.
           for (uint32_t k = start_from; k < length; ++k) {
-            if (elements->is_the_hole(k)) {
-              continue;
-            }
-            if (elements->get_scalar(k) == search_value) return Just(true);
+            double element_k =
+                bit_cast<double>(elements->get_representation(k));
+            if (element_k == search_value) return Just(true);
           }
           return Just(false);
         } else {
@@ -2363,6 +2365,15 @@ class FastElementsAccessor : public ElementsAccessorBase<Subclass, KindTraits> {
           // and trust UCOMISD or similar operation for result
           auto elements = FixedArray::cast(receiver->elements());
 
+          // In Smi elements kinds a Smi search value can be matched by word
+          // equality on the raw tagged slots, as in IndexOfValueImpl.
+          if (value->IsSmi() && IsSmiElementsKind(Subclass::kind())) {
+            ObjectSlot slot = elements->data_start() + start_from;
+            for (uint32_t k = start_from; k < length; ++k, ++slot) {
+              if (*slot == value) return Just(true);
+            }
+            return Just(false);
+          }
           for (uint32_t k = start_from; k < length; ++k) {
             Object* element_k = elements->get(k);
             if (element_k->IsNumber() && element_k->Number() == search_value) {
@@ -2631,6 +2642,18 @@ class FastSmiOrObjectElementsAccessor
     // elements->get(k) can return the hole, for which the StrictEquals will
     // always fail.
     FixedArray* elements = FixedArray::cast(receiver->elements());
+
+    // In Smi elements kinds every element is either a Smi or the hole, so
+    // strict equality against a Smi search value reduces to word equality on
+    // the tagged slot. Scanning the raw slots avoids the StrictEquals
+    // dispatch per element; the hole never compares equal to a Smi.
+    if (value->IsSmi() && IsSmiElementsKind(Subclass::kind())) {
+      ObjectSlot slot = elements->data_start() + start_from;
+      for (uint32_t k = start_from; k < length; ++k, ++slot) {
+        if (*slot == value) return Just<int64_t>(k);
+      }
+      return Just<int64_t>(-1);
+    }
     for (uint32_t k = start_from; k < length; ++k) {
       if (value->StrictEquals(elements->get(k))) return Just<int64_t>(k);
     }
@@ -2791,16 +2814,45 @@ class FastDoubleElementsAccessor
     double numeric_search_value = value->Number();
     FixedDoubleArray* elements = FixedDoubleArray::cast(receiver->elements());
 
+    // The hole is encoded as a NaN representation and the search value is not
+    // NaN at this point, so hole slots can never compare equal; comparing the
+    // raw double directly avoids a per-element hole check. get_scalar() is
+    // not used since it is not applicable to holes.
     for (uint32_t k = start_from; k < length; ++k) {
-      if (elements->is_the_hole(k)) {
-        continue;
-      }
-      if (elements->get_scalar(k) == numeric_search_value) {
+      double element_k = bit_cast<double>(elements->get_representation(k));
+      if (element_k == numeric_search_value) {
         return Just<int64_t>(k);
       }
     }
     return Just<int64_t>(-1);
   }
+
+  static Object* FillImpl(Handle<JSObject> receiver, Handle<Object> obj_value,
+                          uint32_t start, uint32_t end) {
+    // Ensure indexes are within array bounds
+    DCHECK_LE(0, start);
+    DCHECK_LE(start, end);
+
+    // Make sure we have enough space.
+    uint32_t capacity =
+        Subclass::GetCapacityImpl(*receiver, receiver->elements());
+    if (end > capacity) {
+      Subclass::GrowCapacityAndConvertImpl(receiver, end);
+      CHECK_EQ(Subclass::kind(), receiver->GetElementsKind());
+    }
+    DCHECK_LE(end, Subclass::GetCapacityImpl(*receiver, receiver->elements()));
+
+    // Convert the value to a double once instead of per element; the raw
+    // double stores need no write barrier, so the loop is a plain memory
+    // fill that the compiler can vectorize.
+    double numeric_value = obj_value->Number();
+    DisallowHeapAllocation no_gc;
+    FixedDoubleArray* elements = FixedDoubleArray::cast(receiver->elements());
+    for (uint32_t index = start; index < end; ++index) {
+      elements->set(index, numeric_value);
+    }
+    return *receiver;
+  }
 };
 
 class FastPackedDoubleElementsAccessor
@@ -95,10 +95,12 @@ int FeedbackMetadata::GetSlotSize(FeedbackSlotKind kind) {
 ACCESSORS(FeedbackVector, shared_function_info, SharedFunctionInfo,
           kSharedFunctionInfoOffset)
 WEAK_ACCESSORS(FeedbackVector, optimized_code_weak_or_smi, kOptimizedCodeOffset)
+WEAK_ACCESSORS(FeedbackVector, osr_code_weak_or_smi, kOsrCodeOffset)
 INT32_ACCESSORS(FeedbackVector, length, kLengthOffset)
 INT32_ACCESSORS(FeedbackVector, invocation_count, kInvocationCountOffset)
 INT32_ACCESSORS(FeedbackVector, profiler_ticks, kProfilerTicksOffset)
 INT32_ACCESSORS(FeedbackVector, deopt_count, kDeoptCountOffset)
+INT32_ACCESSORS(FeedbackVector, osr_bailout_id, kOsrBailoutIdOffset)
 
 bool FeedbackVector::is_empty() const { return length() == 0; }
 
@@ -133,6 +135,19 @@ bool FeedbackVector::has_optimized_code() const {
   return !optimized_code().is_null();
 }
 
+Code FeedbackVector::osr_code(BailoutId osr_offset) const {
+  if (osr_bailout_id() != osr_offset.ToInt()) return Code();
+  MaybeObject slot = osr_code_weak_or_smi();
+  DCHECK(slot->IsSmi() || slot->IsWeakOrCleared());
+  HeapObject* heap_object;
+  return slot->GetHeapObject(&heap_object) ? Code::cast(heap_object) : Code();
+}
+
+bool FeedbackVector::has_osr_code() const {
+  return osr_code_weak_or_smi()->IsWeakOrCleared() &&
+         !osr_code_weak_or_smi()->IsCleared();
+}
+
 bool FeedbackVector::has_optimization_marker() const {
   return optimization_marker() != OptimizationMarker::kLogFirstExecution &&
          optimization_marker() != OptimizationMarker::kNone;
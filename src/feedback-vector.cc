@@ -217,9 +217,11 @@ Handle<FeedbackVector> FeedbackVector::New(Isolate* isolate,
       MaybeObject::FromSmi(Smi::FromEnum(
           FLAG_log_function_events ? OptimizationMarker::kLogFirstExecution
                                    : OptimizationMarker::kNone)));
+  DCHECK_EQ(vector->osr_code_weak_or_smi(), MaybeObject::FromSmi(Smi::kZero));
   DCHECK_EQ(vector->invocation_count(), 0);
   DCHECK_EQ(vector->profiler_ticks(), 0);
   DCHECK_EQ(vector->deopt_count(), 0);
+  DCHECK_EQ(vector->osr_bailout_id(), BailoutId::None().ToInt());
 
   // Ensure we can skip the write barrier
   Handle<Object> uninitialized_sentinel = UninitializedSentinel(isolate);
@@ -316,6 +318,22 @@ void FeedbackVector::ClearOptimizedCode() {
   SetOptimizationMarker(OptimizationMarker::kNone);
 }
 
+// static
+void FeedbackVector::SetOsrCode(Handle<FeedbackVector> vector,
+                                BailoutId osr_offset, Handle<Code> code) {
+  DCHECK_EQ(code->kind(), Code::OPTIMIZED_FUNCTION);
+  DCHECK(!osr_offset.IsNone());
+  // The cache holds the most recent OSR compilation only; a new entry for a
+  // different loop simply replaces the old one.
+  vector->set_osr_bailout_id(osr_offset.ToInt());
+  vector->set_osr_code_weak_or_smi(HeapObjectReference::Weak(*code));
+}
+
+void FeedbackVector::ClearOsrCode() {
+  set_osr_bailout_id(BailoutId::None().ToInt());
+  set_osr_code_weak_or_smi(MaybeObject::FromSmi(Smi::kZero));
+}
+
 void FeedbackVector::ClearOptimizationMarker() {
   DCHECK(!has_optimized_code());
   SetOptimizationMarker(OptimizationMarker::kNone);
@@ -327,6 +345,28 @@ void FeedbackVector::SetOptimizationMarker(OptimizationMarker marker) {
 
 void FeedbackVector::EvictOptimizedCodeMarkedForDeoptimization(
     SharedFunctionInfo* shared, const char* reason) {
+  MaybeObject osr_slot = osr_code_weak_or_smi();
+  if (!osr_slot->IsSmi()) {
+    if (osr_slot->IsCleared()) {
+      ClearOsrCode();
+    } else {
+      Code osr_code = Code::cast(osr_slot->GetHeapObject());
+      if (osr_code->marked_for_deoptimization()) {
+        if (FLAG_trace_deopt) {
+          PrintF("[evicting OSR code marked for deoptimization (%s) for ",
+                 reason);
+          shared->ShortPrint();
+          PrintF("]\n");
+        }
+        if (!osr_code->deopt_already_counted()) {
+          increment_deopt_count();
+          osr_code->set_deopt_already_counted(true);
+        }
+        ClearOsrCode();
+      }
+    }
+  }
+
   MaybeObject slot = optimized_code_weak_or_smi();
   if (slot->IsSmi()) {
     return;
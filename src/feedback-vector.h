@@ -15,6 +15,7 @@
 #include "src/objects/name.h"
 #include "src/objects/object-macros.h"
 #include "src/type-hints.h"
+#include "src/utils.h"
 #include "src/zone/zone-containers.h"
 
 namespace v8 {
@@ -163,8 +164,26 @@ class FeedbackVector : public HeapObject, public NeverReadOnlySpaceObject {
 
   // [optimized_code_weak_or_smi]: weak reference to optimized code or a Smi
   // marker defining optimization behaviour.
+  //
+  // The feedback vector is deliberately the widest sound granularity for
+  // caching optimized code: every closure sharing this vector (same
+  // function literal, same native context) reuses the code via
+  // JSFunction's code installation path. Hoisting the cache up to the
+  // SharedFunctionInfo to share across native contexts - the old
+  // optimized-code-map design - is not sound in TurboFan's current
+  // compilation model, because the generated code embeds
+  // context-dependent heap constants: maps originating from the context's
+  // constructors, property cells of the context's global object, and the
+  // native context itself. Threading those in as parameters would turn
+  // the constants feedback-driven optimization relies on into loads,
+  // which is the optimization the cache exists to preserve.
   DECL_ACCESSORS2(optimized_code_weak_or_smi, MaybeObject)
 
+  // [osr_code_weak_or_smi]: weak reference to optimized code compiled for
+  // on-stack replacement, or the zero Smi if there is none. The entry bytecode
+  // offset the code was compiled for is kept in [osr_bailout_id].
+  DECL_ACCESSORS2(osr_code_weak_or_smi, MaybeObject)
+
   // [length]: The length of the feedback vector (not including the header, i.e.
   // the number of feedback slots).
   DECL_INT32_ACCESSORS(length)
@@ -179,6 +198,10 @@ class FeedbackVector : public HeapObject, public NeverReadOnlySpaceObject {
   // [deopt_count]: The number of times this function has deoptimized.
   DECL_INT32_ACCESSORS(deopt_count)
 
+  // [osr_bailout_id]: The entry bailout id the cached OSR code was compiled
+  // for, or BailoutId::None() if no OSR code is cached.
+  DECL_INT32_ACCESSORS(osr_bailout_id)
+
   inline void clear_invocation_count();
   inline void increment_deopt_count();
 
@@ -193,6 +216,15 @@ class FeedbackVector : public HeapObject, public NeverReadOnlySpaceObject {
                                Handle<Code> code);
   void SetOptimizationMarker(OptimizationMarker marker);
 
+  // Cache of the most recent OSR compilation, keyed by the osr entry bytecode
+  // offset. Avoids repeated OSR recompiles of hot loops that deoptimize on a
+  // rare path and then re-enter through the same loop header.
+  inline Code osr_code(BailoutId osr_offset) const;
+  inline bool has_osr_code() const;
+  static void SetOsrCode(Handle<FeedbackVector> vector, BailoutId osr_offset,
+                         Handle<Code> code);
+  void ClearOsrCode();
+
   // Clears the optimization marker in the feedback vector.
   void ClearOptimizationMarker();
 
@@ -279,10 +311,12 @@ class FeedbackVector : public HeapObject, public NeverReadOnlySpaceObject {
   /* Header fields. */                       \
   V(kSharedFunctionInfoOffset, kPointerSize) \
   V(kOptimizedCodeOffset, kPointerSize)      \
+  V(kOsrCodeOffset, kPointerSize)            \
   V(kLengthOffset, kInt32Size)               \
   V(kInvocationCountOffset, kInt32Size)      \
   V(kProfilerTicksOffset, kInt32Size)        \
   V(kDeoptCountOffset, kInt32Size)           \
+  V(kOsrBailoutIdOffset, kInt32Size)         \
   V(kUnalignedHeaderSize, 0)
 
   DEFINE_FIELD_OFFSET_CONSTANTS(HeapObject::kHeaderSize, FEEDBACK_VECTOR_FIELDS)
@@ -288,6 +288,9 @@ DEFINE_IMPLICATION(future, write_protect_code_memory)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(stable_allocation_site_pretenuring, false,
+            "only change allocation site tenuring decisions after several "
+            "consecutive GCs of consistent feedback")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
@@ -319,6 +322,11 @@ DEFINE_BOOL(enable_one_shot_optimization, true,
             "only be executed once")
 
 
+DEFINE_BOOL(flatten_bound_chains, true,
+            "flatten non-constructable bound function chains at bind time; "
+            "deviates from the spec if @@hasInstance is installed on an "
+            "intermediate bound function after it has been re-bound")
+
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
@@ -344,11 +352,18 @@ DEFINE_INT(interrupt_budget, 144 * KB,
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_compact_register_frame, false,
+            "renumber temporary registers to compact the interpreter frame")
+DEFINE_BOOL(ignition_superinstructions, false,
+            "fuse frequent bytecode pairs into single superinstructions")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(ignition_share_named_property_feedback, true,
             "share feedback slots when loading the same named property from "
             "the same object")
+DEFINE_BOOL(fast_literal_property_loads, true,
+            "load constant-shaped object literal properties at a fixed "
+            "in-object offset instead of through a LoadIC")
 DEFINE_BOOL(print_bytecode, false,
             "print bytecode generated by ignition interpreter")
 DEFINE_STRING(print_bytecode_filter, "*",
@@ -376,6 +391,9 @@ DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
 DEFINE_BOOL(trace_migration, false, "trace object migration")
 DEFINE_BOOL(trace_generalization, false, "trace map generalization")
+DEFINE_BOOL(batch_migrate_deprecated_maps, false,
+            "eagerly migrate instances of deprecated maps in a posted task "
+            "instead of lazily when each object is next accessed")
 
 // Flags for concurrent recompilation.
 DEFINE_BOOL(concurrent_recompilation, true,
@@ -384,6 +402,9 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_INT(concurrent_recompilation_context_quota, 0,
+           "the maximum number of concurrent compilation queue slots one "
+           "native context may occupy (0 disables the quota)")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -404,6 +425,11 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_BOOL(turbo_fast_regalloc, false,
+            "skip live range splintering for faster register allocation")
+DEFINE_INT(turbo_fast_regalloc_range_limit, 4096,
+           "maximum number of live ranges for which fast register allocation "
+           "is used")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_STRING(trace_turbo_path, nullptr,
@@ -418,6 +444,11 @@ DEFINE_STRING(trace_turbo_cfg_file, nullptr,
 DEFINE_BOOL(trace_turbo_types, true, "trace TurboFan's types")
 DEFINE_BOOL(trace_turbo_scheduler, false, "trace TurboFan's scheduler")
 DEFINE_BOOL(trace_turbo_reduction, false, "trace TurboFan's various reducers")
+DEFINE_BOOL(turbo_reducer_stats, false,
+            "print per-reducer call/change/time statistics after each graph "
+            "reduction")
+DEFINE_BOOL(turbo_batch_reductions, false,
+            "process graph reducer revisits in batches sorted by node id")
 DEFINE_BOOL(trace_turbo_trimming, false, "trace TurboFan's graph trimmer")
 DEFINE_BOOL(trace_turbo_jt, false, "trace TurboFan's jump threading")
 DEFINE_BOOL(trace_turbo_ceq, false, "trace TurboFan's control equivalence")
@@ -467,6 +498,9 @@ DEFINE_INT(max_inlined_bytecode_size_small, 30,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_inlining_frequency, 0.15, "minimum frequency for inlining")
 DEFINE_BOOL(polymorphic_inlining, true, "polymorphic inlining")
+DEFINE_INT(polymorphic_inlining_dominance, 90,
+           "percentage of profiled invocations a polymorphic call target must "
+           "receive to be inlined exclusively (0 disables)")
 DEFINE_BOOL(stress_inline, false,
             "set high thresholds for inlining to inline as much as possible")
 DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size, 999999)
@@ -496,12 +530,14 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_licm, false,
+            "hoist loop-invariant loads and bounds checks out of loops")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_loop_rotation, true, "Turbofan loop rotation")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
 DEFINE_BOOL(turbo_allocation_folding, true, "Turbofan allocation folding")
-DEFINE_BOOL(turbo_instruction_scheduling, false,
+DEFINE_BOOL(turbo_instruction_scheduling, true,
             "enable instruction scheduling in TurboFan")
 DEFINE_BOOL(turbo_stress_instruction_scheduling, false,
             "randomly schedule instructions to stress dependency tracking")
@@ -510,6 +546,8 @@ DEFINE_BOOL(turbo_store_elimination, true,
 DEFINE_BOOL(trace_store_elimination, false, "trace store elimination")
 DEFINE_BOOL(turbo_rewrite_far_jumps, true,
             "rewrite far to near jumps (ia32,x64)")
+DEFINE_BOOL(turbo_dedupe_translations, true,
+            "share identical deoptimization translations between deopt points")
 DEFINE_BOOL(experimental_inline_promise_constructor, true,
             "inline the Promise constructor in TurboFan")
 
@@ -530,6 +568,9 @@ DEFINE_BOOL(wasm_disable_structured_cloning, false,
             "disable wasm structured cloning")
 DEFINE_INT(wasm_num_compilation_tasks, 10,
            "number of parallel compilation tasks for wasm")
+DEFINE_UINT(wasm_compilation_batch_size, 8,
+            "maximum number of baseline compilation units a compilation task "
+            "claims at a time")
 DEFINE_DEBUG_BOOL(trace_wasm_native_heap, false,
                   "trace wasm native heap events")
 DEFINE_BOOL(wasm_write_protect_code_memory, false,
@@ -544,6 +585,9 @@ DEFINE_UINT(wasm_max_mem_pages, v8::internal::wasm::kV8MaxWasmMemoryPages,
             "maximum number of 64KiB memory pages of a wasm instance")
 DEFINE_UINT(wasm_max_table_size, v8::internal::wasm::kV8MaxWasmTableSize,
             "maximum table size of a wasm instance")
+DEFINE_UINT(wasm_guard_region_pool_size, 0,
+            "maximum number of released wasm memory guard region reservations "
+            "to pool for reuse (0 disables pooling)")
 // Enable Liftoff by default on ia32 and x64. More architectures will follow
 // once they are implemented and sufficiently tested.
 #if V8_TARGET_ARCH_IA32 || V8_TARGET_ARCH_X64
@@ -613,6 +657,9 @@ DEFINE_BOOL(wasm_no_bounds_checks, false,
 DEFINE_BOOL(wasm_no_stack_checks, false,
             "disable stack checks (performance testing only)")
 
+DEFINE_BOOL(wasm_native_module_cache, false,
+            "reuse compiled wasm modules with identical wire bytes within the "
+            "wasm engine")
 DEFINE_BOOL(wasm_shared_engine, true,
             "shares one wasm engine between all isolates within a process")
 DEFINE_IMPLICATION(future, wasm_shared_engine)
@@ -643,6 +690,11 @@ DEFINE_NEG_IMPLICATION(wasm_interpret_all, wasm_lazy_compilation)
 
 // Profiler flags.
 DEFINE_INT(frame_count, 1, "number of stack frames inspected by the profiler")
+DEFINE_BOOL(tierup_caller_boost, false,
+            "credit an extra profiler tick to the interpreted caller of a "
+            "small function that just became hot, so that inlining callers "
+            "tier up sooner")
+DEFINE_VALUE_IMPLICATION(tierup_caller_boost, frame_count, 2)
 DEFINE_INT(type_info_threshold, 25,
            "percentage of ICs that must have type info to allow optimization")
 
@@ -696,8 +748,18 @@ DEFINE_BOOL(trace_mutator_utilization, false,
 DEFINE_BOOL(incremental_marking, true, "use incremental marking")
 DEFINE_BOOL(incremental_marking_wrappers, true,
             "use incremental marking for marking wrappers")
+DEFINE_BOOL(predictive_marking_schedule, true,
+            "size incremental marking steps based on the measured allocation "
+            "throughput and over-mark during idle time")
 DEFINE_BOOL(trace_unmapper, false, "Trace the unmapping")
+DEFINE_BOOL(discard_pooled_pages, false,
+            "discard the memory of pooled pages with madvise instead of "
+            "decommitting it, avoiding the permission-change syscall pair on "
+            "every pool round-trip")
 DEFINE_BOOL(parallel_scavenge, true, "parallel scavenge")
+DEFINE_BOOL(scavenge_survival_promotion, false,
+            "use per-page survival history instead of only the age mark for "
+            "scavenger promotion decisions")
 DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 #if defined(V8_TARGET_ARCH_ARM) || defined(V8_TARGET_ARCH_ARM64)
 #define V8_WRITE_PROTECT_CODE_MEMORY_BOOL false
@@ -706,6 +768,12 @@ DEFINE_BOOL(trace_parallel_scavenge, false, "trace parallel scavenge")
 #endif
 DEFINE_BOOL(write_protect_code_memory, V8_WRITE_PROTECT_CODE_MEMORY_BOOL,
             "write protect code memory")
+DEFINE_BOOL(transparent_huge_pages, false,
+            "advise the OS to back code space and read-only space with "
+            "transparent huge pages to reduce iTLB misses (Linux only)")
+DEFINE_BOOL(mergeable_read_only_pages, false,
+            "advise the OS that sealed read-only heap pages may be "
+            "deduplicated across isolates (Linux with KSM only)")
 #ifdef V8_CONCURRENT_MARKING
 #define V8_CONCURRENT_MARKING_BOOL true
 #else
@@ -713,6 +781,9 @@ DEFINE_BOOL(write_protect_code_memory, V8_WRITE_PROTECT_CODE_MEMORY_BOOL,
 #endif
 DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
+DEFINE_BOOL(flush_bytecode, false,
+            "flush the bytecode of functions that have not been executed "
+            "recently, making them lazily recompile on their next call")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
 DEFINE_INT(ephemeron_fixpoint_iterations, 10,
            "number of fixpoint iterations it takes to switch to linear "
@@ -723,6 +794,8 @@ DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
+DEFINE_BOOL(parallel_object_stats, true,
+            "use parallel heap iteration for object stats collection")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
 DEFINE_BOOL(detect_ineffective_gcs_near_heap_limit, true,
@@ -735,11 +808,17 @@ DEFINE_BOOL(track_gc_object_stats, false,
             "track object counts and memory usage")
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
+DEFINE_BOOL(deduplicate_descriptor_arrays, false,
+            "merge content-identical descriptor arrays during full GC")
 DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
 DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
             "free array buffer allocations on a background thread")
+DEFINE_BOOL(array_buffer_pooling, false,
+            "recycle garbage array buffer backing stores through a bounded "
+            "engine-side pool instead of returning them to the embedder "
+            "allocator immediately")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_VALUE_IMPLICATION(track_gc_object_stats, gc_stats, 1)
@@ -767,6 +846,13 @@ DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_BOOL(gc_string_dedup, false,
+            "after every full GC, forward duplicate strings to their "
+            "internalized twin from the string table")
+DEFINE_INT(second_pass_callbacks_slice_ms, 0,
+           "time budget in milliseconds for one deferred task of embedder "
+           "second-pass weak callbacks; remaining callbacks are re-posted "
+           "(0 runs all pending callbacks in a single task)")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -794,6 +880,10 @@ DEFINE_INT(stress_scavenge, 0,
 DEFINE_IMPLICATION(fuzzer_gc_analysis, stress_marking)
 DEFINE_IMPLICATION(fuzzer_gc_analysis, stress_scavenge)
 
+DEFINE_BOOL(per_context_accounting, false,
+            "attribute sampled allocation bytes to the native context that is "
+            "entered at allocation time")
+
 DEFINE_BOOL(disable_abortjs, false, "disables AbortJS runtime function")
 
 DEFINE_BOOL(manual_evacuation_candidates_selection, false,
@@ -911,8 +1001,20 @@ DEFINE_BOOL(cache_prototype_transitions, true, "cache prototype transitions")
 
 // compiler-dispatcher.cc
 DEFINE_BOOL(parallel_compile_tasks, false, "enable parallel compile tasks")
+DEFINE_BOOL(parallel_parse_tasks, false,
+            "parse and compile lazy top-level functions on background threads "
+            "via the compiler dispatcher")
 DEFINE_BOOL(compiler_dispatcher, false, "enable compiler dispatcher")
 DEFINE_IMPLICATION(parallel_compile_tasks, compiler_dispatcher)
+DEFINE_IMPLICATION(parallel_parse_tasks, compiler_dispatcher)
+DEFINE_STRING(compile_hints, nullptr,
+              "file with script offsets of previously hot functions, as "
+              "written by --compile-hints-out; functions starting at these "
+              "offsets are parsed and compiled on the compiler dispatcher at "
+              "script compile time (enables the compiler dispatcher)")
+DEFINE_STRING(compile_hints_out, nullptr,
+              "file to append the script offsets of lazily compiled "
+              "functions to, for use with --compile-hints on a later run")
 DEFINE_BOOL(trace_compiler_dispatcher, false,
             "trace compiler dispatcher activity")
 
@@ -1059,6 +1161,9 @@ DEFINE_BOOL(runtime_call_stats, false, "report runtime call counts and times")
 DEFINE_INT(runtime_stats, 0,
            "internal usage only for controlling runtime statistics")
 DEFINE_VALUE_IMPLICATION(runtime_call_stats, runtime_stats, 1)
+DEFINE_BOOL(vm_state_times, false,
+            "accumulate wall-clock time per VM state, exposed through "
+            "v8::Isolate::GetTimeSpentInVMState")
 
 // snapshot-common.cc
 #ifdef V8_EMBEDDED_BUILTINS
@@ -1068,6 +1173,10 @@ DEFINE_VALUE_IMPLICATION(runtime_call_stats, runtime_stats, 1)
 #endif
 DEFINE_BOOL_READONLY(embedded_builtins, V8_EMBEDDED_BUILTINS_BOOL,
                      "Embed builtin code into the binary.")
+DEFINE_STRING(embedded_builtins_profile, nullptr,
+              "path to a file with one builtin name per line, hottest first; "
+              "mksnapshot lays these builtins out contiguously at the start "
+              "of the embedded blob to improve startup code locality")
 // TODO(jgruber,v8:6666): Remove once ia32 has full embedded builtin support.
 DEFINE_BOOL_READONLY(
     ia32_verify_root_register, false,
@@ -1078,6 +1187,9 @@ DEFINE_BOOL(serialization_statistics, false,
             "Collect statistics on serialized objects.")
 DEFINE_UINT(serialization_chunk_size, 4096,
             "Custom size for serialization chunks")
+DEFINE_BOOL(compress_code_cache, false,
+            "compress code cache payloads with zlib (requires a build with "
+            "v8_enable_snapshot_compression)")
 
 // JIT-less V8. Design doc: goo.gl/kRnhVe
 #ifdef V8_JITLESS_MODE
@@ -1090,6 +1202,14 @@ DEFINE_BOOL_READONLY(jitless, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 DEFINE_BOOL(regexp_mode_modifiers, false, "enable inline flags in regexp.")
+DEFINE_BOOL(regexp_tier_up, false,
+            "interpret new regexps and only compile them to native code once "
+            "they have run hot")
+DEFINE_INT(regexp_tier_up_ticks, 8,
+           "number of executions of an interpreted regexp before it is "
+           "compiled to native code")
+DEFINE_BOOL(regexp_shared_cache, false,
+            "share compiled regexp bytecode between isolates")
 
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
@@ -1119,6 +1239,13 @@ DEFINE_BOOL(minor_mc_parallel_marking, true,
 DEFINE_BOOL(trace_minor_mc_parallel_marking, false,
             "trace parallel marking for the young generation")
 DEFINE_BOOL(minor_mc, false, "perform young generation mark compact GCs")
+DEFINE_BOOL(minor_mc_auto, false,
+            "choose between scavenge and minor mark compact per GC based on "
+            "recorded survival rates")
+DEFINE_IMPLICATION(minor_mc_auto, minor_mc)
+DEFINE_INT(minor_mc_auto_survival_threshold, 70,
+           "average survival percentage above which minor mark compact is "
+           "preferred over scavenging with --minor-mc-auto")
 #endif  // ENABLE_MINOR_MC
 
 //
@@ -1304,6 +1431,10 @@ DEFINE_NEG_IMPLICATION(perf_basic_prof, compact_code_space)
 DEFINE_BOOL(perf_basic_prof_only_functions, false,
             "Only report function code ranges to perf (i.e. no stubs).")
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
+DEFINE_BOOL(perf_basic_prof_async, false,
+            "Write perf map entries on a dedicated writer thread instead of "
+            "the thread that generated the code.")
+DEFINE_IMPLICATION(perf_basic_prof_async, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
 DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
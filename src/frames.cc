@@ -175,16 +175,10 @@ namespace {
 
 bool IsInterpreterFramePc(Isolate* isolate, Address pc,
                           StackFrame::State* state) {
-  Code interpreter_entry_trampoline =
-      isolate->builtins()->builtin(Builtins::kInterpreterEntryTrampoline);
-  Code interpreter_bytecode_advance =
-      isolate->builtins()->builtin(Builtins::kInterpreterEnterBytecodeAdvance);
-  Code interpreter_bytecode_dispatch =
-      isolate->builtins()->builtin(Builtins::kInterpreterEnterBytecodeDispatch);
-
-  if (interpreter_entry_trampoline->contains(pc) ||
-      interpreter_bytecode_advance->contains(pc) ||
-      interpreter_bytecode_dispatch->contains(pc)) {
+  // This runs for every frame of every profiler tick, so consult the pc
+  // ranges cached on the isolate instead of re-deriving the interpreter
+  // dispatch builtins and their instruction ranges from the heap here.
+  if (isolate->IsInterpreterBuiltinPc(pc)) {
     return true;
   } else if (FLAG_interpreted_frames_native_stack) {
     intptr_t marker = Memory<intptr_t>(
@@ -200,7 +194,7 @@ bool IsInterpreterFramePc(Isolate* isolate, Address pc,
     } else if (!isolate->heap()->code_space()->ContainsSlow(pc)) {
       return false;
     }
-    interpreter_entry_trampoline =
+    Code interpreter_entry_trampoline =
         isolate->heap()->GcSafeFindCodeForInnerPointer(pc);
     return interpreter_entry_trampoline->is_interpreter_trampoline_builtin();
   } else {
@@ -1360,8 +1354,9 @@ int FrameSummary::WasmCompiledFrameSummary::GetWasmSourcePosition(
   int position = 0;
   // Subtract one because the current PC is one instruction after the call site.
   offset--;
-  for (SourcePositionTableIterator iterator(code->source_positions());
-       !iterator.done() && iterator.code_offset() <= offset;
+  SourcePositionTableIterator iterator(code->source_positions());
+  iterator.SeekForward(offset);
+  for (; !iterator.done() && iterator.code_offset() <= offset;
        iterator.Advance()) {
     position = iterator.source_position().ScriptOffset();
   }
@@ -41,37 +41,42 @@ void FutexWaitListNode::NotifyWake() {
 }
 
 
-FutexWaitList::FutexWaitList() : head_(nullptr), tail_(nullptr) {}
+FutexWaitList::FutexWaitList() = default;
 
 
 void FutexWaitList::AddNode(FutexWaitListNode* node) {
   DCHECK(node->prev_ == nullptr && node->next_ == nullptr);
-  if (tail_) {
-    tail_->next_ = node;
+  Bucket& bucket = buckets_[BucketKey(node->backing_store_, node->wait_addr_)];
+  if (bucket.tail) {
+    bucket.tail->next_ = node;
   } else {
-    head_ = node;
+    bucket.head = node;
   }
 
-  node->prev_ = tail_;
+  node->prev_ = bucket.tail;
   node->next_ = nullptr;
-  tail_ = node;
+  bucket.tail = node;
 }
 
 
 void FutexWaitList::RemoveNode(FutexWaitListNode* node) {
+  auto it = buckets_.find(BucketKey(node->backing_store_, node->wait_addr_));
+  DCHECK(it != buckets_.end());
+  Bucket& bucket = it->second;
   if (node->prev_) {
     node->prev_->next_ = node->next_;
   } else {
-    head_ = node->next_;
+    bucket.head = node->next_;
   }
 
   if (node->next_) {
     node->next_->prev_ = node->prev_;
   } else {
-    tail_ = node->prev_;
+    bucket.tail = node->prev_;
   }
 
   node->prev_ = node->next_ = nullptr;
+  if (bucket.head == nullptr) buckets_.erase(it);
 }
 
 void AtomicsWaitWakeHandle::Wake() {
@@ -266,8 +271,14 @@ Object* FutexEmulation::Wake(Handle<JSArrayBuffer> array_buffer, size_t addr,
   void* backing_store = array_buffer->backing_store();
 
   base::MutexGuard lock_guard(mutex_.Pointer());
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitList* wait_list = wait_list_.Pointer();
+  auto it = wait_list->buckets_.find(
+      FutexWaitList::BucketKey(backing_store, addr));
+  FutexWaitListNode* node =
+      it != wait_list->buckets_.end() ? it->second.head : nullptr;
   while (node && num_waiters_to_wake > 0) {
+    // Hash collisions can put waiters on other addresses into this bucket, so
+    // the exact match still has to be checked per node.
     if (backing_store == node->backing_store_ && addr == node->wait_addr_) {
       node->waiting_ = false;
       node->cond_.NotifyOne();
@@ -291,7 +302,11 @@ Object* FutexEmulation::NumWaitersForTesting(Handle<JSArrayBuffer> array_buffer,
   base::MutexGuard lock_guard(mutex_.Pointer());
 
   int waiters = 0;
-  FutexWaitListNode* node = wait_list_.Pointer()->head_;
+  FutexWaitList* wait_list = wait_list_.Pointer();
+  auto it = wait_list->buckets_.find(
+      FutexWaitList::BucketKey(backing_store, addr));
+  FutexWaitListNode* node =
+      it != wait_list->buckets_.end() ? it->second.head : nullptr;
   while (node) {
     if (backing_store == node->backing_store_ && addr == node->wait_addr_ &&
         node->waiting_) {
@@ -7,8 +7,11 @@
 
 #include <stdint.h>
 
+#include <unordered_map>
+
 #include "src/allocation.h"
 #include "src/base/atomicops.h"
+#include "src/base/functional.h"
 #include "src/base/lazy-instance.h"
 #include "src/base/macros.h"
 #include "src/base/platform/condition-variable.h"
@@ -90,8 +93,21 @@ class FutexWaitList {
  private:
   friend class FutexEmulation;
 
-  FutexWaitListNode* head_;
-  FutexWaitListNode* tail_;
+  // Nodes waiting on the same (backing store, address) pair hash to the same
+  // bucket and are linked there in FIFO order. Waking one address then only
+  // walks its own bucket instead of every waiter in the process. Different
+  // addresses may collide in a bucket, so bucket walks still have to compare
+  // the backing store and address of each node.
+  struct Bucket {
+    FutexWaitListNode* head = nullptr;
+    FutexWaitListNode* tail = nullptr;
+  };
+
+  static size_t BucketKey(void* backing_store, size_t wait_addr) {
+    return base::hash_combine(backing_store, wait_addr);
+  }
+
+  std::unordered_map<size_t, Bucket> buckets_;
 
   DISALLOW_COPY_AND_ASSIGN(FutexWaitList);
 };
@@ -146,7 +162,11 @@ class FutexEmulation : public AllStatic {
   // added or removed without holding this mutex), as well as the `waiting_`
   // and `interrupted_` fields for each individual list node that is currently
   // part of the list. It must be the mutex used together with the `cond_`
-  // condition variable of such nodes.
+  // condition variable of such nodes. The mutex deliberately stays global even
+  // though the list is bucketed per address: `NotifyWake` can fire from the
+  // interrupt path at any time, including while the owning thread is rewriting
+  // the node's address fields at the top of `Wait`, so there is no moment at
+  // which a per-bucket lock for the node could be determined safely.
   static base::LazyMutex mutex_;
   static base::LazyInstance<FutexWaitList>::type wait_list_;
 };
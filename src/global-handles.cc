@@ -5,6 +5,7 @@
 #include "src/global-handles.h"
 
 #include "src/api-inl.h"
+#include "src/base/bits.h"
 #include "src/cancelable-task.h"
 #include "src/objects-inl.h"
 #include "src/objects/slots.h"
@@ -383,13 +384,17 @@ class GlobalHandles::Node {
 class GlobalHandles::NodeBlock {
  public:
   static const int kSize = 256;
+  static const int kBitsPerWord = 32;
+  static const int kBitmapWords = kSize / kBitsPerWord;
 
   explicit NodeBlock(GlobalHandles* global_handles, NodeBlock* next)
       : next_(next),
         used_nodes_(0),
         next_used_(nullptr),
         prev_used_(nullptr),
-        global_handles_(global_handles) {}
+        global_handles_(global_handles) {
+    memset(used_bitmap_, 0, sizeof(used_bitmap_));
+  }
 
   void PutNodesOnFreeList(Node** first_free) {
     for (int i = kSize - 1; i >= 0; --i) {
@@ -425,6 +430,23 @@ class GlobalHandles::NodeBlock {
     }
   }
 
+  // The used bitmap has one bit per slot, so that iteration can skip free
+  // slots without touching their cache lines. It tracks allocation state, not
+  // any particular node state: a set bit means the node is not on the free
+  // list.
+  void MarkUsed(int index) {
+    used_bitmap_[index / kBitsPerWord] |= 1u << (index % kBitsPerWord);
+  }
+
+  void MarkUnused(int index) {
+    used_bitmap_[index / kBitsPerWord] &= ~(1u << (index % kBitsPerWord));
+  }
+
+  uint32_t used_bits(int word) const {
+    DCHECK(0 <= word && word < kBitmapWords);
+    return used_bitmap_[word];
+  }
+
   GlobalHandles* global_handles() { return global_handles_; }
 
   // Next block in the list of all blocks.
@@ -437,6 +459,7 @@ class GlobalHandles::NodeBlock {
  private:
   Node nodes_[kSize];
   NodeBlock* const next_;
+  uint32_t used_bitmap_[kBitmapWords];
   int used_nodes_;
   NodeBlock* next_used_;
   NodeBlock* prev_used_;
@@ -460,6 +483,7 @@ GlobalHandles::NodeBlock* GlobalHandles::Node::FindBlock() {
 
 void GlobalHandles::Node::IncreaseBlockUses() {
   NodeBlock* node_block = FindBlock();
+  node_block->MarkUsed(index_);
   node_block->IncreaseUses();
   GlobalHandles* global_handles = node_block->global_handles();
   global_handles->isolate()->counters()->global_handles()->Increment();
@@ -472,35 +496,54 @@ void GlobalHandles::Node::DecreaseBlockUses() {
   GlobalHandles* global_handles = node_block->global_handles();
   data_.next_free = global_handles->first_free_;
   global_handles->first_free_ = this;
+  node_block->MarkUnused(index_);
   node_block->DecreaseUses();
   global_handles->isolate()->counters()->global_handles()->Decrement();
   global_handles->number_of_global_handles_--;
 }
 
 
+// Iterates over the used nodes of all blocks on the used-block list, walking
+// the per-block used bitmaps so that free slots are never touched.
 class GlobalHandles::NodeIterator {
  public:
   explicit NodeIterator(GlobalHandles* global_handles)
-      : block_(global_handles->first_used_block_),
-        index_(0) {}
+      : block_(global_handles->first_used_block_) {
+    if (block_ != nullptr) {
+      bits_ = block_->used_bits(0);
+      SkipUnusedSlots();
+    }
+  }
 
   bool done() const { return block_ == nullptr; }
 
   Node* node() const {
     DCHECK(!done());
-    return block_->node_at(index_);
+    return block_->node_at(word_ * NodeBlock::kBitsPerWord +
+                           base::bits::CountTrailingZeros(bits_));
   }
 
   void Advance() {
     DCHECK(!done());
-    if (++index_ < NodeBlock::kSize) return;
-    index_ = 0;
-    block_ = block_->next_used();
+    bits_ &= bits_ - 1;  // Clear the lowest set bit.
+    SkipUnusedSlots();
   }
 
  private:
+  void SkipUnusedSlots() {
+    while (bits_ == 0) {
+      if (++word_ == NodeBlock::kBitmapWords) {
+        word_ = 0;
+        block_ = block_->next_used();
+        if (block_ == nullptr) return;
+      }
+      bits_ = block_->used_bits(word_);
+    }
+  }
+
   NodeBlock* block_;
-  int index_;
+  int word_ = 0;
+  uint32_t bits_ = 0;
 
   DISALLOW_COPY_AND_ASSIGN(NodeIterator);
 };
@@ -736,9 +779,29 @@ void GlobalHandles::InvokeSecondPassPhantomCallbacksFromTask() {
   TRACE_EVENT0("v8", "V8.GCPhantomHandleProcessingCallback");
   isolate()->heap()->CallGCPrologueCallbacks(
       GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
-  InvokeSecondPassPhantomCallbacks();
+  if (FLAG_second_pass_callbacks_slice_ms > 0) {
+    // Process only one time slice of callbacks per task, so embedders with
+    // very many weak wrappers do not stall the main thread on one long
+    // finalization burst; the remainder is handled by a follow-up task.
+    double deadline_ms =
+        isolate()->heap()->MonotonicallyIncreasingTimeInMs() +
+        FLAG_second_pass_callbacks_slice_ms;
+    while (!second_pass_callbacks_.empty() &&
+           isolate()->heap()->MonotonicallyIncreasingTimeInMs() <
+               deadline_ms) {
+      auto callback = second_pass_callbacks_.back();
+      second_pass_callbacks_.pop_back();
+      DCHECK_NULL(callback.node());
+      callback.Invoke(isolate());
+    }
+  } else {
+    InvokeSecondPassPhantomCallbacks();
+  }
   isolate()->heap()->CallGCEpilogueCallbacks(
       GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
+  if (!second_pass_callbacks_.empty()) {
+    ScheduleSecondPassPhantomCallbacksTask();
+  }
 }
 
 void GlobalHandles::InvokeSecondPassPhantomCallbacks() {
@@ -861,15 +924,20 @@ void GlobalHandles::InvokeOrScheduleSecondPassPhantomCallbacks(
       isolate()->heap()->CallGCEpilogueCallbacks(
           GCType::kGCTypeProcessWeakCallbacks, kNoGCCallbackFlags);
     } else if (!second_pass_callbacks_task_posted_) {
-      second_pass_callbacks_task_posted_ = true;
-      auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
-          reinterpret_cast<v8::Isolate*>(isolate()));
-      taskrunner->PostTask(MakeCancelableTask(
-          isolate(), [this] { InvokeSecondPassPhantomCallbacksFromTask(); }));
+      ScheduleSecondPassPhantomCallbacksTask();
     }
   }
 }
 
+void GlobalHandles::ScheduleSecondPassPhantomCallbacksTask() {
+  DCHECK(!second_pass_callbacks_task_posted_);
+  second_pass_callbacks_task_posted_ = true;
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate()));
+  taskrunner->PostTask(MakeCancelableTask(
+      isolate(), [this] { InvokeSecondPassPhantomCallbacksFromTask(); }));
+}
+
 void GlobalHandles::PendingPhantomCallback::Invoke(Isolate* isolate) {
   Data::Callback* callback_addr = nullptr;
   if (node_ != nullptr) {
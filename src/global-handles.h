@@ -193,6 +193,7 @@ class GlobalHandles {
   explicit GlobalHandles(Isolate* isolate);
 
   void InvokeSecondPassPhantomCallbacksFromTask();
+  void ScheduleSecondPassPhantomCallbacksTask();
   int PostScavengeProcessing(int initial_post_gc_processing_count);
   int PostMarkSweepProcessing(int initial_post_gc_processing_count);
   void InvokeOrScheduleSecondPassPhantomCallbacks(bool synchronous_second_pass);
@@ -102,6 +102,35 @@ void HandleScope::DeleteExtensions(Isolate* isolate) {
   isolate->handle_scope_implementer()->DeleteExtensions(current->limit);
 }
 
+Address* HandleScope::CreateHandles(Isolate* isolate, FixedArray* array,
+                                    int count) {
+  DCHECK_LE(0, count);
+  DCHECK_LE(count, array->length());
+  DCHECK_LE(count, kHandleBlockSize);
+  HandleScopeData* data = isolate->handle_scope_data();
+  while (static_cast<int>(data->limit - data->next) < count) {
+    // Not enough room for a consecutive batch: fill the remainder of the
+    // block with Smi zero (full blocks are visited in their entirety by
+    // the GC) and extend the scope.
+    for (Address* slot = data->next; slot < data->limit; slot++) {
+      *slot = kNullAddress;
+    }
+    data->next = data->limit;
+    Address* block = Extend(isolate);
+    if (block == nullptr) return nullptr;
+    data->next = block;
+  }
+  Address* result = data->next;
+  {
+    DisallowHeapAllocation no_gc;
+    for (int i = 0; i < count; i++) {
+      result[i] = reinterpret_cast<Address>(array->get(i));
+    }
+  }
+  data->next = result + count;
+  return result;
+}
+
 
 #ifdef ENABLE_HANDLE_ZAPPING
 void HandleScope::ZapRange(Address* start, Address* end) {
@@ -25,6 +25,7 @@ namespace internal {
 
 // Forward declarations.
 class DeferredHandles;
+class FixedArray;
 class HandleScopeImplementer;
 class Isolate;
 template <typename T>
@@ -244,6 +245,14 @@ class HandleScope {
   // Creates a new handle with the given value.
   V8_INLINE static Address* CreateHandle(Isolate* isolate, Address value);
 
+  // Creates handles for the first {count} elements of {array} in bulk,
+  // paying the scope bounds check once instead of once per element. The
+  // handle locations are consecutive, so {count} must not exceed the size
+  // of one handle block. Returns the location of the first handle.
+  V8_EXPORT_PRIVATE static Address* CreateHandles(Isolate* isolate,
+                                                  FixedArray* array,
+                                                  int count);
+
   // Deallocates any extensions used by the current scope.
   V8_EXPORT_PRIVATE static void DeleteExtensions(Isolate* isolate);
 
@@ -303,6 +303,7 @@
   V(_, console_context_name_symbol)         \
   V(_, class_fields_symbol)                 \
   V(_, class_positions_symbol)              \
+  V(_, clone_object_transition_symbol)      \
   V(_, detailed_stack_trace_symbol)         \
   V(_, elements_transition_symbol)          \
   V(_, error_end_pos_symbol)                \
@@ -16,8 +16,14 @@ namespace internal {
 namespace {
 
 void FreeAllocationsHelper(
-    Heap* heap, const std::vector<JSArrayBuffer::Allocation>& allocations) {
+    Heap* heap, const std::vector<JSArrayBuffer::Allocation>& allocations,
+    bool allow_pooling) {
+  ArrayBufferCollector* collector = heap->array_buffer_collector();
   for (JSArrayBuffer::Allocation alloc : allocations) {
+    if (allow_pooling && FLAG_array_buffer_pooling &&
+        collector->TryAddToPool(alloc)) {
+      continue;
+    }
     JSArrayBuffer::FreeBackingStore(heap->isolate(), alloc);
   }
 }
@@ -27,7 +33,9 @@ void FreeAllocationsHelper(
 void ArrayBufferCollector::QueueOrFreeGarbageAllocations(
     std::vector<JSArrayBuffer::Allocation> allocations) {
   if (heap_->ShouldReduceMemory()) {
-    FreeAllocationsHelper(heap_, allocations);
+    // Under memory pressure garbage backing stores go straight back to the
+    // embedder allocator instead of into the pool.
+    FreeAllocationsHelper(heap_, allocations, false);
   } else {
     base::MutexGuard guard(&allocations_mutex_);
     allocations_.push_back(std::move(allocations));
@@ -38,7 +46,7 @@ void ArrayBufferCollector::PerformFreeAllocations() {
   base::MutexGuard guard(&allocations_mutex_);
   for (const std::vector<JSArrayBuffer::Allocation>& allocations :
        allocations_) {
-    FreeAllocationsHelper(heap_, allocations);
+    FreeAllocationsHelper(heap_, allocations, true);
   }
   allocations_.clear();
 }
@@ -46,6 +54,7 @@ void ArrayBufferCollector::PerformFreeAllocations() {
 void ArrayBufferCollector::FreeAllocations() {
   // TODO(wez): Remove backing-store from external memory accounting.
   heap_->account_external_memory_concurrently_freed();
+  if (heap_->ShouldReduceMemory()) ClearPool();
   if (!heap_->IsTearingDown() && !heap_->ShouldReduceMemory() &&
       FLAG_concurrent_array_buffer_freeing) {
     V8::GetCurrentPlatform()->CallOnWorkerThread(
@@ -64,5 +73,41 @@ void ArrayBufferCollector::FreeAllocations() {
   }
 }
 
+void* ArrayBufferCollector::TryRemoveFromPool(size_t byte_length) {
+  base::MutexGuard guard(&pool_mutex_);
+  auto it = pool_.find(byte_length);
+  if (it == pool_.end() || it->second.empty()) return nullptr;
+  void* data = it->second.back();
+  it->second.pop_back();
+  pool_bytes_ -= byte_length;
+  return data;
+}
+
+bool ArrayBufferCollector::TryAddToPool(
+    const JSArrayBuffer::Allocation& allocation) {
+  // Only plain embedder-allocator memory where the backing store spans the
+  // whole allocation can be handed out again by SetupAllocatingData.
+  if (allocation.is_wasm_memory) return false;
+  if (allocation.backing_store != allocation.allocation_base) return false;
+  const size_t length = allocation.length;
+  if (length < kMinPooledLength || length > kMaxPooledLength) return false;
+  base::MutexGuard guard(&pool_mutex_);
+  if (pool_bytes_ + length > kMaxPoolBytes) return false;
+  pool_[length].push_back(allocation.allocation_base);
+  pool_bytes_ += length;
+  return true;
+}
+
+void ArrayBufferCollector::ClearPool() {
+  base::MutexGuard guard(&pool_mutex_);
+  for (const auto& bucket : pool_) {
+    for (void* data : bucket.second) {
+      heap_->isolate()->array_buffer_allocator()->Free(data, bucket.first);
+    }
+  }
+  pool_.clear();
+  pool_bytes_ = 0;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 #define V8_HEAP_ARRAY_BUFFER_COLLECTOR_H_
 
+#include <unordered_map>
 #include <vector>
 
 #include "src/base/platform/mutex.h"
@@ -23,7 +24,10 @@ class ArrayBufferCollector {
  public:
   explicit ArrayBufferCollector(Heap* heap) : heap_(heap) {}
 
-  ~ArrayBufferCollector() { PerformFreeAllocations(); }
+  ~ArrayBufferCollector() {
+    PerformFreeAllocations();
+    ClearPool();
+  }
 
   // These allocations will be either
   // - freed immediately when under memory pressure, or
@@ -36,9 +40,34 @@ class ArrayBufferCollector {
   // Calls FreeAllocations() on a background thread.
   void FreeAllocations();
 
+  // Backing store pool, enabled by --array-buffer-pooling. Garbage backing
+  // stores are retained in exact-size buckets instead of being returned to
+  // the embedder allocator, so that allocation-heavy workloads with uniform
+  // buffer sizes can recycle them. The pool is bounded and flushed under
+  // memory pressure and on tear down.
+
+  // Returns a pooled backing store of exactly {byte_length} bytes, or nullptr.
+  // The contents of the returned memory are unspecified.
+  void* TryRemoveFromPool(size_t byte_length);
+
+  // Takes ownership of the backing store of {allocation} if it is poolable
+  // and the pool has capacity left. Returns false if the caller must free the
+  // allocation itself.
+  bool TryAddToPool(const JSArrayBuffer::Allocation& allocation);
+
+  // Frees all pooled backing stores back to the embedder allocator.
+  void ClearPool();
+
  private:
   class FreeingTask;
 
+  // Limits for the backing store pool. Very small allocations are cheap to
+  // serve from the embedder allocator, and very large ones would make the
+  // retained-memory bound useless.
+  static const size_t kMinPooledLength = 4 * KB;
+  static const size_t kMaxPooledLength = MB;
+  static const size_t kMaxPoolBytes = 16 * MB;
+
   // Begin freeing the allocations added through QueueOrFreeGarbageAllocations.
   // Also called by TearDown.
   void PerformFreeAllocations();
@@ -46,6 +75,9 @@ class ArrayBufferCollector {
   Heap* const heap_;
   base::Mutex allocations_mutex_;
   std::vector<std::vector<JSArrayBuffer::Allocation>> allocations_;
+  base::Mutex pool_mutex_;
+  std::unordered_map<size_t, std::vector<void*>> pool_;
+  size_t pool_bytes_ = 0;
 };
 
 }  // namespace internal
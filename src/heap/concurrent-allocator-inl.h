@@ -0,0 +1,32 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
+#define V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
+
+#include "src/heap/concurrent-allocator.h"
+
+#include "src/heap/spaces-inl.h"
+
+namespace v8 {
+namespace internal {
+
+AllocationResult ConcurrentAllocator::AllocateRaw(
+    int object_size, AllocationAlignment alignment) {
+  return compaction_spaces_.Get(OLD_SPACE)->AllocateRaw(object_size,
+                                                        alignment);
+}
+
+void ConcurrentAllocator::FreeLast(HeapObject* object, int object_size) {
+  if (!compaction_spaces_.Get(OLD_SPACE)->TryFreeLast(object, object_size)) {
+    // We couldn't free the last object so we have to write a proper filler.
+    heap_->CreateFillerObjectAt(object->address(), object_size,
+                                ClearRecordedSlots::kNo);
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_ALLOCATOR_INL_H_
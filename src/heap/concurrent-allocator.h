@@ -0,0 +1,47 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONCURRENT_ALLOCATOR_H_
+#define V8_HEAP_CONCURRENT_ALLOCATOR_H_
+
+#include "src/globals.h"
+#include "src/heap/heap.h"
+#include "src/heap/spaces.h"
+
+namespace v8 {
+namespace internal {
+
+// Thread-local allocation buffer for old space that can be used from
+// background threads, e.g. for off-main-thread allocation of strings during
+// background compilation. Allocation is funneled through a thread-private
+// compaction space that acquires its pages from the memory allocator, which
+// is safe without any locks; see the evacuator for the analogous usage
+// pattern. Callers are responsible for keeping the GC from running while raw
+// pointers to allocated objects are held on the background thread.
+class ConcurrentAllocator {
+ public:
+  static const int kMaxLabObjectSize = 8 * KB;
+
+  explicit ConcurrentAllocator(Heap* heap)
+      : heap_(heap), compaction_spaces_(heap) {}
+
+  // Needs to be called from the main thread to merge the allocated memory
+  // back into old space.
+  void Finalize() {
+    heap_->old_space()->MergeCompactionSpace(compaction_spaces_.Get(OLD_SPACE));
+  }
+
+  inline AllocationResult AllocateRaw(int object_size,
+                                      AllocationAlignment alignment);
+  inline void FreeLast(HeapObject* object, int object_size);
+
+ private:
+  Heap* const heap_;
+  CompactionSpaceCollection compaction_spaces_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONCURRENT_ALLOCATOR_H_
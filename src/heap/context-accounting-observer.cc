@@ -0,0 +1,30 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/context-accounting-observer.h"
+
+#include "src/bootstrapper.h"
+#include "src/contexts.h"
+#include "src/heap/heap-inl.h"
+#include "src/isolate.h"
+
+namespace v8 {
+namespace internal {
+
+ContextAccountingObserver::ContextAccountingObserver(Heap& heap)
+    : AllocationObserver(kStepSize), heap_(heap) {}
+
+void ContextAccountingObserver::Step(int bytes_allocated, Address soon_object,
+                                     size_t size) {
+  Isolate* isolate = heap_.isolate();
+  // There is nobody to bill while no context is entered, and the counter
+  // slot is not initialized until bootstrapping has finished.
+  if (isolate->context() == nullptr) return;
+  if (isolate->bootstrapper()->IsActive()) return;
+  isolate->context()->native_context()->AddSampledAllocatedBytes(
+      bytes_allocated);
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,35 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_CONTEXT_ACCOUNTING_OBSERVER_H_
+#define V8_HEAP_CONTEXT_ACCOUNTING_OBSERVER_H_
+
+#include "src/heap/heap.h"
+
+namespace v8 {
+namespace internal {
+
+// Attributes sampled allocation bytes to the native context that is entered
+// at the time of allocation, so embedders can meter heap consumption per
+// context without taking a heap snapshot. Only installed when
+// --per-context-accounting is enabled.
+class ContextAccountingObserver : public AllocationObserver {
+ public:
+  explicit ContextAccountingObserver(Heap& heap);
+
+  void Step(int bytes_allocated, Address soon_object, size_t size) override;
+
+ private:
+  // Sampling interval. Coarse enough to keep the overhead of reading the
+  // current context off the allocation path negligible, fine enough that
+  // the per-context estimates converge quickly.
+  static const intptr_t kStepSize = 64 * KB;
+
+  Heap& heap_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_CONTEXT_ACCOUNTING_OBSERVER_H_
@@ -4,6 +4,8 @@
 
 #include "src/heap/embedder-tracing.h"
 
+#include <algorithm>
+
 #include "src/base/logging.h"
 
 namespace v8 {
@@ -53,7 +55,21 @@ void LocalEmbedderHeapTracer::RegisterWrappersWithRemoteTracer() {
     return;
   }
 
-  remote_tracer_->RegisterV8References(cached_wrappers_to_trace_);
+  if (cached_wrappers_to_trace_.size() <= kWrapperBatchSize) {
+    remote_tracer_->RegisterV8References(cached_wrappers_to_trace_);
+  } else {
+    // Deliver over-sized caches (e.g. after deserialization) in bounded
+    // slices so the embedder never sees an unbounded burst.
+    WrapperCache batch;
+    for (size_t i = 0; i < cached_wrappers_to_trace_.size();
+         i += kWrapperBatchSize) {
+      const size_t batch_size =
+          std::min(kWrapperBatchSize, cached_wrappers_to_trace_.size() - i);
+      batch.assign(cached_wrappers_to_trace_.begin() + i,
+                   cached_wrappers_to_trace_.begin() + i + batch_size);
+      remote_tracer_->RegisterV8References(batch);
+    }
+  }
   cached_wrappers_to_trace_.clear();
 }
 
@@ -55,6 +55,15 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
   // are too many of them.
   bool RequiresImmediateWrapperProcessing();
 
+  // Wrapper pairs are handed to the embedder in bounded batches instead of
+  // one unbounded burst at the end of a tracing step; callers that discover
+  // wrappers in a loop flush whenever a batch fills up, spreading the
+  // embedder's registration cost across the step.
+  static const size_t kWrapperBatchSize = 1024;
+  bool WrapperBatchIsFull() const {
+    return cached_wrappers_to_trace_.size() >= kWrapperBatchSize;
+  }
+
   void NotifyV8MarkingWorklistWasEmpty() {
     num_v8_marking_worklist_was_empty_++;
   }
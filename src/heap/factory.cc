@@ -4,6 +4,12 @@
 
 #include "src/heap/factory.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "src/accessors.h"
 #include "src/allocation-site-scopes.h"
 #include "src/ast/ast-source-ranges.h"
@@ -14,6 +20,7 @@
 #include "src/compiler.h"
 #include "src/conversions.h"
 #include "src/counters.h"
+#include "src/heap/concurrent-allocator-inl.h"
 #include "src/interpreter/interpreter.h"
 #include "src/isolate-inl.h"
 #include "src/macro-assembler.h"
@@ -422,10 +429,12 @@ Handle<FeedbackVector> Factory::NewFeedbackVector(
   vector->set_optimized_code_weak_or_smi(MaybeObject::FromSmi(Smi::FromEnum(
       FLAG_log_function_events ? OptimizationMarker::kLogFirstExecution
                                : OptimizationMarker::kNone)));
+  vector->set_osr_code_weak_or_smi(MaybeObject::FromSmi(Smi::kZero));
   vector->set_length(length);
   vector->set_invocation_count(0);
   vector->set_profiler_ticks(0);
   vector->set_deopt_count(0);
+  vector->set_osr_bailout_id(BailoutId::None().ToInt());
   // TODO(leszeks): Initialize based on the feedback metadata.
   MemsetPointer(ObjectSlot(vector->slots_start()), *undefined_value(), length);
   return vector;
@@ -635,12 +644,41 @@ MaybeHandle<String> Factory::NewStringFromOneByte(Vector<const uint8_t> string,
   return result;
 }
 
+namespace {
+
+// Returns the length of the pure-ASCII prefix of |chars|, classifying 16
+// bytes per step where SIMD is available. The tail that does not fill a
+// whole vector is handled by the word-at-a-time scan in
+// String::NonAsciiStart. Pure-ASCII UTF-8 payloads are thereby detected at
+// near-memcpy speed, and mixed payloads only fall back to the scalar decoder
+// from the first actual multi-byte sequence onwards.
+int AsciiPrefixLength(const char* chars, int length) {
+  int start = 0;
+#if defined(__SSE2__)
+  while (length - start >= 16) {
+    __m128i chunk =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(chars + start));
+    if (_mm_movemask_epi8(chunk) != 0) break;
+    start += 16;
+  }
+#elif defined(__aarch64__)
+  while (length - start >= 16) {
+    uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(chars + start));
+    if (vmaxvq_u8(chunk) > unibrow::Utf8::kMaxOneByteChar) break;
+    start += 16;
+  }
+#endif
+  return start + String::NonAsciiStart(chars + start, length - start);
+}
+
+}  // namespace
+
 MaybeHandle<String> Factory::NewStringFromUtf8(Vector<const char> string,
                                                PretenureFlag pretenure) {
   // Check for ASCII first since this is the common case.
   const char* ascii_data = string.start();
   int length = string.length();
-  int non_ascii_start = String::NonAsciiStart(ascii_data, length);
+  int non_ascii_start = AsciiPrefixLength(ascii_data, length);
   if (non_ascii_start >= length) {
     // If the string is ASCII, we do not need to convert the characters
     // since UTF8 is backwards compatible with ASCII.
@@ -678,7 +716,7 @@ MaybeHandle<String> Factory::NewStringFromUtf8SubString(
     PretenureFlag pretenure) {
   const char* ascii_data =
       reinterpret_cast<const char*>(str->GetChars() + begin);
-  int non_ascii_start = String::NonAsciiStart(ascii_data, length);
+  int non_ascii_start = AsciiPrefixLength(ascii_data, length);
   if (non_ascii_start >= length) {
     // If the string is ASCII, we can just make a substring.
     // TODO(v8): the pretenure flag is ignored in this case.
@@ -1001,6 +1039,38 @@ MaybeHandle<SeqTwoByteString> Factory::NewRawTwoByteString(
   return string;
 }
 
+SeqOneByteString* Factory::NewRawOneByteStringInBackground(
+    ConcurrentAllocator* allocator, int length) {
+  DCHECK_LT(0, length);
+  DCHECK_LE(length, String::kMaxLength);
+  int size = SeqOneByteString::SizeFor(length);
+  HeapObject* result = nullptr;
+  if (!allocator->AllocateRaw(size, kWordAligned).To(&result)) return nullptr;
+  // String maps are immortal immovable roots and therefore safe to read from
+  // a background thread.
+  result->set_map_after_allocation(*one_byte_string_map(), SKIP_WRITE_BARRIER);
+  SeqOneByteString* string = SeqOneByteString::cast(result);
+  string->set_length(length);
+  string->set_hash_field(String::kEmptyHashField);
+  DCHECK_EQ(size, string->Size());
+  return string;
+}
+
+SeqTwoByteString* Factory::NewRawTwoByteStringInBackground(
+    ConcurrentAllocator* allocator, int length) {
+  DCHECK_LT(0, length);
+  DCHECK_LE(length, String::kMaxLength);
+  int size = SeqTwoByteString::SizeFor(length);
+  HeapObject* result = nullptr;
+  if (!allocator->AllocateRaw(size, kWordAligned).To(&result)) return nullptr;
+  result->set_map_after_allocation(*string_map(), SKIP_WRITE_BARRIER);
+  SeqTwoByteString* string = SeqTwoByteString::cast(result);
+  string->set_length(length);
+  string->set_hash_field(String::kEmptyHashField);
+  DCHECK_EQ(size, string->Size());
+  return string;
+}
+
 Handle<String> Factory::LookupSingleCharacterStringFromCode(uint32_t code) {
   if (code <= String::kMaxOneByteCharCodeU) {
     {
@@ -1216,7 +1286,18 @@ Handle<String> Factory::NewProperSubString(Handle<String> str, int begin,
     return MakeOrFindTwoCharacterString(isolate(), c1, c2);
   }
 
-  if (!FLAG_string_slices || length < SlicedString::kMinLength) {
+  // A slice keeps its whole backing string alive. When the requested
+  // substring is short and the backing string is disproportionately large,
+  // a sequential copy retains far less memory and is cheap to create.
+  bool make_copy = !FLAG_string_slices || length < SlicedString::kMinLength;
+  if (!make_copy && length <= SlicedString::kMaxTrimmedLength) {
+    int backing_length = str->IsSlicedString()
+                             ? SlicedString::cast(*str)->parent()->length()
+                             : str->length();
+    make_copy = length < backing_length / SlicedString::kTrimRatio;
+  }
+
+  if (make_copy) {
     if (str->IsOneByteRepresentation()) {
       Handle<SeqOneByteString> result =
           NewRawOneByteString(length).ToHandleChecked();
@@ -2964,6 +3045,48 @@ Handle<JSObject> Factory::NewJSObjectFromMap(
   return js_obj;
 }
 
+void Factory::NewJSObjectBatchFromMap(Handle<Map> map, int count,
+                                      Handle<FixedArray> results,
+                                      int start_index) {
+  DCHECK(map->instance_type() != JS_FUNCTION_TYPE);
+  DCHECK(map->instance_type() != JS_GLOBAL_OBJECT_TYPE);
+  DCHECK(!map->is_dictionary_map());
+  DCHECK_LE(start_index + count, results->length());
+
+  // Per-object slack tracking steps would let objects within one batch
+  // disagree about the instance size; finalize the size up front instead.
+  if (map->IsInobjectSlackTrackingInProgress()) {
+    map->FindRootMap(isolate())->CompleteInobjectSlackTracking(isolate());
+  }
+
+  int instance_size = map->instance_size();
+  int max_objects_per_block =
+      Min(count, kMaxRegularHeapObjectSize / instance_size);
+  int index = start_index;
+  while (count > 0) {
+    int block_count = Min(count, max_objects_per_block);
+    HeapObject* block = isolate()->heap()->AllocateRawWithRetryOrFail(
+        block_count * instance_size, NEW_SPACE);
+    DisallowHeapAllocation no_gc;
+    Map raw_map = *map;
+    Object* properties = *empty_fixed_array();
+    Object* filler = *undefined_value();
+    Address address = block->address();
+    for (int i = 0; i < block_count; i++) {
+      JSObject* object = JSObject::cast(HeapObject::FromAddress(address));
+      // The block lives in new space, so none of the initializing stores
+      // below need a write barrier.
+      object->set_map_after_allocation(raw_map, SKIP_WRITE_BARRIER);
+      object->set_raw_properties_or_hash(properties, SKIP_WRITE_BARRIER);
+      object->initialize_elements();
+      object->InitializeBody(raw_map, JSObject::kHeaderSize, filler, filler);
+      results->set(index++, object);
+      address += instance_size;
+    }
+    count -= block_count;
+  }
+}
+
 Handle<JSObject> Factory::NewSlowJSObjectFromMap(Handle<Map> map, int capacity,
                                                  PretenureFlag pretenure) {
   DCHECK(map->is_dictionary_map());
@@ -3369,8 +3492,56 @@ MaybeHandle<JSBoundFunction> Factory::NewJSBoundFunction(
   isolate()->set_context(*target_function->GetCreationContext());
 
   // Create the [[BoundArguments]] for the result.
+  //
+  // If the {target_function} is itself a bound function that cannot be used
+  // as a constructor, collapse one level of the bound function chain: the
+  // result calls the target's [[BoundTargetFunction]] directly, with the
+  // target's [[BoundArguments]] spliced in front of the new {bound_args},
+  // so that calling the result sets up a single frame no matter how often
+  // it was re-bound. This is unobservable for non-constructors, which can
+  // never occur as new.target; the result's [[Prototype]] was derived from
+  // the original {target_function} above, and its "length" and "name" are
+  // set up eagerly by the callers of this function. The {target_function}
+  // must not carry an own @@hasInstance either: OrdinaryHasInstance unwraps
+  // a bound chain one level at a time and consults @@hasInstance on every
+  // link, so a wrapper with its own hook has to stay in the chain. A hook
+  // installed on the wrapper only after it has been re-bound is still
+  // skipped; that residual deviation is what --flatten-bound-chains
+  // documents.
+  bool flatten_bound_chain = FLAG_flatten_bound_chains &&
+                             target_function->IsJSBoundFunction() &&
+                             !target_function->IsConstructor();
+  if (flatten_bound_chain) {
+    Maybe<bool> target_has_instance =
+        JSReceiver::HasOwnProperty(target_function, has_instance_symbol());
+    MAYBE_RETURN(target_has_instance, MaybeHandle<JSBoundFunction>());
+    flatten_bound_chain = !target_has_instance.FromJust();
+  }
   Handle<FixedArray> bound_arguments;
-  if (bound_args.length() == 0) {
+  if (flatten_bound_chain) {
+    Handle<JSBoundFunction> bound_target =
+        Handle<JSBoundFunction>::cast(target_function);
+    Handle<FixedArray> inner_args(bound_target->bound_arguments(), isolate());
+    int total_args = inner_args->length() + bound_args.length();
+    if (total_args >= Code::kMaxArguments) {
+      THROW_NEW_ERROR(isolate(),
+                      NewRangeError(MessageTemplate::kTooManyArguments),
+                      JSBoundFunction);
+    }
+    if (total_args == 0) {
+      bound_arguments = empty_fixed_array();
+    } else {
+      bound_arguments = NewFixedArray(total_args);
+      for (int i = 0; i < inner_args->length(); ++i) {
+        bound_arguments->set(i, inner_args->get(i));
+      }
+      for (int i = 0; i < bound_args.length(); ++i) {
+        bound_arguments->set(inner_args->length() + i, *bound_args[i]);
+      }
+    }
+    bound_this = handle(bound_target->bound_this(), isolate());
+    target_function = handle(bound_target->bound_target_function(), isolate());
+  } else if (bound_args.length() == 0) {
     bound_arguments = empty_fixed_array();
   } else {
     bound_arguments = NewFixedArray(bound_args.length());
@@ -3886,6 +4057,8 @@ void Factory::SetRegExpIrregexpData(Handle<JSRegExp> regexp,
   store->set(JSRegExp::kIrregexpMaxRegisterCountIndex, Smi::kZero);
   store->set(JSRegExp::kIrregexpCaptureCountIndex, Smi::FromInt(capture_count));
   store->set(JSRegExp::kIrregexpCaptureNameMapIndex, uninitialized);
+  store->set(JSRegExp::kIrregexpTierUpTicksIndex, Smi::kZero);
+  store->set(JSRegExp::kIrregexpRequiredPrefixIndex, Smi::kZero);
   regexp->set_data(*store);
 }
 
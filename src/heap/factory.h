@@ -33,6 +33,7 @@ class BreakPointInfo;
 class CallableTask;
 class CallbackTask;
 class CallHandlerInfo;
+class ConcurrentAllocator;
 class Expression;
 class EmbedderDataArray;
 class ArrayBoilerplateDescription;
@@ -331,6 +332,16 @@ class V8_EXPORT_PRIVATE Factory {
   V8_WARN_UNUSED_RESULT MaybeHandle<SeqTwoByteString> NewRawTwoByteString(
       int length, PretenureFlag pretenure = NOT_TENURED);
 
+  // Variants of the above that allocate in old space from the given
+  // thread-local allocator and hand out raw pointers instead of handles.
+  // Safe to call from background threads as long as the caller keeps the GC
+  // from running; the result must not escape the background thread before
+  // the allocator has been finalized on the main thread.
+  SeqOneByteString* NewRawOneByteStringInBackground(
+      ConcurrentAllocator* allocator, int length);
+  SeqTwoByteString* NewRawTwoByteStringInBackground(
+      ConcurrentAllocator* allocator, int length);
+
   // Creates a single character string where the character has given code.
   // A cache is used for Latin1 codes.
   Handle<String> LookupSingleCharacterStringFromCode(uint32_t code);
@@ -602,6 +613,14 @@ class V8_EXPORT_PRIVATE Factory {
   Handle<JSObject> NewJSObjectFromMap(
       Handle<Map> map, PretenureFlag pretenure = NOT_TENURED,
       Handle<AllocationSite> allocation_site = Handle<AllocationSite>::null());
+  // Allocates and initializes |count| JavaScript objects based on a map and
+  // stores them into |results| starting at |start_index|. The objects are
+  // carved out of contiguous new-space blocks, so one allocation check is
+  // amortized over a whole block and the initializing stores need no write
+  // barriers. Each object ends up initialized exactly as NewJSObjectFromMap
+  // would have initialized it.
+  void NewJSObjectBatchFromMap(Handle<Map> map, int count,
+                               Handle<FixedArray> results, int start_index);
   Handle<JSObject> NewSlowJSObjectFromMap(
       Handle<Map> map,
       int number_of_slow_properties = NameDictionary::kInitialCapacity,
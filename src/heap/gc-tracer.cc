@@ -116,7 +116,10 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
       new_space_object_size(0),
       survived_new_space_object_size(0),
       incremental_marking_bytes(0),
-      incremental_marking_duration(0.0) {
+      incremental_marking_duration(0.0),
+      scavenger_stolen_segments(0),
+      scavenger_idle_rounds(0),
+      store_buffer_merged_entries(0) {
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
@@ -301,6 +304,9 @@ void GCTracer::Stop(GarbageCollector collector) {
 
   AddAllocation(current_.end_time);
 
+  current_.store_buffer_merged_entries =
+      store_buffer_merged_entries_.exchange(0, std::memory_order_relaxed);
+
   double duration = current_.end_time - current_.start_time;
 
   switch (current_.type) {
@@ -414,6 +420,16 @@ void GCTracer::AddContextDisposalTime(double time) {
   recorded_context_disposal_times_.Push(time);
 }
 
+void GCTracer::AddScavengerWorkStealingStats(size_t stolen_segments,
+                                             size_t idle_rounds) {
+  current_.scavenger_stolen_segments += stolen_segments;
+  current_.scavenger_idle_rounds += idle_rounds;
+}
+
+void GCTracer::AddStoreBufferMergeEntries(size_t entries) {
+  store_buffer_merged_entries_.fetch_add(entries, std::memory_order_relaxed);
+}
+
 void GCTracer::AddCompactionEvent(double duration,
                                   size_t live_bytes_compacted) {
   recorded_compactions_.Push(
@@ -523,10 +539,16 @@ void GCTracer::PrintNVP() const {
           "scavenge.weak_global_handles.identify=%.2f "
           "scavenge.weak_global_handles.process=%.2f "
           "scavenge.parallel=%.2f "
+          "scavenge.parallel.stolen_segments=%" PRIuS
+          " "
+          "scavenge.parallel.idle_rounds=%" PRIuS
+          " "
           "scavenge.update_refs=%.2f "
           "background.scavenge.parallel=%.2f "
           "background.array_buffer_free=%.2f "
           "background.store_buffer=%.2f "
+          "store_buffer.merged_entries=%" PRIuS
+          " "
           "background.unmapper=%.2f "
           "incremental.steps_count=%d "
           "incremental.steps_took=%.1f "
@@ -572,10 +594,12 @@ void GCTracer::PrintNVP() const {
           current_
               .scopes[Scope::SCAVENGER_SCAVENGE_WEAK_GLOBAL_HANDLES_PROCESS],
           current_.scopes[Scope::SCAVENGER_SCAVENGE_PARALLEL],
+          current_.scavenger_stolen_segments, current_.scavenger_idle_rounds,
           current_.scopes[Scope::SCAVENGER_SCAVENGE_UPDATE_REFS],
           current_.scopes[Scope::SCAVENGER_BACKGROUND_SCAVENGE_PARALLEL],
           current_.scopes[Scope::BACKGROUND_ARRAY_BUFFER_FREE],
           current_.scopes[Scope::BACKGROUND_STORE_BUFFER],
+          current_.store_buffer_merged_entries,
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.incremental_marking_scopes[GCTracer::Scope::MC_INCREMENTAL]
               .steps,
@@ -724,6 +748,8 @@ void GCTracer::PrintNVP() const {
           "background.evacuate.update_pointers=%.1f "
           "background.array_buffer_free=%.2f "
           "background.store_buffer=%.2f "
+          "store_buffer.merged_entries=%" PRIuS
+          " "
           "background.unmapper=%.1f "
           "total_size_before=%" PRIuS
           " "
@@ -826,6 +852,7 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MC_BACKGROUND_EVACUATE_UPDATE_POINTERS],
           current_.scopes[Scope::BACKGROUND_ARRAY_BUFFER_FREE],
           current_.scopes[Scope::BACKGROUND_STORE_BUFFER],
+          current_.store_buffer_merged_entries,
           current_.scopes[Scope::BACKGROUND_UNMAPPER],
           current_.start_object_size, current_.end_object_size,
           current_.start_holes_size, current_.end_holes_size,
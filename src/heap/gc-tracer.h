@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <atomic>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -191,6 +193,18 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Duration of incremental marking steps for INCREMENTAL_MARK_COMPACTOR.
     double incremental_marking_duration;
 
+    // Number of worklist segments stolen from the global pool by parallel
+    // scavenger tasks.
+    size_t scavenger_stolen_segments;
+
+    // Number of rounds in which a parallel scavenger task ran out of work and
+    // had to wait for work published by other tasks.
+    size_t scavenger_idle_rounds;
+
+    // Number of store buffer entries merged into the remembered set since the
+    // previous event.
+    size_t store_buffer_merged_entries;
+
     // Amounts of time spent in different scopes during GC.
     double scopes[Scope::NUMBER_OF_SCOPES];
 
@@ -224,6 +238,15 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddContextDisposalTime(double time);
 
+  // Accumulates work-stealing statistics of the parallel scavenger for the
+  // current event. Called once per scavenge from the main thread.
+  void AddScavengerWorkStealingStats(size_t stolen_segments,
+                                     size_t idle_rounds);
+
+  // Accumulates the number of store buffer entries merged into the remembered
+  // set. May be called from background threads.
+  void AddStoreBufferMergeEntries(size_t entries);
+
   void AddCompactionEvent(double duration, size_t live_bytes_compacted);
 
   void AddSurvivalRatio(double survival_ratio);
@@ -435,6 +458,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Counts how many tracers were started without stopping.
   int start_counter_;
 
+  // Store buffer entries merged into the remembered set since the last event.
+  // Updated from background threads, moved into the current event on Stop.
+  std::atomic<size_t> store_buffer_merged_entries_{0};
+
   // Used for computing average mutator utilization.
   double average_mutator_duration_;
   double average_mark_compact_duration_;
@@ -116,7 +116,11 @@ void Heap::SetRootScriptList(Object* value) {
 }
 
 void Heap::SetRootStringTable(StringTable* value) {
-  roots_table()[RootIndex::kStringTable] = value;
+  // The string table is probed by background threads without a lock (see
+  // StringTable::TryLookupConcurrent), so a grown copy must be published
+  // with a release store after its elements have been written.
+  base::AsAtomicPointer::Release_Store(
+      &roots_table()[RootIndex::kStringTable], static_cast<Object*>(value));
 }
 
 void Heap::SetRootNoScriptSharedFunctionInfos(Object* value) {
@@ -488,8 +492,20 @@ Heap* Heap::FromWritableHeapObject(const HeapObjectPtr* obj) {
 bool Heap::ShouldBePromoted(Address old_address) {
   Page* page = Page::FromAddress(old_address);
   Address age_mark = new_space_->age_mark();
-  return page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) &&
-         (!page->ContainsLimit(age_mark) || old_address < age_mark);
+  const bool below_age_mark =
+      page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK) &&
+      (!page->ContainsLimit(age_mark) || old_address < age_mark);
+  if (V8_UNLIKELY(FLAG_scavenge_survival_promotion)) {
+    const intptr_t rate = page->last_survival_rate();
+    if (rate != MemoryChunk::kUnknownSurvivalRate) {
+      // Promote wholesale from pages with a history of high survival and
+      // keep copying survivors of mostly-garbage pages within new space,
+      // even below the age mark.
+      if (rate >= kHighYoungSurvivalRatePercent) return true;
+      if (below_age_mark && rate <= kLowYoungSurvivalRatePercent) return false;
+    }
+  }
+  return below_age_mark;
 }
 
 void Heap::CopyBlock(Address dst, Address src, int byte_size) {
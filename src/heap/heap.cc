@@ -26,6 +26,7 @@
 #include "src/heap/barrier.h"
 #include "src/heap/code-stats.h"
 #include "src/heap/concurrent-marking.h"
+#include "src/heap/context-accounting-observer.h"
 #include "src/heap/embedder-tracing.h"
 #include "src/heap/gc-idle-time-handler.h"
 #include "src/heap/gc-tracer.h"
@@ -51,6 +52,7 @@
 #include "src/objects/maybe-object.h"
 #include "src/objects/shared-function-info.h"
 #include "src/objects/slots-inl.h"
+#include "src/objects/string-table.h"
 #include "src/regexp/jsregexp.h"
 #include "src/runtime-profiler.h"
 #include "src/snapshot/embedded-data.h"
@@ -290,7 +292,20 @@ GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
 
   // Default
   *reason = nullptr;
-  return YoungGenerationCollector();
+  GarbageCollector young_collector = YoungGenerationCollector();
+#if ENABLE_MINOR_MC
+  if (young_collector == MINOR_MARK_COMPACTOR && FLAG_minor_mc_auto &&
+      tracer()->AverageSurvivalRatio() <
+          FLAG_minor_mc_auto_survival_threshold) {
+    // When little survives, copying collection touches only the survivors
+    // and wins; minor mark-compact pays for marking and per-page processing
+    // regardless of survival. When most of new space survives, copying
+    // everything twice is the worst strategy, so prefer minor mark-compact
+    // for high recorded survival rates.
+    young_collector = SCAVENGER;
+  }
+#endif  // ENABLE_MINOR_MC
+  return young_collector;
 }
 
 void Heap::SetGCState(HeapState state) {
@@ -701,6 +716,60 @@ inline bool MakePretenureDecision(
   return false;
 }
 
+// Stabilized variant of MakePretenureDecision, used with
+// --stable-allocation-site-pretenuring. The decision only changes after the
+// survival ratio has supported the same new decision for
+// kPretenureDecisionStrikes consecutive GCs, and made decisions may be
+// revised in either direction (deoptimizing dependent code) instead of
+// requiring a full site reset.
+inline bool MakeStablePretenureDecision(
+    AllocationSite* site, AllocationSite::PretenureDecision current_decision,
+    double ratio, bool maximum_size_scavenge) {
+  bool wants_tenure = ratio >= AllocationSite::kPretenureRatio;
+  bool is_tenure_like = current_decision == AllocationSite::kMaybeTenure ||
+                        current_decision == AllocationSite::kTenure;
+  if (wants_tenure == is_tenure_like &&
+      current_decision != AllocationSite::kUndecided) {
+    // Feedback agrees with the current decision; forget earlier outliers.
+    if (site->pretenure_strike_count() != 0) {
+      site->set_pretenure_strike_count(0);
+    }
+    // Promotion from maybe tenure still waits for a maximum-size scavenge,
+    // as in the default policy.
+    if (current_decision == AllocationSite::kMaybeTenure &&
+        maximum_size_scavenge) {
+      site->set_deopt_dependent_code(true);
+      site->set_pretenure_decision(AllocationSite::kTenure);
+      return true;
+    }
+    return false;
+  }
+  int strikes = site->pretenure_strike_count() + 1;
+  if (strikes < AllocationSite::kPretenureDecisionStrikes) {
+    site->set_pretenure_strike_count(strikes);
+    return false;
+  }
+  site->set_pretenure_strike_count(0);
+  if (wants_tenure) {
+    if (!maximum_size_scavenge) {
+      site->set_pretenure_decision(AllocationSite::kMaybeTenure);
+      return false;
+    }
+    site->set_deopt_dependent_code(true);
+    site->set_pretenure_decision(AllocationSite::kTenure);
+    return true;
+  }
+  bool was_tenured = current_decision == AllocationSite::kTenure;
+  site->set_pretenure_decision(AllocationSite::kDontTenure);
+  if (was_tenured) {
+    // Dependent code allocates in old space and has to be deoptimized for
+    // the revised decision to take effect.
+    site->set_deopt_dependent_code(true);
+    return true;
+  }
+  return false;
+}
+
 inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
                                       bool maximum_size_scavenge) {
   bool deopt = false;
@@ -715,8 +784,11 @@ inline bool DigestPretenuringFeedback(Isolate* isolate, AllocationSite* site,
       site->pretenure_decision();
 
   if (minimum_mementos_created) {
-    deopt = MakePretenureDecision(site, current_decision, ratio,
-                                  maximum_size_scavenge);
+    deopt = FLAG_stable_allocation_site_pretenuring
+                ? MakeStablePretenureDecision(site, current_decision, ratio,
+                                              maximum_size_scavenge)
+                : MakePretenureDecision(site, current_decision, ratio,
+                                        maximum_size_scavenge);
   }
 
   if (FLAG_trace_pretenuring_statistics) {
@@ -958,6 +1030,35 @@ void Heap::GarbageCollectionEpilogue() {
   }
 }
 
+void Heap::DeduplicateStringsAfterGC() {
+  if (!FLAG_thin_strings) return;
+  DCHECK(gc_state_ == NOT_IN_GC);
+  // Forward non-internalized sequential strings that have an internalized
+  // twin in the string table to that twin; the lookup rewrites the
+  // duplicate into a ThinString in place, so its body is reclaimed by the
+  // next collection and byte-equal strings converge on one instance.
+  // Only strings whose hash is already computed are considered, which
+  // both reuses the cached hashes and restricts the pass to strings that
+  // were used in hash-demanding positions (e.g. as property keys).
+  int deduplicated = 0;
+  HeapIterator iterator(this);
+  for (HeapObject* obj = iterator.next(); obj != nullptr;
+       obj = iterator.next()) {
+    if (!obj->IsSeqString()) continue;
+    String* string = String::cast(obj);
+    if (string->IsInternalizedString()) continue;
+    if (!string->HasHashCode()) continue;
+    Object* result =
+        StringTable::LookupStringIfExists_NoAllocate(isolate(), string);
+    // A string result means the lookup hit and {string} is now thin.
+    if (result->IsString()) deduplicated++;
+  }
+  if (FLAG_trace_gc_verbose) {
+    isolate()->PrintWithTimestamp("String deduplication: %d strings thinned\n",
+                                  deduplicated);
+  }
+}
+
 class GCCallbacksScope {
  public:
   explicit GCCallbacksScope(Heap* heap) : heap_(heap) {
@@ -1190,6 +1291,9 @@ void Heap::PreciseCollectAllGarbage(int flags,
 }
 
 void Heap::ReportExternalMemoryPressure() {
+  // Give the embedder a chance to evict freeable external allocations (e.g.
+  // caches) before reacting with a garbage collection.
+  if (InvokeExternalMemoryPressureCallback()) return;
   const GCCallbackFlags kGCCallbackFlagsForExternalMemory =
       static_cast<GCCallbackFlags>(
           kGCCallbackFlagSynchronousPhantomCallbackProcessing |
@@ -1246,12 +1350,53 @@ void Heap::EnsureFillerObjectAtTop() {
   }
 }
 
+void Heap::SetGCPauseBudget(double budget_in_ms) {
+  DCHECK_LE(0, budget_in_ms);
+  gc_pause_budget_ms_ = budget_in_ms;
+}
+
+bool Heap::ShouldDeferFullGCForPauseBudget(
+    GarbageCollector collector, GarbageCollectionReason gc_reason) {
+  if (!HasGCPauseBudget() || collector != MARK_COMPACTOR) return false;
+  if (incremental_marking()->IsStopped() &&
+      !incremental_marking()->CanBeActivated()) {
+    return false;
+  }
+  // Only collections triggered by heuristics may be deferred. Everything
+  // else, e.g. collections on allocation failure, marking finalization, or
+  // collections explicitly requested by the embedder or by tests, has to be
+  // performed atomically.
+  switch (gc_reason) {
+    case GarbageCollectionReason::kAllocationLimit:
+    case GarbageCollectionReason::kContextDisposal:
+    case GarbageCollectionReason::kMemoryReducer:
+      return true;
+    default:
+      return false;
+  }
+}
+
 bool Heap::CollectGarbage(AllocationSpace space,
                           GarbageCollectionReason gc_reason,
                           const v8::GCCallbackFlags gc_callback_flags) {
   const char* collector_reason = nullptr;
   GarbageCollector collector = SelectGarbageCollector(space, &collector_reason);
 
+  if (ShouldDeferFullGCForPauseBudget(collector, gc_reason)) {
+    // A pause budget is active: make bounded incremental marking progress
+    // instead of performing the collection atomically. The collection is
+    // finalized later by the regular incremental marking machinery,
+    // preferably in an idle window signaled by the embedder.
+    if (incremental_marking()->IsStopped()) {
+      StartIncrementalMarking(GCFlagsForIncrementalMarking(), gc_reason,
+                              gc_callback_flags);
+    }
+    incremental_marking()->AdvanceIncrementalMarking(
+        MonotonicallyIncreasingTimeInMs() + gc_pause_budget_ms_,
+        IncrementalMarking::GC_VIA_STACK_GUARD, StepOrigin::kV8);
+    return false;
+  }
+
   if (!CanExpandOldGeneration(new_space()->Capacity())) {
     InvokeNearHeapLimitCallback();
   }
@@ -1343,6 +1488,10 @@ bool Heap::CollectGarbage(AllocationSpace space,
     tracer()->Stop(collector);
   }
 
+  if (collector == MARK_COMPACTOR && FLAG_gc_string_dedup) {
+    DeduplicateStringsAfterGC();
+  }
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -1872,8 +2021,11 @@ void Heap::MarkCompactEpilogue() {
 void Heap::MarkCompactPrologue() {
   TRACE_GC(tracer(), GCTracer::Scope::MC_PROLOGUE);
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->transition_lookup_cache()->Clear();
+  isolate_->property_lookup_cache()->Clear();
   RegExpResultsCache::Clear(string_split_cache());
   RegExpResultsCache::Clear(regexp_multiple_cache());
+  RegExpResultsCache::Clear(regexp_replace_plan_cache());
 
   isolate_->compilation_cache()->MarkCompactPrologue();
 
@@ -3302,6 +3454,25 @@ void Heap::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   UNREACHABLE();
 }
 
+void Heap::SetExternalMemoryPressureCallback(
+    v8::ExternalMemoryPressureCallback callback, void* data) {
+  external_memory_pressure_callback_ = callback;
+  external_memory_pressure_callback_data_ = data;
+}
+
+bool Heap::InvokeExternalMemoryPressureCallback() {
+  if (external_memory_pressure_callback_ == nullptr) return false;
+  if (in_external_memory_pressure_callback_) return false;
+  in_external_memory_pressure_callback_ = true;
+  external_memory_pressure_callback_(
+      external_memory_pressure_callback_data_,
+      isolate()->isolate_data()->external_memory_,
+      isolate()->isolate_data()->external_memory_limit_);
+  in_external_memory_pressure_callback_ = false;
+  return isolate()->isolate_data()->external_memory_ <=
+         isolate()->isolate_data()->external_memory_limit_;
+}
+
 bool Heap::InvokeNearHeapLimitCallback() {
   if (near_heap_limit_callbacks_.size() > 0) {
     HandleScope scope(isolate());
@@ -4436,6 +4607,11 @@ void Heap::SetUp() {
     stress_scavenge_observer_ = new StressScavengeObserver(*this);
     new_space()->AddAllocationObserver(stress_scavenge_observer_);
   }
+  if (FLAG_per_context_accounting) {
+    context_accounting_observer_ = new ContextAccountingObserver(*this);
+    AddAllocationObserversToAllSpaces(context_accounting_observer_,
+                                      context_accounting_observer_);
+  }
 
   write_protect_code_memory_ = FLAG_write_protect_code_memory;
 }
@@ -4602,6 +4778,12 @@ void Heap::TearDown() {
     delete stress_scavenge_observer_;
     stress_scavenge_observer_ = nullptr;
   }
+  if (FLAG_per_context_accounting) {
+    RemoveAllocationObserversFromAllSpaces(context_accounting_observer_,
+                                           context_accounting_observer_);
+    delete context_accounting_observer_;
+    context_accounting_observer_ = nullptr;
+  }
 
   if (heap_controller_ != nullptr) {
     delete heap_controller_;
@@ -5453,6 +5635,20 @@ bool Heap::AllowedToBeMigrated(HeapObject* obj, AllocationSpace dst) {
   UNREACHABLE();
 }
 
+void Heap::PinObject(HeapObject* object) {
+  // Only paged old generation spaces compact; large objects and read-only
+  // objects never move, and new space objects are evacuated individually by
+  // the scavenger so they cannot be pinned in place.
+  DCHECK(InOldSpace(object) || code_space()->Contains(object));
+  Page::FromAddress(object->address())->SetPinned(true);
+}
+
+void Heap::UnpinObject(HeapObject* object) {
+  Page* page = Page::FromAddress(object->address());
+  DCHECK(page->IsPinned());
+  page->SetPinned(false);
+}
+
 void Heap::CreateObjectStats() {
   if (V8_LIKELY(FLAG_gc_stats == 0)) return;
   if (!live_object_stats_) {
@@ -267,6 +267,12 @@ class Heap {
 
   static const int kMinPromotedPercentForFastPromotionMode = 90;
 
+  // Thresholds on the survival history of a new space page, used by the
+  // scavenger to promote wholesale from high-survival pages and to keep
+  // copying from mostly-garbage pages (--scavenge-survival-promotion).
+  static const int kHighYoungSurvivalRatePercent = 75;
+  static const int kLowYoungSurvivalRatePercent = 25;
+
   STATIC_ASSERT(static_cast<int>(RootIndex::kUndefinedValue) ==
                 Internals::kUndefinedValueRootIndex);
   STATIC_ASSERT(static_cast<int>(RootIndex::kTheHoleValue) ==
@@ -428,6 +434,14 @@ class Heap {
   // current space into the given destination space. Used for debugging.
   bool AllowedToBeMigrated(HeapObject* object, AllocationSpace dest);
 
+  // Pins the page containing the given old generation object so that the
+  // mark-compactor never selects it as an evacuation candidate. Pinning works
+  // at page granularity, i.e. all other objects on the page stay in place as
+  // well. Pins do not nest; a single UnpinObject call makes the page movable
+  // again at the next full GC.
+  void PinObject(HeapObject* object);
+  void UnpinObject(HeapObject* object);
+
   void CheckHandleCount();
 
   // Number of "runtime allocations" done so far.
@@ -495,9 +509,19 @@ class Heap {
                                   bool is_isolate_locked);
   void CheckMemoryPressure();
 
+  // Sets a budget for garbage collection pauses. While a budget is active,
+  // full collections triggered for non-critical reasons are turned into
+  // incremental marking steps bounded by the budget, and memory reducer
+  // collections are deferred until the embedder signals an idle window. A
+  // budget of zero disables the limit.
+  void SetGCPauseBudget(double budget_in_ms);
+  bool HasGCPauseBudget() const { return gc_pause_budget_ms_ > 0; }
+
   void AddNearHeapLimitCallback(v8::NearHeapLimitCallback, void* data);
   void RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
                                    size_t heap_limit);
+  void SetExternalMemoryPressureCallback(
+      v8::ExternalMemoryPressureCallback callback, void* data);
 
   double MonotonicallyIncreasingTimeInMs();
 
@@ -1299,6 +1323,13 @@ class Heap {
   // External strings table is a place where all external strings are
   // registered.  We need to keep track of such strings to properly
   // finalize them.
+  //
+  // The table is generational: new space strings are kept separate and are
+  // the only ones scanned during a scavenge, while old space strings are
+  // only visited at full GCs. Strings created through the factory are
+  // allocated tenured and therefore go straight to the old space list;
+  // only in-place externalization of a new space string adds to the new
+  // space list, and such entries are promoted by the next GC.
   class ExternalStringTable {
    public:
     explicit ExternalStringTable(Heap* heap) : heap_(heap) {}
@@ -1330,7 +1361,7 @@ class Heap {
 
     Heap* const heap_;
 
-    // To speed up scavenge collections new space string are kept
+    // To speed up scavenge collections new space strings are kept
     // separate from old space strings.
     std::vector<Object*> new_space_strings_;
     std::vector<Object*> old_space_strings_;
@@ -1429,6 +1460,13 @@ class Heap {
   GarbageCollector SelectGarbageCollector(AllocationSpace space,
                                           const char** reason);
 
+  // Checks whether an active pause budget allows turning a requested full
+  // collection into bounded incremental marking steps. Collections that are
+  // required for correctness or explicitly requested by the embedder are
+  // never deferred.
+  bool ShouldDeferFullGCForPauseBudget(GarbageCollector collector,
+                                       GarbageCollectionReason gc_reason);
+
   // Make sure there is a filler value behind the top of the new space
   // so that the GC does not confuse some unintialized/stale memory
   // with the allocation memento of the object at the top
@@ -1526,6 +1564,11 @@ class Heap {
 
   bool InvokeNearHeapLimitCallback();
 
+  // Invokes the external memory pressure callback, if one is installed.
+  // Returns true if the embedder released enough external memory to bring
+  // the external memory counter back under its limit.
+  bool InvokeExternalMemoryPressureCallback();
+
   void ComputeFastPromotionMode();
 
   // Attempt to over-approximate the weak closure by marking object groups and
@@ -1565,6 +1608,12 @@ class Heap {
   void GarbageCollectionPrologue();
   void GarbageCollectionEpilogue();
 
+  // With --gc-string-dedup, runs after every full collection: forwards
+  // non-internalized sequential strings that have an internalized twin in
+  // the string table to that twin via the ThinString mechanism, so the
+  // duplicate bodies die in the next collection.
+  void DeduplicateStringsAfterGC();
+
   // Performs a major collection in the whole heap.
   void MarkCompact();
   // Performs a minor collection of just the young generation.
@@ -1799,6 +1848,12 @@ class Heap {
   std::vector<std::pair<v8::NearHeapLimitCallback, void*> >
       near_heap_limit_callbacks_;
 
+  v8::ExternalMemoryPressureCallback external_memory_pressure_callback_ =
+      nullptr;
+  void* external_memory_pressure_callback_data_ = nullptr;
+  // Guards against reentrant pressure reports from within the callback.
+  bool in_external_memory_pressure_callback_ = false;
+
   // For keeping track of context disposals.
   int contexts_disposed_ = 0;
 
@@ -1845,6 +1900,10 @@ class Heap {
   // limit.
   AllocationObserver* stress_marking_observer_ = nullptr;
 
+  // Observer that attributes sampled allocation bytes to the running native
+  // context.
+  AllocationObserver* context_accounting_observer_ = nullptr;
+
   // Observer that can cause early scavenge start.
   StressScavengeObserver* stress_scavenge_observer_ = nullptr;
 
@@ -1996,6 +2055,10 @@ class Heap {
   bool force_oom_ = false;
   bool delay_sweeper_tasks_for_testing_ = false;
 
+  // Pause budget set by the embedder, see SetGCPauseBudget. Zero means that
+  // no budget is active.
+  double gc_pause_budget_ms_ = 0.0;
+
   HeapObject* pending_layout_change_object_ = nullptr;
 
   base::Mutex unprotected_memory_chunks_mutex_;
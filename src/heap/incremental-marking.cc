@@ -811,6 +811,9 @@ void IncrementalMarking::EmbedderStep(double duration_ms) {
   int cnt = 0;
   while (marking_worklist()->embedder()->Pop(0, &object)) {
     heap_->TracePossibleWrapper(JSObject::cast(object));
+    if (heap_->local_embedder_heap_tracer()->WrapperBatchIsFull()) {
+      heap_->local_embedder_heap_tracer()->RegisterWrappersWithRemoteTracer();
+    }
     if (++cnt == kObjectsToProcessBeforeInterrupt) {
       cnt = 0;
       if (heap_->MonotonicallyIncreasingTimeInMs() > deadline) {
@@ -948,6 +951,14 @@ double IncrementalMarking::AdvanceIncrementalMarking(
   intptr_t step_size_in_bytes = GCIdleTimeHandler::EstimateMarkingStepSize(
       kStepSizeInMs,
       heap()->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond());
+  if (FLAG_predictive_marking_schedule && step_origin == StepOrigin::kTask &&
+      heap()->tracer()->CurrentAllocationThroughputInBytesPerMillisecond() >
+          heap()->tracer()->IncrementalMarkingSpeedInBytesPerMillisecond()) {
+    // The mutator currently allocates faster than we mark. Idle time is
+    // cheap, so deliberately over-mark to build up a buffer of bytes marked
+    // ahead of schedule that covers the next allocation burst.
+    step_size_in_bytes *= kIdleOvermarkingFactor;
+  }
 
   const bool incremental_wrapper_tracing =
       state_ == MARKING && FLAG_incremental_marking_wrappers &&
@@ -987,7 +998,16 @@ size_t IncrementalMarking::StepSizeToKeepUpWithAllocations() {
   size_t current_counter = heap_->OldGenerationAllocationCounter();
   bytes_allocated_ += current_counter - old_generation_allocation_counter_;
   old_generation_allocation_counter_ = current_counter;
-  return bytes_allocated_;
+  if (!FLAG_predictive_marking_schedule) return bytes_allocated_;
+  // Additionally anticipate the allocations expected until the next step
+  // using the measured throughput. Purely reactive scheduling repeatedly
+  // falls behind under bursty allocation patterns and then has to finalize
+  // marking in a full pause.
+  const size_t predicted_bytes = static_cast<size_t>(
+      heap()->tracer()->AllocationThroughputInBytesPerMillisecond(
+          kPredictionTimeFrameMs) *
+      kMaxStepSizeInMs);
+  return bytes_allocated_ + predicted_bytes;
 }
 
 size_t IncrementalMarking::StepSizeToMakeProgress() {
@@ -1100,6 +1120,13 @@ size_t IncrementalMarking::Step(size_t bytes_to_process,
     }
 
     if (marking_worklist()->IsEmpty()) {
+      if (FLAG_concurrent_marking) {
+        // Marking has run out of work, so let the concurrent tasks resolve
+        // ephemerons whose keys have been marked in the meantime. This way
+        // the ephemeron fixpoint in the atomic pause mostly degenerates to a
+        // short final re-scan.
+        heap_->mark_compact_collector()->AdvanceEphemeronsConcurrently();
+      }
       if (heap_->local_embedder_heap_tracer()
               ->ShouldFinalizeIncrementalMarking()) {
         if (!finalize_marking_completed_) {
@@ -74,6 +74,12 @@ class V8_EXPORT_PRIVATE IncrementalMarking {
   static const int kStepSizeInMs = 1;
   static const int kMaxStepSizeInMs = 5;
 
+  // Parameters for the predictive marking schedule. Allocation throughput is
+  // averaged over the given time frame; idle steps are inflated by the given
+  // factor when the mutator allocates faster than we mark.
+  static const int kPredictionTimeFrameMs = 1000;
+  static const int kIdleOvermarkingFactor = 2;
+
 #ifndef DEBUG
   static const intptr_t kActivationThreshold = 8 * MB;
 #else
@@ -31,6 +31,7 @@
 #include "src/objects/hash-table-inl.h"
 #include "src/objects/js-objects-inl.h"
 #include "src/objects/maybe-object.h"
+#include "src/objects/shared-function-info-inl.h"
 #include "src/objects/slots-inl.h"
 #include "src/transitions-inl.h"
 #include "src/utils-inl.h"
@@ -419,6 +420,7 @@ void MarkCompactCollector::TearDown() {
 
 void MarkCompactCollector::AddEvacuationCandidate(Page* p) {
   DCHECK(!p->NeverEvacuate());
+  DCHECK(!p->IsPinned());
   p->MarkEvacuationCandidate();
   evacuation_candidates_.push_back(p);
 }
@@ -438,6 +440,13 @@ bool MarkCompactCollector::StartCompaction() {
 
     CollectEvacuationCandidates(heap()->old_space());
 
+    // Code space is defragmented on full collections; MemoryReducer's idle
+    // GCs arrive here with ShouldReduceMemory() set, which makes the
+    // candidate heuristics below evacuate more aggressively, so long-running
+    // isolates get their scattered code pages folded together during idle
+    // time. Objects are moved in page sweep order — the evacuator has no
+    // per-object placement hook, so clustering code by hotness would need a
+    // different mechanism than compaction.
     if (FLAG_compact_code_space) {
       CollectEvacuationCandidates(heap()->code_space());
     } else if (FLAG_trace_fragmentation) {
@@ -600,8 +609,8 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
           ? nullptr
           : Page::FromAllocationAreaAddress(space->top());
   for (Page* p : *space) {
-    if (p->NeverEvacuate() || (p == owner_of_linear_allocation_area) ||
-        !p->CanAllocate())
+    if (p->NeverEvacuate() || p->IsPinned() ||
+        (p == owner_of_linear_allocation_area) || !p->CanAllocate())
       continue;
     // Invariant: Evacuation candidates are just created when marking is
     // started. This means that sweeping has finished. Furthermore, at the end
@@ -832,6 +841,9 @@ void MarkCompactCollector::Finish() {
   state_ = IDLE;
 #endif
   heap_->isolate()->inner_pointer_to_code_cache()->Flush();
+  // Compaction may have moved the interpreter dispatch builtins; refresh
+  // the pc ranges the profiler uses to classify interpreted frames.
+  heap_->isolate()->UpdateInterpreterBuiltinPcRanges();
 
   // The stub caches are not traversed during GC; clear them to force
   // their lazy re-initialization. This must be done after the
@@ -1606,6 +1618,9 @@ void MarkCompactCollector::PerformWrapperTracing() {
     HeapObject* object;
     while (marking_worklist()->embedder()->Pop(kMainThread, &object)) {
       heap_->TracePossibleWrapper(JSObject::cast(object));
+      if (heap_->local_embedder_heap_tracer()->WrapperBatchIsFull()) {
+        heap_->local_embedder_heap_tracer()->RegisterWrappersWithRemoteTracer();
+      }
     }
     heap_->local_embedder_heap_tracer()->RegisterWrappersWithRemoteTracer();
     heap_->local_embedder_heap_tracer()->Trace(
@@ -1653,6 +1668,29 @@ bool MarkCompactCollector::VisitEphemeron(HeapObject* key, HeapObject* value) {
   return false;
 }
 
+void MarkCompactCollector::AdvanceEphemeronsConcurrently() {
+  DCHECK(FLAG_concurrent_marking);
+  // If the concurrent tasks have not caught up with the last hand-off yet
+  // there is no point in publishing more ephemerons.
+  if (!weak_objects_.current_ephemerons.IsEmpty()) return;
+
+  // Move all ephemerons discovered so far into current_ephemerons, where the
+  // concurrent marking tasks pick them up. Ephemerons whose key got marked
+  // since discovery have their value pushed onto the shared marking worklist
+  // by the tasks; ephemerons with still-white keys are pushed back into
+  // next_ephemerons for the final fixpoint in the atomic pause. Pop/Push are
+  // thread-safe, so this is fine while tasks are running.
+  Ephemeron ephemeron;
+  bool moved = false;
+  while (weak_objects_.next_ephemerons.Pop(kMainThread, &ephemeron)) {
+    weak_objects_.current_ephemerons.Push(kMainThread, ephemeron);
+    moved = true;
+  }
+  if (!moved) return;
+  weak_objects_.current_ephemerons.FlushToGlobal(kMainThread);
+  heap()->concurrent_marking()->RescheduleTasksIfNeeded();
+}
+
 void MarkCompactCollector::ProcessEphemeronMarking() {
   DCHECK(marking_worklist()->IsEmpty());
 
@@ -1859,9 +1897,13 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     // ClearFullMapTransitions must be called before weak references are
     // cleared.
     ClearFullMapTransitions();
+    if (FLAG_deduplicate_descriptor_arrays) DeduplicateDescriptorArrays();
   }
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_REFERENCES);
+    // ClearOldBytecodeCandidates must run before ClearWeakReferences so that
+    // any feedback metadata made unreachable by flushing is cleared below.
+    ClearOldBytecodeCandidates();
     ClearWeakReferences();
     ClearWeakCollections();
     ClearJSWeakCells();
@@ -1873,6 +1915,7 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   DCHECK(weak_objects_.weak_references.IsEmpty());
   DCHECK(weak_objects_.weak_objects_in_code.IsEmpty());
   DCHECK(weak_objects_.js_weak_cells.IsEmpty());
+  DCHECK(weak_objects_.bytecode_flushing_candidates.IsEmpty());
 }
 
 void MarkCompactCollector::MarkDependentCodeForDeoptimization() {
@@ -1893,6 +1936,112 @@ void MarkCompactCollector::MarkDependentCodeForDeoptimization() {
   }
 }
 
+void MarkCompactCollector::FlushBytecodeFromSFI(
+    SharedFunctionInfo* shared_info) {
+  DCHECK(shared_info->HasBytecodeArray());
+
+  // Retain objects required for uncompiled data.
+  String* inferred_name = shared_info->inferred_name();
+  int start_position = shared_info->StartPosition();
+  int end_position = shared_info->EndPosition();
+  int function_literal_id = shared_info->FunctionLiteralId(isolate());
+
+  // Reset the outer scope info slot, which piggy-backs on the feedback
+  // metadata field while the function is compiled. Use the raw setter to
+  // avoid validity checks, since we're performing the unusual task of
+  // decompiling.
+  HeapObject* outer_scope_info;
+  if (shared_info->scope_info()->HasOuterScopeInfo()) {
+    outer_scope_info = shared_info->scope_info()->OuterScopeInfo();
+  } else {
+    outer_scope_info = ReadOnlyRoots(heap()).the_hole_value();
+  }
+  shared_info->set_raw_outer_scope_info_or_feedback_metadata(
+      outer_scope_info, SKIP_WRITE_BARRIER);
+  RecordSlot(shared_info,
+             HeapObject::RawField(
+                 shared_info,
+                 SharedFunctionInfo::kOuterScopeInfoOrFeedbackMetadataOffset),
+             outer_scope_info);
+
+  // The size of the bytecode array should always be larger than an
+  // UncompiledData object.
+  STATIC_ASSERT(BytecodeArray::SizeFor(0) >=
+                UncompiledDataWithoutPreParsedScope::kSize);
+
+  // Replace bytecode array with an uncompiled data array in-place.
+  BytecodeArray* compiled_data = shared_info->GetBytecodeArray();
+  Address compiled_data_start = compiled_data->address();
+  int compiled_data_size = compiled_data->Size();
+  MemoryChunk* chunk = MemoryChunk::FromAddress(compiled_data_start);
+
+  // Clear any recorded slots for the compiled data as being invalid.
+  RememberedSet<OLD_TO_NEW>::RemoveRange(
+      chunk, compiled_data_start, compiled_data_start + compiled_data_size,
+      SlotSet::PREFREE_EMPTY_BUCKETS);
+  RememberedSet<OLD_TO_OLD>::RemoveRange(
+      chunk, compiled_data_start, compiled_data_start + compiled_data_size,
+      SlotSet::PREFREE_EMPTY_BUCKETS);
+
+  // Swap the map, using set_map_after_allocation to avoid verify heap checks
+  // which are not necessary since we are doing this during the GC atomic pause.
+  compiled_data->set_map_after_allocation(
+      ReadOnlyRoots(heap()).uncompiled_data_without_pre_parsed_scope_map(),
+      SKIP_WRITE_BARRIER);
+
+  // Create a filler object for any left over space in the bytecode array.
+  if (!heap()->lo_space()->Contains(compiled_data)) {
+    heap()->CreateFillerObjectAt(
+        compiled_data->address() + UncompiledDataWithoutPreParsedScope::kSize,
+        compiled_data_size - UncompiledDataWithoutPreParsedScope::kSize,
+        ClearRecordedSlots::kNo);
+  }
+
+  // Initialize the uncompiled data. The write barrier is disabled during GC,
+  // so record the inferred name slot manually.
+  UncompiledData* uncompiled_data = UncompiledData::cast(compiled_data);
+  uncompiled_data->set_inferred_name(inferred_name, SKIP_WRITE_BARRIER);
+  RecordSlot(uncompiled_data,
+             HeapObject::RawField(uncompiled_data,
+                                  UncompiledData::kInferredNameOffset),
+             inferred_name);
+  uncompiled_data->set_start_position(start_position);
+  uncompiled_data->set_end_position(end_position);
+  uncompiled_data->set_function_literal_id(function_literal_id);
+  uncompiled_data->clear_padding();
+
+  // Mark the uncompiled data as black, and ensure all fields have already been
+  // marked.
+  DCHECK(non_atomic_marking_state()->IsBlackOrGrey(inferred_name));
+  non_atomic_marking_state()->WhiteToBlack(uncompiled_data);
+
+  // Use the raw function data setter to avoid validity checks, since we're
+  // performing the unusual task of decompiling.
+  shared_info->set_function_data(uncompiled_data, SKIP_WRITE_BARRIER);
+  DCHECK(!shared_info->is_compiled());
+}
+
+void MarkCompactCollector::ClearOldBytecodeCandidates() {
+  DCHECK(FLAG_flush_bytecode ||
+         weak_objects_.bytecode_flushing_candidates.IsEmpty());
+  SharedFunctionInfo* flushing_candidate;
+  while (weak_objects_.bytecode_flushing_candidates.Pop(kMainThread,
+                                                        &flushing_candidate)) {
+    // If the BytecodeArray is dead, flush it, which will replace the field
+    // with an uncompiled data object.
+    if (!non_atomic_marking_state()->IsBlackOrGrey(
+            flushing_candidate->GetBytecodeArray())) {
+      FlushBytecodeFromSFI(flushing_candidate);
+    }
+
+    // Now record the slot, which has either been updated to an uncompiled
+    // data, or is the BytecodeArray which is still alive.
+    ObjectSlot slot = HeapObject::RawField(
+        flushing_candidate, SharedFunctionInfo::kFunctionDataOffset);
+    RecordSlot(flushing_candidate, slot, HeapObject::cast(*slot));
+  }
+}
+
 void MarkCompactCollector::ClearPotentialSimpleMapTransition(Map dead_target) {
   DCHECK(non_atomic_marking_state()->IsWhite(dead_target));
   Object* potential_parent = dead_target->constructor_or_backpointer();
@@ -1918,7 +2067,9 @@ void MarkCompactCollector::ClearPotentialSimpleMapTransition(Map map,
   if (descriptors == dead_target->instance_descriptors() &&
       number_of_own_descriptors > 0) {
     TrimDescriptorArray(map, descriptors);
-    DCHECK(descriptors->number_of_descriptors() == number_of_own_descriptors);
+    DCHECK_IMPLIES(
+        !FLAG_deduplicate_descriptor_arrays,
+        descriptors->number_of_descriptors() == number_of_own_descriptors);
   }
 }
 
@@ -1996,8 +2147,96 @@ bool MarkCompactCollector::CompactTransitionArray(
   return descriptors_owner_died;
 }
 
+namespace {
+
+// Whether {descriptors} may be shared with maps from unrelated transition
+// trees. Field types and representations can be generalized in place, which
+// must never become visible to another tree, so only arrays whose fields are
+// already fully general (and thus can never change again) qualify.
+bool DescriptorArrayCanBeShared(DescriptorArray* descriptors) {
+  int nof_descriptors = descriptors->number_of_descriptors();
+  if (nof_descriptors == 0) return false;
+  for (int i = 0; i < nof_descriptors; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    if (details.location() != kField) return false;
+    if (details.constness() != PropertyConstness::kMutable) return false;
+    if (!details.representation().IsTagged()) return false;
+    if (!descriptors->GetFieldType(i).IsAny()) return false;
+  }
+  return true;
+}
+
+size_t DescriptorArrayContentHash(DescriptorArray* descriptors) {
+  int limit = DescriptorArray::kFirstIndex +
+              descriptors->number_of_descriptors() *
+                  DescriptorArray::kEntrySize;
+  size_t hash = static_cast<size_t>(descriptors->number_of_descriptors());
+  for (int i = DescriptorArray::kFirstIndex; i < limit; i++) {
+    hash = hash * 31 + static_cast<size_t>(descriptors->Get(i).ptr());
+  }
+  return hash;
+}
+
+bool DescriptorArrayContentEquals(DescriptorArray* a, DescriptorArray* b) {
+  int nof_descriptors = a->number_of_descriptors();
+  if (nof_descriptors != b->number_of_descriptors()) return false;
+  int limit = DescriptorArray::kFirstIndex +
+              nof_descriptors * DescriptorArray::kEntrySize;
+  for (int i = DescriptorArray::kFirstIndex; i < limit; i++) {
+    if (a->Get(i) != b->Get(i)) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+void MarkCompactCollector::DeduplicateDescriptorArrays() {
+  // Maps keys of {forwarding} to the canonical array for their contents;
+  // an array maps to itself when it is the canonical one (or ineligible).
+  std::unordered_map<DescriptorArray*, DescriptorArray*> forwarding;
+  std::unordered_map<size_t, std::vector<DescriptorArray*>> canonical_arrays;
+  HeapObjectIterator iterator(heap()->map_space());
+  for (HeapObject* object = iterator.Next(); object != nullptr;
+       object = iterator.Next()) {
+    if (!object->IsMap()) continue;
+    if (non_atomic_marking_state()->IsWhite(object)) continue;
+    Map map = Map::cast(object);
+    DescriptorArray* descriptors = map->instance_descriptors();
+    auto it = forwarding.find(descriptors);
+    if (it == forwarding.end()) {
+      DescriptorArray* canonical = descriptors;
+      if (DescriptorArrayCanBeShared(descriptors)) {
+        std::vector<DescriptorArray*>& bucket =
+            canonical_arrays[DescriptorArrayContentHash(descriptors)];
+        bool found = false;
+        for (DescriptorArray* candidate : bucket) {
+          if (DescriptorArrayContentEquals(descriptors, candidate)) {
+            canonical = candidate;
+            found = true;
+            break;
+          }
+        }
+        if (!found) bucket.push_back(descriptors);
+      }
+      it = forwarding.emplace(descriptors, canonical).first;
+    }
+    DescriptorArray* canonical = it->second;
+    if (canonical == descriptors) continue;
+    map->set_instance_descriptors(canonical, SKIP_WRITE_BARRIER);
+    RecordSlot(map, map.RawField(Map::kDescriptorsOffset), canonical);
+    // The canonical array already has an owner; this map must copy on its
+    // next descriptor addition rather than append into shared slack.
+    map->set_owns_descriptors(false);
+  }
+}
+
 void MarkCompactCollector::TrimDescriptorArray(Map map,
                                                DescriptorArray* descriptors) {
+  // Once descriptor arrays can be shared across transition trees, trimming
+  // an array to this map's descriptor count could cut off descriptors an
+  // unrelated live map still uses. Deduplication recovers the memory of
+  // dead-owner arrays instead.
+  if (FLAG_deduplicate_descriptor_arrays) return;
   int number_of_own_descriptors = map->NumberOfOwnDescriptors();
   if (number_of_own_descriptors == 0) {
     DCHECK(descriptors == ReadOnlyRoots(heap_).empty_descriptor_array());
@@ -2142,6 +2381,7 @@ void MarkCompactCollector::AbortWeakObjects() {
   weak_objects_.weak_references.Clear();
   weak_objects_.weak_objects_in_code.Clear();
   weak_objects_.js_weak_cells.Clear();
+  weak_objects_.bytecode_flushing_candidates.Clear();
 }
 
 bool MarkCompactCollector::IsOnEvacuationCandidate(MaybeObject obj) {
@@ -2637,7 +2877,29 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
                                  &page_parallel_job_semaphore_);
   intptr_t live_bytes = 0;
 
+  // Order evacuation candidates by the density of their old-to-old remembered
+  // sets. Pages that contain many pointers into other candidates end up
+  // adjacent in the item list, and since each evacuation task processes a
+  // contiguous range of items through its own compaction space, objects that
+  // reference each other tend to be moved by the same task and thus onto the
+  // same target pages. Computing exact page-to-page connectivity would require
+  // decoding every recorded slot during the atomic pause; the number of
+  // occupied slot set buckets serves as a cheap proxy.
+  using DensityPagePair = std::pair<int, Page*>;
+  std::vector<DensityPagePair> ranked_candidates;
+  ranked_candidates.reserve(old_space_evacuation_pages_.size());
   for (Page* page : old_space_evacuation_pages_) {
+    SlotSet* slots = page->slot_set<OLD_TO_OLD>();
+    ranked_candidates.emplace_back(
+        slots != nullptr ? slots->OccupiedBucketCount() : 0, page);
+  }
+  std::sort(ranked_candidates.begin(), ranked_candidates.end(),
+            [](const DensityPagePair& a, const DensityPagePair& b) {
+              return a.first > b.first;
+            });
+
+  for (const DensityPagePair& pair : ranked_candidates) {
+    Page* page = pair.second;
     live_bytes += non_atomic_marking_state()->live_bytes(page);
     evacuation_job.AddItem(new PageEvacuationItem(page));
   }
@@ -444,6 +444,10 @@ struct WeakObjects {
   Worklist<std::pair<HeapObject*, Code>, 64> weak_objects_in_code;
 
   Worklist<JSWeakCell*, 64> js_weak_cells;
+
+  // SharedFunctionInfos with old bytecode, whose bytecode is flushed if it is
+  // not otherwise strongly reachable when marking finishes.
+  Worklist<SharedFunctionInfo*, 64> bytecode_flushing_candidates;
 };
 
 struct EphemeronMarking {
@@ -613,6 +617,13 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // it to complete as requested by |stop_request|).
   void FinishConcurrentMarking(ConcurrentMarking::StopRequest stop_request);
 
+  // Hands the ephemerons discovered so far to the concurrent marking tasks.
+  // This lets ephemeron fixpoint iterations run off the main thread while the
+  // mutator is still executing, so that the atomic pause only has to perform
+  // a short final re-scan. Called when the incremental marking worklist runs
+  // empty before finalization.
+  void AdvanceEphemeronsConcurrently();
+
   bool StartCompaction();
 
   void AbortCompaction();
@@ -678,6 +689,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
     weak_objects_.js_weak_cells.Push(kMainThread, weak_cell);
   }
 
+  void AddBytecodeFlushingCandidate(SharedFunctionInfo* flush_candidate) {
+    weak_objects_.bytecode_flushing_candidates.Push(kMainThread,
+                                                    flush_candidate);
+  }
+
   void AddNewlyDiscovered(HeapObject* object) {
     if (ephemeron_marking_.newly_discovered_overflowed) return;
 
@@ -795,6 +811,15 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // and deoptimize dependent code of non-live maps.
   void ClearNonLiveReferences() override;
   void MarkDependentCodeForDeoptimization();
+
+  // Goes through the list of SharedFunctionInfos with bytecode that was old at
+  // marking start, and flushes the bytecode of those whose bytecode did not
+  // get marked in the meantime. Flushed functions recompile lazily on their
+  // next invocation.
+  void ClearOldBytecodeCandidates();
+  // Flushes a weakly held bytecode array from a shared function info, by
+  // converting the bytecode array to an uncompiled data object in place.
+  void FlushBytecodeFromSFI(SharedFunctionInfo* shared_info);
   // Checks if the given weak cell is a simple transition from the parent map
   // of the given dead target. If so it clears the transition and trims
   // the descriptor array of the parent if needed.
@@ -808,6 +833,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void TrimDescriptorArray(Map map, DescriptorArray* descriptors);
   void TrimEnumCache(Map map, DescriptorArray* descriptors);
 
+  // Redirects live maps whose descriptor arrays have identical contents to
+  // one canonical array, so the duplicates die in the next cycle. Only runs
+  // with --deduplicate-descriptor-arrays.
+  void DeduplicateDescriptorArrays();
+
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
   // The linked list of all encountered weak maps is destroyed.
@@ -928,6 +958,7 @@ class MarkingVisitor final
   V8_INLINE int VisitJSDataView(Map map, JSDataView* object);
   V8_INLINE int VisitJSTypedArray(Map map, JSTypedArray* object);
   V8_INLINE int VisitMap(Map map, Map object);
+  V8_INLINE int VisitSharedFunctionInfo(Map map, SharedFunctionInfo* object);
   V8_INLINE int VisitTransitionArray(Map map, TransitionArray* object);
   V8_INLINE int VisitJSWeakCell(Map map, JSWeakCell* object);
 
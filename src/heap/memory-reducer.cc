@@ -54,9 +54,13 @@ void MemoryReducer::TimerTask::RunInternal() {
   // 2) mutator is in background: optimize for memory flag is set.
   event.should_start_incremental_gc =
       low_allocation_rate || optimize_for_memory;
+  // While the embedder enforces a pause budget, memory reducer GCs are
+  // deferred; they are started again once the budget is cleared or from an
+  // idle window.
   event.can_start_incremental_gc =
       heap->incremental_marking()->IsStopped() &&
-      (heap->incremental_marking()->CanBeActivated() || optimize_for_memory);
+      (heap->incremental_marking()->CanBeActivated() || optimize_for_memory) &&
+      !heap->HasGCPauseBudget();
   event.committed_memory = heap->CommittedOldGenerationMemory();
   memory_reducer_->NotifyTimer(event);
 }
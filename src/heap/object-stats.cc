@@ -13,6 +13,7 @@
 #include "src/counters.h"
 #include "src/globals.h"
 #include "src/heap/heap-inl.h"
+#include "src/heap/item-parallel-job.h"
 #include "src/heap/mark-compact.h"
 #include "src/isolate.h"
 #include "src/objects/compilation-cache-inl.h"
@@ -22,6 +23,7 @@
 #include "src/objects/slots.h"
 #include "src/objects/templates.h"
 #include "src/utils.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -315,6 +317,22 @@ void ObjectStats::RecordVirtualObjectStats(VirtualInstanceType type,
                            [HistogramIndexFromSize(size)]++;
 }
 
+void ObjectStats::Merge(const ObjectStats& other) {
+  for (int i = 0; i < OBJECT_STATS_COUNT; i++) {
+    object_counts_[i] += other.object_counts_[i];
+    object_sizes_[i] += other.object_sizes_[i];
+    over_allocated_[i] += other.over_allocated_[i];
+    for (int j = 0; j < kNumberOfBuckets; j++) {
+      size_histogram_[i][j] += other.size_histogram_[i][j];
+      over_allocated_histogram_[i][j] += other.over_allocated_histogram_[i][j];
+    }
+  }
+  tagged_fields_count_ += other.tagged_fields_count_;
+  embedder_fields_count_ += other.embedder_fields_count_;
+  unboxed_double_fields_count_ += other.unboxed_double_fields_count_;
+  raw_fields_count_ += other.raw_fields_count_;
+}
+
 Isolate* ObjectStats::isolate() { return heap()->isolate(); }
 
 class ObjectStatsCollectorImpl {
@@ -724,6 +742,8 @@ void ObjectStatsCollectorImpl::CollectGlobalStatistics() {
                                  ObjectStats::STRING_SPLIT_CACHE_TYPE);
   RecordSimpleVirtualObjectStats(nullptr, heap_->regexp_multiple_cache(),
                                  ObjectStats::REGEXP_MULTIPLE_CACHE_TYPE);
+  RecordSimpleVirtualObjectStats(nullptr, heap_->regexp_replace_plan_cache(),
+                                 ObjectStats::REGEXP_REPLACE_PLAN_CACHE_TYPE);
   RecordSimpleVirtualObjectStats(nullptr, heap_->retained_maps(),
                                  ObjectStats::RETAINED_MAPS_TYPE);
 
@@ -1013,16 +1033,143 @@ void IterateHeap(Heap* heap, ObjectStatsVisitor* visitor) {
   }
 }
 
+// Work item of parallel stats collection, covering the objects of a single
+// page or large page.
+class ObjectStatsItem : public ItemParallelJob::Item {
+ public:
+  virtual void Process(ObjectStatsVisitor* visitor) = 0;
+};
+
+class PageStatsItem final : public ObjectStatsItem {
+ public:
+  explicit PageStatsItem(Page* page) : page_(page) {}
+
+  void Process(ObjectStatsVisitor* visitor) override {
+    HeapObjectIterator it(page_);
+    for (HeapObject* obj = it.Next(); obj != nullptr; obj = it.Next()) {
+      visitor->Visit(obj, obj->Size());
+    }
+  }
+
+ private:
+  Page* page_;
+};
+
+class LargePageStatsItem final : public ObjectStatsItem {
+ public:
+  explicit LargePageStatsItem(LargePage* page) : page_(page) {}
+
+  void Process(ObjectStatsVisitor* visitor) override {
+    HeapObject* obj = page_->GetObject();
+    visitor->Visit(obj, obj->Size());
+  }
+
+ private:
+  LargePage* page_;
+};
+
+// Collects stats into task-local accumulators and merges them into the
+// global ones at the end. Note that deduplication of owned sub-objects
+// (e.g. shared COW arrays) is per task; owners on pages processed by
+// different tasks may record the same sub-object twice. Owners are usually
+// allocated close to their backing stores, so this is rare in practice.
+class ParallelObjectStatsTask final : public ItemParallelJob::Task {
+ public:
+  ParallelObjectStatsTask(Isolate* isolate, Heap* heap, ObjectStats* live,
+                          ObjectStats* dead, base::Mutex* merge_mutex)
+      : ItemParallelJob::Task(isolate),
+        heap_(heap),
+        local_live_(heap),
+        local_dead_(heap),
+        live_(live),
+        dead_(dead),
+        merge_mutex_(merge_mutex) {}
+
+  void RunInParallel() override {
+    ObjectStatsCollectorImpl live_collector(heap_, &local_live_);
+    ObjectStatsCollectorImpl dead_collector(heap_, &local_dead_);
+    ObjectStatsItem* item = nullptr;
+    while ((item = GetItem<ObjectStatsItem>()) != nullptr) {
+      for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+        ObjectStatsVisitor visitor(
+            heap_, &live_collector, &dead_collector,
+            static_cast<ObjectStatsCollectorImpl::Phase>(i));
+        item->Process(&visitor);
+      }
+      item->MarkFinished();
+    }
+    base::MutexGuard guard(merge_mutex_);
+    live_->Merge(local_live_);
+    dead_->Merge(local_dead_);
+  }
+
+ private:
+  Heap* const heap_;
+  ObjectStats local_live_;
+  ObjectStats local_dead_;
+  ObjectStats* const live_;
+  ObjectStats* const dead_;
+  base::Mutex* const merge_mutex_;
+};
+
+void IterateHeapInParallel(Heap* heap, ObjectStats* live, ObjectStats* dead,
+                           ObjectStatsCollectorImpl* main_live_collector,
+                           ObjectStatsCollectorImpl* main_dead_collector) {
+  base::Semaphore semaphore(0);
+  base::Mutex merge_mutex;
+  ItemParallelJob job(heap->isolate()->cancelable_task_manager(), &semaphore);
+
+  PagedSpace* paged_spaces[] = {heap->old_space(), heap->code_space(),
+                                heap->map_space(), heap->read_only_space()};
+  for (PagedSpace* space : paged_spaces) {
+    for (Page* page : *space) {
+      job.AddItem(new PageStatsItem(page));
+    }
+  }
+  for (LargePage* page : *heap->lo_space()) {
+    job.AddItem(new LargePageStatsItem(page));
+  }
+  for (LargePage* page : *heap->new_lo_space()) {
+    job.AddItem(new LargePageStatsItem(page));
+  }
+
+  // The semispaces of new space are iterated on the main thread with the
+  // main collectors; they are small compared to the paged spaces.
+  for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+    ObjectStatsVisitor visitor(heap, main_live_collector, main_dead_collector,
+                               static_cast<ObjectStatsCollectorImpl::Phase>(i));
+    std::unique_ptr<ObjectIterator> it(heap->new_space()->GetObjectIterator());
+    for (HeapObject* obj = it->Next(); obj != nullptr; obj = it->Next()) {
+      visitor.Visit(obj, obj->Size());
+    }
+  }
+
+  const int num_tasks =
+      Min(job.NumberOfItems(),
+          V8::GetCurrentPlatform()->NumberOfWorkerThreads() + 1);
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(new ParallelObjectStatsTask(heap->isolate(), heap, live, dead,
+                                            &merge_mutex));
+  }
+  job.Run(heap->isolate()->async_counters());
+}
+
 }  // namespace
 
 void ObjectStatsCollector::Collect() {
   ObjectStatsCollectorImpl live_collector(heap_, live_);
   ObjectStatsCollectorImpl dead_collector(heap_, dead_);
   live_collector.CollectGlobalStatistics();
-  for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
-    ObjectStatsVisitor visitor(heap_, &live_collector, &dead_collector,
-                               static_cast<ObjectStatsCollectorImpl::Phase>(i));
-    IterateHeap(heap_, &visitor);
+  if (FLAG_parallel_object_stats) {
+    IterateHeapInParallel(heap_, live_, dead_, &live_collector,
+                          &dead_collector);
+  } else {
+    for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+      ObjectStatsVisitor visitor(
+          heap_, &live_collector, &dead_collector,
+          static_cast<ObjectStatsCollectorImpl::Phase>(i));
+      IterateHeap(heap_, &visitor);
+    }
   }
 }
 
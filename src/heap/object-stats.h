@@ -54,6 +54,7 @@
   V(OTHER_CONTEXT_TYPE)                          \
   V(PROTOTYPE_USERS_TYPE)                        \
   V(REGEXP_MULTIPLE_CACHE_TYPE)                  \
+  V(REGEXP_REPLACE_PLAN_CACHE_TYPE)              \
   V(RELOC_INFO_TYPE)                             \
   V(RETAINED_MAPS_TYPE)                          \
   V(SCRIPT_LIST_TYPE)                            \
@@ -110,6 +111,10 @@ class ObjectStats {
   void RecordVirtualObjectStats(VirtualInstanceType type, size_t size,
                                 size_t over_allocated);
 
+  // Accumulates the counts, sizes and histograms of another accumulator.
+  // Used to merge the per-task accumulators of parallel stats collection.
+  void Merge(const ObjectStats& other);
+
   size_t object_count_last_gc(size_t index) {
     return object_counts_last_time_[index];
   }
@@ -46,6 +46,10 @@ bool Scavenger::PromotionList::View::ShouldEagerlyProcessPromotionList() {
   return promotion_list_->ShouldEagerlyProcessPromotionList(task_id_);
 }
 
+void Scavenger::PromotionList::View::FlushPushSegmentsToGlobal() {
+  promotion_list_->FlushPushSegmentsToGlobal(task_id_);
+}
+
 void Scavenger::PromotionList::PushRegularObject(int task_id,
                                                  HeapObject* object, int size) {
   regular_object_promotion_list_.Push(task_id, ObjectAndSize(object, size));
@@ -83,6 +87,16 @@ bool Scavenger::PromotionList::IsGlobalPoolEmpty() {
          large_object_promotion_list_.IsGlobalPoolEmpty();
 }
 
+void Scavenger::PromotionList::FlushPushSegmentsToGlobal(int task_id) {
+  regular_object_promotion_list_.FlushPushSegmentToGlobal(task_id);
+  large_object_promotion_list_.FlushPushSegmentToGlobal(task_id);
+}
+
+size_t Scavenger::PromotionList::StolenSegments() const {
+  return regular_object_promotion_list_.StolenSegments() +
+         large_object_promotion_list_.StolenSegments();
+}
+
 bool Scavenger::PromotionList::ShouldEagerlyProcessPromotionList(int task_id) {
   // Threshold when to prioritize processing of the promotion list. Right
   // now we only look into the regular object list.
@@ -236,6 +250,11 @@ bool Scavenger::HandleLargeObject(Map map, HeapObject* object,
   return false;
 }
 
+void Scavenger::RecordPageSurvival(HeapObject* object, int object_size) {
+  if (V8_LIKELY(!FLAG_scavenge_survival_promotion)) return;
+  Page::FromAddress(object->address())->AddSurvivedBytes(object_size);
+}
+
 SlotCallbackResult Scavenger::EvacuateObjectDefault(Map map,
                                                     HeapObjectSlot slot,
                                                     HeapObject* object,
@@ -254,6 +273,7 @@ SlotCallbackResult Scavenger::EvacuateObjectDefault(Map map,
     // try to promote the object.
     result = SemiSpaceCopyObject(map, slot, object, object_size);
     if (result != CopyAndForwardResult::FAILURE) {
+      RecordPageSurvival(object, object_size);
       return RememberedSetEntryNeeded(result);
     }
   }
@@ -263,12 +283,14 @@ SlotCallbackResult Scavenger::EvacuateObjectDefault(Map map,
   // failed.
   result = PromoteObject(map, slot, object, object_size);
   if (result != CopyAndForwardResult::FAILURE) {
+    RecordPageSurvival(object, object_size);
     return RememberedSetEntryNeeded(result);
   }
 
   // If promotion failed, we try to copy the object to the other semi-space.
   result = SemiSpaceCopyObject(map, slot, object, object_size);
   if (result != CopyAndForwardResult::FAILURE) {
+    RecordPageSurvival(object, object_size);
     return RememberedSetEntryNeeded(result);
   }
 
@@ -51,9 +51,12 @@ class ScavengingTask final : public ItemParallelJob::Task {
         item->Process(scavenger_);
         item->MarkFinished();
       }
+      bool done;
       do {
         scavenger_->Process(barrier_);
-      } while (!barrier_->Wait());
+        done = barrier_->Wait();
+        if (!done) scavenger_->NotifyIdleRound();
+      } while (!done);
       scavenger_->Process();
     }
     if (FLAG_trace_parallel_scavenge) {
@@ -230,10 +233,15 @@ void ScavengerCollector::CollectGarbage() {
       // Finalize parallel scavenging.
       TRACE_GC(heap_->tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE_FINALIZE);
 
+      size_t idle_rounds = 0;
       for (int i = 0; i < num_scavenge_tasks; i++) {
+        idle_rounds += scavengers[i]->idle_rounds();
         scavengers[i]->Finalize();
         delete scavengers[i];
       }
+      heap_->tracer()->AddScavengerWorkStealingStats(
+          copied_list.StolenSegments() + promotion_list.StolenSegments(),
+          idle_rounds);
 
       HandleSurvivingNewLargeObjects();
     }
@@ -277,6 +285,17 @@ void ScavengerCollector::CollectGarbage() {
     }
   });
 
+  if (V8_UNLIKELY(FLAG_scavenge_survival_promotion)) {
+    // Record the survival history of the evacuated pages. It feeds the
+    // promotion decisions of the next scavenge, see Heap::ShouldBePromoted.
+    for (Page* page :
+         PageRange(heap_->new_space()->from_space().first_page(), nullptr)) {
+      page->set_last_survival_rate(100 * page->survived_bytes() /
+                                   static_cast<intptr_t>(page->area_size()));
+      page->ResetSurvivedBytes();
+    }
+  }
+
   // Update how much has survived scavenge.
   heap_->IncrementYoungSurvivorsCounter(heap_->SurvivedNewSpaceObjectSize());
 
@@ -333,6 +352,7 @@ Scavenger::Scavenger(ScavengerCollector* collector, Heap* heap, bool is_logging,
       local_pretenuring_feedback_(kInitialLocalPretenuringFeedbackCapacity),
       copied_size_(0),
       promoted_size_(0),
+      idle_rounds_(0),
       allocator_(heap),
       is_logging_(is_logging),
       is_incremental_marking_(heap->incremental_marking()->IsMarking()),
@@ -395,6 +415,12 @@ void Scavenger::Process(OneshotBarrier* barrier) {
       scavenge_visitor.Visit(object_and_size.first);
       done = false;
       if (have_barrier && ((++objects % kInterruptThreshold) == 0)) {
+        if (copied_list_.IsGlobalPoolEmpty() &&
+            copied_list_.LocalPushSegmentSize() > 0) {
+          // Other tasks may be starving for work. Publish the local push
+          // segment so that it can be stolen.
+          copied_list_.FlushPushSegmentToGlobal();
+        }
         if (!copied_list_.IsGlobalPoolEmpty()) {
           barrier->NotifyAll();
         }
@@ -408,6 +434,10 @@ void Scavenger::Process(OneshotBarrier* barrier) {
       IterateAndScavengePromotedObject(target, entry.map, entry.size);
       done = false;
       if (have_barrier && ((++objects % kInterruptThreshold) == 0)) {
+        if (promotion_list_.IsGlobalPoolEmpty() &&
+            promotion_list_.LocalPushSegmentSize() > 0) {
+          promotion_list_.FlushPushSegmentsToGlobal();
+        }
         if (!promotion_list_.IsGlobalPoolEmpty()) {
           barrier->NotifyAll();
         }
@@ -73,6 +73,7 @@ class Scavenger {
       inline bool Pop(struct PromotionListEntry* entry);
       inline bool IsGlobalPoolEmpty();
       inline bool ShouldEagerlyProcessPromotionList();
+      inline void FlushPushSegmentsToGlobal();
 
      private:
       PromotionList* promotion_list_;
@@ -91,6 +92,8 @@ class Scavenger {
     inline bool Pop(int task_id, struct PromotionListEntry* entry);
     inline bool IsGlobalPoolEmpty();
     inline bool ShouldEagerlyProcessPromotionList(int task_id);
+    inline void FlushPushSegmentsToGlobal(int task_id);
+    inline size_t StolenSegments() const;
 
    private:
     static const int kRegularObjectPromotionListSegmentSize = 256;
@@ -127,6 +130,11 @@ class Scavenger {
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
 
+  // Notifies the scavenger that its task went idle waiting for work published
+  // by other tasks. Only called from the task owning this scavenger.
+  void NotifyIdleRound() { idle_rounds_++; }
+  size_t idle_rounds() const { return idle_rounds_; }
+
  private:
   // Number of objects to process before interrupting for potentially waking
   // up other tasks.
@@ -171,6 +179,10 @@ class Scavenger {
   V8_INLINE bool HandleLargeObject(Map map, HeapObject* object,
                                    int object_size);
 
+  // Accounts a surviving object on its from-space page when per-page
+  // survival tracking is enabled.
+  V8_INLINE void RecordPageSurvival(HeapObject* object, int object_size);
+
   // Different cases for object evacuation.
   V8_INLINE SlotCallbackResult EvacuateObjectDefault(Map map,
                                                      HeapObjectSlot slot,
@@ -197,6 +209,7 @@ class Scavenger {
   Heap::PretenuringFeedbackMap local_pretenuring_feedback_;
   size_t copied_size_;
   size_t promoted_size_;
+  size_t idle_rounds_;
   LocalAllocator allocator_;
   SurvivingNewLargeObjectsMap surviving_new_large_objects_;
   const bool is_logging_;
@@ -760,11 +760,13 @@ void Heap::CreateInitialObjects() {
   set_number_string_cache(
       *factory->NewFixedArray(kInitialNumberStringCacheSize * 2, TENURED));
 
-  // Allocate cache for string split and regexp-multiple.
+  // Allocate cache for string split, regexp-multiple and replace-plan.
   set_string_split_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
   set_regexp_multiple_cache(*factory->NewFixedArray(
       RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
+  set_regexp_replace_plan_cache(*factory->NewFixedArray(
+      RegExpResultsCache::kRegExpResultsCacheSize, TENURED));
 
   // Allocate FeedbackCell for builtins.
   Handle<FeedbackCell> many_closures_cell =
@@ -925,6 +927,12 @@ void Heap::CreateInitialObjects() {
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
 
+  // Initialize transition cache.
+  isolate_->transition_lookup_cache()->Clear();
+
+  // Initialize property lookup cache.
+  isolate_->property_lookup_cache()->Clear();
+
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
 }
@@ -101,6 +101,18 @@ class SlotSet : public Malloced {
     }
   }
 
+  // Returns the number of allocated buckets, i.e. buckets into which at least
+  // one slot has been recorded. This is a cheap, coarse measure of how densely
+  // the page is covered with recorded slots; note that buckets kept alive via
+  // KEEP_EMPTY_BUCKETS count even if all their slots have been removed again.
+  int OccupiedBucketCount() {
+    int count = 0;
+    for (int i = 0; i < kBuckets; i++) {
+      if (LoadBucket(&buckets_[i]) != nullptr) count++;
+    }
+    return count;
+  }
+
   // The slot offsets specify a range of slots at addresses:
   // [page_start_ + start_offset ... page_start_ + end_offset).
   void RemoveRange(int start_offset, int end_offset, EmptyBucketMode mode) {
@@ -204,6 +204,14 @@ void MemoryAllocator::InitializeCodePageAllocator(
       NewEvent("CodeRange", reinterpret_cast<void*>(reservation.address()),
                requested));
 
+  if (FLAG_transparent_huge_pages) {
+    // Generated code suffers most from iTLB misses, so hint the whole code
+    // range at once; the kernel backs 2MB sub-regions with huge pages as
+    // they become resident.
+    page_allocator->AdviseHugePages(reinterpret_cast<void*>(aligned_base),
+                                    size);
+  }
+
   heap_reservation_.TakeControl(&reservation);
   code_page_allocator_instance_ = base::make_unique<base::BoundedPageAllocator>(
       page_allocator, aligned_base, size,
@@ -418,6 +426,16 @@ bool MemoryAllocator::UncommitMemory(VirtualMemory* reservation) {
   return true;
 }
 
+bool MemoryAllocator::DiscardMemory(VirtualMemory* reservation) {
+  size_t size = reservation->size();
+  if (!reservation->page_allocator()->DiscardSystemPages(
+          reinterpret_cast<void*>(reservation->address()), size)) {
+    return false;
+  }
+  isolate_->counters()->memory_allocated()->Decrement(static_cast<int>(size));
+  return true;
+}
+
 void MemoryAllocator::FreeMemory(v8::PageAllocator* page_allocator,
                                  Address base, size_t size) {
   CHECK(FreePages(page_allocator, reinterpret_cast<void*>(base), size));
@@ -619,6 +637,8 @@ MemoryChunk* MemoryChunk::Initialize(Heap* heap, Address base, size_t size,
   chunk->mutex_ = new base::Mutex();
   chunk->allocated_bytes_ = chunk->area_size();
   chunk->wasted_memory_ = 0;
+  chunk->survived_bytes_ = 0;
+  chunk->last_survival_rate_ = kUnknownSurvivalRate;
   chunk->young_generation_bitmap_ = nullptr;
   chunk->marking_bitmap_ = nullptr;
   chunk->local_tracker_ = nullptr;
@@ -862,6 +882,15 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
     area_end = area_start + commit_area_size;
   }
 
+  if (FLAG_transparent_huge_pages &&
+      (executable == EXECUTABLE || owner->identity() == RO_SPACE)) {
+    // Chunks inside the code range are already covered by the range-wide
+    // hint; repeating it per chunk is harmless and also covers executable
+    // chunks on targets without a code range as well as read-only pages.
+    this->page_allocator(executable)
+        ->AdviseHugePages(reinterpret_cast<void*>(base), chunk_size);
+  }
+
   // Use chunk_size for statistics and callbacks because we assume that they
   // treat reserved but not-yet committed memory regions of chunks as allocated.
   isolate_->counters()->memory_allocated()->Increment(
@@ -1076,7 +1105,14 @@ void MemoryAllocator::PerformFreeMemory(MemoryChunk* chunk) {
 
   VirtualMemory* reservation = chunk->reserved_memory();
   if (chunk->IsFlagSet(MemoryChunk::POOLED)) {
-    UncommitMemory(reservation);
+    if (FLAG_discard_pooled_pages) {
+      // Keep the page readable and writable: AllocatePagePooled can then hand
+      // it out again without changing permissions, so a pool round-trip costs
+      // one madvise instead of two mprotect calls.
+      DiscardMemory(reservation);
+    } else {
+      UncommitMemory(reservation);
+    }
   } else {
     if (reservation->IsReserved()) {
       reservation->Free();
@@ -1097,7 +1133,8 @@ void MemoryAllocator::Free(MemoryChunk* chunk) {
       PerformFreeMemory(chunk);
       break;
     case kAlreadyPooled:
-      // Pooled pages cannot be touched anymore as their memory is uncommitted.
+      // Pooled pages cannot be touched anymore as their memory is uncommitted
+      // or, with --discard-pooled-pages, holds undefined contents.
       // Pooled pages are not-executable.
       FreeMemory(data_page_allocator(), chunk->address(),
                  static_cast<size_t>(MemoryChunk::kPageSize));
@@ -1176,7 +1213,15 @@ MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
   // Pooled pages are always regular data pages.
   DCHECK_NE(CODE_SPACE, owner->identity());
   VirtualMemory reservation(data_page_allocator(), start, size);
-  if (!CommitMemory(&reservation)) return nullptr;
+  if (FLAG_discard_pooled_pages) {
+    // The page went into the pool via DiscardMemory, so it is still readable
+    // and writable; its contents are undefined though, and only the
+    // accounting has to be restored here.
+    UpdateAllocatedSpaceLimits(start, start + size);
+    isolate_->counters()->memory_allocated()->Increment(static_cast<int>(size));
+  } else if (!CommitMemory(&reservation)) {
+    return nullptr;
+  }
   if (Heap::ShouldZapGarbage()) {
     ZapBlock(start, size, kZapValue);
   }
@@ -3277,6 +3322,16 @@ void ReadOnlySpace::SetPermissionsForPages(PageAllocator::Permission access) {
         memory_allocator->page_allocator(page->executable());
     CHECK(SetPermissions(page_allocator, page->address() + area_start_offset,
                          page->size() - area_start_offset, access));
+
+    if (access == PageAllocator::kRead && FLAG_mergeable_read_only_pages) {
+      // The sealed read-only space is identical in every isolate
+      // deserialized from the same snapshot and is never written again, so
+      // let the kernel deduplicate its resident pages across isolates (and
+      // processes) where same-page merging is available.
+      page_allocator->AdviseMergeablePages(
+          reinterpret_cast<void*>(page->address() + area_start_offset),
+          page->size() - area_start_offset);
+    }
   }
 }
 
@@ -3410,6 +3465,14 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
     return AllocationResult::Retry(identity());
   }
 
+  // Synchronize against in-flight concurrent sweeping of dead large pages
+  // before growing the space, similar to how paged spaces contribute to
+  // sweeping on the slow allocation path.
+  Sweeper* sweeper = heap()->mark_compact_collector()->sweeper();
+  if (sweeper->sweeping_in_progress() && sweeper->HasDeadLargePages()) {
+    sweeper->EnsureDeadLargePagesFreed();
+  }
+
   LargePage* page = AllocateLargePage(object_size, executable);
   if (page == nullptr) return AllocationResult::Retry(identity());
   page->SetOldGenerationPageFlags(heap()->incremental_marking()->IsMarking());
@@ -3508,6 +3571,9 @@ void LargeObjectSpace::RemoveChunkMapEntries(LargePage* page) {
 
 void LargeObjectSpace::RemoveChunkMapEntries(LargePage* page,
                                              Address free_start) {
+  // There may be concurrent access on the chunk map. We have to take the lock
+  // here.
+  base::MutexGuard guard(&chunk_map_mutex_);
   for (Address current = ::RoundUp(free_start, MemoryChunk::kPageSize);
        current < reinterpret_cast<Address>(page) + page->size();
        current += MemoryChunk::kPageSize) {
@@ -3582,9 +3648,15 @@ void LargeObjectSpace::FreeUnmarkedObjects() {
       AccountUncommitted(current->size());
       page_count_--;
 
-      RemoveChunkMapEntries(current);
-      heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(
-          current);
+      if (FLAG_concurrent_sweeping) {
+        // Defer removal of the chunk map entries and freeing of the page to
+        // the concurrent large-object sweeping phase.
+        heap()->mark_compact_collector()->sweeper()->AddDeadLargePage(current);
+      } else {
+        RemoveChunkMapEntries(current);
+        heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(
+            current);
+      }
     }
     current = next_current;
   }
@@ -323,7 +323,12 @@ class MemoryChunk {
 
     // |INCREMENTAL_MARKING|: Indicates whether incremental marking is currently
     // enabled.
-    INCREMENTAL_MARKING = 1u << 18
+    INCREMENTAL_MARKING = 1u << 18,
+
+    // |PINNED|: The page was pinned through the Heap pinning API and must not
+    // be selected as an evacuation candidate. In contrast to |NEVER_EVACUATE|
+    // the flag can be cleared again when the last pin is removed.
+    PINNED = 1u << 19
   };
 
   using Flags = uintptr_t;
@@ -393,7 +398,9 @@ class MemoryChunk {
       // FreeListCategory categories_[kNumberOfCategories]
       + kPointerSize  // LocalArrayBufferTracker* local_tracker_
       + kIntptrSize   // std::atomic<intptr_t> young_generation_live_byte_count_
-      + kPointerSize;  // Bitmap* young_generation_bitmap_
+      + kPointerSize  // Bitmap* young_generation_bitmap_
+      + kIntptrSize   // std::atomic<intptr_t> survived_bytes_
+      + kIntptrSize;  // intptr_t last_survival_rate_
 
   // Page size in bytes.  This must be a multiple of the OS page size.
   static const int kPageSize = 1 << kPageSizeBits;
@@ -605,6 +612,31 @@ class MemoryChunk {
 
   void MarkNeverEvacuate() { SetFlag(NEVER_EVACUATE); }
 
+  bool IsPinned() { return IsFlagSet(PINNED); }
+
+  void SetPinned(bool pinned) {
+    if (pinned) {
+      SetFlag(PINNED);
+    } else {
+      ClearFlag(PINNED);
+    }
+  }
+
+  static const intptr_t kUnknownSurvivalRate = -1;
+
+  void AddSurvivedBytes(intptr_t bytes) {
+    survived_bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+  intptr_t survived_bytes() const {
+    return survived_bytes_.load(std::memory_order_relaxed);
+  }
+  void ResetSurvivedBytes() {
+    survived_bytes_.store(0, std::memory_order_relaxed);
+  }
+
+  intptr_t last_survival_rate() const { return last_survival_rate_; }
+  void set_last_survival_rate(intptr_t rate) { last_survival_rate_ = rate; }
+
   bool CanAllocate() {
     return !IsEvacuationCandidate() && !IsFlagSet(NEVER_ALLOCATE_ON_PAGE);
   }
@@ -739,6 +771,15 @@ class MemoryChunk {
   std::atomic<intptr_t> young_generation_live_byte_count_;
   Bitmap* young_generation_bitmap_;
 
+  // Bytes that were evacuated off this page in the current scavenge. Only
+  // maintained for new space pages when --scavenge-survival-promotion is
+  // enabled.
+  std::atomic<intptr_t> survived_bytes_;
+
+  // Survival rate in percent observed when this page was evacuated last, or
+  // kUnknownSurvivalRate if the page has not been evacuated yet.
+  intptr_t last_survival_rate_;
+
  private:
   void InitializeReservedMemory() { reservation_.Reset(); }
 
@@ -1353,6 +1394,13 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   // it succeeded and false otherwise.
   bool UncommitMemory(VirtualMemory* reservation);
 
+  // Give the memory region owned by given reservation object back to the
+  // operating system without changing its permissions. The contents become
+  // undefined but the pages remain immediately reusable, which makes this
+  // cheaper than an uncommit/recommit pair for pooled pages. Returns true if
+  // it succeeded and false otherwise.
+  bool DiscardMemory(VirtualMemory* reservation);
+
   // Zaps a contiguous block of memory [start..(start+size)[ with
   // a given zap value.
   void ZapBlock(Address start, size_t size, uintptr_t zap_value);
@@ -24,6 +24,7 @@ StoreBuffer::StoreBuffer(Heap* heap)
     start_[i] = nullptr;
     limit_[i] = nullptr;
     lazy_top_[i] = nullptr;
+    buffer_processing_[i] = false;
   }
   task_running_ = false;
   insertion_callback = &InsertDuringRuntime;
@@ -133,69 +134,121 @@ int StoreBuffer::StoreBufferOverflow(Isolate* isolate) {
 }
 
 void StoreBuffer::FlipStoreBuffers() {
-  base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
+  int other;
+  {
+    base::MutexGuard guard(&mutex_);
+    other = (current_ + 1) % kStoreBuffers;
+  }
+  // Drain the other buffer if the concurrent task has not claimed it yet and
+  // then wait until any in-flight processing is done, so that the buffer is
+  // free for reuse and entries stay ordered.
   MoveEntriesToRememberedSet(other);
-  lazy_top_[current_] = top_;
-  current_ = other;
-  top_ = start_[current_];
+  {
+    base::MutexGuard guard(&mutex_);
+    while (buffer_processing_[other]) processing_done_.Wait(&mutex_);
+    lazy_top_[current_] = top_;
+    current_ = other;
+    top_ = start_[current_];
 
-  if (!task_running_ && FLAG_concurrent_store_buffer) {
-    task_running_ = true;
-    V8::GetCurrentPlatform()->CallOnWorkerThread(
-        base::make_unique<Task>(heap_->isolate(), this));
+    if (!task_running_ && FLAG_concurrent_store_buffer) {
+      task_running_ = true;
+      V8::GetCurrentPlatform()->CallOnWorkerThread(
+          base::make_unique<Task>(heap_->isolate(), this));
+    }
   }
 }
 
 void StoreBuffer::MoveEntriesToRememberedSet(int index) {
-  if (!lazy_top_[index]) return;
   DCHECK_GE(index, 0);
   DCHECK_LT(index, kStoreBuffers);
+  Address* top;
+  {
+    // Claim the buffer under the lock and process its entries without
+    // holding it, so that the mutator and GC never serialize on a drain in
+    // progress.
+    base::MutexGuard guard(&mutex_);
+    top = lazy_top_[index];
+    if (!top) return;
+    lazy_top_[index] = nullptr;
+    DCHECK(!buffer_processing_[index]);
+    buffer_processing_[index] = true;
+  }
   Address last_inserted_addr = kNullAddress;
+  MemoryChunk* last_chunk = nullptr;
+  size_t merged_entries = 0;
 
-  // We are taking the chunk map mutex here because the page lookup of addr
-  // below may require us to check if addr is part of a large page.
-  base::MutexGuard guard(heap_->lo_space()->chunk_map_mutex());
-  for (Address* current = start_[index]; current < lazy_top_[index];
-       current++) {
-    Address addr = *current;
-    MemoryChunk* chunk = MemoryChunk::FromAnyPointerAddress(heap_, addr);
-    if (IsDeletionAddress(addr)) {
-      last_inserted_addr = kNullAddress;
-      current++;
-      Address end = *current;
-      DCHECK(!IsDeletionAddress(end));
-      addr = UnmarkDeletionAddress(addr);
-      if (end) {
-        RememberedSet<OLD_TO_NEW>::RemoveRange(chunk, addr, end,
-                                               SlotSet::PREFREE_EMPTY_BUCKETS);
-      } else {
-        RememberedSet<OLD_TO_NEW>::Remove(chunk, addr);
+  {
+    // We are taking the chunk map mutex here because the page lookup of addr
+    // below may require us to check if addr is part of a large page.
+    base::MutexGuard guard(heap_->lo_space()->chunk_map_mutex());
+    for (Address* current = start_[index]; current < top; current++) {
+      Address addr = *current;
+      MemoryChunk* chunk = last_chunk;
+      if (chunk == nullptr ||
+          UnmarkDeletionAddress(addr) - chunk->address() >= chunk->size()) {
+        chunk = MemoryChunk::FromAnyPointerAddress(heap_, addr);
+        last_chunk = chunk;
       }
-    } else {
-      DCHECK(!IsDeletionAddress(addr));
-      if (addr != last_inserted_addr) {
-        RememberedSet<OLD_TO_NEW>::Insert(chunk, addr);
-        last_inserted_addr = addr;
+      merged_entries++;
+      if (IsDeletionAddress(addr)) {
+        last_inserted_addr = kNullAddress;
+        current++;
+        Address end = *current;
+        DCHECK(!IsDeletionAddress(end));
+        addr = UnmarkDeletionAddress(addr);
+        if (end) {
+          RememberedSet<OLD_TO_NEW>::RemoveRange(
+              chunk, addr, end, SlotSet::PREFREE_EMPTY_BUCKETS);
+        } else {
+          RememberedSet<OLD_TO_NEW>::Remove(chunk, addr);
+        }
+      } else {
+        DCHECK(!IsDeletionAddress(addr));
+        if (addr != last_inserted_addr) {
+          RememberedSet<OLD_TO_NEW>::Insert(chunk, addr);
+          last_inserted_addr = addr;
+        }
       }
     }
   }
-  lazy_top_[index] = nullptr;
+  heap_->tracer()->AddStoreBufferMergeEntries(merged_entries);
+  {
+    base::MutexGuard guard(&mutex_);
+    buffer_processing_[index] = false;
+    processing_done_.NotifyAll();
+  }
 }
 
 void StoreBuffer::MoveAllEntriesToRememberedSet() {
-  base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
+  int other;
+  {
+    base::MutexGuard guard(&mutex_);
+    other = (current_ + 1) % kStoreBuffers;
+  }
   MoveEntriesToRememberedSet(other);
-  lazy_top_[current_] = top_;
+  {
+    base::MutexGuard guard(&mutex_);
+    // The GC has to observe fully drained buffers, so wait for any in-flight
+    // concurrent processing of the other buffer.
+    while (buffer_processing_[other]) processing_done_.Wait(&mutex_);
+    // The current buffer is never published for concurrent processing and
+    // thus cannot be in flight here.
+    DCHECK(!buffer_processing_[current_]);
+    lazy_top_[current_] = top_;
+  }
   MoveEntriesToRememberedSet(current_);
+  base::MutexGuard guard(&mutex_);
   top_ = start_[current_];
 }
 
 void StoreBuffer::ConcurrentlyProcessStoreBuffer() {
-  base::MutexGuard guard(&mutex_);
-  int other = (current_ + 1) % kStoreBuffers;
+  int other;
+  {
+    base::MutexGuard guard(&mutex_);
+    other = (current_ + 1) % kStoreBuffers;
+  }
   MoveEntriesToRememberedSet(other);
+  base::MutexGuard guard(&mutex_);
   task_running_ = false;
 }
 
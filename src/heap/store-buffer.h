@@ -7,6 +7,7 @@
 
 #include "src/allocation.h"
 #include "src/base/logging.h"
+#include "src/base/platform/condition-variable.h"
 #include "src/base/platform/platform.h"
 #include "src/cancelable-task.h"
 #include "src/globals.h"
@@ -50,8 +51,9 @@ class StoreBuffer {
   // Used to add entries from generated code.
   inline Address* top_address() { return reinterpret_cast<Address*>(&top_); }
 
-  // Moves entries from a specific store buffer to the remembered set. This
-  // method takes a lock.
+  // Moves entries from a specific store buffer to the remembered set. The
+  // buffer is claimed under the lock but its entries are processed without
+  // holding it; inserts into the remembered set are lock-free.
   void MoveEntriesToRememberedSet(int index);
 
   // This method ensures that all used store buffer entries are transferred to
@@ -155,6 +157,13 @@ class StoreBuffer {
   Address* lazy_top_[kStoreBuffers];
   base::Mutex mutex_;
 
+  // Set while the entries of a buffer are moved to the remembered set
+  // without holding the mutex. A buffer may not be reused for new entries
+  // until its processing is done, which is signaled through the condition
+  // variable.
+  bool buffer_processing_[kStoreBuffers];
+  base::ConditionVariable processing_done_;
+
   // We only want to have at most one concurrent processing tas running.
   bool task_running_;
 
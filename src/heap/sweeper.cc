@@ -107,6 +107,7 @@ class Sweeper::SweeperTask final : public CancelableTask {
       DCHECK(IsValidSweepingSpace(space_id));
       sweeper_->SweepSpaceFromTask(space_id);
     }
+    sweeper_->SweepDeadLargePages();
     (*num_sweeping_tasks_)--;
     pending_sweeper_tasks_->Signal();
   }
@@ -135,7 +136,18 @@ class Sweeper::IncrementalSweeperTask final : public CancelableTask {
     sweeper_->incremental_sweeper_pending_ = false;
 
     if (sweeper_->sweeping_in_progress()) {
-      if (!sweeper_->SweepSpaceIncrementallyFromTask(CODE_SPACE)) {
+      // Hand back large pages whose chunk map entries have already been
+      // removed by sweeper tasks. Doing this here bounds their reclamation
+      // by the sweeping cycle instead of by the next large-object
+      // allocation.
+      sweeper_->EnsureDeadLargePagesFreed();
+      const bool code_space_done =
+          sweeper_->SweepSpaceIncrementallyFromTask(CODE_SPACE);
+      // Keep the task alive until the sweeper tasks have drained the dead
+      // large page list, so that the last swept pages are freed promptly as
+      // well.
+      if (!code_space_done || sweeper_->HasDeadLargePages() ||
+          sweeper_->AreSweeperTasksRunning()) {
         sweeper_->ScheduleIncrementalSweepingTask();
       }
     }
@@ -234,6 +246,8 @@ void Sweeper::EnsureCompleted() {
 
   AbortAndWaitForTasks();
 
+  EnsureDeadLargePagesFreed();
+
   ForAllSweepingSpaces([this](AllocationSpace space) {
     CHECK(sweeping_list_[GetSweepSpaceIndex(space)].empty());
   });
@@ -509,6 +523,51 @@ Page* Sweeper::GetSweepingPageSafe(AllocationSpace space) {
   return page;
 }
 
+void Sweeper::AddDeadLargePage(LargePage* page) {
+  base::MutexGuard guard(&mutex_);
+  dead_large_pages_.push_back(page);
+}
+
+LargePage* Sweeper::GetDeadLargePageSafe() {
+  base::MutexGuard guard(&mutex_);
+  if (dead_large_pages_.empty()) return nullptr;
+  LargePage* page = dead_large_pages_.back();
+  dead_large_pages_.pop_back();
+  return page;
+}
+
+bool Sweeper::HasDeadLargePages() {
+  base::MutexGuard guard(&mutex_);
+  return !dead_large_pages_.empty() || !swept_large_pages_.empty();
+}
+
+void Sweeper::SweepDeadLargePages() {
+  LargePage* page = nullptr;
+  while ((page = GetDeadLargePageSafe()) != nullptr) {
+    // Removing the chunk map entries is the dominant cost of releasing a
+    // large page and synchronizes via the chunk map mutex of the space.
+    reinterpret_cast<LargeObjectSpace*>(page->owner())
+        ->RemoveChunkMapEntries(page);
+    base::MutexGuard guard(&mutex_);
+    swept_large_pages_.push_back(page);
+  }
+}
+
+void Sweeper::EnsureDeadLargePagesFreed() {
+  // Contribute to any in-flight concurrent sweeping. Pages currently owned by
+  // sweeper tasks are picked up by the next call after the tasks finished.
+  SweepDeadLargePages();
+  LargePageList swept_pages;
+  {
+    base::MutexGuard guard(&mutex_);
+    swept_pages = std::move(swept_large_pages_);
+    swept_large_pages_.clear();
+  }
+  for (LargePage* page : swept_pages) {
+    heap_->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(page);
+  }
+}
+
 void Sweeper::EnsurePageIsIterable(Page* page) {
   AllocationSpace space = page->owner()->identity();
   if (IsValidSweepingSpace(space)) {
@@ -15,6 +15,7 @@
 namespace v8 {
 namespace internal {
 
+class LargePage;
 class MajorNonAtomicMarkingState;
 class Page;
 class PagedSpace;
@@ -26,6 +27,7 @@ class Sweeper {
   typedef std::vector<Page*> IterabilityList;
   typedef std::deque<Page*> SweepingList;
   typedef std::vector<Page*> SweptList;
+  typedef std::vector<LargePage*> LargePageList;
 
   // Pauses the sweeper tasks or completes sweeping.
   class PauseOrCompleteScope final {
@@ -108,6 +110,21 @@ class Sweeper {
   void StartIterabilityTasks();
   void EnsureIterabilityCompleted();
 
+  // Adds a dead large page for concurrent sweeping. The page must already be
+  // detached from its space with accounting updated. Called during the atomic
+  // pause.
+  void AddDeadLargePage(LargePage* page);
+
+  // Removes the chunk map entries of dead large pages. Safe to call
+  // concurrently from sweeper tasks and from the main thread.
+  void SweepDeadLargePages();
+
+  // Completes in-flight large-object sweeping and hands the fully swept pages
+  // to the memory allocator. Needs to be called on the main thread.
+  void EnsureDeadLargePagesFreed();
+
+  bool HasDeadLargePages();
+
  private:
   class IncrementalSweeperTask;
   class IterabilityTask;
@@ -143,6 +160,8 @@ class Sweeper {
 
   Page* GetSweepingPageSafe(AllocationSpace space);
 
+  LargePage* GetDeadLargePageSafe();
+
   void PrepareToBeSweptPage(AllocationSpace space, Page* page);
 
   void SweepOrWaitUntilSweepingCompleted(Page* page);
@@ -179,6 +198,12 @@ class Sweeper {
   // Used by PauseOrCompleteScope to signal early bailout to tasks.
   std::atomic<bool> stop_sweeper_tasks_;
 
+  // Dead large pages that wait for their chunk map entries to be removed
+  // concurrently and the corresponding pages whose concurrent sweeping is
+  // done, waiting for the final free on the main thread.
+  LargePageList dead_large_pages_;
+  LargePageList swept_large_pages_;
+
   // Pages that are only made iterable but have their free lists ignored.
   IterabilityList iterability_list_;
   CancelableTaskManager::Id iterability_task_id_;
@@ -5,6 +5,7 @@
 #ifndef V8_HEAP_WORKLIST_H_
 #define V8_HEAP_WORKLIST_H_
 
+#include <atomic>
 #include <cstddef>
 #include <utility>
 
@@ -51,6 +52,12 @@ class Worklist {
       return worklist_->LocalPushSegmentSize(task_id_);
     }
 
+    // Publishes the local push segment to the global pool so that it can be
+    // stolen by other tasks.
+    void FlushPushSegmentToGlobal() {
+      worklist_->FlushPushSegmentToGlobal(task_id_);
+    }
+
    private:
     Worklist<EntryType, SEGMENT_SIZE>* worklist_;
     int task_id_;
@@ -198,6 +205,16 @@ class Worklist {
     PublishPopSegmentToGlobal(task_id);
   }
 
+  void FlushPushSegmentToGlobal(int task_id) {
+    PublishPushSegmentToGlobal(task_id);
+  }
+
+  // Number of segments stolen from the global pool since construction. Used
+  // to gauge how much work was rebalanced across tasks.
+  size_t StolenSegments() const {
+    return stolen_segments_.load(std::memory_order_relaxed);
+  }
+
   void MergeGlobalPool(Worklist* other) {
     auto pair = other->global_pool_.Extract();
     global_pool_.MergeList(pair.first, pair.second);
@@ -406,6 +423,7 @@ class Worklist {
     if (global_pool_.Pop(&new_segment)) {
       delete private_pop_segment(task_id);
       private_pop_segment(task_id) = new_segment;
+      stolen_segments_.fetch_add(1, std::memory_order_relaxed);
       return true;
     }
     return false;
@@ -418,6 +436,7 @@ class Worklist {
 
   PrivateSegmentHolder private_segments_[kMaxNumTasks];
   GlobalPool global_pool_;
+  std::atomic<size_t> stolen_segments_{0};
   int num_tasks_;
 };
 
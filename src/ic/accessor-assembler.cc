@@ -2700,7 +2700,13 @@ void AccessorAssembler::KeyedLoadIC(const LoadICParameters* p) {
   BIND(&try_polymorphic_name);
   {
     // We might have a name in feedback, and a weak fixed array in the next
-    // slot.
+    // slot. This caches exactly one key: a keyed access that keeps hitting
+    // the same string key stays on this fast path with per-map handlers,
+    // while a second distinct key drives the slot megamorphic. That is not
+    // as bad as it sounds: the megamorphic builtin above inlines the fast
+    // property lookup and probes the (map, name)-keyed stub cache without
+    // leaving generated code, so alternating string keys still avoid the
+    // runtime once the stub cache is warm.
     Node* name = p->name;
     Comment("KeyedLoadIC_try_polymorphic_name");
     VARIABLE(var_name, MachineRepresentation::kTagged, name);
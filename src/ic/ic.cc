@@ -13,6 +13,7 @@
 #include "src/code-factory.h"
 #include "src/conversions.h"
 #include "src/execution.h"
+#include "src/field-index-inl.h"
 #include "src/field-type.h"
 #include "src/frames-inl.h"
 #include "src/handles-inl.h"
@@ -34,6 +35,7 @@
 #include "src/runtime/runtime.h"
 #include "src/tracing/trace-event.h"
 #include "src/tracing/tracing-category-observer.h"
+#include "src/transitions.h"
 
 namespace v8 {
 namespace internal {
@@ -2484,6 +2486,19 @@ static Handle<Map> FastCloneObjectMap(Isolate* isolate,
                                       Handle<HeapObject> source, int flags) {
   Handle<Map> source_map(source->map(), isolate);
   SLOW_DCHECK(source->IsNullOrUndefined() || CanFastCloneObject(source_map));
+
+  // The result map only depends on the source map, so it is cached on the
+  // source map as a special transition. This keeps the number of maps created
+  // for cloning a given shape at one, no matter how many feedback slots (or
+  // megamorphic misses) clone objects of that shape.
+  if (flags == 0 && source_map->IsJSObjectMap()) {
+    Map cached =
+        TransitionsAccessor(isolate, source_map)
+            .SearchSpecial(
+                ReadOnlyRoots(isolate).clone_object_transition_symbol());
+    if (!cached.is_null()) return handle(cached, isolate);
+  }
+
   Handle<JSFunction> constructor(isolate->native_context()->object_function(),
                                  isolate);
   DCHECK(constructor->has_initial_map());
@@ -2531,12 +2546,101 @@ static Handle<Map> FastCloneObjectMap(Isolate* isolate,
   map->set_may_have_interesting_symbols(
       source_map->may_have_interesting_symbols());
 
+  // Cache the result map on the source map, provided the transition tree
+  // invariants hold: inserting the transition rewrites the result map's back
+  // pointer, which requires both maps to agree on the constructor (see
+  // Map::SetBackPointer).
+  if (flags == 0 && !map.is_identical_to(initial_map) &&
+      !source_map->is_prototype_map() &&
+      map->GetBackPointer()->IsUndefined(isolate) &&
+      source_map->GetConstructor() == map->GetConstructor()) {
+    TransitionsAccessor transitions(isolate, source_map);
+    if (transitions.CanHaveMoreTransitions()) {
+      transitions.Insert(isolate->factory()->clone_object_transition_symbol(),
+                         map, SPECIAL_TRANSITION);
+    }
+  }
+
   return map;
 }
 
+// Clones a fast-mode source object by bulk-copying its property backing
+// stores (elements, property array and in-object fields), equivalent to but
+// much faster than adding the properties one at a time. |result_map| must
+// have been created for this source by FastCloneObjectMap.
+static Handle<JSObject> FastCloneJSObject(Isolate* isolate,
+                                          Handle<JSObject> source,
+                                          Handle<Map> result_map) {
+  Factory* factory = isolate->factory();
+  Handle<Map> source_map(source->map(), isolate);
+  DCHECK_EQ(source_map->NumberOfOwnDescriptors(),
+            result_map->NumberOfOwnDescriptors());
+  DCHECK_EQ(source_map->GetInObjectProperties(),
+            result_map->GetInObjectProperties());
+
+  Handle<JSObject> clone = factory->NewJSObjectFromMap(result_map);
+
+  // Copy (or in the copy-on-write case, share) the elements backing store.
+  if (source->elements()->length() > 0) {
+    DCHECK(IsSmiOrObjectElementsKind(source_map->elements_kind()));
+    Handle<FixedArray> elements(FixedArray::cast(source->elements()), isolate);
+    if (elements->map() != ReadOnlyRoots(isolate).fixed_cow_array_map()) {
+      elements = factory->CopyFixedArray(elements);
+    }
+    clone->set_elements(*elements);
+  }
+
+  // Allocate a fresh backing store for the out-of-object properties; the
+  // values are filled in by the field copy below.
+  if (source->property_array()->length() > 0) {
+    Handle<PropertyArray> properties =
+        factory->NewPropertyArray(source->property_array()->length());
+    clone->set_raw_properties_or_hash(*properties);
+  }
+
+  // Copy the field values. MutableHeapNumbers are cloned so that the clone
+  // does not alias the source's boxed double fields.
+  Handle<DescriptorArray> descriptors(source_map->instance_descriptors(),
+                                      isolate);
+  int descriptor_count = source_map->NumberOfOwnDescriptors();
+  for (int i = 0; i < descriptor_count; i++) {
+    PropertyDetails details = descriptors->GetDetails(i);
+    DCHECK_EQ(kData, details.kind());
+    if (details.location() != kField) continue;
+    FieldIndex source_index = FieldIndex::ForDescriptor(*source_map, i);
+    FieldIndex target_index = FieldIndex::ForDescriptor(*result_map, i);
+    if (source->IsUnboxedDoubleField(source_index)) {
+      DCHECK(clone->IsUnboxedDoubleField(target_index));
+      clone->RawFastDoublePropertyAsBitsAtPut(
+          target_index, source->RawFastDoublePropertyAsBitsAt(source_index));
+    } else {
+      Object* value = source->RawFastPropertyAt(source_index);
+      if (value->IsMutableHeapNumber()) {
+        double number = MutableHeapNumber::cast(value)->value();
+        value = *factory->NewMutableHeapNumber(number);
+      }
+      clone->RawFastPropertyAtPut(target_index, value);
+    }
+  }
+  return clone;
+}
+
 static MaybeHandle<JSObject> CloneObjectSlowPath(Isolate* isolate,
                                                  Handle<HeapObject> source,
                                                  int flags) {
+  // Even when the feedback has gone megamorphic, a fast-mode source with
+  // only enumerable data properties can be cloned wholesale. The result map
+  // lookup hits the transition cache maintained by FastCloneObjectMap, so
+  // this costs O(1) map work plus the backing store copies.
+  if (source->IsJSObject()) {
+    Handle<Map> source_map(source->map(), isolate);
+    if (!source_map->is_deprecated() && CanFastCloneObject(source_map)) {
+      Handle<Map> result_map = FastCloneObjectMap(isolate, source, flags);
+      return FastCloneJSObject(isolate, Handle<JSObject>::cast(source),
+                               result_map);
+    }
+  }
+
   Handle<JSObject> new_object;
   if (flags & ObjectLiteral::kHasNullPrototype) {
     new_object = isolate->factory()->NewJSObjectWithNullProto();
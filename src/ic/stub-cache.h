@@ -87,7 +87,13 @@ class StubCache {
 
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
+  // The secondary table catches everything evicted from the primary table,
+  // so megamorphic workloads hit its miss rate directly; at 24 bytes per
+  // entry, matching the primary table's size costs 36KB more per isolate
+  // and keeps markedly more megamorphic sites out of the runtime.
+  // Must not exceed kPrimaryTableBits: the secondary hash reuses the
+  // primary offset as its seed and has no entropy above that.
+  static const int kSecondaryTableBits = 11;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
   // Some magic number used in the secondary hash computation.
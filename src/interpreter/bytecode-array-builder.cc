@@ -91,6 +91,13 @@ Handle<BytecodeArray> BytecodeArrayBuilder::ToBytecodeArray(Isolate* isolate) {
   if (register_optimizer_) {
     register_optimizer_->Flush();
     register_count = register_optimizer_->maxiumum_register_index() + 1;
+    if (FLAG_ignition_compact_register_frame) {
+      // The register optimizer can leave gaps in the register file when all
+      // uses of an allocated temporary have been elided. Renumber the
+      // surviving temporaries into a dense range to shrink the frame.
+      register_count = bytecode_array_writer_.CompactRegisterFrame(
+          fixed_register_count(), register_count, handler_table_builder());
+    }
   }
 
   Handle<ByteArray> handler_table =
@@ -804,6 +811,14 @@ BytecodeArrayBuilder& BytecodeArrayBuilder::LoadNamedPropertyNoFeedback(
   return *this;
 }
 
+BytecodeArrayBuilder& BytecodeArrayBuilder::LoadInObjectProperty(
+    Register object, const AstRawString* name, int offset) {
+  DCHECK_LE(JSObject::kHeaderSize, offset);
+  size_t name_index = GetConstantPoolEntry(name);
+  OutputLdaInObjectProperty(object, name_index, offset);
+  return *this;
+}
+
 BytecodeArrayBuilder& BytecodeArrayBuilder::LoadKeyedProperty(
     Register object, int feedback_slot) {
   OutputLdaKeyedProperty(object, feedback_slot);
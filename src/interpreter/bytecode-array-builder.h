@@ -123,6 +123,13 @@ class V8_EXPORT_PRIVATE BytecodeArrayBuilder final {
   // Named load property without feedback
   BytecodeArrayBuilder& LoadNamedPropertyNoFeedback(Register object,
                                                     const AstRawString* name);
+  // Named load of an in-object property at a statically known byte offset.
+  // Only valid when the shape of the object in |object| is fully determined
+  // by the bytecode that produced it (e.g. a just-cloned object literal).
+  // |name| is recorded for the benefit of the optimizing compiler.
+  BytecodeArrayBuilder& LoadInObjectProperty(Register object,
+                                             const AstRawString* name,
+                                             int offset);
 
   // Keyed load property. The key should be in the accumulator.
   BytecodeArrayBuilder& LoadKeyedProperty(Register object, int feedback_slot);
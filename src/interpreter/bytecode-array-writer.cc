@@ -5,12 +5,14 @@
 #include "src/interpreter/bytecode-array-writer.h"
 
 #include "src/api-inl.h"
+#include "src/interpreter/bytecode-decoder.h"
 #include "src/interpreter/bytecode-jump-table.h"
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-node.h"
 #include "src/interpreter/bytecode-register.h"
 #include "src/interpreter/bytecode-source-info.h"
 #include "src/interpreter/constant-array-builder.h"
+#include "src/interpreter/handler-table-builder.h"
 #include "src/log.h"
 #include "src/objects-inl.h"
 
@@ -32,6 +34,7 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_offset_(0),
       last_bytecode_had_source_info_(false),
       elide_noneffectful_bytecodes_(FLAG_ignition_elide_noneffectful_bytecodes),
+      fuse_superinstructions_(FLAG_ignition_superinstructions),
       exit_seen_in_block_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
@@ -43,10 +46,17 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
 
   int bytecode_size = static_cast<int>(bytecodes()->size());
   int frame_size = register_count * kPointerSize;
-  Handle<FixedArray> constant_pool =
-      constant_array_builder()->ToFixedArray(isolate);
+  // Executing LdaConstant costs a dependent load chain of bytecode array ->
+  // constant pool -> element. Folding the pool into the bytecode array object
+  // itself would need per-instance tagged/raw region boundaries in the body
+  // descriptor (see BytecodeArray::BodyDescriptor), which the GC does not
+  // support; instead, allocate the constant pool immediately before the
+  // bytecode array so that both usually end up adjacent in the old-space
+  // linear allocation area and the element loads hit warm cache lines.
   Handle<ByteArray> source_position_table =
       source_position_table_builder()->ToSourcePositionTable(isolate);
+  Handle<FixedArray> constant_pool =
+      constant_array_builder()->ToFixedArray(isolate);
   Handle<BytecodeArray> bytecode_array = isolate->factory()->NewBytecodeArray(
       bytecode_size, &bytecodes()->front(), frame_size, parameter_count,
       constant_pool);
@@ -58,11 +68,183 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
   return bytecode_array;
 }
 
+Register BytecodeArrayWriter::DecodeRegisterOperandAt(
+    size_t operand_offset, OperandType operand_type,
+    OperandScale operand_scale) const {
+  Address operand_start = reinterpret_cast<Address>(
+      const_cast<uint8_t*>(&bytecodes_[operand_offset]));
+  return BytecodeDecoder::DecodeRegisterOperand(operand_start, operand_type,
+                                                operand_scale);
+}
+
+void BytecodeArrayWriter::OverwriteRegisterOperandAt(size_t operand_offset,
+                                                     OperandType operand_type,
+                                                     OperandScale operand_scale,
+                                                     Register reg) {
+  int32_t operand = reg.ToOperand();
+  Address operand_start =
+      reinterpret_cast<Address>(&bytecodes()->at(operand_offset));
+  switch (Bytecodes::SizeOfOperand(operand_type, operand_scale)) {
+    case OperandSize::kByte:
+      DCHECK_LE(Bytecodes::ScaleForSignedOperand(operand),
+                OperandScale::kSingle);
+      bytecodes()->at(operand_offset) =
+          static_cast<uint8_t>(operand & kMaxUInt8);
+      break;
+    case OperandSize::kShort:
+      DCHECK_LE(Bytecodes::ScaleForSignedOperand(operand),
+                OperandScale::kDouble);
+      WriteUnalignedUInt16(operand_start, static_cast<uint16_t>(operand));
+      break;
+    case OperandSize::kQuad:
+      WriteUnalignedUInt32(operand_start, static_cast<uint32_t>(operand));
+      break;
+    case OperandSize::kNone:
+      UNREACHABLE();
+  }
+}
+
+int BytecodeArrayWriter::GetRegisterOperandRangeSize(
+    size_t bytecode_offset, Bytecode bytecode, int operand_index,
+    OperandScale operand_scale) const {
+  OperandType operand_type =
+      Bytecodes::GetOperandType(bytecode, operand_index);
+  if (!Bytecodes::IsRegisterListOperandType(operand_type)) {
+    return Bytecodes::GetNumberOfRegistersRepresentedBy(operand_type);
+  }
+  // Register lists are immediately followed by their register count operand.
+  DCHECK_EQ(Bytecodes::GetOperandType(bytecode, operand_index + 1),
+            OperandType::kRegCount);
+  size_t count_offset =
+      bytecode_offset +
+      Bytecodes::GetOperandOffset(bytecode, operand_index + 1, operand_scale);
+  Address count_start = reinterpret_cast<Address>(
+      const_cast<uint8_t*>(&bytecodes_[count_offset]));
+  return static_cast<int>(BytecodeDecoder::DecodeUnsignedOperand(
+      count_start, OperandType::kRegCount, operand_scale));
+}
+
+int BytecodeArrayWriter::CompactRegisterFrame(
+    int fixed_register_count, int register_count,
+    HandlerTableBuilder* handler_table_builder) {
+  DCHECK_LE(fixed_register_count, register_count);
+  int temporary_count = register_count - fixed_register_count;
+  if (temporary_count == 0) return register_count;
+
+  Zone* zone = bytecodes_.get_allocator().zone();
+  ZoneVector<bool> used(temporary_count, false, zone);
+
+  // Mark the temporary registers which are still referenced by the bytecode.
+  // Register pairs, triples and lists are marked register by register, which
+  // guarantees that their members remain contiguous after renumbering.
+  size_t offset = 0;
+  while (offset < bytecodes()->size()) {
+    OperandScale operand_scale = OperandScale::kSingle;
+    Bytecode bytecode = Bytecodes::FromByte(bytecodes()->at(offset));
+    if (Bytecodes::IsPrefixScalingBytecode(bytecode)) {
+      operand_scale = Bytecodes::PrefixBytecodeToOperandScale(bytecode);
+      ++offset;
+      bytecode = Bytecodes::FromByte(bytecodes()->at(offset));
+    }
+    for (int i = 0; i < Bytecodes::NumberOfOperands(bytecode); ++i) {
+      OperandType operand_type = Bytecodes::GetOperandType(bytecode, i);
+      if (!Bytecodes::IsRegisterOperandType(operand_type)) continue;
+      size_t operand_offset =
+          offset + Bytecodes::GetOperandOffset(bytecode, i, operand_scale);
+      Register first =
+          DecodeRegisterOperandAt(operand_offset, operand_type, operand_scale);
+      int range_size =
+          GetRegisterOperandRangeSize(offset, bytecode, i, operand_scale);
+      for (int r = 0; r < range_size; ++r) {
+        int index = first.index() + r;
+        if (index >= fixed_register_count) {
+          DCHECK_LT(index, register_count);
+          used[index - fixed_register_count] = true;
+        }
+      }
+    }
+    offset += Bytecodes::Size(bytecode, operand_scale);
+  }
+
+  // The context registers of exception handlers live in the frame too.
+  for (int i = 0; i < handler_table_builder->handler_count(); ++i) {
+    Register context = handler_table_builder->GetContextRegister(i);
+    if (context.is_valid() && context.index() >= fixed_register_count) {
+      used[context.index() - fixed_register_count] = true;
+    }
+  }
+
+  // Renumber the referenced temporaries into a dense range above the fixed
+  // registers. Renumbered indices never exceed the original ones, so the
+  // rewritten operands always fit their original operand size.
+  ZoneVector<int> remap(temporary_count, Register::invalid_value().index(),
+                        zone);
+  int next_index = fixed_register_count;
+  for (int i = 0; i < temporary_count; ++i) {
+    if (used[i]) remap[i] = next_index++;
+  }
+  if (next_index == register_count) return register_count;  // No gaps.
+
+  auto renumber = [&](Register reg) {
+    if (!reg.is_valid() || reg.index() < fixed_register_count) return reg;
+    int new_index = remap[reg.index() - fixed_register_count];
+    DCHECK_NE(new_index, Register::invalid_value().index());
+    DCHECK_LE(new_index, reg.index());
+    return Register(new_index);
+  };
+
+  // Rewrite the register operands in place. Only the first register of a
+  // pair, triple or list is materialized in the bytecode stream.
+  offset = 0;
+  while (offset < bytecodes()->size()) {
+    OperandScale operand_scale = OperandScale::kSingle;
+    Bytecode bytecode = Bytecodes::FromByte(bytecodes()->at(offset));
+    if (Bytecodes::IsPrefixScalingBytecode(bytecode)) {
+      operand_scale = Bytecodes::PrefixBytecodeToOperandScale(bytecode);
+      ++offset;
+      bytecode = Bytecodes::FromByte(bytecodes()->at(offset));
+    }
+    for (int i = 0; i < Bytecodes::NumberOfOperands(bytecode); ++i) {
+      OperandType operand_type = Bytecodes::GetOperandType(bytecode, i);
+      if (!Bytecodes::IsRegisterOperandType(operand_type)) continue;
+      size_t operand_offset =
+          offset + Bytecodes::GetOperandOffset(bytecode, i, operand_scale);
+      int range_size =
+          GetRegisterOperandRangeSize(offset, bytecode, i, operand_scale);
+      // The first register of an empty register list is meaningless.
+      if (range_size == 0) continue;
+      Register first =
+          DecodeRegisterOperandAt(operand_offset, operand_type, operand_scale);
+      Register renumbered = renumber(first);
+      if (renumbered != first) {
+        OverwriteRegisterOperandAt(operand_offset, operand_type, operand_scale,
+                                   renumbered);
+      }
+#ifdef DEBUG
+      // Check that renumbering kept the register range contiguous.
+      for (int r = 1; r < range_size; ++r) {
+        DCHECK_EQ(renumber(Register(first.index() + r)).index(),
+                  renumbered.index() + r);
+      }
+#endif
+    }
+    offset += Bytecodes::Size(bytecode, operand_scale);
+  }
+
+  for (int i = 0; i < handler_table_builder->handler_count(); ++i) {
+    handler_table_builder->SetContextRegister(
+        i, renumber(handler_table_builder->GetContextRegister(i)));
+  }
+
+  return next_index;
+}
+
 void BytecodeArrayWriter::Write(BytecodeNode* node) {
   DCHECK(!Bytecodes::IsJump(node->bytecode()));
 
   if (exit_seen_in_block_) return;  // Don't emit dead code.
   UpdateExitSeenInBlock(node->bytecode());
+  if (TryFuseWithLastBytecode(node)) return;
   MaybeElideLastBytecode(node->bytecode(), node->source_info().is_valid());
 
   UpdateSourcePositionTable(node);
@@ -153,6 +335,8 @@ void BytecodeArrayWriter::UpdateSourcePositionTable(
 void BytecodeArrayWriter::UpdateExitSeenInBlock(Bytecode bytecode) {
   switch (bytecode) {
     case Bytecode::kReturn:
+    case Bytecode::kReturnUndefined:
+    case Bytecode::kReturnSmi:
     case Bytecode::kThrow:
     case Bytecode::kReThrow:
     case Bytecode::kAbort:
@@ -187,6 +371,62 @@ void BytecodeArrayWriter::MaybeElideLastBytecode(Bytecode next_bytecode,
   last_bytecode_offset_ = bytecodes()->size();
 }
 
+// Fuses frequently executed bytecode pairs into a single superinstruction,
+// saving a dispatch. The pairs below dominate the dispatch counters collected
+// with --trace-ignition-dispatches; in particular every implicit function
+// return emits LdaUndefined followed by Return. Fusion is only attempted
+// within a basic block (label binding invalidates the last bytecode), and
+// only when at most one of the two bytecodes carries source info, so the
+// source position table entry of the pair survives at the fused bytecode's
+// offset, exactly as in MaybeElideLastBytecode.
+bool BytecodeArrayWriter::TryFuseWithLastBytecode(BytecodeNode* node) {
+  if (!fuse_superinstructions_) return false;
+  if (node->bytecode() != Bytecode::kReturn) return false;
+  if (last_bytecode_had_source_info_ && node->source_info().is_valid()) {
+    return false;
+  }
+
+  Bytecode fused_bytecode;
+  uint32_t operand = 0;
+  switch (last_bytecode_) {
+    case Bytecode::kLdaUndefined:
+      fused_bytecode = Bytecode::kReturnUndefined;
+      break;
+    case Bytecode::kLdaZero:
+      fused_bytecode = Bytecode::kReturnSmi;
+      break;
+    case Bytecode::kLdaSmi: {
+      // Bail out on a scaled LdaSmi; re-decoding wide operands isn't worth it
+      // for the rare large immediate.
+      if (Bytecodes::FromByte(bytecodes()->at(last_bytecode_offset_)) !=
+          Bytecode::kLdaSmi) {
+        return false;
+      }
+      fused_bytecode = Bytecode::kReturnSmi;
+      operand = static_cast<uint32_t>(
+          static_cast<int8_t>(bytecodes()->at(last_bytecode_offset_ + 1)));
+      break;
+    }
+    default:
+      return false;
+  }
+
+  // Rewind the accumulator load and emit the fused bytecode in its place. If
+  // the load had source info, the entry written for it already points at this
+  // offset.
+  DCHECK_GT(bytecodes()->size(), last_bytecode_offset_);
+  bytecodes()->resize(last_bytecode_offset_);
+  BytecodeNode fused =
+      fused_bytecode == Bytecode::kReturnUndefined
+          ? BytecodeNode::ReturnUndefined(node->source_info())
+          : BytecodeNode::ReturnSmi(node->source_info(), operand);
+  last_bytecode_ = fused_bytecode;
+  last_bytecode_had_source_info_ |= fused.source_info().is_valid();
+  UpdateSourcePositionTable(&fused);
+  EmitBytecode(&fused);
+  return true;
+}
+
 void BytecodeArrayWriter::InvalidateLastBytecode() {
   last_bytecode_ = Bytecode::kIllegal;
 }
@@ -7,6 +7,7 @@
 
 #include "src/base/compiler-specific.h"
 #include "src/globals.h"
+#include "src/interpreter/bytecode-register.h"
 #include "src/interpreter/bytecodes.h"
 #include "src/source-position-table.h"
 
@@ -22,6 +23,7 @@ class BytecodeLabel;
 class BytecodeNode;
 class BytecodeJumpTable;
 class ConstantArrayBuilder;
+class HandlerTableBuilder;
 
 namespace bytecode_array_writer_unittest {
 class BytecodeArrayWriterUnittest;
@@ -45,6 +47,17 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
                                         int parameter_count,
                                         Handle<ByteArray> handler_table);
 
+  // Renumbers the register operands of the finished bytecode so that the
+  // temporary registers still referenced after optimization occupy a dense
+  // range above the fixed registers, and returns the resulting register
+  // count. The register optimizer leaves gaps in the register file when all
+  // uses of an allocated temporary are elided. Renumbered indices never
+  // grow, so operands are rewritten in place without perturbing bytecode
+  // offsets. The context registers recorded in |handler_table_builder| are
+  // renumbered alongside the bytecode.
+  int CompactRegisterFrame(int fixed_register_count, int register_count,
+                           HandlerTableBuilder* handler_table_builder);
+
   bool RemainderOfBlockIsDead() const { return exit_seen_in_block_; }
 
  private:
@@ -77,8 +90,24 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   void UpdateExitSeenInBlock(Bytecode bytecode);
 
   void MaybeElideLastBytecode(Bytecode next_bytecode, bool has_source_info);
+  bool TryFuseWithLastBytecode(BytecodeNode* node);
   void InvalidateLastBytecode();
 
+  // Decodes the register operand at |operand_offset| in the bytecode stream.
+  Register DecodeRegisterOperandAt(size_t operand_offset,
+                                   OperandType operand_type,
+                                   OperandScale operand_scale) const;
+  // Overwrites the register operand at |operand_offset| with |reg|, which
+  // must fit in the operand's existing size.
+  void OverwriteRegisterOperandAt(size_t operand_offset,
+                                  OperandType operand_type,
+                                  OperandScale operand_scale, Register reg);
+  // Returns the number of registers represented by the register operand at
+  // index |operand_index| of |bytecode| located at |bytecode_offset|.
+  int GetRegisterOperandRangeSize(size_t bytecode_offset, Bytecode bytecode,
+                                  int operand_index,
+                                  OperandScale operand_scale) const;
+
   ZoneVector<uint8_t>* bytecodes() { return &bytecodes_; }
   SourcePositionTableBuilder* source_position_table_builder() {
     return &source_position_table_builder_;
@@ -96,6 +125,7 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
   size_t last_bytecode_offset_;
   bool last_bytecode_had_source_info_;
   bool elide_noneffectful_bytecodes_;
+  bool fuse_superinstructions_;
 
   bool exit_seen_in_block_;
 
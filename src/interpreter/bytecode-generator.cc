@@ -1668,6 +1668,14 @@ void BytecodeGenerator::VisitForInStatement(ForInStatement* stmt) {
 }
 
 void BytecodeGenerator::VisitForOfStatement(ForOfStatement* stmt) {
+  // The iterator protocol is spelled out by the parser: assign_iterator,
+  // next_result, result_done and assign_each are desugared assignments to
+  // temporaries, so the generator cannot substitute a protector-guarded
+  // indexed walk for plain arrays here. Unlike optimized code, which
+  // deoptimizes when the array iterator protector is invalidated, bytecode
+  // would keep running a stale fast path if the protocol is patched while a
+  // loop is on the stack, so dodging the per-element next() call is left to
+  // JSCallReducer.
   LoopBuilder loop_builder(builder(), block_coverage_builder_, stmt);
 
   builder()->SetExpressionAsStatementPosition(stmt->assign_iterator());
@@ -2908,9 +2916,77 @@ void BytecodeGenerator::BuildVariableAssignment(
   }
 }
 
+// Tries to replace a named load whose receiver is an object literal in the
+// same expression with a direct in-object load at a statically known offset,
+// bypassing the LoadIC. This is only sound when the shape of the cloned
+// literal is fully determined at bytecode generation time:
+//  - the literal is cloned shallowly from its boilerplate and has no
+//    elements, no rest property and no __proto__ override,
+//  - every property is a compile-time constant with a non-computed,
+//    non-duplicated name, so the i-th property occupies the i-th in-object
+//    field of the clone,
+//  - the loaded value is a string, boolean, undefined or null literal.
+// The last restriction keeps the field's representation HeapObject; numeric
+// values could generalize the boilerplate map's field to Double, in which
+// case the in-object slot holds a MutableHeapNumber box that a raw load
+// would leak.
+bool BytecodeGenerator::TryBuildInObjectPropertyLoad(Property* property,
+                                                     Register object,
+                                                     const AstRawString* name) {
+  if (!FLAG_fast_literal_property_loads) return false;
+  ObjectLiteral* literal = property->obj()->AsObjectLiteral();
+  if (literal == nullptr || !literal->IsFastCloningSupported()) return false;
+  if (literal->has_elements() || literal->has_rest_property() ||
+      literal->has_null_prototype()) {
+    return false;
+  }
+
+  const ZonePtrList<ObjectLiteral::Property>* properties =
+      literal->properties();
+  if (literal->properties_count() != properties->length()) return false;
+
+  int found_index = -1;
+  for (int i = 0; i < properties->length(); i++) {
+    ObjectLiteral::Property* entry = properties->at(i);
+    if (entry->kind() != ObjectLiteral::Property::CONSTANT ||
+        entry->is_computed_name()) {
+      return false;
+    }
+    Literal* key = entry->key()->AsLiteral();
+    if (key == nullptr || !key->IsPropertyName()) return false;
+    const AstRawString* key_name = key->AsRawPropertyName();
+    // Duplicate names shadow earlier fields; bail out rather than track the
+    // final field layout.
+    for (int j = 0; j < i; j++) {
+      Literal* previous = properties->at(j)->key()->AsLiteral();
+      if (previous->AsRawPropertyName() == key_name) return false;
+    }
+    if (key_name == name) {
+      Literal* value = entry->value()->AsLiteral();
+      if (value == nullptr) return false;
+      switch (value->type()) {
+        case Literal::kString:
+        case Literal::kBoolean:
+        case Literal::kUndefined:
+        case Literal::kNull:
+          break;
+        default:
+          return false;
+      }
+      found_index = i;
+    }
+  }
+  if (found_index == -1) return false;
+
+  int offset = JSObject::kHeaderSize + found_index * kPointerSize;
+  builder()->LoadInObjectProperty(object, name, offset);
+  return true;
+}
+
 void BytecodeGenerator::BuildLoadNamedProperty(Property* property,
                                                Register object,
                                                const AstRawString* name) {
+  if (TryBuildInObjectPropertyLoad(property, object, name)) return;
   if (ShouldOptimizeAsOneShot()) {
     builder()->LoadNamedPropertyNoFeedback(object, name);
   } else {
@@ -124,6 +124,8 @@ class BytecodeGenerator final : public AstVisitor<BytecodeGenerator> {
 
   void BuildLoadNamedProperty(Property* property, Register object,
                               const AstRawString* name);
+  bool TryBuildInObjectPropertyLoad(Property* property, Register object,
+                                    const AstRawString* name);
   void BuildStoreNamedProperty(Property* property, Register object,
                                const AstRawString* name);
 
@@ -194,7 +194,9 @@ class V8_EXPORT_PRIVATE BytecodeRegisterOptimizer final
   ZoneVector<RegisterInfo*> register_info_table_;
   int register_info_table_offset_;
 
-  ZoneDeque<RegisterInfo*> registers_needing_flushed_;
+  // Typically only a handful of registers are awaiting a flush at any
+  // point, so keep them inline.
+  ZoneSmallVector<RegisterInfo*, 16> registers_needing_flushed_;
 
   // Counter for equivalence sets identifiers.
   int equivalence_id_;
@@ -100,6 +100,8 @@ namespace interpreter {
     OperandType::kIdx, OperandType::kIdx)                                      \
   V(LdaNamedPropertyNoFeedback, AccumulatorUse::kWrite, OperandType::kReg,     \
     OperandType::kIdx)                                                         \
+  V(LdaInObjectProperty, AccumulatorUse::kWrite, OperandType::kReg,            \
+    OperandType::kIdx, OperandType::kUImm)                                     \
   V(LdaKeyedProperty, AccumulatorUse::kReadWrite, OperandType::kReg,           \
     OperandType::kIdx)                                                         \
                                                                                \
@@ -341,6 +343,9 @@ namespace interpreter {
   V(Throw, AccumulatorUse::kRead)                                              \
   V(ReThrow, AccumulatorUse::kRead)                                            \
   V(Return, AccumulatorUse::kRead)                                             \
+  /* - [Superinstructions, fused by the BytecodeArrayWriter] */                \
+  V(ReturnUndefined, AccumulatorUse::kWrite)                                   \
+  V(ReturnSmi, AccumulatorUse::kWrite, OperandType::kImm)                      \
   V(ThrowReferenceErrorIfHole, AccumulatorUse::kRead, OperandType::kIdx)       \
   V(ThrowSuperNotCalledIfHole, AccumulatorUse::kRead)                          \
   V(ThrowSuperAlreadyCalledIfNotHole, AccumulatorUse::kRead)                   \
@@ -450,6 +455,8 @@ namespace interpreter {
 
 #define RETURN_BYTECODE_LIST(V) \
   V(Return)                     \
+  V(ReturnUndefined)            \
+  V(ReturnSmi)                  \
   V(SuspendGenerator)
 
 // Enumeration of interpreter bytecodes.
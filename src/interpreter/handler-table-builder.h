@@ -42,6 +42,13 @@ class V8_EXPORT_PRIVATE HandlerTableBuilder final {
   void SetPrediction(int handler_id, HandlerTable::CatchPrediction prediction);
   void SetContextRegister(int handler_id, Register reg);
 
+  // Accessors used when renumbering the context registers after the bytecode
+  // register frame has been compacted.
+  int handler_count() const { return static_cast<int>(entries_.size()); }
+  Register GetContextRegister(int handler_id) const {
+    return entries_[handler_id].context;
+  }
+
  private:
   struct Entry {
     size_t offset_start;   // Bytecode offset starting try-region.
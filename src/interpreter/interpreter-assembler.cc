@@ -1411,6 +1411,13 @@ Node* InterpreterAssembler::Dispatch() {
 
 Node* InterpreterAssembler::DispatchToBytecode(Node* target_bytecode,
                                                Node* new_bytecode_offset) {
+  // This is deliberately an indexed load from the per-isolate dispatch table
+  // rather than direct-threaded code (i.e. storing pre-resolved handler
+  // entry points alongside the bytecode): handler addresses are
+  // process-specific and cannot be serialized into snapshots or code caches,
+  // and a parallel pointer-width array would multiply the memory cost of
+  // every BytecodeArray. The table base is kept in a fixed register, so the
+  // indirection costs a single load.
   if (FLAG_trace_ignition_dispatches) {
     TraceBytecodeDispatch(target_bytecode);
   }
@@ -530,6 +530,20 @@ IGNITION_HANDLER(LdaNamedPropertyNoFeedback, InterpreterAssembler) {
   Dispatch();
 }
 
+// LdaInObjectProperty <object> <name_index> <offset>
+//
+// Loads the in-object field of <object> at byte offset <offset> into the
+// accumulator. The bytecode generator only emits this when the map of
+// <object> is statically known, so no IC dispatch or map check is needed.
+// <name_index> identifies the property name for the optimizing compiler.
+IGNITION_HANDLER(LdaInObjectProperty, InterpreterAssembler) {
+  Node* object = LoadRegisterAtOperandIndex(0);
+  Node* offset = ChangeUint32ToWord(BytecodeOperandUImm(2));
+  Node* result = LoadObjectField(object, offset);
+  SetAccumulator(result);
+  Dispatch();
+}
+
 // KeyedLoadIC <object> <slot>
 //
 // Calls the KeyedLoadIC at FeedBackVector slot <slot> for <object> and the key
@@ -2806,6 +2820,28 @@ IGNITION_HANDLER(Return, InterpreterAssembler) {
   Return(accumulator);
 }
 
+// ReturnUndefined
+//
+// Return undefined to the caller. Superinstruction for LdaUndefined followed
+// by Return, fused by the BytecodeArrayWriter.
+IGNITION_HANDLER(ReturnUndefined, InterpreterAssembler) {
+  Node* value = UndefinedConstant();
+  SetAccumulator(value);
+  UpdateInterruptBudgetOnReturn();
+  Return(value);
+}
+
+// ReturnSmi <imm>
+//
+// Return the Smi <imm> to the caller. Superinstruction for LdaSmi (or
+// LdaZero) followed by Return, fused by the BytecodeArrayWriter.
+IGNITION_HANDLER(ReturnSmi, InterpreterAssembler) {
+  Node* value = BytecodeOperandImmSmi(0);
+  SetAccumulator(value);
+  UpdateInterruptBudgetOnReturn();
+  Return(value);
+}
+
 // ThrowReferenceErrorIfHole <variable_name>
 //
 // Throws an exception if the value in the accumulator is TheHole.
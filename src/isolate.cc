@@ -245,6 +245,15 @@ void ThreadLocalTop::Free() {
   while (promise_on_stack_) isolate_->PopPromise();
 }
 
+void VMStateTimeStats::BankTime(StateTag state) {
+  int64_t now = base::TimeTicks::Now().ToInternalValue();
+  // The first transition only starts the clock.
+  if (last_transition_us_ != 0) {
+    times_in_microseconds_[state] += now - last_transition_us_;
+  }
+  last_transition_us_ = now;
+}
+
 
 base::Thread::LocalStorageKey Isolate::isolate_key_;
 base::Thread::LocalStorageKey Isolate::per_isolate_thread_data_key_;
@@ -2849,6 +2858,23 @@ void Isolate::ClearSerializerData() {
   external_reference_map_ = nullptr;
 }
 
+void Isolate::ClearCachesForReuse() {
+  // Drop caches that keep code and feedback from previous workloads
+  // reachable. The stub caches and the inner-pointer cache are also
+  // cleared during mark-compact, but clearing them eagerly makes the
+  // reset independent of which collections the GC below decides to run.
+  compilation_cache()->Clear();
+  load_stub_cache()->Clear();
+  store_stub_cache()->Clear();
+  descriptor_lookup_cache()->Clear();
+  inner_pointer_to_code_cache()->Flush();
+  // This also aborts concurrent optimization and clears the compilation
+  // cache again after the sweep, and retries until no weak callbacks
+  // free further memory.
+  heap()->CollectAllAvailableGarbage(
+      GarbageCollectionReason::kLowMemoryNotification);
+}
+
 bool Isolate::LogObjectRelocation() {
   return FLAG_verify_predictable || logger()->is_logging() || is_profiling() ||
          heap()->isolate()->logger()->is_listening_to_code_events() ||
@@ -2979,6 +3005,12 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete transition_lookup_cache_;
+  transition_lookup_cache_ = nullptr;
+
+  delete property_lookup_cache_;
+  property_lookup_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -3195,6 +3227,37 @@ void Isolate::TearDownEmbeddedBlob() {
   }
 }
 
+bool Isolate::IsInterpreterBuiltinPc(Address pc) const {
+  for (int i = 0; i < interpreter_builtin_pc_range_count_; i++) {
+    if (interpreter_builtin_pc_ranges_[i].contains(pc)) return true;
+  }
+  return false;
+}
+
+void Isolate::UpdateInterpreterBuiltinPcRanges() {
+  static const int kBuiltinIds[] = {
+      Builtins::kInterpreterEntryTrampoline,
+      Builtins::kInterpreterEnterBytecodeAdvance,
+      Builtins::kInterpreterEnterBytecodeDispatch};
+  // Unpublish the cache before refilling it, so that a profiling signal
+  // arriving mid-update at worst observes an empty cache rather than a
+  // mixture of old and new ranges.
+  interpreter_builtin_pc_range_count_ = 0;
+  int count = 0;
+  for (int builtin_id : kBuiltinIds) {
+    Code code = builtins()->builtin(builtin_id);
+    interpreter_builtin_pc_ranges_[count++] =
+        base::AddressRegion(code->address(), code->Size());
+    if (code->is_off_heap_trampoline()) {
+      Address start = code->OffHeapInstructionStart();
+      interpreter_builtin_pc_ranges_[count++] = base::AddressRegion(
+          start, static_cast<size_t>(code->OffHeapInstructionEnd() - start));
+    }
+  }
+  DCHECK_LE(count, kMaxInterpreterBuiltinPcRanges);
+  interpreter_builtin_pc_range_count_ = count;
+}
+
 bool Isolate::Init(StartupDeserializer* des) {
   TRACE_ISOLATE(init);
 
@@ -3230,6 +3293,8 @@ bool Isolate::Init(StartupDeserializer* des) {
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  transition_lookup_cache_ = new TransitionLookupCache();
+  property_lookup_cache_ = new PropertyLookupCache();
   unicode_cache_ = new UnicodeCache();
   inner_pointer_to_code_cache_ = new InnerPointerToCodeCache(this);
   global_handles_ = new GlobalHandles(this);
@@ -3349,6 +3414,11 @@ bool Isolate::Init(StartupDeserializer* des) {
   delete setup_delegate_;
   setup_delegate_ = nullptr;
 
+  // The builtins are materialized at this point, either created or
+  // deserialized; cache the interpreter dispatch pc ranges for the
+  // profiler's frame classification.
+  UpdateInterpreterBuiltinPcRanges();
+
   if (FLAG_print_builtin_size) PrintBuiltinSizes(this);
 
   // Finish initialization of ThreadLocal after deserialization is done.
@@ -4493,6 +4563,27 @@ void Isolate::set_icu_object_in_cache(ICUObjectCacheType cache_type,
 void Isolate::clear_cached_icu_object(ICUObjectCacheType cache_type) {
   icu_object_cache_.erase(cache_type);
 }
+
+icu::UObject* Isolate::get_cached_icu_formatter(const std::string& key) {
+  auto it = icu_formatter_cache_.find(key);
+  if (it == icu_formatter_cache_.end()) return nullptr;
+  it->second.last_used = ++icu_formatter_cache_clock_;
+  return it->second.obj.get();
+}
+
+void Isolate::set_icu_formatter_in_cache(const std::string& key,
+                                         std::shared_ptr<icu::UObject> obj) {
+  if (icu_formatter_cache_.size() >= kICUFormatterCacheMaxSize &&
+      icu_formatter_cache_.count(key) == 0) {
+    auto lru = icu_formatter_cache_.begin();
+    for (auto it = icu_formatter_cache_.begin();
+         it != icu_formatter_cache_.end(); ++it) {
+      if (it->second.last_used < lru->second.last_used) lru = it;
+    }
+    icu_formatter_cache_.erase(lru);
+  }
+  icu_formatter_cache_[key] = {std::move(obj), ++icu_formatter_cache_clock_};
+}
 #endif  // V8_INTL_SUPPORT
 
 bool StackLimitCheck::JsHasOverflowed(uintptr_t gap) const {
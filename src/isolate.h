@@ -16,6 +16,7 @@
 #include "include/v8-internal.h"
 #include "include/v8.h"
 #include "src/allocation.h"
+#include "src/base/address-region.h"
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
 #include "src/builtins/builtins.h"
@@ -78,6 +79,8 @@ class DescriptorLookupCache;
 class EternalHandles;
 class ExternalCallbackScope;
 class HandleScopeImplementer;
+class PropertyLookupCache;
+class TransitionLookupCache;
 class HeapObjectToIndexHashMap;
 class HeapProfiler;
 class InnerPointerToCodeCache;
@@ -503,6 +506,29 @@ typedef std::vector<HeapObject*> DebugObjectCache;
 #define THREAD_LOCAL_TOP_ADDRESS(type, name) \
   type* name##_address() { return &thread_local_top_.name##_; }
 
+// Accumulates wall-clock time per VM state while --vm-state-times is
+// enabled. Unlike RuntimeCallStats there is no timer stack and no TLS
+// lookup: every VMState transition banks the time elapsed since the
+// previous transition on the outgoing state, so a switch costs a single
+// clock read.
+class VMStateTimeStats {
+ public:
+  // Banks the time elapsed since the last transition on {state}.
+  V8_EXPORT_PRIVATE void BankTime(StateTag state);
+
+  // Returns the total microseconds banked on {state}. Time accrued in the
+  // current state since the last transition is not included, so snapshots
+  // should be taken from a fixed state (for embedders: while in EXTERNAL).
+  int64_t GetTimeInMicroseconds(StateTag state) const {
+    return times_in_microseconds_[state];
+  }
+
+ private:
+  static const int kNumberOfStates = IDLE + 1;
+  int64_t times_in_microseconds_[kNumberOfStates] = {};
+  int64_t last_transition_us_ = 0;
+};
+
 // HiddenFactory exists so Isolate can privately inherit from it without making
 // Factory's members available to Isolate directly.
 class V8_EXPORT_PRIVATE HiddenFactory : private Factory {};
@@ -626,6 +652,12 @@ class Isolate final : private HiddenFactory {
 
   void ClearSerializerData();
 
+  // Backs v8::Isolate::ClearCachesForReuse: drops caches that retain code
+  // and feedback from previously executed workloads and collects all
+  // reclaimable memory, approximating a freshly deserialized isolate for
+  // embedders that pool isolates instead of churning them.
+  void ClearCachesForReuse();
+
   bool LogObjectRelocation();
 
   // Initializes the current thread to run this Isolate.
@@ -967,6 +999,7 @@ class Isolate final : private HiddenFactory {
     DCHECK_NOT_NULL(async_counters_.get());
     return async_counters_;
   }
+  VMStateTimeStats* vm_state_time_stats() { return &vm_state_time_stats_; }
   RuntimeProfiler* runtime_profiler() { return runtime_profiler_; }
   CompilationCache* compilation_cache() { return compilation_cache_; }
   Logger* logger() {
@@ -1032,6 +1065,14 @@ class Isolate final : private HiddenFactory {
     return descriptor_lookup_cache_;
   }
 
+  TransitionLookupCache* transition_lookup_cache() {
+    return transition_lookup_cache_;
+  }
+
+  PropertyLookupCache* property_lookup_cache() {
+    return property_lookup_cache_;
+  }
+
   HandleScopeData* handle_scope_data() { return &handle_scope_data_; }
 
   HandleScopeImplementer* handle_scope_implementer() {
@@ -1047,6 +1088,18 @@ class Isolate final : private HiddenFactory {
     return inner_pointer_to_code_cache_;
   }
 
+  // Returns whether {pc} lies within one of the interpreter dispatch
+  // builtins (the entry trampoline and the enter-bytecode builtins). Only
+  // consults pc ranges cached by UpdateInterpreterBuiltinPcRanges, so it
+  // performs no heap reads and is safe to call from the profiler's signal
+  // handler.
+  bool IsInterpreterBuiltinPc(Address pc) const;
+
+  // (Re)computes the pc ranges consulted by IsInterpreterBuiltinPc. Called
+  // once the builtins have been set up, and again after a mark-compact GC
+  // since code space compaction may have moved the builtin code objects.
+  void UpdateInterpreterBuiltinPcRanges();
+
   GlobalHandles* global_handles() { return global_handles_; }
 
   EternalHandles* eternal_handles() { return eternal_handles_; }
@@ -1208,6 +1261,15 @@ class Isolate final : private HiddenFactory {
                                std::shared_ptr<icu::UObject> obj);
   void clear_cached_icu_object(ICUObjectCacheType cache_type);
 
+  // Bounded cache of base ICU formatters keyed by locale and format options,
+  // so that repeated Intl constructor calls with identical arguments can
+  // clone a pre-built formatter instead of re-reading ICU locale data. The
+  // least recently used entry is evicted when the cache is full.
+  static const size_t kICUFormatterCacheMaxSize = 16;
+  icu::UObject* get_cached_icu_formatter(const std::string& key);
+  void set_icu_formatter_in_cache(const std::string& key,
+                                  std::shared_ptr<icu::UObject> obj);
+
 #endif  // V8_INTL_SUPPORT
 
   static const int kProtectorValid = 1;
@@ -1558,6 +1620,16 @@ class Isolate final : private HiddenFactory {
   void set_allow_atomics_wait(bool set) { allow_atomics_wait_ = set; }
   bool allow_atomics_wait() { return allow_atomics_wait_; }
 
+  // Whether a task that eagerly migrates instances of deprecated maps has
+  // been posted and not yet run, so that a burst of map deprecations only
+  // schedules one heap walk. See --batch-migrate-deprecated-maps.
+  void set_batch_migration_task_pending(bool set) {
+    batch_migration_task_pending_ = set;
+  }
+  bool batch_migration_task_pending() const {
+    return batch_migration_task_pending_;
+  }
+
   // Register a finalizer to be called at isolate teardown.
   void RegisterManagedPtrDestructor(ManagedPtrDestructor* finalizer);
 
@@ -1694,6 +1766,7 @@ class Isolate final : private HiddenFactory {
   StringStream* incomplete_message_ = nullptr;
   Address isolate_addresses_[kIsolateAddressCount + 1] = {};
   Bootstrapper* bootstrapper_ = nullptr;
+  VMStateTimeStats vm_state_time_stats_;
   RuntimeProfiler* runtime_profiler_ = nullptr;
   CompilationCache* compilation_cache_ = nullptr;
   std::shared_ptr<Counters> async_counters_;
@@ -1711,11 +1784,20 @@ class Isolate final : private HiddenFactory {
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  TransitionLookupCache* transition_lookup_cache_ = nullptr;
+  PropertyLookupCache* property_lookup_cache_ = nullptr;
   HandleScopeData handle_scope_data_;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
   InnerPointerToCodeCache* inner_pointer_to_code_cache_ = nullptr;
+  // Cached instruction ranges of the interpreter dispatch builtins; each
+  // builtin contributes its on-heap range and, when it is an off-heap
+  // trampoline, the embedded instruction range as well.
+  static const int kMaxInterpreterBuiltinPcRanges = 6;
+  int interpreter_builtin_pc_range_count_ = 0;
+  base::AddressRegion
+      interpreter_builtin_pc_ranges_[kMaxInterpreterBuiltinPcRanges];
   GlobalHandles* global_handles_ = nullptr;
   EternalHandles* eternal_handles_ = nullptr;
   ThreadManager* thread_manager_ = nullptr;
@@ -1754,6 +1836,14 @@ class Isolate final : private HiddenFactory {
                      ICUObjectCacheTypeHash>
       icu_object_cache_;
 
+  struct ICUFormatterCacheEntry {
+    std::shared_ptr<icu::UObject> obj;
+    uint64_t last_used;
+  };
+  std::unordered_map<std::string, ICUFormatterCacheEntry>
+      icu_formatter_cache_;
+  uint64_t icu_formatter_cache_clock_ = 0;
+
 #endif  // V8_INTL_SUPPORT
 
   // Whether the isolate has been created for snapshotting.
@@ -1885,6 +1975,8 @@ class Isolate final : private HiddenFactory {
 
   bool allow_atomics_wait_ = true;
 
+  bool batch_migration_task_pending_ = false;
+
   base::Mutex managed_ptr_destructors_mutex_;
   ManagedPtrDestructor* managed_ptr_destructors_head_ = nullptr;
 
@@ -4,6 +4,7 @@
 
 #include "src/json-parser.h"
 
+#include "src/base/bits.h"
 #include "src/char-predicates-inl.h"
 #include "src/conversions.h"
 #include "src/debug/debug.h"
@@ -12,8 +13,9 @@
 #include "src/objects-inl.h"
 #include "src/objects/hash-table-inl.h"
 #include "src/property-descriptor.h"
-#include "src/string-hasher.h"
+#include "src/string-hasher-inl.h"
 #include "src/transitions.h"
+#include "src/v8memory.h"
 
 namespace v8 {
 namespace internal {
@@ -47,6 +49,50 @@ class VectorSegment {
   const typename Container::size_type begin_;
 };
 
+// Word-at-a-time classification of the bytes that end a plain JSON string
+// span: the closing quote, a backslash starting an escape sequence, or a
+// control character.
+const uint64_t kOneInEveryByte = V8_2PART_UINT64_C(0x01010101, 01010101);
+const uint64_t kHighBitInEveryByte = V8_2PART_UINT64_C(0x80808080, 80808080);
+
+// Returns a word with the high bit set in every byte of |w| that equals |c|.
+V8_INLINE uint64_t BytesEqual(uint64_t w, uint8_t c) {
+  uint64_t x = w ^ (kOneInEveryByte * c);
+  return (x - kOneInEveryByte) & ~x & kHighBitInEveryByte;
+}
+
+// Returns a word with the high bit set in every byte of |w| that is below
+// 0x20. Bytes with the high bit set never match, which is correct since
+// Latin1 characters >= 0x80 are not control characters.
+V8_INLINE uint64_t BytesBelowSpace(uint64_t w) {
+  return (w - kOneInEveryByte * 0x20) & ~w & kHighBitInEveryByte;
+}
+
+// Returns the offset of the first byte in chars[0..length) that is a quote,
+// a backslash or a control character, or length if there is none.
+int ScanJsonStringSpan(const uint8_t* chars, int length) {
+  static const int kWordSize = static_cast<int>(sizeof(uint64_t));
+  int i = 0;
+  for (; i + kWordSize <= length; i += kWordSize) {
+    uint64_t w =
+        ReadUnalignedValue<uint64_t>(reinterpret_cast<Address>(chars + i));
+    uint64_t hits =
+        BytesEqual(w, '"') | BytesEqual(w, '\\') | BytesBelowSpace(w);
+    if (hits != 0) {
+#if defined(V8_TARGET_BIG_ENDIAN)
+      return i + static_cast<int>(base::bits::CountLeadingZeros64(hits) / 8);
+#else
+      return i + static_cast<int>(base::bits::CountTrailingZeros64(hits) / 8);
+#endif
+    }
+  }
+  for (; i < length; i++) {
+    uint8_t c = chars[i];
+    if (c == '"' || c == '\\' || c < 0x20) break;
+  }
+  return i;
+}
+
 }  // namespace
 
 MaybeHandle<Object> JsonParseInternalizer::Internalize(Isolate* isolate,
@@ -825,60 +871,42 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
     // parsed is not a known internalized string, contains backslashes or
     // unexpectedly reaches the end of string, return with an empty handle.
 
-    // We intentionally use local variables instead of fields, compute hash
-    // while we are iterating a string and manually inline StringTable lookup
-    // here.
-
-    int position = position_;
-    uc32 c0 = c0_;
-    uint32_t running_hash =
-        static_cast<uint32_t>(isolate()->heap()->HashSeed());
-    uint32_t index = 0;
-    bool is_array_index = true;
-
-    do {
-      if (c0 == '\\') {
-        c0_ = c0;
-        int beg_pos = position_;
-        position_ = position;
-        return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
-                                                             position_);
-      }
-      if (c0 < 0x20) {
-        c0_ = c0;
-        position_ = position;
-        return Handle<String>::null();
-      }
-      if (is_array_index) {
-        // With leading zero, the string has to be "0" to be a valid index.
-        if (!IsDecimalDigit(c0) || (position > position_ && index == 0)) {
-          is_array_index = false;
-        } else {
-          int d = c0 - '0';
-          is_array_index = index <= 429496729U - ((d + 3) >> 3);
-          index = (index * 10) + d;
-        }
-      }
-      running_hash = StringHasher::AddCharacterCore(running_hash,
-                                                    static_cast<uint16_t>(c0));
-      position++;
-      if (position >= source_length_) {
+    // Find the extent of the string with a word-at-a-time scan over the raw
+    // backing store, then hash and look up the whole span at once. The scan
+    // stops at the closing quote, at an escape sequence (handled by the slow
+    // path), or at a control character (a syntax error).
+    int position;
+    uint8_t terminator;
+    {
+      DisallowHeapAllocation no_gc;
+      const uint8_t* chars = seq_source_->GetChars();
+      position = position_ + ScanJsonStringSpan(chars + position_,
+                                                source_length_ - position_);
+      if (position == source_length_) {
         c0_ = kEndOfString;
         position_ = position;
         return Handle<String>::null();
       }
-      c0 = seq_source_->SeqOneByteStringGet(position);
-    } while (c0 != '"');
-    int length = position - position_;
-    uint32_t hash;
-    if (is_array_index) {
-      hash =
-          StringHasher::MakeArrayIndexHash(index, length) >> String::kHashShift;
-    } else if (length <= String::kMaxHashCalcLength) {
-      hash = StringHasher::GetHashCore(running_hash);
-    } else {
-      hash = static_cast<uint32_t>(length);
+      terminator = chars[position];
     }
+    if (terminator == '\\') {
+      int beg_pos = position_;
+      position_ = position;
+      c0_ = '\\';
+      return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
+                                                           position_);
+    }
+    if (terminator != '"') {
+      // Control character (0x00-0x1F).
+      c0_ = terminator;
+      position_ = position;
+      return Handle<String>::null();
+    }
+    int length = position - position_;
+    uint32_t hash = StringHasher::HashSequentialString(
+                        seq_source_->GetChars() + position_, length,
+                        isolate()->heap()->HashSeed()) >>
+                    String::kHashShift;
     Vector<const uint8_t> string_vector(seq_source_->GetChars() + position_,
                                         length);
     StringTable* string_table = isolate()->heap()->string_table();
@@ -5,6 +5,7 @@
 #include "src/json-stringifier.h"
 
 #include "src/conversions.h"
+#include "src/global-handles.h"
 #include "src/heap/heap-inl.h"
 #include "src/lookup.h"
 #include "src/message-template.h"
@@ -21,12 +22,22 @@ class JsonStringifier {
  public:
   explicit JsonStringifier(Isolate* isolate);
 
-  ~JsonStringifier() { DeleteArray(gap_); }
+  ~JsonStringifier() {
+    DeleteArray(gap_);
+    if (!plan_map_.is_null()) {
+      GlobalHandles::Destroy(plan_map_.location());
+    }
+  }
 
   V8_WARN_UNUSED_RESULT MaybeHandle<Object> Stringify(Handle<Object> object,
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToCallback(
+      Handle<Object> object, Handle<Object> replacer, Handle<Object> gap,
+      IncrementalStringBuilder::PartCallback chunk_callback,
+      void* chunk_callback_data);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION };
 
@@ -70,7 +81,15 @@ class JsonStringifier {
 
   Result SerializeDouble(double number);
   V8_INLINE Result SerializeHeapNumber(Handle<HeapNumber> object) {
-    return SerializeDouble(object->value());
+    // Infinities and NaN serialize as "null" and cannot use the cache.
+    if (!std::isfinite(object->value())) {
+      return SerializeDouble(object->value());
+    }
+    // JSON serialization of a finite double is ToString(double), so go
+    // through the isolate's number-string cache; payloads that repeat the
+    // same doubles (metrics, coordinates) then skip dtoa entirely.
+    builder_.AppendString(factory()->NumberToString(object));
+    return SUCCESS;
   }
 
   Result SerializeJSValue(Handle<JSValue> object);
@@ -78,6 +97,21 @@ class JsonStringifier {
   V8_INLINE Result SerializeJSArray(Handle<JSArray> object);
   V8_INLINE Result SerializeJSObject(Handle<JSObject> object);
 
+  // One enumerable string-keyed descriptor of a cached serialization plan.
+  // The descriptor index is replayed against the map; the pre-escaped key
+  // text (including the surrounding quotes) avoids re-escaping the key for
+  // every object sharing the map.
+  struct PlanEntry {
+    int descriptor;
+    std::string escaped_key;
+  };
+
+  // Compiles plan_ for the given map. Returns false if the map has a key
+  // that needs escaping or a non-one-byte key, in which case the generic
+  // walk must be used.
+  bool CompileObjectSerializationPlan(Handle<Map> map);
+  Result SerializeJSObjectWithPlan(Handle<JSObject> object, Handle<Map> map);
+
   Result SerializeJSProxy(Handle<JSProxy> object);
   Result SerializeJSReceiverSlow(Handle<JSReceiver> object);
   Result SerializeArrayLikeSlow(Handle<JSReceiver> object, uint32_t start,
@@ -118,6 +152,17 @@ class JsonStringifier {
   uc16* gap_;
   int indent_;
 
+  // Map-keyed serialization plan cache for repeated objects sharing one
+  // hidden class. plan_map_ is a global handle so it survives the handle
+  // scopes opened per object.
+  Handle<Map> plan_map_;
+  std::vector<PlanEntry> plan_;
+  bool plan_valid_;
+  int plan_replay_depth_;
+  // Set while serializing a planned property; consumed by
+  // SerializeDeferredKey instead of re-escaping the key.
+  const std::string* planned_key_;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
 };
@@ -128,6 +173,16 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToCallback(Isolate* isolate, Handle<Object> object,
+                                    Handle<Object> replacer, Handle<Object> gap,
+                                    void (*chunk_callback)(Handle<String> chunk,
+                                                           void* data),
+                                    void* chunk_callback_data) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToCallback(object, replacer, gap, chunk_callback,
+                                         chunk_callback_data);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -197,7 +252,13 @@ const char* const JsonStringifier::JsonEscapeTable =
     "\xFC\0      \xFD\0      \xFE\0      \xFF\0      ";
 
 JsonStringifier::JsonStringifier(Isolate* isolate)
-    : isolate_(isolate), builder_(isolate), gap_(nullptr), indent_(0) {
+    : isolate_(isolate),
+      builder_(isolate),
+      gap_(nullptr),
+      indent_(0),
+      plan_valid_(false),
+      plan_replay_depth_(0),
+      planned_key_(nullptr) {
   tojson_string_ = factory()->toJSON_string();
   stack_ = factory()->NewJSArray(8);
 }
@@ -216,6 +277,27 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToCallback(
+    Handle<Object> object, Handle<Object> replacer, Handle<Object> gap,
+    IncrementalStringBuilder::PartCallback chunk_callback,
+    void* chunk_callback_data) {
+  if (!InitializeReplacer(replacer)) return Nothing<bool>();
+  if (!gap->IsUndefined(isolate_) && !InitializeGap(gap)) {
+    return Nothing<bool>();
+  }
+  builder_.EnableStreaming(chunk_callback, chunk_callback_data);
+  Result result = SerializeObject(object);
+  if (result == UNCHANGED) return Just(false);
+  if (result == SUCCESS) {
+    // Flush the remaining characters. The returned accumulator is the empty
+    // string in streaming mode, and streaming does not overflow.
+    USE(builder_.Finish().ToHandleChecked());
+    return Just(true);
+  }
+  DCHECK(result == EXCEPTION);
+  return Nothing<bool>();
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -643,6 +725,28 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
     DCHECK(!object->HasIndexedInterceptor());
     DCHECK(!object->HasNamedInterceptor());
     Handle<Map> map(object->map(), isolate_);
+    // Compile a serialization plan the first time a map is seen and replay
+    // it for subsequent objects sharing that map. While a replay is on the
+    // stack the cached plan must not be replaced, so nested objects with
+    // other maps take the generic walk below.
+    bool use_plan = false;
+    if (!plan_map_.is_null() && *plan_map_ == *map) {
+      use_plan = plan_valid_;
+    } else if (plan_replay_depth_ == 0) {
+      if (!plan_map_.is_null()) GlobalHandles::Destroy(plan_map_.location());
+      plan_map_ =
+          Handle<Map>::cast(isolate_->global_handles()->Create(map->ptr()));
+      plan_valid_ = CompileObjectSerializationPlan(map);
+      use_plan = plan_valid_;
+    }
+    if (use_plan) {
+      plan_replay_depth_++;
+      Result result = SerializeJSObjectWithPlan(object, map);
+      plan_replay_depth_--;
+      if (result != SUCCESS) return result;
+      StackPop();
+      return SUCCESS;
+    }
     builder_.AppendCharacter('{');
     Indent();
     bool comma = false;
@@ -679,6 +783,69 @@ JsonStringifier::Result JsonStringifier::SerializeJSObject(
   return SUCCESS;
 }
 
+bool JsonStringifier::CompileObjectSerializationPlan(Handle<Map> map) {
+  plan_.clear();
+  for (int i = 0; i < map->NumberOfOwnDescriptors(); i++) {
+    Name* name = map->instance_descriptors()->GetKey(i);
+    // Symbol-keyed and non-enumerable properties are skipped per map, so
+    // they do not need plan entries.
+    if (!name->IsString()) continue;
+    if (map->instance_descriptors()->GetDetails(i).IsDontEnum()) continue;
+    String* key = String::cast(name);
+    DisallowHeapAllocation no_gc;
+    String::FlatContent content = key->GetFlatContent();
+    if (!content.IsOneByte()) return false;
+    Vector<const uint8_t> chars = content.ToOneByteVector();
+    PlanEntry entry;
+    entry.descriptor = i;
+    entry.escaped_key.reserve(chars.length() + 2);
+    entry.escaped_key.push_back('"');
+    for (int j = 0; j < chars.length(); j++) {
+      // Keys that need escaping go through the generic walk.
+      if (!DoNotEscape(chars[j])) return false;
+      entry.escaped_key.push_back(static_cast<char>(chars[j]));
+    }
+    entry.escaped_key.push_back('"');
+    plan_.push_back(std::move(entry));
+  }
+  return true;
+}
+
+JsonStringifier::Result JsonStringifier::SerializeJSObjectWithPlan(
+    Handle<JSObject> object, Handle<Map> map) {
+  builder_.AppendCharacter('{');
+  Indent();
+  bool comma = false;
+  for (const PlanEntry& entry : plan_) {
+    int i = entry.descriptor;
+    Handle<String> key(String::cast(map->instance_descriptors()->GetKey(i)),
+                       isolate_);
+    // Details are re-read per object; in-place generalization may update
+    // them without changing the map.
+    PropertyDetails details = map->instance_descriptors()->GetDetails(i);
+    Handle<Object> property;
+    if (details.location() == kField && *map == object->map()) {
+      DCHECK_EQ(kData, details.kind());
+      FieldIndex field_index = FieldIndex::ForDescriptor(*map, i);
+      property = JSObject::FastPropertyAt(object, details.representation(),
+                                          field_index);
+    } else {
+      ASSIGN_RETURN_ON_EXCEPTION_VALUE(
+          isolate_, property,
+          Object::GetPropertyOrElement(isolate_, object, key), EXCEPTION);
+    }
+    planned_key_ = &entry.escaped_key;
+    Result result = SerializeProperty(property, comma, key);
+    planned_key_ = nullptr;
+    if (!comma && result == SUCCESS) comma = true;
+    if (result == EXCEPTION) return result;
+  }
+  Unindent();
+  if (comma) NewLine();
+  builder_.AppendCharacter('}');
+  return SUCCESS;
+}
+
 JsonStringifier::Result JsonStringifier::SerializeJSReceiverSlow(
     Handle<JSReceiver> object) {
   Handle<FixedArray> contents = property_list_;
@@ -894,7 +1061,14 @@ void JsonStringifier::Separator(bool first) {
 void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
                                            Handle<Object> deferred_key) {
   Separator(!deferred_comma);
-  SerializeString(Handle<String>::cast(deferred_key));
+  if (planned_key_ != nullptr) {
+    // The quoted key text was pre-escaped when the serialization plan for
+    // the holder's map was compiled.
+    builder_.AppendCString(planned_key_->c_str());
+    planned_key_ = nullptr;
+  } else {
+    SerializeString(Handle<String>::cast(deferred_key));
+  }
   builder_.AppendCharacter(':');
   if (gap_ != nullptr) builder_.AppendCharacter(' ');
 }
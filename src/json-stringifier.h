@@ -14,6 +14,18 @@ V8_WARN_UNUSED_RESULT MaybeHandle<Object> JsonStringify(Isolate* isolate,
                                                         Handle<Object> object,
                                                         Handle<Object> replacer,
                                                         Handle<Object> gap);
+
+// Streaming variant of JsonStringify: result chunks are handed to
+// |chunk_callback| as they are produced instead of being assembled into a
+// single result string. Chunk handles are only valid for the duration of
+// the call; their backing stores are reused for later chunks. Returns
+// Just(true) if output was produced, Just(false) if |object| is not
+// serializable (as for undefined), and Nothing<bool>() on exception.
+V8_WARN_UNUSED_RESULT Maybe<bool> JsonStringifyToCallback(
+    Isolate* isolate, Handle<Object> object, Handle<Object> replacer,
+    Handle<Object> gap, void (*chunk_callback)(Handle<String> chunk,
+                                               void* data),
+    void* chunk_callback_data);
 }  // namespace internal
 }  // namespace v8
 
@@ -14,14 +14,20 @@ DefaultForegroundTaskRunner::DefaultForegroundTaskRunner(
     IdleTaskSupport idle_task_support, TimeFunction time_function)
     : idle_task_support_(idle_task_support), time_function_(time_function) {}
 
+// Required for the in-class initializer of {next_delayed_task_deadline_}.
+constexpr double DefaultForegroundTaskRunner::kNoDelayedTaskDeadline;
+
 void DefaultForegroundTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
+  base::MutexGuard delayed_guard(&delayed_lock_);
   terminated_ = true;
 
   // Drain the task queues.
   while (!task_queue_.empty()) task_queue_.pop();
   while (!delayed_task_queue_.empty()) delayed_task_queue_.pop();
   while (!idle_task_queue_.empty()) idle_task_queue_.pop();
+  next_delayed_task_deadline_.store(kNoDelayedTaskDeadline,
+                                    std::memory_order_relaxed);
 }
 
 void DefaultForegroundTaskRunner::PostTaskLocked(std::unique_ptr<Task> task,
@@ -43,10 +49,14 @@ double DefaultForegroundTaskRunner::MonotonicallyIncreasingTime() {
 void DefaultForegroundTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
                                                   double delay_in_seconds) {
   DCHECK_GE(delay_in_seconds, 0.0);
-  base::MutexGuard guard(&lock_);
-  if (terminated_) return;
   double deadline = MonotonicallyIncreasingTime() + delay_in_seconds;
+  base::MutexGuard guard(&delayed_lock_);
+  if (terminated_) return;
   delayed_task_queue_.push(std::make_pair(deadline, std::move(task)));
+  if (deadline <
+      next_delayed_task_deadline_.load(std::memory_order_relaxed)) {
+    next_delayed_task_deadline_.store(deadline, std::memory_order_relaxed);
+  }
 }
 
 void DefaultForegroundTaskRunner::PostIdleTask(std::unique_ptr<IdleTask> task) {
@@ -62,43 +72,57 @@ bool DefaultForegroundTaskRunner::IdleTasksEnabled() {
 
 std::unique_ptr<Task> DefaultForegroundTaskRunner::PopTaskFromQueue(
     MessageLoopBehavior wait_for_work) {
-  base::MutexGuard guard(&lock_);
   // Move delayed tasks that hit their deadline to the main queue.
-  std::unique_ptr<Task> task = PopTaskFromDelayedQueueLocked(guard);
-  while (task) {
-    PostTaskLocked(std::move(task), guard);
-    task = PopTaskFromDelayedQueueLocked(guard);
-  }
+  MoveExpiredDelayedTasks();
 
+  base::MutexGuard guard(&lock_);
   while (task_queue_.empty()) {
     if (wait_for_work == MessageLoopBehavior::kDoNotWait) return {};
     WaitForTaskLocked(guard);
   }
 
-  task = std::move(task_queue_.front());
+  std::unique_ptr<Task> task = std::move(task_queue_.front());
   task_queue_.pop();
 
   return task;
 }
 
-std::unique_ptr<Task>
-DefaultForegroundTaskRunner::PopTaskFromDelayedQueueLocked(
-    const base::MutexGuard&) {
-  if (delayed_task_queue_.empty()) return {};
-
-  double now = MonotonicallyIncreasingTime();
-  const DelayedEntry& deadline_and_task = delayed_task_queue_.top();
-  if (deadline_and_task.first > now) return {};
-  // The const_cast here is necessary because there does not exist a clean way
-  // to get a unique_ptr out of the priority queue. We provide the priority
-  // queue with a custom comparison operator to make sure that the priority
-  // queue does not access the unique_ptr. Therefore it should be safe to reset
-  // the unique_ptr in the priority queue here. Note that the DelayedEntry is
-  // removed from the priority_queue immediately afterwards.
-  std::unique_ptr<Task> result =
-      std::move(const_cast<DelayedEntry&>(deadline_and_task).second);
-  delayed_task_queue_.pop();
-  return result;
+void DefaultForegroundTaskRunner::MoveExpiredDelayedTasks() {
+  if (next_delayed_task_deadline_.load(std::memory_order_relaxed) >
+      MonotonicallyIncreasingTime()) {
+    return;
+  }
+
+  std::vector<std::unique_ptr<Task>> ready_tasks;
+  {
+    base::MutexGuard guard(&delayed_lock_);
+    double now = MonotonicallyIncreasingTime();
+    while (!delayed_task_queue_.empty() &&
+           delayed_task_queue_.top().first <= now) {
+      // The const_cast here is necessary because there does not exist a clean
+      // way to get a unique_ptr out of the priority queue. We provide the
+      // priority queue with a custom comparison operator to make sure that the
+      // priority queue does not access the unique_ptr. Therefore it should be
+      // safe to reset the unique_ptr in the priority queue here. Note that the
+      // DelayedEntry is removed from the priority_queue immediately
+      // afterwards.
+      ready_tasks.push_back(std::move(
+          const_cast<DelayedEntry&>(delayed_task_queue_.top()).second));
+      delayed_task_queue_.pop();
+    }
+    next_delayed_task_deadline_.store(delayed_task_queue_.empty()
+                                          ? kNoDelayedTaskDeadline
+                                          : delayed_task_queue_.top().first,
+                                      std::memory_order_relaxed);
+  }
+  if (ready_tasks.empty()) return;
+
+  // {delayed_lock_} is released before the main lock is taken; the two are
+  // never held together except in Terminate().
+  base::MutexGuard guard(&lock_);
+  for (std::unique_ptr<Task>& task : ready_tasks) {
+    PostTaskLocked(std::move(task), guard);
+  }
 }
 
 std::unique_ptr<IdleTask> DefaultForegroundTaskRunner::PopTaskFromIdleQueue() {
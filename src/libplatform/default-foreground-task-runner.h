@@ -5,6 +5,8 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_FOREGROUND_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_FOREGROUND_TASK_RUNNER_H_
 
+#include <atomic>
+#include <limits>
 #include <queue>
 
 #include "include/libplatform/libplatform.h"
@@ -48,10 +50,18 @@ class V8_PLATFORM_EXPORT DefaultForegroundTaskRunner
   // {guard} parameter should make sure that the caller is holding the lock.
   void PostTaskLocked(std::unique_ptr<Task> task, const base::MutexGuard&);
 
-  // A caller of this function has to hold {lock_}. The {guard} parameter should
-  // make sure that the caller is holding the lock.
-  std::unique_ptr<Task> PopTaskFromDelayedQueueLocked(const base::MutexGuard&);
+  // Moves delayed tasks whose deadline has passed to the main task queue.
+  // Only takes {delayed_lock_} when the cached next deadline has passed, so
+  // the common no-op case costs a single atomic load.
+  void MoveExpiredDelayedTasks();
 
+  // Sentinel deadline stored in {next_delayed_task_deadline_} while the
+  // delayed task queue is empty.
+  static constexpr double kNoDelayedTaskDeadline =
+      std::numeric_limits<double>::max();
+
+  // {terminated_} is written with both {lock_} and {delayed_lock_} held, and
+  // may be read with either of the two held.
   bool terminated_ = false;
   base::Mutex lock_;
   base::ConditionVariable event_loop_control_;
@@ -70,9 +80,14 @@ class V8_PLATFORM_EXPORT DefaultForegroundTaskRunner
       return left.first > right.first;
     }
   };
+  // The delayed tasks have their own lock so that high-frequency timer
+  // posting (e.g. the GC heartbeat tasks) does not contend with the
+  // embedder's message loop pumping the main queue.
+  base::Mutex delayed_lock_;
   std::priority_queue<DelayedEntry, std::vector<DelayedEntry>,
                       DelayedEntryCompare>
       delayed_task_queue_;
+  std::atomic<double> next_delayed_task_deadline_{kNoDelayedTaskDeadline};
 
   TimeFunction time_function_;
 };
@@ -5,15 +5,30 @@
 #include "src/libplatform/default-worker-threads-task-runner.h"
 
 #include "src/base/platform/mutex.h"
-#include "src/libplatform/worker-thread.h"
+#include "src/base/platform/time.h"
+#include "src/base/template-utils.h"
 
 namespace v8 {
 namespace platform {
 
+namespace {
+
+// An idle worker periodically rechecks its siblings' queues so that a
+// backlog behind a long-running task on one worker does not go unserved.
+const int kIdleStealIntervalMs = 20;
+
+}  // namespace
+
 DefaultWorkerThreadsTaskRunner::DefaultWorkerThreadsTaskRunner(
     uint32_t thread_pool_size) {
+  // Even with an empty thread pool there has to be somewhere for posted
+  // tasks to go.
+  uint32_t num_queues = thread_pool_size > 0 ? thread_pool_size : 1;
+  for (uint32_t i = 0; i < num_queues; ++i) {
+    queues_.push_back(base::make_unique<TaskQueue>());
+  }
   for (uint32_t i = 0; i < thread_pool_size; ++i) {
-    thread_pool_.push_back(base::make_unique<WorkerThread>(&queue_));
+    thread_pool_.push_back(base::make_unique<WorkerThread>(this, i));
   }
 }
 
@@ -26,7 +41,7 @@ DefaultWorkerThreadsTaskRunner::~DefaultWorkerThreadsTaskRunner() {
 void DefaultWorkerThreadsTaskRunner::Terminate() {
   base::MutexGuard guard(&lock_);
   terminated_ = true;
-  queue_.Terminate();
+  for (std::unique_ptr<TaskQueue>& queue : queues_) queue->Terminate();
   // Clearing the thread pool lets all worker threads join.
   thread_pool_.clear();
 }
@@ -34,7 +49,8 @@ void DefaultWorkerThreadsTaskRunner::Terminate() {
 void DefaultWorkerThreadsTaskRunner::PostTask(std::unique_ptr<Task> task) {
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
-  queue_.Append(std::move(task));
+  queues_[next_queue_ % queues_.size()]->Append(std::move(task));
+  next_queue_++;
 }
 
 void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
@@ -42,7 +58,8 @@ void DefaultWorkerThreadsTaskRunner::PostDelayedTask(std::unique_ptr<Task> task,
   base::MutexGuard guard(&lock_);
   if (terminated_) return;
   if (delay_in_seconds == 0) {
-    queue_.Append(std::move(task));
+    queues_[next_queue_ % queues_.size()]->Append(std::move(task));
+    next_queue_++;
     return;
   }
   // There is no use case for this function with non zero delay_in_second on a
@@ -61,5 +78,40 @@ bool DefaultWorkerThreadsTaskRunner::IdleTasksEnabled() {
   return false;
 }
 
+std::unique_ptr<Task> DefaultWorkerThreadsTaskRunner::GetNext(uint32_t index) {
+  const size_t num_queues = queues_.size();
+  for (;;) {
+    std::unique_ptr<Task> task = queues_[index]->TryGetNext();
+    if (task) return task;
+    // Steal from the sibling queues, starting past our own queue so that
+    // idle workers spread over different victims.
+    for (size_t i = 1; i < num_queues; ++i) {
+      task = queues_[(index + i) % num_queues]->TryGetNext();
+      if (task) return task;
+    }
+    // Appends stop before the queues are terminated, so once all queues
+    // were observed empty after termination no more work can show up.
+    if (queues_[index]->IsTerminated()) return nullptr;
+    // Wait for work on our own queue. The wait is bounded so that stealable
+    // work queued behind a long-running task on a sibling is picked up.
+    queues_[index]->WaitForTask(
+        base::TimeDelta::FromMilliseconds(kIdleStealIntervalMs));
+  }
+}
+
+DefaultWorkerThreadsTaskRunner::WorkerThread::WorkerThread(
+    DefaultWorkerThreadsTaskRunner* runner, uint32_t index)
+    : Thread(Options("V8 WorkerThread")), runner_(runner), index_(index) {
+  Start();
+}
+
+DefaultWorkerThreadsTaskRunner::WorkerThread::~WorkerThread() { Join(); }
+
+void DefaultWorkerThreadsTaskRunner::WorkerThread::Run() {
+  while (std::unique_ptr<Task> task = runner_->GetNext(index_)) {
+    task->Run();
+  }
+}
+
 }  // namespace platform
 }  // namespace v8
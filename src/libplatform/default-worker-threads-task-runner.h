@@ -5,15 +5,16 @@
 #ifndef V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 #define V8_LIBPLATFORM_DEFAULT_WORKER_THREADS_TASK_RUNNER_H_
 
+#include <memory>
+#include <vector>
+
 #include "include/v8-platform.h"
+#include "src/base/platform/platform.h"
 #include "src/libplatform/task-queue.h"
 
 namespace v8 {
 namespace platform {
 
-class Thread;
-class WorkerThread;
-
 class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
     : public NON_EXPORTED_BASE(TaskRunner) {
  public:
@@ -34,9 +35,35 @@ class V8_PLATFORM_EXPORT DefaultWorkerThreadsTaskRunner
   bool IdleTasksEnabled() override;
 
  private:
+  class WorkerThread : public base::Thread {
+   public:
+    WorkerThread(DefaultWorkerThreadsTaskRunner* runner, uint32_t index);
+    ~WorkerThread() override;
+
+    // Repeatedly asks the runner for the next task, preferring the worker's
+    // own queue, until the runner is terminated.
+    void Run() override;
+
+   private:
+    DefaultWorkerThreadsTaskRunner* runner_;
+    uint32_t index_;
+
+    DISALLOW_COPY_AND_ASSIGN(WorkerThread);
+  };
+
+  // Returns the next task for worker {index}: from its own queue if
+  // possible, otherwise stolen from a sibling queue, otherwise after a
+  // bounded wait on its own queue. Returns nullptr once the runner has been
+  // terminated and all queues have drained.
+  std::unique_ptr<Task> GetNext(uint32_t index);
+
   bool terminated_ = false;
   base::Mutex lock_;
-  TaskQueue queue_;
+  // One queue per worker thread. Tasks are distributed over the queues
+  // round-robin at post time and idle workers steal from their siblings, so
+  // the workers do not all contend on a single queue lock.
+  std::vector<std::unique_ptr<TaskQueue>> queues_;
+  uint32_t next_queue_ = 0;
   std::vector<std::unique_ptr<WorkerThread>> thread_pool_;
 };
 
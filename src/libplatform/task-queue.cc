@@ -47,6 +47,23 @@ std::unique_ptr<Task> TaskQueue::GetNext() {
 }
 
 
+std::unique_ptr<Task> TaskQueue::TryGetNext() {
+  base::MutexGuard guard(&lock_);
+  if (task_queue_.empty()) return nullptr;
+  std::unique_ptr<Task> result = std::move(task_queue_.front());
+  task_queue_.pop();
+  return result;
+}
+
+bool TaskQueue::WaitForTask(const base::TimeDelta& rel_time) {
+  return process_queue_semaphore_.WaitFor(rel_time);
+}
+
+bool TaskQueue::IsTerminated() {
+  base::MutexGuard guard(&lock_);
+  return terminated_;
+}
+
 void TaskQueue::Terminate() {
   base::MutexGuard guard(&lock_);
   DCHECK(!terminated_);
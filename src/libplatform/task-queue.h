@@ -31,6 +31,19 @@ class V8_PLATFORM_EXPORT TaskQueue {
   // nullptr if the queue is terminated.
   std::unique_ptr<Task> GetNext();
 
+  // Returns the next task if one is immediately available, otherwise nullptr.
+  // Does not block. Tasks taken this way leave the internal semaphore count
+  // behind the queue length; blocked callers of GetNext() treat the surplus
+  // signals as spurious wakeups.
+  std::unique_ptr<Task> TryGetNext();
+
+  // Waits until a task may have been appended or the queue terminated, for at
+  // most {rel_time}. Returns false if the wait timed out.
+  bool WaitForTask(const base::TimeDelta& rel_time);
+
+  // Returns true once Terminate() has been called.
+  bool IsTerminated();
+
   // Terminate the queue.
   void Terminate();
 
@@ -180,6 +180,118 @@ TraceWriter* TraceWriter::CreateJSONTraceWriter(std::ostream& stream,
   return new JSONTraceWriter(stream, tag);
 }
 
+// Binary format constants. The stream starts with the magic and a version
+// word, followed by a sequence of records, each introduced by a one-byte
+// record type. All multi-byte values are in host byte order.
+static const char kBinaryTraceMagic[4] = {'V', '8', 'T', 'R'};
+static const uint32_t kBinaryTraceVersion = 1;
+
+enum BinaryTraceRecordType : uint8_t {
+  // uint32 id, uint32 byte length, then the (unterminated) string bytes.
+  kStringRecord = 1,
+  // The fixed-size event record; see BinaryTraceWriter::AppendTraceEvent.
+  kEventRecord = 2,
+};
+
+namespace {
+
+template <typename T>
+void WriteValue(std::ostream& stream, T value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+}  // namespace
+
+BinaryTraceWriter::BinaryTraceWriter(std::ostream& stream) : stream_(stream) {
+  stream_.write(kBinaryTraceMagic, sizeof(kBinaryTraceMagic));
+  WriteValue(stream_, kBinaryTraceVersion);
+}
+
+BinaryTraceWriter::~BinaryTraceWriter() { stream_.flush(); }
+
+uint32_t BinaryTraceWriter::InternString(const char* str) {
+  if (str == nullptr) return 0;
+  return InternString(std::string(str));
+}
+
+uint32_t BinaryTraceWriter::InternString(const std::string& str) {
+  auto it = string_ids_.find(str);
+  if (it != string_ids_.end()) return it->second;
+  uint32_t id = next_string_id_++;
+  string_ids_.emplace(str, id);
+  WriteValue<uint8_t>(stream_, kStringRecord);
+  WriteValue(stream_, id);
+  WriteValue(stream_, static_cast<uint32_t>(str.size()));
+  stream_.write(str.data(), str.size());
+  return id;
+}
+
+void BinaryTraceWriter::AppendArgValue(TraceObject* trace_event, int index) {
+  uint8_t type = trace_event->arg_types()[index];
+  WriteValue(stream_, type);
+  if (type == TRACE_VALUE_TYPE_CONVERTABLE) {
+    // Convertables only know how to stringify themselves, so store the
+    // stringified form. Interning still pays off for values that repeat.
+    std::string arg_stringified;
+    trace_event->arg_convertables()[index]->AppendAsTraceFormat(
+        &arg_stringified);
+    WriteValue<uint64_t>(stream_, InternString(arg_stringified));
+    return;
+  }
+  TraceObject::ArgValue value = trace_event->arg_values()[index];
+  switch (type) {
+    case TRACE_VALUE_TYPE_STRING:
+    case TRACE_VALUE_TYPE_COPY_STRING:
+      WriteValue<uint64_t>(stream_, InternString(value.as_string));
+      break;
+    default:
+      // All remaining value types fit in the 64-bit union representation.
+      WriteValue(stream_, value.as_uint);
+      break;
+  }
+}
+
+void BinaryTraceWriter::AppendTraceEvent(TraceObject* trace_event) {
+  // Intern the strings first so that their records precede the event record
+  // that references them.
+  uint32_t category_id = InternString(TracingController::GetCategoryGroupName(
+      trace_event->category_enabled_flag()));
+  uint32_t name_id = InternString(trace_event->name());
+  uint32_t scope_id = (trace_event->flags() & TRACE_EVENT_FLAG_HAS_ID)
+                          ? InternString(trace_event->scope())
+                          : 0;
+  uint32_t arg_name_ids[kTraceMaxNumArgs] = {0};
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    arg_name_ids[i] = InternString(trace_event->arg_names()[i]);
+  }
+
+  WriteValue<uint8_t>(stream_, kEventRecord);
+  WriteValue<int32_t>(stream_, trace_event->pid());
+  WriteValue<int32_t>(stream_, trace_event->tid());
+  WriteValue<uint8_t>(stream_, static_cast<uint8_t>(trace_event->phase()));
+  WriteValue<uint32_t>(stream_, trace_event->flags());
+  WriteValue<int64_t>(stream_, trace_event->ts());
+  WriteValue<int64_t>(stream_, trace_event->tts());
+  WriteValue<uint64_t>(stream_, trace_event->duration());
+  WriteValue<uint64_t>(stream_, trace_event->cpu_duration());
+  WriteValue<uint64_t>(stream_, trace_event->id());
+  WriteValue<uint64_t>(stream_, trace_event->bind_id());
+  WriteValue(stream_, category_id);
+  WriteValue(stream_, name_id);
+  WriteValue(stream_, scope_id);
+  WriteValue<uint8_t>(stream_, static_cast<uint8_t>(trace_event->num_args()));
+  for (int i = 0; i < trace_event->num_args(); ++i) {
+    WriteValue(stream_, arg_name_ids[i]);
+    AppendArgValue(trace_event, i);
+  }
+}
+
+void BinaryTraceWriter::Flush() { stream_.flush(); }
+
+TraceWriter* TraceWriter::CreateBinaryTraceWriter(std::ostream& stream) {
+  return new BinaryTraceWriter(stream);
+}
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -5,6 +5,9 @@
 #ifndef V8_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 #define V8_LIBPLATFORM_TRACING_TRACE_WRITER_H_
 
+#include <string>
+#include <unordered_map>
+
 #include "include/libplatform/v8-tracing.h"
 
 namespace v8 {
@@ -27,6 +30,30 @@ class JSONTraceWriter : public TraceWriter {
   bool append_comma_ = false;
 };
 
+// Writes events as packed binary records with interned strings. Category and
+// event names, scopes and string-valued arguments are emitted once as a
+// string record and referenced by id afterwards, so repeated events cost a
+// fixed-size record with no escaping or number formatting. The format is
+// host-endian and versioned; see kBinaryTraceMagic in trace-writer.cc.
+class BinaryTraceWriter : public TraceWriter {
+ public:
+  explicit BinaryTraceWriter(std::ostream& stream);
+  ~BinaryTraceWriter() override;
+  void AppendTraceEvent(TraceObject* trace_event) override;
+  void Flush() override;
+
+ private:
+  // Returns the id for |str|, writing a string record on first use. A null
+  // string maps to id 0 and no record.
+  uint32_t InternString(const char* str);
+  uint32_t InternString(const std::string& str);
+  void AppendArgValue(TraceObject* trace_event, int index);
+
+  std::ostream& stream_;
+  std::unordered_map<std::string, uint32_t> string_ids_;
+  uint32_t next_string_id_ = 1;
+};
+
 }  // namespace tracing
 }  // namespace platform
 }  // namespace v8
@@ -252,6 +252,96 @@ void CodeEventLogger::RegExpCodeCreateEvent(AbstractCode* code,
   LogRecordedBuffer(code, nullptr, name_buffer_->get(), name_buffer_->size());
 }
 
+// Writes perf map entries on a dedicated thread. With --perf-basic-prof-async
+// the thread that generated the code only copies the already assembled name
+// into a bounded circular buffer; formatting the line and the file I/O happen
+// here. The buffer mirrors the Profiler's sampler queue below: fixed-size
+// slots, a semaphore counting the filled ones, and a single producer at a
+// time (code event dispatch is serialized by the CodeEventDispatcher mutex).
+// On overflow the entry is dropped; a missing symbol merely leaves an
+// unresolved address in the profile, which beats stalling a compile thread.
+class PerfBasicWriterThread : public base::Thread {
+ public:
+  explicit PerfBasicWriterThread(FILE* output_handle)
+      : base::Thread(Options("v8:PerfBasicWriter")),
+        output_handle_(output_handle),
+        head_(0),
+        buffer_semaphore_(0) {
+    base::Relaxed_Store(&tail_, 0);
+    base::Relaxed_Store(&running_, 1);
+  }
+
+  // Inserts an entry. Called on the thread that generated the code.
+  void Enqueue(uintptr_t address, int size, const char* name, int name_length) {
+    if (Succ(head_) == static_cast<int>(base::Relaxed_Load(&tail_))) {
+      return;  // Buffer full, drop the entry.
+    }
+    Entry* entry = &buffer_[head_];
+    entry->address = address;
+    entry->size = size;
+    entry->name_length = Min(name_length, Entry::kMaxNameLength);
+    MemCopy(entry->name, name, entry->name_length);
+    head_ = Succ(head_);
+    buffer_semaphore_.Signal();  // Tell we have an element.
+  }
+
+  void Run() override {
+    while (true) {
+      buffer_semaphore_.Wait();  // Wait for an element.
+      if (!base::Relaxed_Load(&running_)) break;
+      WriteEntry(static_cast<int>(base::Relaxed_Load(&tail_)));
+    }
+    // The logger has been removed from the dispatcher before Stop() is
+    // called, so the remaining entries can be drained without a producer
+    // racing against us.
+    while (static_cast<int>(base::Relaxed_Load(&tail_)) != head_) {
+      WriteEntry(static_cast<int>(base::Relaxed_Load(&tail_)));
+    }
+  }
+
+  // Flushes remaining entries and joins the thread.
+  void Stop() {
+    base::Relaxed_Store(&running_, 0);
+    buffer_semaphore_.Signal();  // Wake the writer if it is idle.
+    Join();
+  }
+
+ private:
+  struct Entry {
+    // Matches CodeEventLogger::NameBuffer's capacity, so the asynchronous
+    // path never truncates more than the synchronous one does.
+    static const int kMaxNameLength = 512;
+
+    uintptr_t address;
+    int size;
+    int name_length;
+    char name[kMaxNameLength];
+  };
+
+  void WriteEntry(int index) {
+    Entry* entry = &buffer_[index];
+    base::OS::FPrint(output_handle_, "%" V8PRIxPTR " %x %.*s\n",
+                     entry->address, entry->size, entry->name_length,
+                     entry->name);
+    base::Relaxed_Store(&tail_, static_cast<base::Atomic32>(Succ(index)));
+  }
+
+  // Returns the next index in the cyclic buffer.
+  int Succ(int index) { return (index + 1) % kBufferSize; }
+
+  FILE* output_handle_;
+  // Cyclic buffer for communicating entries between the code-generating
+  // threads and the writer thread.
+  static const int kBufferSize = 128;
+  Entry buffer_[kBufferSize];
+  int head_;             // Index to the buffer head.
+  base::Atomic32 tail_;  // Index to the buffer tail.
+  // Semaphore used for buffer synchronization.
+  base::Semaphore buffer_semaphore_;
+  // Tells whether the writer thread should continue running.
+  base::Atomic32 running_;
+};
+
 // Linux perf tool logging support
 class PerfBasicLogger : public CodeEventLogger {
  public:
@@ -275,6 +365,7 @@ class PerfBasicLogger : public CodeEventLogger {
   static const int kFilenameBufferPadding;
 
   FILE* perf_output_handle_;
+  PerfBasicWriterThread* writer_thread_;
 };
 
 const char PerfBasicLogger::kFilenameFormatString[] = "/tmp/perf-%d.map";
@@ -282,7 +373,9 @@ const char PerfBasicLogger::kFilenameFormatString[] = "/tmp/perf-%d.map";
 const int PerfBasicLogger::kFilenameBufferPadding = 16;
 
 PerfBasicLogger::PerfBasicLogger(Isolate* isolate)
-    : CodeEventLogger(isolate), perf_output_handle_(nullptr) {
+    : CodeEventLogger(isolate),
+      perf_output_handle_(nullptr),
+      writer_thread_(nullptr) {
   // Open the perf JIT dump file.
   int bufferSize = sizeof(kFilenameFormatString) + kFilenameBufferPadding;
   ScopedVector<char> perf_dump_name(bufferSize);
@@ -295,10 +388,20 @@ PerfBasicLogger::PerfBasicLogger(Isolate* isolate)
       base::OS::FOpen(perf_dump_name.start(), base::OS::LogFileOpenMode);
   CHECK_NOT_NULL(perf_output_handle_);
   setvbuf(perf_output_handle_, nullptr, _IOLBF, 0);
+
+  if (FLAG_perf_basic_prof_async) {
+    writer_thread_ = new PerfBasicWriterThread(perf_output_handle_);
+    writer_thread_->Start();
+  }
 }
 
 
 PerfBasicLogger::~PerfBasicLogger() {
+  if (writer_thread_ != nullptr) {
+    writer_thread_->Stop();
+    delete writer_thread_;
+    writer_thread_ = nullptr;
+  }
   fclose(perf_output_handle_);
   perf_output_handle_ = nullptr;
 }
@@ -306,6 +409,10 @@ PerfBasicLogger::~PerfBasicLogger() {
 void PerfBasicLogger::WriteLogRecordedBuffer(uintptr_t address, int size,
                                              const char* name,
                                              int name_length) {
+  if (writer_thread_ != nullptr) {
+    writer_thread_->Enqueue(address, size, name, name_length);
+    return;
+  }
   // Linux perf expects hex literals without a leading 0x, while some
   // implementations of printf might prepend one when using the %p format
   // for pointers, leading to wrongly formatted JIT symbols maps.
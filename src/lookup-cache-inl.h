@@ -38,6 +38,79 @@ void DescriptorLookupCache::Update(Map source, Name* name, int result) {
   results_[index] = result;
 }
 
+// static
+int TransitionLookupCache::Hash(Map source, Name* name) {
+  DCHECK(name->IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t source_hash =
+      static_cast<uint32_t>(source.ptr()) >> kPointerSizeLog2;
+  uint32_t name_hash = name->hash_field();
+  return (source_hash ^ name_hash) % kLength;
+}
+
+// static
+uint32_t TransitionLookupCache::EncodeDetails(PropertyKind kind,
+                                              PropertyAttributes attributes) {
+  return (static_cast<uint32_t>(kind) << 3) |
+         static_cast<uint32_t>(attributes);
+}
+
+Map TransitionLookupCache::Lookup(Map source, Name* name, PropertyKind kind,
+                                  PropertyAttributes attributes) {
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  if ((key.source == source) && (key.name == name) &&
+      (key.details == EncodeDetails(kind, attributes))) {
+    return results_[index];
+  }
+  return Map();
+}
+
+void TransitionLookupCache::Update(Map source, Name* name, PropertyKind kind,
+                                   PropertyAttributes attributes, Map target) {
+  DCHECK(!target.is_null());
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  key.source = source;
+  key.name = name;
+  key.details = EncodeDetails(kind, attributes);
+  results_[index] = target;
+}
+
+// static
+int PropertyLookupCache::Hash(Map source, Name* name) {
+  DCHECK(name->IsUniqueName());
+  // Uses only lower 32 bits if pointers are larger.
+  uint32_t source_hash =
+      static_cast<uint32_t>(source.ptr()) >> kPointerSizeLog2;
+  uint32_t name_hash = name->hash_field();
+  return (source_hash ^ name_hash) % kLength;
+}
+
+int PropertyLookupCache::Lookup(Map source, Name* name, JSObject** holder_out,
+                                Cell** validity_cell_out) {
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  if ((key.source == source) && (key.name == name)) {
+    *holder_out = holders_[index];
+    *validity_cell_out = validity_cells_[index];
+    return descriptors_[index];
+  }
+  return kAbsent;
+}
+
+void PropertyLookupCache::Update(Map source, Name* name, JSObject* holder,
+                                 Cell* validity_cell, int descriptor) {
+  DCHECK_NE(descriptor, kAbsent);
+  int index = Hash(source, name);
+  Key& key = keys_[index];
+  key.source = source;
+  key.name = name;
+  holders_[index] = holder;
+  validity_cells_[index] = validity_cell;
+  descriptors_[index] = descriptor;
+}
+
 }  // namespace internal
 }  // namespace v8
 
@@ -13,5 +13,13 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+void TransitionLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].source = Map();
+}
+
+void PropertyLookupCache::Clear() {
+  for (int index = 0; index < kLength; index++) keys_[index].source = Map();
+}
+
 }  // namespace internal
 }  // namespace v8
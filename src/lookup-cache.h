@@ -53,6 +53,107 @@ class DescriptorLookupCache {
   DISALLOW_COPY_AND_ASSIGN(DescriptorLookupCache);
 };
 
+// Cache for mapping (map, transition key) into the transition target map.
+// Repeatedly constructing objects of the same shape walks the same transition
+// chain, probing one TransitionArray per property; this cache makes each of
+// those probes O(1) after the first construction. Only positive results are
+// cached, since a miss is usually followed by the transition being created.
+// Cleared at startup, prior to any gc, and whenever transitions are mutated.
+class TransitionLookupCache {
+ public:
+  // Lookup the transition target for (source, name, kind, attributes).
+  // Returns a null Map if absent.
+  inline Map Lookup(Map source, Name* name, PropertyKind kind,
+                    PropertyAttributes attributes);
+
+  // Update an element in the cache.
+  inline void Update(Map source, Name* name, PropertyKind kind,
+                     PropertyAttributes attributes, Map target);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  TransitionLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      keys_[i].source = Map();
+      keys_[i].name = nullptr;
+      keys_[i].details = 0;
+      results_[i] = Map();
+    }
+  }
+
+  static inline int Hash(Map source, Name* name);
+  static inline uint32_t EncodeDetails(PropertyKind kind,
+                                       PropertyAttributes attributes);
+
+  static const int kLength = 64;
+  struct Key {
+    Map source;
+    Name* name;
+    uint32_t details;
+  };
+
+  Key keys_[kLength];
+  Map results_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(TransitionLookupCache);
+};
+
+// Cache for (receiver map, property name) lookups that resolved to a fast
+// data property on an object further up the prototype chain. Megamorphic
+// access sites that fall through to the runtime re-walk the whole chain on
+// every access; a hit here replaces the walk with a single probe, guarded by
+// the same prototype chain validity cell the IC handlers use. Only holders
+// in old space are cached so entries cannot be moved by scavenges.
+// Cleared at startup and prior to any gc.
+class PropertyLookupCache {
+ public:
+  static const int kAbsent = -1;
+
+  // Lookup the cached result for (source, name). Returns the descriptor
+  // index of the property in the holder's map and fills *holder_out and
+  // *validity_cell_out, or returns kAbsent. The caller must check the
+  // validity cell before using the result.
+  inline int Lookup(Map source, Name* name, JSObject** holder_out,
+                    Cell** validity_cell_out);
+
+  // Update an element in the cache.
+  inline void Update(Map source, Name* name, JSObject* holder,
+                     Cell* validity_cell, int descriptor);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  PropertyLookupCache() {
+    for (int i = 0; i < kLength; ++i) {
+      keys_[i].source = Map();
+      keys_[i].name = nullptr;
+      holders_[i] = nullptr;
+      validity_cells_[i] = nullptr;
+      descriptors_[i] = kAbsent;
+    }
+  }
+
+  static inline int Hash(Map source, Name* name);
+
+  static const int kLength = 128;
+  struct Key {
+    Map source;
+    Name* name;
+  };
+
+  Key keys_[kLength];
+  JSObject* holders_[kLength];
+  Cell* validity_cells_[kLength];
+  int descriptors_[kLength];
+
+  friend class Isolate;
+  DISALLOW_COPY_AND_ASSIGN(PropertyLookupCache);
+};
+
 }  // namespace internal
 }  // namespace v8
 
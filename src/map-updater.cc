@@ -4,12 +4,18 @@
 
 #include "src/map-updater.h"
 
+#include <vector>
+
+#include "src/base/template-utils.h"
+#include "src/cancelable-task.h"
 #include "src/field-type.h"
 #include "src/handles.h"
+#include "src/heap/heap.h"
 #include "src/isolate.h"
 #include "src/objects-inl.h"
 #include "src/objects.h"
 #include "src/transitions.h"
+#include "src/v8.h"
 
 namespace v8 {
 namespace internal {
@@ -22,6 +28,55 @@ inline bool EqualImmutableValues(Object* obj1, Object* obj2) {
   return false;
 }
 
+// Eagerly migrates instances of deprecated maps. Migration is normally lazy:
+// each object goes through JSObject::MigrateInstance when it is next touched,
+// which spreads the cost of a field generalization over subsequent user code.
+// With --batch-migrate-deprecated-maps a single task posted right after the
+// deprecation concentrates that work in one place instead. The heap walk only
+// collects the affected objects; migration happens after the iterator is gone
+// because it allocates and may trigger GC.
+class MigrateDeprecatedInstancesTask final : public CancelableTask {
+ public:
+  explicit MigrateDeprecatedInstancesTask(Isolate* isolate)
+      : CancelableTask(isolate), isolate_(isolate) {}
+
+  void RunInternal() override {
+    isolate_->set_batch_migration_task_pending(false);
+    HandleScope scope(isolate_);
+    std::vector<Handle<JSObject>> to_migrate;
+    {
+      HeapIterator iterator(isolate_->heap());
+      for (HeapObject* obj = iterator.next(); obj != nullptr;
+           obj = iterator.next()) {
+        if (!obj->IsJSObject()) continue;
+        JSObject* js_object = JSObject::cast(obj);
+        if (!js_object->map()->is_deprecated()) continue;
+        to_migrate.push_back(handle(js_object, isolate_));
+      }
+    }
+    for (Handle<JSObject> object : to_migrate) {
+      // An earlier migration in this loop may already have updated the
+      // object's map, e.g. through an allocation-triggered GC callback.
+      if (!object->map()->is_deprecated()) continue;
+      JSObject::MigrateInstance(object);
+    }
+  }
+
+ private:
+  Isolate* isolate_;
+
+  DISALLOW_COPY_AND_ASSIGN(MigrateDeprecatedInstancesTask);
+};
+
+void ScheduleBatchMigration(Isolate* isolate) {
+  if (isolate->batch_migration_task_pending()) return;
+  isolate->set_batch_migration_task_pending(true);
+  auto taskrunner = V8::GetCurrentPlatform()->GetForegroundTaskRunner(
+      reinterpret_cast<v8::Isolate*>(isolate));
+  taskrunner->PostTask(
+      base::make_unique<MigrateDeprecatedInstancesTask>(isolate));
+}
+
 }  // namespace
 
 MapUpdater::MapUpdater(Isolate* isolate, Handle<Map> old_map)
@@ -658,6 +713,9 @@ MapUpdater::State MapUpdater::ConstructNewMap() {
       GetKey(split_nof), split_details.kind(), split_details.attributes());
   if (!maybe_transition.is_null()) {
     maybe_transition->DeprecateTransitionTree(isolate_);
+    if (V8_UNLIKELY(FLAG_batch_migrate_deprecated_maps)) {
+      ScheduleBatchMigration(isolate_);
+    }
   }
 
   // If |maybe_transition| is not nullptr then the transition array already
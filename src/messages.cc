@@ -653,7 +653,12 @@ MaybeHandle<String> JSStackFrame::ToString() {
   return builder.Finish();
 }
 
-int JSStackFrame::GetPosition() const { return code_->SourcePosition(offset_); }
+int JSStackFrame::GetPosition() const {
+  // Decoding the source position table is expensive; both the line and the
+  // column number computation need the position, so cache it.
+  if (!cached_position_) cached_position_ = code_->SourcePosition(offset_);
+  return *cached_position_;
+}
 
 bool JSStackFrame::HasScript() const {
   return function_->shared()->script()->IsScript();
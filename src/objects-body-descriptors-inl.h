@@ -182,6 +182,34 @@ class JSWeakCell::BodyDescriptor final : public BodyDescriptorBase {
   }
 };
 
+class SharedFunctionInfo::BodyDescriptor final : public BodyDescriptorBase {
+ public:
+  STATIC_ASSERT(SharedFunctionInfo::kStartOfPointerFieldsOffset ==
+                SharedFunctionInfo::kFunctionDataOffset);
+
+  static bool IsValidSlot(Map map, HeapObject* obj, int offset) {
+    return offset >= SharedFunctionInfo::kStartOfPointerFieldsOffset &&
+           offset < SharedFunctionInfo::kEndOfPointerFieldsOffset;
+  }
+
+  template <typename ObjectVisitor>
+  static inline void IterateBody(Map map, HeapObject* obj, int object_size,
+                                 ObjectVisitor* v) {
+    // The function data is visited as a custom weak pointer. This is skipped
+    // by the garbage collector's marking visitors, which instead either treat
+    // it as strong or flush old bytecode (see
+    // SharedFunctionInfo::ShouldFlushBytecode).
+    IterateCustomWeakPointer(obj, SharedFunctionInfo::kFunctionDataOffset, v);
+    IteratePointers(obj,
+                    SharedFunctionInfo::kFunctionDataOffset + kPointerSize,
+                    SharedFunctionInfo::kEndOfPointerFieldsOffset, v);
+  }
+
+  static inline int SizeOf(Map map, HeapObject* object) {
+    return SharedFunctionInfo::kAlignedSize;
+  }
+};
+
 class AllocationSite::BodyDescriptor final : public BodyDescriptorBase {
  public:
   STATIC_ASSERT(AllocationSite::kCommonPointerFieldEndOffset ==
@@ -424,7 +452,8 @@ class FeedbackVector::BodyDescriptor final : public BodyDescriptorBase {
  public:
   static bool IsValidSlot(Map map, HeapObject* obj, int offset) {
     return offset == kSharedFunctionInfoOffset ||
-           offset == kOptimizedCodeOffset || offset >= kFeedbackSlotsOffset;
+           offset == kOptimizedCodeOffset || offset == kOsrCodeOffset ||
+           offset >= kFeedbackSlotsOffset;
   }
 
   template <typename ObjectVisitor>
@@ -432,6 +461,7 @@ class FeedbackVector::BodyDescriptor final : public BodyDescriptorBase {
                                  ObjectVisitor* v) {
     IteratePointer(obj, kSharedFunctionInfoOffset, v);
     IterateMaybeWeakPointer(obj, kOptimizedCodeOffset, v);
+    IterateMaybeWeakPointer(obj, kOsrCodeOffset, v);
     IterateMaybeWeakPointers(obj, kFeedbackSlotsOffset, object_size, v);
   }
 
@@ -489,6 +489,9 @@ void FeedbackVector::FeedbackVectorVerify(Isolate* isolate) {
   MaybeObject code = optimized_code_weak_or_smi();
   MaybeObject::VerifyMaybeObjectPointer(isolate, code);
   CHECK(code->IsSmi() || code->IsWeakOrCleared());
+  MaybeObject osr_code = osr_code_weak_or_smi();
+  MaybeObject::VerifyMaybeObjectPointer(isolate, osr_code);
+  CHECK(osr_code->IsSmi() || osr_code->IsWeakOrCleared());
 }
 
 template <class Traits>
@@ -1518,20 +1521,29 @@ void JSRegExp::JSRegExpVerify(Isolate* isolate) {
       bool is_native = RegExpImpl::UsesNativeRegExp();
 
       FixedArray* arr = FixedArray::cast(data());
+      // With --regexp-tier-up, native builds also hold bytecode until the
+      // regexp has run hot.
+      bool bytecode_allowed = !is_native || FLAG_regexp_tier_up;
       Object* one_byte_data = arr->get(JSRegExp::kIrregexpLatin1CodeIndex);
       // Smi : Not compiled yet (-1).
       // Code/ByteArray: Compiled code.
       CHECK(
           (one_byte_data->IsSmi() &&
            Smi::ToInt(one_byte_data) == JSRegExp::kUninitializedValue) ||
-          (is_native ? one_byte_data->IsCode() : one_byte_data->IsByteArray()));
+          (is_native && one_byte_data->IsCode()) ||
+          (bytecode_allowed && one_byte_data->IsByteArray()));
       Object* uc16_data = arr->get(JSRegExp::kIrregexpUC16CodeIndex);
       CHECK((uc16_data->IsSmi() &&
              Smi::ToInt(uc16_data) == JSRegExp::kUninitializedValue) ||
-            (is_native ? uc16_data->IsCode() : uc16_data->IsByteArray()));
+            (is_native && uc16_data->IsCode()) ||
+            (bytecode_allowed && uc16_data->IsByteArray()));
 
       CHECK(arr->get(JSRegExp::kIrregexpCaptureCountIndex)->IsSmi());
       CHECK(arr->get(JSRegExp::kIrregexpMaxRegisterCountIndex)->IsSmi());
+      CHECK(arr->get(JSRegExp::kIrregexpTierUpTicksIndex)->IsSmi());
+      Object* required_prefix =
+          arr->get(JSRegExp::kIrregexpRequiredPrefixIndex);
+      CHECK(required_prefix->IsSmi() || required_prefix->IsString());
       break;
     }
     default:
@@ -1129,6 +1129,10 @@ void FeedbackVector::FeedbackVectorPrint(std::ostream& os) {  // NOLINT
   } else {
     os << optimization_marker();
   }
+  if (has_osr_code()) {
+    os << "\n - osr code (bailout id " << osr_bailout_id()
+       << "): " << Brief(osr_code_weak_or_smi());
+  }
   os << "\n - invocation count: " << invocation_count();
   os << "\n - profiler ticks: " << profiler_ticks();
 
@@ -3864,6 +3864,9 @@ void HeapObject::RehashBasedOnMap(Isolate* isolate) {
       break;
     case NAME_DICTIONARY_TYPE:
       NameDictionary::cast(this)->Rehash(isolate);
+      // In-place rehashing moves entries around, so any iteration index
+      // cache serialized into the snapshot is stale now.
+      NameDictionary::cast(this)->InvalidateCachedIterationIndices();
       break;
     case GLOBAL_DICTIONARY_TYPE:
       GlobalDictionary::cast(this)->Rehash(isolate);
@@ -6920,6 +6923,7 @@ void JSReceiver::DeleteNormalizedProperty(Handle<JSReceiver> object,
     Handle<NameDictionary> dictionary(object->property_dictionary(), isolate);
     DCHECK_NE(NameDictionary::kNotFound, entry);
 
+    dictionary->InvalidateCachedIterationIndices();
     dictionary = NameDictionary::DeleteEntry(isolate, dictionary, entry);
     object->SetProperties(*dictionary);
   }
@@ -11783,26 +11787,21 @@ bool String::SlowEquals(Isolate* isolate, Handle<String> one,
   }
 
   // We know the strings are both non-empty. Compare the first chars
-  // before we try to flatten the strings.
+  // before we walk the string segments.
   if (one->Get(0) != two->Get(0)) return false;
 
-  one = String::Flatten(isolate, one);
-  two = String::Flatten(isolate, two);
-
   DisallowHeapAllocation no_gc;
-  String::FlatContent flat1 = one->GetFlatContent();
-  String::FlatContent flat2 = two->GetFlatContent();
-
-  if (flat1.IsOneByte() && flat2.IsOneByte()) {
-      return CompareRawStringContents(flat1.ToOneByteVector().start(),
-                                      flat2.ToOneByteVector().start(),
-                                      one_length);
-  } else {
-    for (int i = 0; i < one_length; i++) {
-      if (flat1.Get(i) != flat2.Get(i)) return false;
-    }
-    return true;
+  if (one->IsSeqOneByteString() && two->IsSeqOneByteString()) {
+    const uint8_t* str1 = SeqOneByteString::cast(*one)->GetChars();
+    const uint8_t* str2 = SeqOneByteString::cast(*two)->GetChars();
+    return CompareRawStringContents(str1, str2, one_length);
   }
+
+  // Stream the string segments through the comparator instead of flattening:
+  // flattening a deep cons tree allocates a copy of the whole string just to
+  // compare it.
+  StringComparator comparator;
+  return comparator.Equals(*one, *two);
 }
 
 
@@ -12576,6 +12575,14 @@ void JSFunction::MarkForOptimization(ConcurrencyMode mode) {
 }
 
 // static
+// Note on laziness: the vector must exist before the function's bytecode
+// runs. Nearly every feedback-consuming bytecode handler in
+// interpreter-generator.cc uses the checked LoadFeedbackVector(), and the
+// Load/Store/Call IC builtins it tail-calls take the vector as an operand
+// with no vector-less variant in the snapshot. Deferring this allocation
+// behind an invocation-count budget therefore requires growing no-feedback
+// fallback paths in every one of those handlers and builtins first; the
+// allocation site itself is not the hard part.
 void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function) {
   Isolate* const isolate = function->GetIsolate();
   if (function->feedback_cell()->value()->IsUndefined(isolate)) {
@@ -12911,6 +12918,14 @@ void Map::SetShouldBeFastPrototypeMap(Handle<Map> map, bool value,
 }
 
 // static
+//
+// The returned cell summarizes the validity of the entire prototype chain of
+// the given map: IC handlers and compiled accesses check just this one cell,
+// not one per prototype. That works because invalidation is transitive —
+// when any object in the chain has its prototype, elements kind or
+// properties changed in a way that affects handlers,
+// InvalidatePrototypeChains() walks the prototype-user registry backwards
+// towards leaf objects and flips the cells of all dependent maps.
 Handle<Object> Map::GetOrCreatePrototypeChainValidityCell(Handle<Map> map,
                                                           Isolate* isolate) {
   Handle<Object> maybe_prototype;
@@ -14537,8 +14552,9 @@ int AbstractCode::SourcePosition(int offset) {
   int position = 0;
   // Subtract one because the current PC is one instruction after the call site.
   if (IsCode()) offset--;
-  for (SourcePositionTableIterator iterator(source_position_table());
-       !iterator.done() && iterator.code_offset() <= offset;
+  SourcePositionTableIterator iterator(source_position_table());
+  iterator.SeekForward(offset);
+  for (; !iterator.done() && iterator.code_offset() <= offset;
        iterator.Advance()) {
     position = iterator.source_position().ScriptOffset();
   }
@@ -15821,6 +15837,7 @@ void AllocationSite::ResetPretenureDecision() {
   set_pretenure_decision(kUndecided);
   set_memento_found_count(0);
   set_memento_create_count(0);
+  set_pretenure_strike_count(0);
 }
 
 PretenureFlag AllocationSite::GetPretenureMode() const {
@@ -16230,6 +16247,51 @@ class StringSharedKey : public HashTableKey {
   int position_;
 };
 
+// ScriptCacheKeys are used as keys in the script cache. Unlike the eval
+// cache, the key deliberately contains nothing that depends on the native
+// context: a script's SharedFunctionInfo is context-independent until the
+// script is instantiated, so identical source compiled in any context may
+// share one entry. The origin checks (resource name, line and column
+// offsets, origin options) are performed separately by
+// CompilationCacheScript::HasOrigin.
+class ScriptCacheKey : public HashTableKey {
+ public:
+  ScriptCacheKey(Handle<String> source, LanguageMode language_mode)
+      : HashTableKey(
+            CompilationCacheShape::ScriptHash(*source, language_mode)),
+        source_(source),
+        language_mode_(language_mode) {}
+
+  bool IsMatch(Object* other) override {
+    DisallowHeapAllocation no_allocation;
+    if (!other->IsFixedArray()) {
+      DCHECK(other->IsNumber());
+      uint32_t other_hash = static_cast<uint32_t>(other->Number());
+      return Hash() == other_hash;
+    }
+    FixedArray* other_array = FixedArray::cast(other);
+    DCHECK_EQ(2, other_array->length());
+    int language_unchecked = Smi::ToInt(other_array->get(1));
+    DCHECK(is_valid_language_mode(language_unchecked));
+    LanguageMode language_mode = static_cast<LanguageMode>(language_unchecked);
+    if (language_mode != language_mode_) return false;
+    String* source = String::cast(other_array->get(0));
+    return source->Equals(*source_);
+  }
+
+  Handle<Object> AsHandle(Isolate* isolate) {
+    Handle<FixedArray> array = isolate->factory()->NewFixedArray(2);
+    array->set(0, *source_);
+    array->set(1, Smi::FromEnum(language_mode_));
+    array->set_map(ReadOnlyRoots(isolate).fixed_cow_array_map());
+    return array;
+  }
+
+ private:
+  Handle<String> source_;
+  LanguageMode language_mode_;
+};
+
 v8::Promise::PromiseState JSPromise::status() const {
   int value = flags() & kStatusMask;
   DCHECK(value == 0 || value == 1 || value == 2);
@@ -17204,9 +17266,15 @@ Handle<String> StringTable::AddKeyNoResize(Isolate* isolate,
   DCHECK(string->HasHashCode());
   DCHECK_EQ(table->FindEntry(isolate, key), kNotFound);
 
-  // Add the new string and return it along with the string table.
+  // Add the new string and return it along with the string table. The entry
+  // is published with a release store so that a concurrent reader observing
+  // the slot (see TryLookupConcurrent) also observes the string's map, hash
+  // and contents.
   int entry = table->FindInsertionEntry(key->Hash());
-  table->set(EntryToIndex(entry), *string);
+  ObjectSlot slot = table->RawFieldOfElementAt(EntryToIndex(entry));
+  slot.Release_Store(ObjectPtr(string->ptr()));
+  MarkingBarrier(*table, slot, *string);
+  GenerationalBarrier(*table, slot, *string);
   table->ElementAdded();
 
   return Handle<String>::cast(string);
@@ -17397,6 +17465,36 @@ Object* StringTable::LookupStringIfExists_NoAllocate(Isolate* isolate,
   return Smi::FromInt(ResultSentinel::kNotFound);
 }
 
+// static
+Object* StringTable::TryLookupConcurrent(Isolate* isolate,
+                                         StringTableKey* key) {
+  DisallowHeapAllocation no_gc;
+  // Insertions may install a grown copy of the table; load the root with an
+  // acquire so that the elements copied into the new table are visible (see
+  // Heap::SetRootStringTable).
+  StringTable* table = StringTable::cast(
+      ObjectSlot(&isolate->roots_table()[RootIndex::kStringTable])
+          .Acquire_Load());
+
+  uint32_t capacity = static_cast<uint32_t>(table->Capacity());
+  ReadOnlyRoots roots(isolate);
+  Object* undefined = roots.undefined_value();
+  Object* the_hole = roots.the_hole_value();
+  uint32_t count = 1;
+  for (uint32_t entry = FirstProbe(key->Hash(), capacity);;
+       entry = NextProbe(entry, count++, capacity)) {
+    Object* element =
+        table->RawFieldOfElementAt(EntryToIndex(static_cast<int>(entry)))
+            .Acquire_Load();
+    // An empty entry terminates the probe sequence: the string is either not
+    // in the table or was inserted after this thread started probing.
+    if (element == undefined) break;
+    if (element == the_hole) continue;
+    if (key->IsMatch(element)) return element;
+  }
+  return Smi::FromInt(ResultSentinel::kNotFound);
+}
+
 String* StringTable::ForwardStringIfExists(Isolate* isolate,
                                            StringTableKey* key,
                                            String* string) {
@@ -17562,17 +17660,10 @@ FeedbackCell* SearchLiteralsMap(CompilationCacheTable* cache, int cache_entry,
 }  // namespace
 
 MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
-    Handle<CompilationCacheTable> table, Handle<String> src,
-    Handle<Context> native_context, LanguageMode language_mode) {
-  // We use the empty function SFI as part of the key. Although the
-  // empty_function is native context dependent, the SFI is de-duped on
-  // snapshot builds by the PartialSnapshotCache, and so this does not prevent
-  // reuse of scripts in the compilation cache across native contexts.
-  Handle<SharedFunctionInfo> shared(native_context->empty_function()->shared(),
-                                    native_context->GetIsolate());
-  Isolate* isolate = native_context->GetIsolate();
+    Isolate* isolate, Handle<CompilationCacheTable> table, Handle<String> src,
+    LanguageMode language_mode) {
   src = String::Flatten(isolate, src);
-  StringSharedKey key(src, shared, language_mode, kNoSourcePosition);
+  ScriptCacheKey key(src, language_mode);
   int entry = table->FindEntry(isolate, &key);
   if (entry == kNotFound) return MaybeHandle<SharedFunctionInfo>();
   int index = EntryToIndex(entry);
@@ -17581,7 +17672,7 @@ MaybeHandle<SharedFunctionInfo> CompilationCacheTable::LookupScript(
   }
   Object* obj = table->get(index + 1);
   if (obj->IsSharedFunctionInfo()) {
-    return handle(SharedFunctionInfo::cast(obj), native_context->GetIsolate());
+    return handle(SharedFunctionInfo::cast(obj), isolate);
   }
   return MaybeHandle<SharedFunctionInfo>();
 }
@@ -17618,18 +17709,10 @@ Handle<Object> CompilationCacheTable::LookupRegExp(Handle<String> src,
 }
 
 Handle<CompilationCacheTable> CompilationCacheTable::PutScript(
-    Handle<CompilationCacheTable> cache, Handle<String> src,
-    Handle<Context> native_context, LanguageMode language_mode,
-    Handle<SharedFunctionInfo> value) {
-  Isolate* isolate = native_context->GetIsolate();
-  // We use the empty function SFI as part of the key. Although the
-  // empty_function is native context dependent, the SFI is de-duped on
-  // snapshot builds by the PartialSnapshotCache, and so this does not prevent
-  // reuse of scripts in the compilation cache across native contexts.
-  Handle<SharedFunctionInfo> shared(native_context->empty_function()->shared(),
-                                    isolate);
+    Isolate* isolate, Handle<CompilationCacheTable> cache, Handle<String> src,
+    LanguageMode language_mode, Handle<SharedFunctionInfo> value) {
   src = String::Flatten(isolate, src);
-  StringSharedKey key(src, shared, language_mode, kNoSourcePosition);
+  ScriptCacheKey key(src, language_mode);
   Handle<Object> k = key.AsHandle(isolate);
   cache = EnsureCapacity(isolate, cache, 1);
   int entry = cache->FindInsertionEntry(key.Hash());
@@ -17742,6 +17825,7 @@ Handle<Derived> BaseNameDictionary<Derived, Shape>::New(
       isolate, at_least_space_for, pretenure, capacity_option);
   dict->SetHash(PropertyArray::kNoHashSentinel);
   dict->SetNextEnumerationIndex(PropertyDetails::kInitialIndex);
+  dict->InvalidateCachedIterationIndices();
   return dict;
 }
 
@@ -17774,7 +17858,14 @@ Handle<Derived> BaseNameDictionary<Derived, Shape>::EnsureCapacity(
     dictionary->SetNextEnumerationIndex(PropertyDetails::kInitialIndex +
                                         length);
   }
-  return HashTable<Derived, Shape>::EnsureCapacity(isolate, dictionary, n);
+  Handle<Derived> new_dictionary =
+      HashTable<Derived, Shape>::EnsureCapacity(isolate, dictionary, n);
+  if (!new_dictionary.is_identical_to(dictionary)) {
+    // Growing rehashed the entries into a new table; the iteration index
+    // cache copied over with the prefix refers to the old entry positions.
+    new_dictionary->InvalidateCachedIterationIndices();
+  }
+  return new_dictionary;
 }
 
 template <typename Derived, typename Shape>
@@ -17838,6 +17929,7 @@ Handle<Derived> BaseNameDictionary<Derived, Shape>::Add(
   // Update enumeration index here in order to avoid potential modification of
   // the canonical empty dictionary which lives in read only space.
   dictionary->SetNextEnumerationIndex(index + 1);
+  dictionary->InvalidateCachedIterationIndices();
   return dictionary;
 }
 
@@ -17967,50 +18059,40 @@ void BaseNameDictionary<Derived, Shape>::CopyEnumKeysTo(
     KeyCollectionMode mode, KeyAccumulator* accumulator) {
   DCHECK_IMPLIES(mode != KeyCollectionMode::kOwnOnly, accumulator != nullptr);
   int length = storage->length();
-  int capacity = dictionary->Capacity();
+  // The cached iteration order is already sorted by enumeration index, so
+  // enumerable keys can be copied out directly.
+  Handle<FixedArray> order = IterationIndices(isolate, dictionary);
+  int order_size = order->length();
   int properties = 0;
-  ReadOnlyRoots roots(isolate);
-  for (int i = 0; i < capacity; i++) {
-    Object* key;
-    if (!dictionary->ToKey(roots, i, &key)) continue;
-    bool is_shadowing_key = false;
+  for (int i = 0; i < order_size; i++) {
+    int index = Smi::ToInt(order->get(i));
+    Object* key = dictionary->NameAt(index);
     if (key->IsSymbol()) continue;
-    PropertyDetails details = dictionary->DetailsAt(i);
+    PropertyDetails details = dictionary->DetailsAt(index);
     if (details.IsDontEnum()) {
       if (mode == KeyCollectionMode::kIncludePrototypes) {
-        is_shadowing_key = true;
-      } else {
-        continue;
+        accumulator->AddShadowingKey(key);
       }
-    }
-    if (is_shadowing_key) {
-      accumulator->AddShadowingKey(key);
       continue;
-    } else {
-      storage->set(properties, Smi::FromInt(i));
     }
+    storage->set(properties, key);
     properties++;
     if (mode == KeyCollectionMode::kOwnOnly && properties == length) break;
   }
 
   CHECK_EQ(length, properties);
-  DisallowHeapAllocation no_gc;
-  Derived* raw_dictionary = *dictionary;
-  FixedArray* raw_storage = *storage;
-  EnumIndexComparator<Derived> cmp(raw_dictionary);
-  // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-  // store operations that are safe for concurrent marking.
-  AtomicSlot start(storage->GetFirstElementAddress());
-  std::sort(start, start + length, cmp);
-  for (int i = 0; i < length; i++) {
-    int index = Smi::ToInt(raw_storage->get(i));
-    raw_storage->set(i, raw_dictionary->NameAt(index));
-  }
 }
 
 template <typename Derived, typename Shape>
 Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
     Isolate* isolate, Handle<Derived> dictionary) {
+  if (Shape::kCacheIterationIndices &&
+      dictionary->cached_iteration_indices()->IsFixedArray()) {
+    Handle<FixedArray> indices(
+        FixedArray::cast(dictionary->cached_iteration_indices()), isolate);
+    DCHECK_EQ(dictionary->NumberOfElements(), indices->length());
+    return indices;
+  }
   int capacity = dictionary->Capacity();
   int length = dictionary->NumberOfElements();
   Handle<FixedArray> array = isolate->factory()->NewFixedArray(length);
@@ -18033,45 +18115,43 @@ Handle<FixedArray> BaseNameDictionary<Derived, Shape>::IterationIndices(
     AtomicSlot start(array->GetFirstElementAddress());
     std::sort(start, start + array_size, cmp);
   }
-  return FixedArray::ShrinkOrEmpty(isolate, array, array_size);
+  Handle<FixedArray> result =
+      FixedArray::ShrinkOrEmpty(isolate, array, array_size);
+  // Remember the iteration order for the next round. Empty dictionaries are
+  // excluded; the canonical one lives in read only space.
+  if (Shape::kCacheIterationIndices && array_size > 0) {
+    dictionary->SetCachedIterationIndices(*result);
+  }
+  return result;
 }
 
 template <typename Derived, typename Shape>
 void BaseNameDictionary<Derived, Shape>::CollectKeysTo(
     Handle<Derived> dictionary, KeyAccumulator* keys) {
   Isolate* isolate = keys->isolate();
-  ReadOnlyRoots roots(isolate);
-  int capacity = dictionary->Capacity();
-  Handle<FixedArray> array =
-      isolate->factory()->NewFixedArray(dictionary->NumberOfElements());
+  // The iteration order is served from the dictionary's cache when possible,
+  // which makes the capacity-wide scan and the sort above unnecessary.
+  Handle<FixedArray> order = IterationIndices(isolate, dictionary);
+  int order_size = order->length();
+  Handle<FixedArray> array = isolate->factory()->NewFixedArray(order_size);
   int array_size = 0;
   PropertyFilter filter = keys->filter();
-  {
-    DisallowHeapAllocation no_gc;
-    Derived* raw_dictionary = *dictionary;
-    for (int i = 0; i < capacity; i++) {
-      Object* k;
-      if (!raw_dictionary->ToKey(roots, i, &k)) continue;
-      if (k->FilterKey(filter)) continue;
-      PropertyDetails details = raw_dictionary->DetailsAt(i);
-      if ((details.attributes() & filter) != 0) {
-        keys->AddShadowingKey(k);
-        continue;
-      }
-      if (filter & ONLY_ALL_CAN_READ) {
-        if (details.kind() != kAccessor) continue;
-        Object* accessors = raw_dictionary->ValueAt(i);
-        if (!accessors->IsAccessorInfo()) continue;
-        if (!AccessorInfo::cast(accessors)->all_can_read()) continue;
-      }
-      array->set(array_size++, Smi::FromInt(i));
+  for (int i = 0; i < order_size; i++) {
+    int index = Smi::ToInt(order->get(i));
+    Object* k = dictionary->NameAt(index);
+    if (k->FilterKey(filter)) continue;
+    PropertyDetails details = dictionary->DetailsAt(index);
+    if ((details.attributes() & filter) != 0) {
+      keys->AddShadowingKey(k);
+      continue;
     }
-
-    EnumIndexComparator<Derived> cmp(raw_dictionary);
-    // Use AtomicSlot wrapper to ensure that std::sort uses atomic load and
-    // store operations that are safe for concurrent marking.
-    AtomicSlot start(array->GetFirstElementAddress());
-    std::sort(start, start + array_size, cmp);
+    if (filter & ONLY_ALL_CAN_READ) {
+      if (details.kind() != kAccessor) continue;
+      Object* accessors = dictionary->ValueAt(index);
+      if (!accessors->IsAccessorInfo()) continue;
+      if (!AccessorInfo::cast(accessors)->all_can_read()) continue;
+    }
+    array->set(array_size++, Smi::FromInt(index));
   }
 
   bool has_seen_symbol = false;
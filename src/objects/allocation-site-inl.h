@@ -153,6 +153,16 @@ inline void AllocationSite::set_memento_found_count(int count) {
   set_pretenure_data(MementoFoundCountBits::update(value, count));
 }
 
+int AllocationSite::pretenure_strike_count() const {
+  return PretenureStrikeBits::decode(pretenure_data());
+}
+
+void AllocationSite::set_pretenure_strike_count(int count) {
+  DCHECK_LE(count, PretenureStrikeBits::kMax);
+  int32_t value = pretenure_data();
+  set_pretenure_data(PretenureStrikeBits::update(value, count));
+}
+
 int AllocationSite::memento_create_count() const {
   return pretenure_create_count();
 }
@@ -18,6 +18,12 @@ class AllocationSite : public Struct, public NeverReadOnlySpaceObject {
   static const uint32_t kMaximumArrayBytesToPretransition = 8 * 1024;
   static const double kPretenureRatio;
   static const int kPretenureMinimumCreated = 100;
+  // Number of consecutive GCs in which the scavenge survival ratio has to
+  // support a tenuring decision different from the current one before that
+  // decision is changed, with --stable-allocation-site-pretenuring. Memento
+  // counts from a single scavenge under-sample high-rate sites, so a single
+  // outlier GC must not flip a decision (and deoptimize dependent code).
+  static const int kPretenureDecisionStrikes = 3;
 
   // Values for pretenure decision field.
   enum PretenureDecision {
@@ -70,7 +76,11 @@ class AllocationSite : public Struct, public NeverReadOnlySpaceObject {
   class MementoFoundCountBits : public BitField<int, 0, 26> {};
   class PretenureDecisionBits : public BitField<PretenureDecision, 26, 3> {};
   class DeoptDependentCodeBit : public BitField<bool, 29, 1> {};
+  // Counts consecutive GCs whose feedback disagreed with the current
+  // tenuring decision, see kPretenureDecisionStrikes.
+  class PretenureStrikeBits : public BitField<int, 30, 2> {};
   STATIC_ASSERT(PretenureDecisionBits::kMax >= kLastPretenureDecisionValue);
+  STATIC_ASSERT(PretenureStrikeBits::kMax >= kPretenureDecisionStrikes - 1);
 
   // Increments the mementos found counter and returns true when the first
   // memento was found for a given allocation site.
@@ -94,6 +104,9 @@ class AllocationSite : public Struct, public NeverReadOnlySpaceObject {
   inline int memento_create_count() const;
   inline void set_memento_create_count(int count);
 
+  inline int pretenure_strike_count() const;
+  inline void set_pretenure_strike_count(int count);
+
   // The pretenuring decision is made during gc, and the zombie state allows
   // us to recognize when an allocation site is just being kept alive because
   // a later traversal of new space may discover AllocationMementos that point
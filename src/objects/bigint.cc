@@ -19,6 +19,8 @@
 
 #include "src/objects/bigint.h"
 
+#include <memory>
+
 #include "src/double.h"
 #include "src/objects-inl.h"
 #include "src/objects/smi.h"
@@ -120,6 +122,20 @@ class MutableBigInt : public FreshlyAllocatedBigInt,
                                   MutableBigInt* result);
   void InplaceMultiplyAdd(uintptr_t factor, uintptr_t summand);
 
+  // Karatsuba multiplication. These helpers operate on raw digit arrays;
+  // they never allocate, so callers may hand them pointers into the heap
+  // under a DisallowHeapAllocation scope.
+  static const int kKaratsubaThreshold = 34;
+  static void MultiplyKaratsuba(digit_t* result, const digit_t* x,
+                                int x_length, const digit_t* y, int y_length,
+                                digit_t* scratch);
+  static void MultiplySchoolbook(digit_t* result, const digit_t* x,
+                                 int x_length, const digit_t* y, int y_length);
+  static digit_t AddDigits(digit_t* dest, int dest_length, const digit_t* src,
+                           int src_length);
+  static digit_t SubDigits(digit_t* dest, int dest_length, const digit_t* src,
+                           int src_length);
+
   // Specialized helpers for Divide/Remainder.
   static void AbsoluteDivSmall(Isolate* isolate, Handle<BigIntBase> x,
                                digit_t divisor, Handle<MutableBigInt>* quotient,
@@ -469,8 +485,28 @@ MaybeHandle<BigInt> BigInt::Multiply(Isolate* isolate, Handle<BigInt> x,
     return MaybeHandle<BigInt>();
   }
   result->InitializeDigits(result_length);
-  for (int i = 0; i < x->length(); i++) {
-    MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+  if (Min(x->length(), y->length()) < MutableBigInt::kKaratsubaThreshold) {
+    for (int i = 0; i < x->length(); i++) {
+      MutableBigInt::MultiplyAccumulate(y, x->digit(i), result, i);
+    }
+  } else {
+    // Karatsuba pays for itself well below crypto-sized operands. Scratch
+    // space lives off-heap so that the recursion can work on raw digit
+    // pointers while the heap is paused.
+    Handle<BigIntBase> big = x;
+    Handle<BigIntBase> small = y;
+    if (big->length() < small->length()) std::swap(big, small);
+    std::unique_ptr<digit_t[]> scratch(new digit_t[4 * result_length + 512]);
+    DisallowHeapAllocation no_gc;
+    MutableBigInt::MultiplyKaratsuba(
+        reinterpret_cast<digit_t*>(result->address() +
+                                   BigIntBase::kHeaderSize),
+        reinterpret_cast<const digit_t*>(big->address() +
+                                         BigIntBase::kHeaderSize),
+        big->length(),
+        reinterpret_cast<const digit_t*>(small->address() +
+                                         BigIntBase::kHeaderSize),
+        small->length(), scratch.get());
   }
   result->set_sign(x->sign() != y->sign());
   return MutableBigInt::MakeImmutable(result);
@@ -1433,6 +1469,163 @@ void BigInt::InplaceMultiplyAdd(Handle<FreshlyAllocatedBigInt> x,
                                      *bigint);
 }
 
+// Adds the {src_length} digits of {src} into {dest}, which has
+// {dest_length} >= {src_length} digits, and propagates the carry.
+// Returns the carry out of {dest}'s most significant digit.
+BigInt::digit_t MutableBigInt::AddDigits(digit_t* dest, int dest_length,
+                                         const digit_t* src, int src_length) {
+  DCHECK(dest_length >= src_length);
+  digit_t carry = 0;
+  int i = 0;
+  for (; i < src_length; i++) {
+    digit_t new_carry = 0;
+    digit_t sum = digit_add(dest[i], src[i], &new_carry);
+    sum = digit_add(sum, carry, &new_carry);
+    dest[i] = sum;
+    carry = new_carry;
+  }
+  for (; carry != 0 && i < dest_length; i++) {
+    digit_t new_carry = 0;
+    dest[i] = digit_add(dest[i], carry, &new_carry);
+    carry = new_carry;
+  }
+  return carry;
+}
+
+// Subtracts the {src_length} digits of {src} from {dest}, which has
+// {dest_length} >= {src_length} digits, and propagates the borrow.
+// Returns the borrow out of {dest}'s most significant digit.
+BigInt::digit_t MutableBigInt::SubDigits(digit_t* dest, int dest_length,
+                                         const digit_t* src, int src_length) {
+  DCHECK(dest_length >= src_length);
+  digit_t borrow = 0;
+  int i = 0;
+  for (; i < src_length; i++) {
+    digit_t new_borrow = 0;
+    digit_t difference = digit_sub(dest[i], src[i], &new_borrow);
+    difference = digit_sub(difference, borrow, &new_borrow);
+    dest[i] = difference;
+    borrow = new_borrow;
+  }
+  for (; borrow != 0 && i < dest_length; i++) {
+    digit_t new_borrow = 0;
+    dest[i] = digit_sub(dest[i], borrow, &new_borrow);
+    borrow = new_borrow;
+  }
+  return borrow;
+}
+
+// Schoolbook multiplication on raw digit arrays. {result} must have room
+// for {x_length} + {y_length} digits and is fully overwritten.
+void MutableBigInt::MultiplySchoolbook(digit_t* result, const digit_t* x,
+                                       int x_length, const digit_t* y,
+                                       int y_length) {
+  memset(result, 0, (x_length + y_length) * kDigitSize);
+  for (int i = 0; i < x_length; i++) {
+    digit_t carry = 0;
+    digit_t high = 0;
+    int k = i;
+    for (int j = 0; j < y_length; j++, k++) {
+      digit_t acc = result[k];
+      digit_t new_carry = 0;
+      acc = digit_add(acc, high, &new_carry);
+      acc = digit_add(acc, carry, &new_carry);
+      digit_t low = digit_mul(x[i], y[j], &high);
+      acc = digit_add(acc, low, &new_carry);
+      result[k] = acc;
+      carry = new_carry;
+    }
+    for (; carry != 0 || high != 0; k++) {
+      DCHECK(k < x_length + y_length);
+      digit_t acc = result[k];
+      digit_t new_carry = 0;
+      acc = digit_add(acc, high, &new_carry);
+      high = 0;
+      acc = digit_add(acc, carry, &new_carry);
+      result[k] = acc;
+      carry = new_carry;
+    }
+  }
+}
+
+// Karatsuba multiplication on raw digit arrays. {result} must have room for
+// {x_length} + {y_length} digits and is fully overwritten. Requires
+// {x_length} >= {y_length} > 0. {scratch} must provide space for at least
+// 4 * ({x_length} + {y_length}) + 64 digits; recursive calls carve their
+// share off its tail.
+void MutableBigInt::MultiplyKaratsuba(digit_t* result, const digit_t* x,
+                                      int x_length, const digit_t* y,
+                                      int y_length, digit_t* scratch) {
+  DCHECK(x_length >= y_length);
+  DCHECK(y_length > 0);
+  if (y_length < kKaratsubaThreshold) {
+    MultiplySchoolbook(result, x, x_length, y, y_length);
+    return;
+  }
+  int total_length = x_length + y_length;
+  int m = x_length >> 1;
+  if (y_length <= m) {
+    // {y} only overlaps the low half of {x}: compute the two halves
+    // separately and recombine:  x*y == x0*y + (x1*y << m digits).
+    MultiplyKaratsuba(result, x, m, y, y_length, scratch);
+    digit_t* high_product = scratch;
+    int high_product_length = x_length - m + y_length;
+    MultiplyKaratsuba(high_product, x + m, x_length - m, y, y_length,
+                      scratch + high_product_length);
+    memset(result + m + y_length, 0,
+           (total_length - m - y_length) * kDigitSize);
+    digit_t carry = AddDigits(result + m, total_length - m, high_product,
+                              high_product_length);
+    DCHECK_EQ(0, carry);
+    USE(carry);
+    return;
+  }
+  // Standard three-product split at {m} digits:
+  //   x == x1 << m | x0,  y == y1 << m | y0
+  //   x*y == x1*y1 << 2m | ((x0+x1)*(y0+y1) - x0*y0 - x1*y1) << m | x0*y0
+  int x1_length = x_length - m;  // >= m
+  int y1_length = y_length - m;  // >= 1
+  // The low and high products land in disjoint parts of {result}.
+  MultiplyKaratsuba(result, x, m, y, m, scratch);
+  MultiplyKaratsuba(result + 2 * m, x + m, x1_length, y + m, y1_length,
+                    scratch);
+  // The middle product goes into scratch space. The digit sums get one
+  // extra digit each so their carries need no separate tracking. {y1} may
+  // have fewer digits than {y0} (which has {m}), so {t2} must be sized for
+  // the longer summand.
+  int t1_length = x1_length + 1;
+  int t2_length = Max(m, y1_length) + 1;
+  digit_t* t1 = scratch;
+  digit_t* t2 = t1 + t1_length;
+  digit_t* middle = t2 + t2_length;
+  int middle_length = t1_length + t2_length;
+  memcpy(t1, x + m, x1_length * kDigitSize);
+  t1[x1_length] = 0;
+  AddDigits(t1, t1_length, x, m);
+  memcpy(t2, y + m, y1_length * kDigitSize);
+  memset(t2 + y1_length, 0, (t2_length - y1_length) * kDigitSize);
+  AddDigits(t2, t2_length, y, m);
+  MultiplyKaratsuba(middle, t1, t1_length, t2, t2_length,
+                    middle + middle_length);
+  digit_t borrow = SubDigits(middle, middle_length, result, 2 * m);
+  borrow += SubDigits(middle, middle_length, result + 2 * m,
+                      total_length - 2 * m);
+  DCHECK_EQ(0, borrow);
+  USE(borrow);
+  // {middle} now holds x0*y1 + x1*y0, which fits in the {total_length - m}
+  // digits left in {result}; any scratch digits beyond that are zero.
+  int middle_result_length = Min(middle_length, total_length - m);
+#ifdef DEBUG
+  for (int i = middle_result_length; i < middle_length; i++) {
+    DCHECK_EQ(0, middle[i]);
+  }
+#endif
+  digit_t carry =
+      AddDigits(result + m, total_length - m, middle, middle_result_length);
+  DCHECK_EQ(0, carry);
+  USE(carry);
+}
+
 // Divides {x} by {divisor}, returning the result in {quotient} and {remainder}.
 // Mathematically, the contract is:
 // quotient = (x - remainder) / divisor, with 0 <= remainder < divisor.
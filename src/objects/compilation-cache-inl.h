@@ -45,12 +45,28 @@ uint32_t CompilationCacheShape::StringSharedHash(String* source,
   return hash;
 }
 
+uint32_t CompilationCacheShape::ScriptHash(String* source,
+                                           LanguageMode language_mode) {
+  uint32_t hash = source->Hash();
+  STATIC_ASSERT(LanguageModeSize == 2);
+  if (is_strict(language_mode)) hash ^= 0x8000;
+  return hash;
+}
+
 uint32_t CompilationCacheShape::HashForObject(Isolate* isolate,
                                               Object* object) {
   if (object->IsNumber()) return static_cast<uint32_t>(object->Number());
 
   FixedArray* val = FixedArray::cast(object);
   if (val->map() == val->GetReadOnlyRoots().fixed_cow_array_map()) {
+    if (val->length() == 2) {
+      // Script keys contain no context-dependent information.
+      String* source = String::cast(val->get(0));
+      int language_unchecked = Smi::ToInt(val->get(1));
+      DCHECK(is_valid_language_mode(language_unchecked));
+      return ScriptHash(source,
+                        static_cast<LanguageMode>(language_unchecked));
+    }
     DCHECK_EQ(4, val->length());
     SharedFunctionInfo* shared = SharedFunctionInfo::cast(val->get(0));
     String* source = String::cast(val->get(1));
@@ -31,6 +31,9 @@ class CompilationCacheShape : public BaseShape<HashTableKey*> {
                                           LanguageMode language_mode,
                                           int position);
 
+  static inline uint32_t ScriptHash(String* source,
+                                    LanguageMode language_mode);
+
   static inline uint32_t HashForObject(Isolate* isolate, Object* object);
 
   static const int kPrefixSize = 0;
@@ -70,8 +73,8 @@ class CompilationCacheTable
       public NeverReadOnlySpaceObject {
  public:
   static MaybeHandle<SharedFunctionInfo> LookupScript(
-      Handle<CompilationCacheTable> table, Handle<String> src,
-      Handle<Context> native_context, LanguageMode language_mode);
+      Isolate* isolate, Handle<CompilationCacheTable> table, Handle<String> src,
+      LanguageMode language_mode);
   static InfoCellPair LookupEval(Handle<CompilationCacheTable> table,
                                  Handle<String> src,
                                  Handle<SharedFunctionInfo> shared,
@@ -79,9 +82,8 @@ class CompilationCacheTable
                                  LanguageMode language_mode, int position);
   Handle<Object> LookupRegExp(Handle<String> source, JSRegExp::Flags flags);
   static Handle<CompilationCacheTable> PutScript(
-      Handle<CompilationCacheTable> cache, Handle<String> src,
-      Handle<Context> native_context, LanguageMode language_mode,
-      Handle<SharedFunctionInfo> value);
+      Isolate* isolate, Handle<CompilationCacheTable> cache, Handle<String> src,
+      LanguageMode language_mode, Handle<SharedFunctionInfo> value);
   static Handle<CompilationCacheTable> PutEval(
       Handle<CompilationCacheTable> cache, Handle<String> src,
       Handle<SharedFunctionInfo> outer_info, Handle<SharedFunctionInfo> value,
@@ -115,10 +115,15 @@ class NameDictionaryShape : public BaseDictionaryShape<Handle<Name>> {
   static inline uint32_t HashForObject(Isolate* isolate, Object* object);
   static inline Handle<Object> AsHandle(Isolate* isolate, Handle<Name> key);
   static inline RootIndex GetMapRootIndex();
-  static const int kPrefixSize = 2;
+  static const int kPrefixSize = 3;
   static const int kEntrySize = 3;
   static const int kEntryValueIndex = 1;
   static const bool kNeedsHoleCheck = false;
+  // Iteration index caching is only sound for dictionaries whose set of live
+  // entries can change solely through Add and DeleteEntry; GlobalDictionary
+  // entries die when their property cell is invalidated, without the table
+  // being touched, and thus must opt out.
+  static const bool kCacheIterationIndices = true;
 };
 
 template <typename Derived, typename Shape>
@@ -129,6 +134,7 @@ class BaseNameDictionary : public Dictionary<Derived, Shape> {
   static const int kNextEnumerationIndexIndex =
       HashTableBase::kPrefixStartIndex;
   static const int kObjectHashIndex = kNextEnumerationIndexIndex + 1;
+  static const int kCachedIterationIndicesIndex = kObjectHashIndex + 1;
   static const int kEntryValueIndex = 1;
 
   // Accessors for next enumeration index.
@@ -153,6 +159,25 @@ class BaseNameDictionary : public Dictionary<Derived, Shape> {
     return hash;
   }
 
+  // Accessors for the lazily computed cache of live entry indices, sorted by
+  // enumeration index. The cache holds either a FixedArray of Smi entry
+  // indices or the zero Smi when it has to be recomputed. Every operation
+  // that adds or removes an entry or moves entries around (rehashing) must
+  // invalidate it; see also CodeStubAssembler::Add and the DeleteProperty
+  // builtin for the CSA side.
+  void SetCachedIterationIndices(FixedArray* indices) {
+    DCHECK(Shape::kCacheIterationIndices);
+    this->set(kCachedIterationIndicesIndex, indices);
+  }
+
+  void InvalidateCachedIterationIndices() {
+    this->set(kCachedIterationIndicesIndex, Smi::kZero);
+  }
+
+  Object* cached_iteration_indices() {
+    return this->get(kCachedIterationIndicesIndex);
+  }
+
   // Creates a new dictionary.
   V8_WARN_UNUSED_RESULT static Handle<Derived> New(
       Isolate* isolate, int at_least_space_for,
@@ -206,6 +231,9 @@ class GlobalDictionaryShape : public NameDictionaryShape {
   static inline uint32_t HashForObject(Isolate* isolate, Object* object);
 
   static const int kEntrySize = 1;  // Overrides NameDictionaryShape::kEntrySize
+  // Entries become dead when their cell is invalidated, which does not go
+  // through the dictionary; see NameDictionaryShape::kCacheIterationIndices.
+  static const bool kCacheIterationIndices = false;
 
   template <typename Dictionary>
   static inline PropertyDetails DetailsAt(Dictionary* dict, int entry);
@@ -111,6 +111,13 @@ class V8_EXPORT_PRIVATE HashTableBase : public NON_EXPORTED_BASE(FixedArray) {
   inline void SetNumberOfDeletedElements(int nod);
 
   // Returns probe entry.
+  // Note: the probe sequence and the entry layout below are duplicated by
+  // hand-written code in CodeStubAssembler::NameDictionaryLookup and
+  // CodeStubAssembler::NumberDictionaryLookup, and tables are embedded in
+  // snapshots. Any change to the probing scheme (e.g. a flat-metadata
+  // SwissTable layout probing a group of slots at a time) has to update the
+  // assembler copies, the heap verifier and the serializer in lockstep;
+  // changing only this copy silently corrupts tables that builtins mutate.
   static uint32_t GetProbe(uint32_t hash, uint32_t number, uint32_t size) {
     DCHECK(base::bits::IsPowerOfTwo(size));
     return (hash + GetProbeOffset(number)) & (size - 1);
@@ -6,6 +6,7 @@
 #include "src/objects/js-array-buffer-inl.h"
 
 #include "src/counters.h"
+#include "src/heap/array-buffer-collector.h"
 #include "src/property-descriptor.h"
 
 namespace v8 {
@@ -120,11 +121,21 @@ bool JSArrayBuffer::SetupAllocatingData(Handle<JSArrayBuffer> array_buffer,
     if (shared_flag == SharedFlag::kShared)
       isolate->counters()->shared_array_allocations()->AddSample(
           ConvertToMb(allocated_length));
-    if (initialize) {
-      data = isolate->array_buffer_allocator()->Allocate(allocated_length);
-    } else {
-      data = isolate->array_buffer_allocator()->AllocateUninitialized(
+    data = nullptr;
+    if (FLAG_array_buffer_pooling) {
+      data = isolate->heap()->array_buffer_collector()->TryRemoveFromPool(
           allocated_length);
+      // Pooled memory has unspecified contents, unlike Allocate() which
+      // guarantees zero-initialized memory.
+      if (data != nullptr && initialize) memset(data, 0, allocated_length);
+    }
+    if (data == nullptr) {
+      if (initialize) {
+        data = isolate->array_buffer_allocator()->Allocate(allocated_length);
+      } else {
+        data = isolate->array_buffer_allocator()->AllocateUninitialized(
+            allocated_length);
+      }
     }
     if (data == nullptr) {
       isolate->counters()->array_buffer_new_size_failures()->AddSample(
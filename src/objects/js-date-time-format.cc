@@ -751,6 +751,20 @@ std::unique_ptr<icu::Calendar> CreateCalendar(Isolate* isolate,
 std::unique_ptr<icu::SimpleDateFormat> CreateICUDateFormat(
     Isolate* isolate, const icu::Locale& icu_locale,
     const std::string& skeleton) {
+  // Pattern generation and formatter construction both read ICU locale
+  // data, so clone a cached formatter when the same (locale, skeleton)
+  // pair was seen before.
+  std::string cache_key(icu_locale.getName());
+  cache_key.push_back('\1');
+  cache_key.append(skeleton);
+  icu::SimpleDateFormat* cached_date_format =
+      static_cast<icu::SimpleDateFormat*>(
+          isolate->get_cached_icu_formatter(cache_key));
+  if (cached_date_format != nullptr) {
+    return std::unique_ptr<icu::SimpleDateFormat>(
+        static_cast<icu::SimpleDateFormat*>(cached_date_format->clone()));
+  }
+
   // See https://github.com/tc39/ecma402/issues/225 . The best pattern
   // generation needs to be done in the base locale according to the
   // current spec however odd it may be. See also crbug.com/826549 .
@@ -780,6 +794,8 @@ std::unique_ptr<icu::SimpleDateFormat> CreateICUDateFormat(
   if (U_FAILURE(status)) return std::unique_ptr<icu::SimpleDateFormat>();
 
   CHECK_NOT_NULL(date_format.get());
+  isolate->set_icu_formatter_in_cache(
+      cache_key, std::shared_ptr<icu::UObject>(date_format->clone()));
   return date_format;
 }
 
@@ -353,32 +353,56 @@ MaybeHandle<JSNumberFormat> JSNumberFormat::Initialize(
   CurrencyDisplay currency_display = maybe_currencyDisplay.FromJust();
   UNumberFormatStyle format_style = ToNumberFormatStyle(currency_display);
 
+  // Creating an icu::NumberFormat loads locale data and parses patterns,
+  // which dominates construction time. Identical (locale, style) requests
+  // are common, so clone a cached base instance when possible; the
+  // per-object option setters below are applied to the clone.
+  std::string cache_key(icu_locale.getName());
+  cache_key.push_back('\1');
+  cache_key.append(std::to_string(static_cast<int>(style)));
+  if (style == Style::CURRENCY) {
+    // The currency display is baked into the base instance.
+    cache_key.push_back('\1');
+    cache_key.append(std::to_string(static_cast<int>(format_style)));
+  }
+
   UErrorCode status = U_ZERO_ERROR;
   std::unique_ptr<icu::NumberFormat> icu_number_format;
-  if (style == Style::DECIMAL) {
-    icu_number_format.reset(
-        icu::NumberFormat::createInstance(icu_locale, status));
-  } else if (style == Style::PERCENT) {
-    icu_number_format.reset(
-        icu::NumberFormat::createPercentInstance(icu_locale, status));
-  } else {
-    DCHECK_EQ(style, Style::CURRENCY);
+  icu::NumberFormat* cached_number_format = static_cast<icu::NumberFormat*>(
+      isolate->get_cached_icu_formatter(cache_key));
+  if (cached_number_format != nullptr) {
     icu_number_format.reset(
-        icu::NumberFormat::createInstance(icu_locale, format_style, status));
+        static_cast<icu::NumberFormat*>(cached_number_format->clone()));
   }
-
-  if (U_FAILURE(status) || icu_number_format.get() == nullptr) {
-    status = U_ZERO_ERROR;
-    // Remove extensions and try again.
-    icu::Locale no_extension_locale(icu_locale.getBaseName());
-    icu_number_format.reset(
-        icu::NumberFormat::createInstance(no_extension_locale, status));
+  if (icu_number_format.get() == nullptr) {
+    if (style == Style::DECIMAL) {
+      icu_number_format.reset(
+          icu::NumberFormat::createInstance(icu_locale, status));
+    } else if (style == Style::PERCENT) {
+      icu_number_format.reset(
+          icu::NumberFormat::createPercentInstance(icu_locale, status));
+    } else {
+      DCHECK_EQ(style, Style::CURRENCY);
+      icu_number_format.reset(
+          icu::NumberFormat::createInstance(icu_locale, format_style, status));
+    }
 
     if (U_FAILURE(status) || icu_number_format.get() == nullptr) {
-      FATAL("Failed to create ICU number_format, are ICU data files missing?");
+      status = U_ZERO_ERROR;
+      // Remove extensions and try again.
+      icu::Locale no_extension_locale(icu_locale.getBaseName());
+      icu_number_format.reset(
+          icu::NumberFormat::createInstance(no_extension_locale, status));
+
+      if (U_FAILURE(status) || icu_number_format.get() == nullptr) {
+        FATAL(
+            "Failed to create ICU number_format, are ICU data files missing?");
+      }
     }
+    DCHECK(U_SUCCESS(status));
+    isolate->set_icu_formatter_in_cache(
+        cache_key, std::shared_ptr<icu::UObject>(icu_number_format->clone()));
   }
-  DCHECK(U_SUCCESS(status));
   CHECK_NOT_NULL(icu_number_format.get());
   if (style == Style::CURRENCY) {
     // 19. If style is "currency", set  numberFormat.[[CurrencyDisplay]] to
@@ -150,8 +150,15 @@ class JSRegExp : public JSObject {
   // Maps names of named capture groups (at indices 2i) to their corresponding
   // (1-based) capture group indices (at indices 2i + 1).
   static const int kIrregexpCaptureNameMapIndex = kDataIndex + 4;
-
-  static const int kIrregexpDataSize = kIrregexpCaptureNameMapIndex + 1;
+  // With --regexp-tier-up, counts executions of the bytecode tier; native
+  // compilation happens once this passes --regexp-tier-up-ticks.
+  static const int kIrregexpTierUpTicksIndex = kDataIndex + 5;
+  // A literal string every match must start with, used to prefilter
+  // candidate match positions with a fast string search before entering
+  // the match engine. Smi zero if no such literal could be extracted.
+  static const int kIrregexpRequiredPrefixIndex = kDataIndex + 6;
+
+  static const int kIrregexpDataSize = kIrregexpRequiredPrefixIndex + 1;
 
   // In-object fields.
   static const int kLastIndexFieldIndex = 0;
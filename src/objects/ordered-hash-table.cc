@@ -29,9 +29,8 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Allocate(
       Derived::GetMapRootIndex(),
       kHashTableStartIndex + num_buckets + (capacity * kEntrySize), pretenure);
   Handle<Derived> table = Handle<Derived>::cast(backing_store);
-  for (int i = 0; i < num_buckets; ++i) {
-    table->set(kHashTableStartIndex + i, Smi::FromInt(kNotFound));
-  }
+  MemsetPointer(table->RawFieldOfElementAt(kHashTableStartIndex).location(),
+                Smi::FromInt(kNotFound).ptr(), num_buckets);
   table->SetNumberOfBuckets(num_buckets);
   table->SetNumberOfElements(0);
   table->SetNumberOfDeletedElements(0);
@@ -196,6 +195,7 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
   int removed_holes_index = 0;
 
   DisallowHeapAllocation no_gc;
+  WriteBarrierMode mode = new_table->GetWriteBarrierMode(no_gc);
   for (int old_entry = 0; old_entry < (nof + nod); ++old_entry) {
     Object* key = table->KeyAt(old_entry);
     if (key->IsTheHole(isolate)) {
@@ -211,9 +211,10 @@ Handle<Derived> OrderedHashTable<Derived, entrysize>::Rehash(
     int old_index = table->EntryToIndex(old_entry);
     for (int i = 0; i < entrysize; ++i) {
       Object* value = table->get(old_index + i);
-      new_table->set(new_index + i, value);
+      new_table->set(new_index + i, value, mode);
     }
-    new_table->set(new_index + kChainOffset, chain_entry);
+    // Chain links are always Smis, so this store never needs a barrier.
+    new_table->set(new_index + kChainOffset, chain_entry, SKIP_WRITE_BARRIER);
     ++new_entry;
   }
 
@@ -624,6 +624,27 @@ String* SharedFunctionInfo::inferred_name() {
   return GetReadOnlyRoots().empty_string();
 }
 
+bool SharedFunctionInfo::ShouldFlushBytecode() {
+  if (!FLAG_flush_bytecode) return false;
+
+  // TODO(rmcilroy): Enable bytecode flushing for resumable functions.
+  if (IsResumableFunction(kind()) || !allows_lazy_compilation()) {
+    return false;
+  }
+
+  // The debugger keeps breakpoint information in the debug info; don't flush
+  // functions it is tracking.
+  if (HasDebugInfo()) return false;
+
+  // Get a snapshot of the function data field, and if it is a bytecode array,
+  // check if it is old. Note, this is done this way since this function can be
+  // called by the concurrent marker.
+  Object* data = function_data();
+  if (!data->IsBytecodeArray()) return false;
+
+  return BytecodeArray::cast(data)->IsOld();
+}
+
 bool SharedFunctionInfo::IsUserJavaScript() {
   Object* script_obj = script();
   if (script_obj->IsUndefined()) return false;
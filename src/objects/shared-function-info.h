@@ -501,6 +501,12 @@ class SharedFunctionInfo : public HeapObject, public NeverReadOnlySpaceObject {
   static inline void DiscardCompiled(Isolate* isolate,
                                      Handle<SharedFunctionInfo> shared_info);
 
+  // Returns true if the function holds bytecode that has not been executed
+  // for several garbage collection cycles and may be flushed by the garbage
+  // collector. May be called from the concurrent marker, so only takes a
+  // snapshot of the function data field.
+  inline bool ShouldFlushBytecode();
+
   // Check whether or not this function is inlineable.
   bool IsInlineable();
 
@@ -615,9 +621,10 @@ class SharedFunctionInfo : public HeapObject, public NeverReadOnlySpaceObject {
 
   static const int kAlignedSize = POINTER_SIZE_ALIGN(kSize);
 
-  typedef FixedBodyDescriptor<kStartOfPointerFieldsOffset,
-                              kEndOfPointerFieldsOffset, kAlignedSize>
-      BodyDescriptor;
+  // The function data field is visited as a custom weak pointer so that the
+  // garbage collector can drop old bytecode (see ShouldFlushBytecode); all
+  // other pointer fields are visited strongly.
+  class BodyDescriptor;
 
 // Bit positions in |flags|.
 #define FLAGS_BIT_FIELDS(V, _)                           \
@@ -77,6 +77,19 @@ class StringTable : public HashTable<StringTable, StringTableShape> {
   static Object* LookupStringIfExists_NoAllocate(Isolate* isolate,
                                                  String* string);
 
+  // Looks up a string matching the given key without allocating and without
+  // assuming exclusive access to the table. Safe to call from background
+  // threads concurrently with main-thread insertions: entries are published
+  // with release stores (see AddKeyNoResize) and read here with acquire
+  // loads, and grown copies of the table are published the same way, so a
+  // reader either observes a fully initialized string or misses the entry.
+  // A miss is not authoritative; callers must fall back to LookupKey on the
+  // main thread. The caller is responsible for ensuring that the GC does not
+  // move objects while the lookup runs and while the result is in use.
+  // Returns the internalized string on a hit, or
+  // Smi::FromInt(ResultSentinel::kNotFound).
+  static Object* TryLookupConcurrent(Isolate* isolate, StringTableKey* key);
+
   static void EnsureCapacityForDeserialization(Isolate* isolate, int expected);
 
   DECL_CAST(StringTable)
@@ -687,6 +687,15 @@ class SlicedString : public String {
   // Minimum length for a sliced string.
   static const int kMinLength = 13;
 
+  // A slice pins its whole parent alive, so short tokens cut out of large
+  // buffers can retain arbitrarily many bytes per live character. Slices
+  // no longer than kMaxTrimmedLength whose parent is at least
+  // kTrimRatio times longer are therefore created as sequential copies
+  // instead (see Factory::NewProperSubString); the copy is cheap at these
+  // lengths and bounds the retained-to-live amplification.
+  static const int kMaxTrimmedLength = 256;
+  static const int kTrimRatio = 16;
+
   typedef FixedBodyDescriptor<kParentOffset, kOffsetOffset + kPointerSize,
                               kSize>
       BodyDescriptor;
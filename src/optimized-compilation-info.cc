@@ -62,6 +62,9 @@ void OptimizedCompilationInfo::ConfigureFlags() {
       if (FLAG_turbo_splitting) {
         MarkAsSplittingEnabled();
       }
+      if (FLAG_turbo_fast_regalloc) {
+        MarkAsFastRegisterAllocationEnabled();
+      }
       if (FLAG_untrusted_code_mitigations) {
         MarkAsPoisoningRegisterArguments();
       }
@@ -51,7 +51,8 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
     kTraceTurboJson = 1 << 14,
     kTraceTurboGraph = 1 << 15,
     kTraceTurboScheduled = 1 << 16,
-    kWasmRuntimeExceptionSupport = 1 << 17
+    kWasmRuntimeExceptionSupport = 1 << 17,
+    kFastRegisterAllocation = 1 << 18
   };
 
   // Construct a compilation info for optimized compilation.
@@ -112,6 +113,13 @@ class V8_EXPORT_PRIVATE OptimizedCompilationInfo final {
   void MarkAsSplittingEnabled() { SetFlag(kSplittingEnabled); }
   bool is_splitting_enabled() const { return GetFlag(kSplittingEnabled); }
 
+  void MarkAsFastRegisterAllocationEnabled() {
+    SetFlag(kFastRegisterAllocation);
+  }
+  bool is_fast_register_allocation_enabled() const {
+    return GetFlag(kFastRegisterAllocation);
+  }
+
   void MarkAsBailoutOnUninitialized() { SetFlag(kBailoutOnUninitialized); }
   bool is_bailout_on_uninitialized() const {
     return GetFlag(kBailoutOnUninitialized);
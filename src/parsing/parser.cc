@@ -6,11 +6,13 @@
 
 #include <algorithm>
 #include <memory>
+#include <unordered_set>
 
 #include "src/ast/ast-function-literal-id-reindexer.h"
 #include "src/ast/ast-traversal-visitor.h"
 #include "src/ast/ast.h"
 #include "src/bailout-reason.h"
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/platform.h"
 #include "src/char-predicates-inl.h"
 #include "src/compiler-dispatcher/compiler-dispatcher.h"
@@ -2426,6 +2428,31 @@ void Parser::PrepareGeneratorVariables() {
       ast_value_factory()->dot_generator_object_string());
 }
 
+namespace {
+
+// Script offsets of functions that were compiled lazily in a profiled run,
+// read from the file given by --compile-hints. Loaded once per process;
+// parsing also happens on background threads, so initialization relies on
+// LazyInstance being thread-safe.
+struct CompileHints {
+  CompileHints() {
+    if (FLAG_compile_hints == nullptr) return;
+    FILE* file = base::OS::FOpen(FLAG_compile_hints, "r");
+    if (file == nullptr) return;
+    int offset;
+    while (fscanf(file, "%d", &offset) == 1) offsets.insert(offset);
+    fclose(file);
+  }
+
+  bool Contains(int offset) const { return offsets.count(offset) > 0; }
+
+  std::unordered_set<int> offsets;
+};
+
+base::LazyInstance<CompileHints>::type compile_hints = LAZY_INSTANCE_INITIALIZER;
+
+}  // namespace
+
 FunctionLiteral* Parser::ParseFunctionLiteral(
     const AstRawString* function_name, Scanner::Location function_name_location,
     FunctionNameValidity function_name_validity, FunctionKind kind,
@@ -2542,6 +2569,18 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
       FLAG_parallel_compile_tasks && info()->parallel_tasks() &&
       scanner()->stream()->can_be_cloned_for_parallel_access();
 
+  // With --parallel-parse-tasks, lazy top level functions are also handed to
+  // a worker thread: only the preparser runs on the main thread, while the
+  // full parse and the unoptimized compile happen on the compiler dispatcher,
+  // so that the code is likely ready before the first call. The dispatcher
+  // job parses into its own zone and merges its literals into the main
+  // isolate when it is finalized.
+  if (FLAG_parallel_parse_tasks && parse_lazily() &&
+      is_lazy_top_level_function && info()->parallel_tasks() &&
+      scanner()->stream()->can_be_cloned_for_parallel_access()) {
+    should_post_parallel_task = true;
+  }
+
   // This may be modified later to reflect preparsing decision taken
   bool should_preparse = (parse_lazily() && is_lazy_top_level_function) ||
                          should_preparse_inner || should_post_parallel_task;
@@ -2635,6 +2674,16 @@ FunctionLiteral* Parser::ParseFunctionLiteral(
   if (should_post_parallel_task) {
     // Start a parallel parse / compile task on the compiler dispatcher.
     info()->parallel_tasks()->Enqueue(info(), function_name, function_literal);
+  } else if (V8_UNLIKELY(FLAG_compile_hints != nullptr) && parse_lazily() &&
+             eager_compile_hint == FunctionLiteral::kShouldLazyCompile &&
+             info()->parallel_tasks() &&
+             scanner()->stream()->can_be_cloned_for_parallel_access() &&
+             compile_hints.Get().Contains(function_literal->start_position())) {
+    // The function was compiled lazily in a profiled run (recorded with
+    // --compile-hints-out), so it is likely to be called again. Parse and
+    // compile it on the dispatcher right away, so that the first call finds
+    // finished bytecode instead of paying lazy-compile latency in-line.
+    info()->parallel_tasks()->Enqueue(info(), function_name, function_literal);
   }
 
   if (should_infer_name) {
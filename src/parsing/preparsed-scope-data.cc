@@ -13,6 +13,8 @@
 #include "src/objects/shared-function-info.h"
 #include "src/parsing/preparsed-scope-data-impl.h"
 #include "src/parsing/preparser.h"
+#include "src/snapshot/code-serializer.h"
+#include "src/version.h"
 
 namespace v8 {
 namespace internal {
@@ -715,5 +717,167 @@ std::unique_ptr<ConsumedPreParsedScopeData> ConsumedPreParsedScopeData::For(
   return base::make_unique<ZoneConsumedPreParsedScopeData>(zone, data);
 }
 
+namespace {
+
+void WriteUint32(std::vector<byte>* out, uint32_t value) {
+  const byte* start = reinterpret_cast<const byte*>(&value);
+  out->insert(out->end(), start, start + kUInt32Size);
+}
+
+// Appends one PreParsedScopeData node and, recursively, its children:
+// [scope data length, scope data bytes..., padding to uint32 alignment,
+//  child count, for each child either 0 or 1 followed by the child node].
+void SerializeTree(PreParsedScopeData* data, std::vector<byte>* out) {
+  PodArray<uint8_t>* scope_data = data->scope_data();
+  int scope_data_length = scope_data->length();
+  WriteUint32(out, static_cast<uint32_t>(scope_data_length));
+  const byte* scope_data_start = scope_data->GetDataStartAddress();
+  out->insert(out->end(), scope_data_start,
+              scope_data_start + scope_data_length);
+  while (out->size() % kUInt32Size != 0) out->push_back(0);
+
+  int child_length = data->length();
+  WriteUint32(out, static_cast<uint32_t>(child_length));
+  for (int i = 0; i < child_length; i++) {
+    Object* child = data->child_data(i);
+    if (child->IsNull()) {
+      WriteUint32(out, 0);
+    } else {
+      WriteUint32(out, 1);
+      SerializeTree(PreParsedScopeData::cast(child), out);
+    }
+  }
+}
+
+class ByteReader {
+ public:
+  ByteReader(const byte* data, uint32_t length) : data_(data), length_(length) {}
+
+  bool ReadUint32(uint32_t* result) {
+    if (length_ - position_ < static_cast<uint32_t>(kUInt32Size)) return false;
+    MemCopy(result, data_ + position_, kUInt32Size);
+    position_ += kUInt32Size;
+    return true;
+  }
+
+  bool ReadBytes(byte* to, uint32_t count) {
+    if (length_ - position_ < count) return false;
+    MemCopy(to, data_ + position_, count);
+    position_ += count;
+    return true;
+  }
+
+  void SkipPadding() {
+    while (position_ % kUInt32Size != 0 && position_ < length_) position_++;
+  }
+
+  uint32_t remaining() const { return length_ - position_; }
+  bool empty() const { return position_ == length_; }
+
+ private:
+  const byte* data_;
+  uint32_t length_;
+  uint32_t position_ = 0;
+};
+
+// Scope nesting in data produced by SerializeTree is bounded by the parser's
+// stack checks; any deeper buffer is corrupt or hostile. The cap keeps the
+// recursion below from overflowing the stack and makes such buffers fail
+// deserialization gracefully (the caller falls back to reparsing).
+const uint32_t kMaxDeserializationDepth = 512;
+
+MaybeHandle<PreParsedScopeData> DeserializeTree(Isolate* isolate,
+                                                ByteReader* reader,
+                                                uint32_t depth) {
+  if (depth > kMaxDeserializationDepth) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  uint32_t scope_data_length;
+  // Bounds are checked before allocating, so that a corrupt length cannot
+  // cause a huge allocation.
+  if (!reader->ReadUint32(&scope_data_length) ||
+      scope_data_length > reader->remaining()) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  Handle<PodArray<uint8_t>> scope_data =
+      PodArray<uint8_t>::New(isolate, static_cast<int>(scope_data_length));
+  CHECK(reader->ReadBytes(scope_data->GetDataStartAddress(),
+                          scope_data_length));
+  reader->SkipPadding();
+
+  uint32_t child_length;
+  if (!reader->ReadUint32(&child_length) ||
+      child_length > reader->remaining() / kUInt32Size) {
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  Handle<PreParsedScopeData> result =
+      isolate->factory()->NewPreParsedScopeData(
+          static_cast<int>(child_length));
+  result->set_scope_data(*scope_data);
+  for (uint32_t i = 0; i < child_length; i++) {
+    uint32_t has_child;
+    if (!reader->ReadUint32(&has_child) || has_child > 1) {
+      return MaybeHandle<PreParsedScopeData>();
+    }
+    if (has_child == 0) continue;
+    Handle<PreParsedScopeData> child;
+    if (!DeserializeTree(isolate, reader, depth + 1).ToHandle(&child)) {
+      return MaybeHandle<PreParsedScopeData>();
+    }
+    result->set_child_data(static_cast<int>(i), *child);
+  }
+  return result;
+}
+
+}  // namespace
+
+// static
+ScriptData* PreParseDataSerializer::Serialize(Isolate* isolate,
+                                              Handle<PreParsedScopeData> data,
+                                              Handle<String> source) {
+  // Hash() may allocate, so compute it before handing out raw pointers.
+  uint32_t source_hash = source->Hash();
+  std::vector<byte> buffer;
+  WriteUint32(&buffer, kMagicNumber);
+  WriteUint32(&buffer, Version::Hash());
+  WriteUint32(&buffer, source_hash);
+  WriteUint32(&buffer, static_cast<uint32_t>(source->length()));
+  DCHECK_EQ(kHeaderSize, buffer.size());
+  {
+    DisallowHeapAllocation no_gc;
+    SerializeTree(*data, &buffer);
+  }
+
+  int length = static_cast<int>(buffer.size());
+  byte* copy = NewArray<byte>(length);
+  MemCopy(copy, buffer.data(), length);
+  ScriptData* result = new ScriptData(copy, length);
+  result->AcquireDataOwnership();
+  return result;
+}
+
+// static
+MaybeHandle<PreParsedScopeData> PreParseDataSerializer::Deserialize(
+    Isolate* isolate, ScriptData* data, Handle<String> source) {
+  ByteReader reader(data->data(), static_cast<uint32_t>(data->length()));
+  uint32_t magic_number, version_hash, source_hash, source_length;
+  if (!reader.ReadUint32(&magic_number) || magic_number != kMagicNumber ||
+      !reader.ReadUint32(&version_hash) || version_hash != Version::Hash() ||
+      !reader.ReadUint32(&source_hash) || source_hash != source->Hash() ||
+      !reader.ReadUint32(&source_length) ||
+      source_length != static_cast<uint32_t>(source->length())) {
+    data->Reject();
+    return MaybeHandle<PreParsedScopeData>();
+  }
+
+  Handle<PreParsedScopeData> result;
+  if (!DeserializeTree(isolate, &reader, 0).ToHandle(&result) ||
+      !reader.empty()) {
+    data->Reject();
+    return MaybeHandle<PreParsedScopeData>();
+  }
+  return result;
+}
+
 }  // namespace internal
 }  // namespace v8
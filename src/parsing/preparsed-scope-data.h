@@ -19,6 +19,8 @@ class PodArray;
 
 class PreParser;
 class PreParsedScopeData;
+class ScriptData;
+class String;
 class ZonePreParsedScopeData;
 
 /*
@@ -204,6 +206,38 @@ class ConsumedPreParsedScopeData {
   DISALLOW_COPY_AND_ASSIGN(ConsumedPreParsedScopeData);
 };
 
+// Converts on-heap PreParsedScopeData trees to and from a flat,
+// position-independent byte format, so that the lazy-compilation skeleton of
+// a script can be cached across isolates and processes without caching full
+// bytecode. The buffer is self-validating: it starts with a header holding a
+// magic number, the V8 version hash and the hash and length of the script
+// source it was produced from, and deserialization fails softly if any of
+// them do not match.
+class PreParseDataSerializer : public AllStatic {
+ public:
+  // Serializes |data| for a script with the given source. The returned
+  // ScriptData owns its buffer.
+  static ScriptData* Serialize(Isolate* isolate,
+                               Handle<PreParsedScopeData> data,
+                               Handle<String> source);
+
+  // Deserializes a buffer produced by Serialize. Returns an empty handle if
+  // the buffer is malformed, was produced by a different V8 version or
+  // belongs to a different script source; in that case the buffer is also
+  // marked as rejected.
+  static MaybeHandle<PreParsedScopeData> Deserialize(Isolate* isolate,
+                                                     ScriptData* data,
+                                                     Handle<String> source);
+
+  static const uint32_t kMagicNumber = 0x50726531;  // "Pre1"
+
+  static const uint32_t kMagicNumberOffset = 0;
+  static const uint32_t kVersionHashOffset = kMagicNumberOffset + kUInt32Size;
+  static const uint32_t kSourceHashOffset = kVersionHashOffset + kUInt32Size;
+  static const uint32_t kSourceLengthOffset = kSourceHashOffset + kUInt32Size;
+  static const uint32_t kHeaderSize = kSourceLengthOffset + kUInt32Size;
+};
+
 }  // namespace internal
 }  // namespace v8
 
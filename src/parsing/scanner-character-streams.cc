@@ -7,6 +7,12 @@
 #include <memory>
 #include <vector>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "include/v8.h"
 #include "src/counters.h"
 #include "src/globals.h"
@@ -18,6 +24,165 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Returns a pointer to the first code unit in [cursor, end) that is not
+// ASCII whitespace or a line terminator, i.e. not one of '\t', '\n', '\v',
+// '\f', '\r' or ' '. Sets |*seen_line_terminator| if a skipped code unit was
+// '\n' or '\r'. Classifies 16 bytes of input per step where SIMD is
+// available; the last, partially matching chunk is re-examined by the scalar
+// loop so that line terminators are only recorded for code units that were
+// actually skipped.
+const uint16_t* FindWhiteSpaceRunEnd(const uint16_t* cursor,
+                                     const uint16_t* end,
+                                     bool* seen_line_terminator) {
+#if defined(__SSE2__)
+  const __m128i tab_minus_one = _mm_set1_epi16('\t' - 1);
+  const __m128i cr_plus_one = _mm_set1_epi16('\r' + 1);
+  const __m128i space = _mm_set1_epi16(' ');
+  const __m128i lf = _mm_set1_epi16('\n');
+  const __m128i cr = _mm_set1_epi16('\r');
+  __m128i line_terminators = _mm_setzero_si128();
+  while (end - cursor >= 8) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    // Code units >= 0x8000 are negative in the signed comparisons and thus
+    // correctly classified as non-whitespace.
+    __m128i is_white_space =
+        _mm_or_si128(_mm_cmpeq_epi16(chunk, space),
+                     _mm_and_si128(_mm_cmpgt_epi16(chunk, tab_minus_one),
+                                   _mm_cmplt_epi16(chunk, cr_plus_one)));
+    if (_mm_movemask_epi8(is_white_space) != 0xFFFF) break;
+    line_terminators = _mm_or_si128(
+        line_terminators, _mm_or_si128(_mm_cmpeq_epi16(chunk, lf),
+                                       _mm_cmpeq_epi16(chunk, cr)));
+    cursor += 8;
+  }
+  if (_mm_movemask_epi8(line_terminators) != 0) *seen_line_terminator = true;
+#elif defined(__aarch64__)
+  uint16x8_t line_terminators = vdupq_n_u16(0);
+  while (end - cursor >= 8) {
+    uint16x8_t chunk = vld1q_u16(cursor);
+    uint16x8_t is_white_space =
+        vorrq_u16(vceqq_u16(chunk, vdupq_n_u16(' ')),
+                  vandq_u16(vcgeq_u16(chunk, vdupq_n_u16('\t')),
+                            vcleq_u16(chunk, vdupq_n_u16('\r'))));
+    if (vminvq_u16(is_white_space) == 0) break;
+    line_terminators =
+        vorrq_u16(line_terminators,
+                  vorrq_u16(vceqq_u16(chunk, vdupq_n_u16('\n')),
+                            vceqq_u16(chunk, vdupq_n_u16('\r'))));
+    cursor += 8;
+  }
+  if (vmaxvq_u16(line_terminators) != 0) *seen_line_terminator = true;
+#endif
+  while (cursor != end) {
+    uint16_t c = *cursor;
+    if (c == '\n' || c == '\r') {
+      *seen_line_terminator = true;
+    } else if (c != ' ' && (c < '\t' || c > '\r')) {
+      break;
+    }
+    cursor++;
+  }
+  return cursor;
+}
+
+// Returns a pointer to the first code unit in [cursor, end) that is not an
+// ASCII identifier-part character ('0'-'9', 'A'-'Z', 'a'-'z', '_' or '$').
+// Clears |*can_be_keyword| if a skipped code unit cannot occur in a keyword,
+// i.e. is not a lowercase letter.
+const uint16_t* FindAsciiIdentifierRunEnd(const uint16_t* cursor,
+                                          const uint16_t* end,
+                                          bool* can_be_keyword) {
+#if defined(__SSE2__)
+  const __m128i lower_a_minus_one = _mm_set1_epi16('a' - 1);
+  const __m128i lower_z_plus_one = _mm_set1_epi16('z' + 1);
+  const __m128i upper_a_minus_one = _mm_set1_epi16('A' - 1);
+  const __m128i upper_z_plus_one = _mm_set1_epi16('Z' + 1);
+  const __m128i zero_minus_one = _mm_set1_epi16('0' - 1);
+  const __m128i nine_plus_one = _mm_set1_epi16('9' + 1);
+  const __m128i underscore = _mm_set1_epi16('_');
+  const __m128i dollar = _mm_set1_epi16('$');
+  __m128i non_keyword_chars = _mm_setzero_si128();
+  while (end - cursor >= 8) {
+    __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(cursor));
+    __m128i is_lower =
+        _mm_and_si128(_mm_cmpgt_epi16(chunk, lower_a_minus_one),
+                      _mm_cmplt_epi16(chunk, lower_z_plus_one));
+    __m128i is_other = _mm_or_si128(
+        _mm_or_si128(_mm_and_si128(_mm_cmpgt_epi16(chunk, upper_a_minus_one),
+                                   _mm_cmplt_epi16(chunk, upper_z_plus_one)),
+                     _mm_and_si128(_mm_cmpgt_epi16(chunk, zero_minus_one),
+                                   _mm_cmplt_epi16(chunk, nine_plus_one))),
+        _mm_or_si128(_mm_cmpeq_epi16(chunk, underscore),
+                     _mm_cmpeq_epi16(chunk, dollar)));
+    if (_mm_movemask_epi8(_mm_or_si128(is_lower, is_other)) != 0xFFFF) break;
+    non_keyword_chars = _mm_or_si128(non_keyword_chars, is_other);
+    cursor += 8;
+  }
+  if (_mm_movemask_epi8(non_keyword_chars) != 0) *can_be_keyword = false;
+#elif defined(__aarch64__)
+  uint16x8_t non_keyword_chars = vdupq_n_u16(0);
+  while (end - cursor >= 8) {
+    uint16x8_t chunk = vld1q_u16(cursor);
+    uint16x8_t is_lower = vandq_u16(vcgeq_u16(chunk, vdupq_n_u16('a')),
+                                    vcleq_u16(chunk, vdupq_n_u16('z')));
+    uint16x8_t is_other = vorrq_u16(
+        vorrq_u16(vandq_u16(vcgeq_u16(chunk, vdupq_n_u16('A')),
+                            vcleq_u16(chunk, vdupq_n_u16('Z'))),
+                  vandq_u16(vcgeq_u16(chunk, vdupq_n_u16('0')),
+                            vcleq_u16(chunk, vdupq_n_u16('9')))),
+        vorrq_u16(vceqq_u16(chunk, vdupq_n_u16('_')),
+                  vceqq_u16(chunk, vdupq_n_u16('$'))));
+    if (vminvq_u16(vorrq_u16(is_lower, is_other)) == 0) break;
+    non_keyword_chars = vorrq_u16(non_keyword_chars, is_other);
+    cursor += 8;
+  }
+  if (vmaxvq_u16(non_keyword_chars) != 0) *can_be_keyword = false;
+#endif
+  while (cursor != end) {
+    uint16_t c = *cursor;
+    bool is_lower = c >= 'a' && c <= 'z';
+    if (!is_lower) {
+      if (!((c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' ||
+            c == '$')) {
+        break;
+      }
+      *can_be_keyword = false;
+    }
+    cursor++;
+  }
+  return cursor;
+}
+
+}  // namespace
+
+uc32 Utf16CharacterStream::AdvanceUntilNonAsciiWhiteSpace(
+    bool* seen_line_terminator) {
+  while (true) {
+    const uint16_t* run_end =
+        FindWhiteSpaceRunEnd(buffer_cursor_, buffer_end_, seen_line_terminator);
+    if (run_end != buffer_end_) {
+      buffer_cursor_ = run_end + 1;
+      return static_cast<uc32>(*run_end);
+    }
+    buffer_cursor_ = buffer_end_;
+    if (!ReadBlockChecked()) {
+      buffer_cursor_++;
+      return kEndOfInput;
+    }
+  }
+}
+
+Vector<const uint16_t> Utf16CharacterStream::AdvanceAsciiIdentifierRun(
+    bool* can_be_keyword) {
+  const uint16_t* run_start = buffer_cursor_;
+  buffer_cursor_ =
+      FindAsciiIdentifierRunEnd(run_start, buffer_end_, can_be_keyword);
+  return Vector<const uint16_t>(run_start,
+                                static_cast<size_t>(buffer_cursor_ - run_start));
+}
+
 class ScopedExternalStringLock {
  public:
   explicit ScopedExternalStringLock(ExternalString* string) {
@@ -548,7 +713,19 @@ void Utf8ExternalStreamingStream::FillBufferFromCurrentChunk() {
   }
 
   size_t it = current_.pos.bytes - chunk.start.bytes;
+  const uint16_t* buffer_limit = buffer_ + kBufferSize - 1;
   while (it < chunk.length && cursor + 1 < buffer_start_ + kBufferSize) {
+    // Fast path: when no partial character is pending, widen runs of one-byte
+    // (ASCII) input directly into the buffer instead of pushing every byte
+    // through the incremental decoder. Only genuinely multi-byte characters
+    // and sequences that straddle chunks take the decoder below.
+    if (state == unibrow::Utf8::State::kAccept) {
+      while (it < chunk.length && cursor < buffer_limit &&
+             chunk.data[it] <= unibrow::Utf8::kMaxOneByteChar) {
+        *(cursor++) = chunk.data[it++];
+      }
+      if (it == chunk.length || cursor >= buffer_limit) break;
+    }
     unibrow::uchar t = unibrow::Utf8::ValueOfIncremental(
         chunk.data[it], &it, &state, &incomplete_char);
     if (V8_LIKELY(t < kUtf8Bom)) {
@@ -258,6 +258,14 @@ V8_INLINE Token::Value Scanner::ScanIdentifierOrKeywordInner() {
       // fall into the slow path after scanning the identifier.
       DCHECK(!NeedsSlowPath(scan_flags));
       AddLiteralChar(static_cast<char>(c0_));
+      // Bulk-scan the body of the identifier within the current buffer; the
+      // terminating character and any tail beyond the buffer are left to the
+      // character-by-character loop below.
+      bool can_be_keyword = true;
+      AddLiteralAsciiChars(source_->AdvanceAsciiIdentifierRun(&can_be_keyword));
+      if (!can_be_keyword) {
+        scan_flags |= static_cast<uint8_t>(ScanFlags::kCannotBeKeyword);
+      }
       AdvanceUntil([this, &scan_flags](uc32 c0) {
         if (V8_UNLIKELY(static_cast<uint32_t>(c0) > kMaxAscii)) {
           // A non-ascii character means we need to drop through to the slow
@@ -304,12 +312,16 @@ V8_INLINE Token::Value Scanner::SkipWhiteSpace() {
   // We won't skip behind the end of input.
   DCHECK(!IsWhiteSpaceOrLineTerminator(kEndOfInput));
 
-  // Advance as long as character is a WhiteSpace or LineTerminator.
+  // Advance as long as character is a WhiteSpace or LineTerminator. Runs of
+  // ASCII whitespace are skipped in bulk; the loop is only taken again for
+  // Unicode whitespace.
   while (IsWhiteSpaceOrLineTerminator(c0_)) {
     if (!next().after_line_terminator && unibrow::IsLineTerminator(c0_)) {
       next().after_line_terminator = true;
     }
-    Advance();
+    bool seen_line_terminator = false;
+    c0_ = source_->AdvanceUntilNonAsciiWhiteSpace(&seen_line_terminator);
+    if (seen_line_terminator) next().after_line_terminator = true;
   }
 
   // Return whether or not we skipped any characters.
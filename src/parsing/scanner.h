@@ -91,6 +91,22 @@ class Utf16CharacterStream {
     }
   }
 
+  // Returns and advances past the next code unit that is not ASCII
+  // whitespace or a line terminator ('\t', '\n', '\v', '\f', '\r', ' '),
+  // skipping runs of such code units 16 bytes at a time where SIMD is
+  // available. Sets |*seen_line_terminator| if the skipped run contained
+  // '\n' or '\r'. If there are no more code units it returns kEndOfInput.
+  // Unicode whitespace is left for the caller to handle.
+  uc32 AdvanceUntilNonAsciiWhiteSpace(bool* seen_line_terminator);
+
+  // Advances past a maximal run of ASCII identifier-part characters
+  // ('0'-'9', 'A'-'Z', 'a'-'z', '_' and '$') and returns the run, which may
+  // be empty, so that the caller can append it to a literal in bulk. Clears
+  // |*can_be_keyword| if the run contains a character that keywords never
+  // contain. Does not advance past the end of the current buffer; scanning
+  // must continue with Advance() or AdvanceUntil() afterwards.
+  Vector<const uint16_t> AdvanceAsciiIdentifierRun(bool* can_be_keyword);
+
   // Go back one by one character in the input stream.
   // This undoes the most recent Advance().
   inline void Back() {
@@ -427,6 +443,19 @@ class Scanner {
       AddOneByteChar(static_cast<byte>(code_unit));
     }
 
+    // Appends a run of ASCII code units in bulk, avoiding the per-character
+    // capacity check of AddChar.
+    V8_INLINE void AddAsciiChars(Vector<const uint16_t> code_units) {
+      DCHECK(is_one_byte());
+      int length = code_units.length();
+      while (position_ + length > backing_store_.length()) ExpandBuffer();
+      for (int i = 0; i < length; i++) {
+        DCHECK(IsValidAscii(static_cast<char>(code_units[i])));
+        backing_store_[position_ + i] = static_cast<byte>(code_units[i]);
+      }
+      position_ += length;
+    }
+
     V8_INLINE void AddChar(uc32 code_unit) {
       if (is_one_byte()) {
         if (code_unit <= static_cast<uc32>(unibrow::Latin1::kMaxChar)) {
@@ -578,6 +607,10 @@ class Scanner {
 
   V8_INLINE void AddLiteralChar(char c) { next().literal_chars.AddChar(c); }
 
+  V8_INLINE void AddLiteralAsciiChars(Vector<const uint16_t> chars) {
+    next().literal_chars.AddAsciiChars(chars);
+  }
+
   V8_INLINE void AddRawLiteralChar(uc32 c) {
     next().raw_literal_chars.AddChar(c);
   }
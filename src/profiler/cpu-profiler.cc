@@ -206,6 +206,19 @@ void SamplingEventsProcessor::Run() {
         while (base::TimeTicks::HighResolutionNow() < nextSampleTime) {
         }
       } else  // NOLINT
+#else
+      if (period_ < base::TimeDelta::FromMilliseconds(1)) {
+        // Sub-millisecond sampling periods are below the scheduler's sleep
+        // granularity. Sleep off the bulk of the wait and busy-wait the last
+        // stretch so the requested period is actually honored.
+        static const base::TimeDelta kSpinSlack =
+            base::TimeDelta::FromMicroseconds(100);
+        if (nextSampleTime - now > kSpinSlack) {
+          base::OS::Sleep(nextSampleTime - now - kSpinSlack);
+        }
+        while (base::TimeTicks::HighResolutionNow() < nextSampleTime) {
+        }
+      } else  // NOLINT
 #endif
       {
         base::OS::Sleep(nextSampleTime - now);
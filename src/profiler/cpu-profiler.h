@@ -197,7 +197,10 @@ class SamplingEventsProcessor : public ProfilerEventsProcessor {
  private:
   SampleProcessingResult ProcessOneSample() override;
 
-  static const size_t kTickSampleBufferSize = 1 * MB;
+  // The buffer is only allocated while profiling is active. At 100us
+  // sampling the previous 1MB (a few hundred records) gave the processing
+  // thread only tens of milliseconds of slack before samples were dropped.
+  static const size_t kTickSampleBufferSize = 4 * MB;
   static const size_t kTickSampleQueueLength =
       kTickSampleBufferSize / sizeof(TickSampleEventRecord);
   SamplingCircularQueue<TickSampleEventRecord,
@@ -161,6 +161,10 @@ SnapshotObjectId HeapProfiler::PushHeapObjectsStats(OutputStream* stream,
   return ids_->PushHeapObjectsStats(stream, timestamp_us);
 }
 
+SnapshotObjectId HeapProfiler::PushHeapObjectUpdates(OutputStream* stream) {
+  return ids_->PushHeapObjectUpdates(stream);
+}
+
 void HeapProfiler::StopHeapObjectsTracking() {
   ids_->StopHeapObjectsTracking();
   if (allocation_tracker_) {
@@ -456,6 +456,50 @@ SnapshotObjectId HeapObjectsMap::PushHeapObjectsStats(OutputStream* stream,
 }
 
 
+SnapshotObjectId HeapObjectsMap::PushHeapObjectUpdates(OutputStream* stream) {
+  // Refresh the entries without removing the dead ones yet; the dead entries
+  // are what tells us which ids to report as gone.
+  heap_->PreciseCollectAllGarbage(Heap::kNoGCFlags,
+                                  GarbageCollectionReason::kHeapProfiler);
+  {
+    HeapIterator iterator(heap_);
+    for (HeapObject* obj = iterator.next(); obj != nullptr;
+         obj = iterator.next()) {
+      FindOrAddEntry(obj->address(), obj->Size());
+    }
+  }
+  // Collect the updates before removing dead entries, so that the map never
+  // holds stale address mappings while the stream runs. The buffer is
+  // proportional to the churn since the last call, not to the heap size.
+  std::vector<v8::HeapObjectUpdate> updates;
+  for (size_t i = 1; i < entries_.size(); ++i) {
+    EntryInfo& entry_info = entries_.at(i);
+    if (!entry_info.accessed) {
+      // Dead since the last call. Objects that were never reported died
+      // before they became visible and are skipped.
+      if (entry_info.reported_size == 0) continue;
+      updates.emplace_back(entry_info.id, 0);
+    } else {
+      if (entry_info.size == entry_info.reported_size) continue;
+      entry_info.reported_size = entry_info.size;
+      updates.emplace_back(entry_info.id, entry_info.size);
+    }
+  }
+  RemoveDeadEntries();
+
+  int prefered_chunk_size = stream->GetChunkSize();
+  for (size_t i = 0; i < updates.size();) {
+    int chunk_size = static_cast<int>(
+        Min(updates.size() - i, static_cast<size_t>(prefered_chunk_size)));
+    OutputStream::WriteResult result =
+        stream->WriteHeapObjectUpdateChunk(&updates[i], chunk_size);
+    if (result == OutputStream::kAbort) return last_assigned_id();
+    i += chunk_size;
+  }
+  stream->EndOfStream();
+  return last_assigned_id();
+}
+
 void HeapObjectsMap::RemoveDeadEntries() {
   DCHECK(entries_.size() > 0 && entries_.at(0).id == 0 &&
          entries_.at(0).addr == kNullAddress);
@@ -1238,6 +1282,12 @@ void V8HeapExplorer::ExtractFeedbackVectorReferences(
     SetWeakReference(entry, "optimized code", code_heap_object,
                      FeedbackVector::kOptimizedCodeOffset);
   }
+  MaybeObject osr_code = feedback_vector->osr_code_weak_or_smi();
+  HeapObject* osr_code_heap_object;
+  if (osr_code->GetHeapObjectIfWeak(&osr_code_heap_object)) {
+    SetWeakReference(entry, "osr code", osr_code_heap_object,
+                     FeedbackVector::kOsrCodeOffset);
+  }
 }
 
 template <typename T>
@@ -2348,6 +2398,17 @@ const int HeapSnapshotJSONSerializer::kEdgeFieldsCount = 3;
 // type, name, id, self_size, edge_count, trace_node_id.
 const int HeapSnapshotJSONSerializer::kNodeFieldsCount = 6;
 
+// The JSON is emitted to the embedder's OutputStream in chunks, so the
+// serializer itself holds only O(chunk) state. The O(heap) cost lives in
+// the HeapSnapshot this serializes: nodes and edges are fully
+// materialized by the generator before serialization starts. That is not
+// incidental - edges are emitted grouped by from-node and reference
+// to-nodes by index into the completed node list, and the same snapshot
+// object backs the v8::HeapSnapshot query API after serialization, so
+// emitting during the heap walk would both require a separate
+// numbering pre-pass under the same no-GC scope and produce a snapshot
+// that cannot be queried afterwards. A bounded-memory mode is thus a new
+// API contract (serialize-only snapshots), not a serializer change.
 void HeapSnapshotJSONSerializer::Serialize(v8::OutputStream* stream) {
   if (AllocationTracker* allocation_tracker =
       snapshot_->profiler()->allocation_tracker()) {
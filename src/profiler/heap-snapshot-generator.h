@@ -258,6 +258,10 @@ class HeapObjectsMap {
   void StopHeapObjectsTracking();
   SnapshotObjectId PushHeapObjectsStats(OutputStream* stream,
                                         int64_t* timestamp_us);
+  // Streams one HeapObjectUpdate per object added, removed or resized since
+  // the previous call. Costs a heap walk plus output proportional to the
+  // churn; no snapshot is built.
+  SnapshotObjectId PushHeapObjectUpdates(OutputStream* stream);
   const std::vector<TimeInterval>& samples() const { return time_intervals_; }
 
   SnapshotObjectId GenerateId(v8::RetainedObjectInfo* info);
@@ -280,6 +284,9 @@ class HeapObjectsMap {
     Address addr;
     unsigned int size;
     bool accessed;
+    // Size last streamed by PushHeapObjectUpdates; 0 means the entry has
+    // not been reported yet.
+    unsigned int reported_size = 0;
   };
 
   SnapshotObjectId next_id_;
@@ -5,6 +5,7 @@
 #include "src/profiler/sampling-heap-profiler.h"
 
 #include <stdint.h>
+#include <algorithm>
 #include <memory>
 
 #include "src/api-inl.h"
@@ -92,9 +93,35 @@ void SamplingHeapProfiler::SampleObject(Address soon_object, size_t size) {
   Local<v8::Value> loc = v8::Utils::ToLocal(obj);
 
   AllocationNode* node = AddStack();
-  node->allocations_[size]++;
-  auto sample =
-      base::make_unique<Sample>(size, node, loc, this, next_sample_id());
+
+  // With adaptive site rates, a call stack that has already fired many
+  // samples only retains every 2^k-th sample (in expectation), where k grows
+  // with the number of samples fired for the stack. Retained samples carry
+  // weight 2^k, so reported counts stay unbiased while hot sites stop
+  // crowding out rare ones.
+  unsigned int weight = 1;
+  if (flags_ & v8::HeapProfiler::kSamplingAdaptiveSiteRates) {
+    // Let the site decay by one power of two for each window of fired
+    // samples, i.e. full rate for the first window, half rate for the
+    // second, and so on, capped so the weight cannot overflow.
+    static const unsigned int kSiteDecayWindow = 64;
+    static const unsigned int kMaxSiteDecayExponent = 16;
+    unsigned int k =
+        std::min(node->samples_fired_ / kSiteDecayWindow, kMaxSiteDecayExponent);
+    if (node->samples_fired_ < kMaxUInt32) node->samples_fired_++;
+    weight = 1u << k;
+    bool keep;
+    if (FLAG_sampling_heap_profiler_suppress_randomness) {
+      keep = node->samples_fired_ % weight == 0;
+    } else {
+      keep = isolate_->random_number_generator()->NextDouble() * weight < 1.0;
+    }
+    if (!keep) return;
+  }
+
+  node->allocations_[size] += weight;
+  auto sample = base::make_unique<Sample>(size, node, loc, this,
+                                          next_sample_id(), weight);
   sample->global.SetWeak(sample.get(), OnWeakCallback,
                          WeakCallbackType::kParameter);
 #if __clang__
@@ -114,8 +141,8 @@ void SamplingHeapProfiler::OnWeakCallback(
     const WeakCallbackInfo<Sample>& data) {
   Sample* sample = data.GetParameter();
   AllocationNode* node = sample->owner;
-  DCHECK_GT(node->allocations_[sample->size], 0);
-  node->allocations_[sample->size]--;
+  DCHECK_GE(node->allocations_[sample->size], sample->weight);
+  node->allocations_[sample->size] -= sample->weight;
   if (node->allocations_[sample->size] == 0) {
     node->allocations_.erase(sample->size);
     while (node->allocations_.empty() && node->children_.empty() &&
@@ -300,8 +327,8 @@ SamplingHeapProfiler::BuildSamples() const {
   for (const auto& it : samples_) {
     const Sample* sample = it.second.get();
     samples.emplace_back(v8::AllocationProfile::Sample{
-        sample->owner->id_, sample->size, ScaleSample(sample->size, 1).count,
-        sample->sample_id});
+        sample->owner->id_, sample->size,
+        ScaleSample(sample->size, sample->weight).count, sample->sample_id});
   }
   return samples;
 }
@@ -88,6 +88,10 @@ class SamplingHeapProfiler {
     // iterator invalidation during TranslateAllocationNode.
     std::map<size_t, unsigned int> allocations_;
     std::map<FunctionId, std::unique_ptr<AllocationNode>> children_;
+    // Number of samples that have fired for this node, including ones that
+    // were dropped again by per-site rate adaptation; drives the retention
+    // probability under kSamplingAdaptiveSiteRates.
+    unsigned int samples_fired_ = 0;
     AllocationNode* const parent_;
     const int script_id_;
     const int script_position_;
@@ -102,19 +106,24 @@ class SamplingHeapProfiler {
 
   struct Sample {
     Sample(size_t size_, AllocationNode* owner_, Local<Value> local_,
-           SamplingHeapProfiler* profiler_, uint64_t sample_id)
+           SamplingHeapProfiler* profiler_, uint64_t sample_id,
+           unsigned int weight)
         : size(size_),
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
           profiler(profiler_),
-          sample_id(sample_id) {}
+          sample_id(sample_id),
+          weight(weight) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
     const uint64_t sample_id;
+    // Number of fired samples this sample stands for; 1 unless per-site rate
+    // adaptation dropped siblings in its stead.
+    const unsigned int weight;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
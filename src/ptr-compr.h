@@ -12,6 +12,17 @@
 namespace v8 {
 namespace internal {
 
+// Constants for the pointer-compression heap layout. What exists so far
+// is only the address-space side: under V8_COMPRESS_POINTERS the
+// IsolateAllocator reserves a 4 GB cage aligned to 4 GB and places the
+// isolate root at its midpoint, so that any heap address minus the root
+// fits in a signed 32-bit offset. Tagged values themselves are still full
+// pointers everywhere: kTaggedSize is kPointerSize, the slot classes in
+// src/objects/slots.h are word-sized, the object-macros accessors and the
+// TurboAssembler/CSA load-store paths read whole words, and the GC
+// visitors iterate word slots. Shrinking tagged values to 32 bits means
+// changing all of those layers together with the snapshot format; until
+// then these constants are exercised only by the cage reservation.
 constexpr size_t kPtrComprHeapReservationSize = size_t{4} * GB;
 constexpr size_t kPtrComprIsolateRootBias = kPtrComprHeapReservationSize / 2;
 constexpr size_t kPtrComprIsolateRootAlignment = size_t{4} * GB;
@@ -4,9 +4,11 @@
 
 #include "src/regexp/jsregexp.h"
 
+#include <map>
 #include <memory>
 #include <vector>
 
+#include "src/base/lazy-instance.h"
 #include "src/base/platform/platform.h"
 #include "src/code-tracer.h"
 #include "src/compilation-cache.h"
@@ -127,6 +129,48 @@ static bool HasFewDifferentCharacters(Handle<String> pattern) {
   return true;
 }
 
+// Walks down the left spine of the parse tree looking for a literal that
+// every match of the regexp must start with. Such a literal lets the
+// runtime prefilter candidate match positions with a plain string search
+// instead of entering the match engine at every position. Returns an empty
+// vector if no usable literal was found.
+static Vector<const uc16> RequiredPrefix(RegExpTree* tree) {
+  while (true) {
+    if (tree->IsAtom()) {
+      RegExpAtom* atom = tree->AsAtom();
+      if (IgnoreCase(atom->flags())) return Vector<const uc16>();
+      return atom->data();
+    } else if (tree->IsAlternative()) {
+      // A concatenation; zero-width assertions at the front (e.g. \b) do
+      // not consume input, so the first consuming node still starts every
+      // match.
+      ZoneList<RegExpTree*>* nodes = tree->AsAlternative()->nodes();
+      int i = 0;
+      while (i < nodes->length() && nodes->at(i)->IsAssertion()) i++;
+      if (i == nodes->length()) return Vector<const uc16>();
+      tree = nodes->at(i);
+    } else if (tree->IsText()) {
+      ZoneList<TextElement>* elements = tree->AsText()->elements();
+      if (elements->length() == 0 ||
+          elements->at(0).text_type() != TextElement::ATOM) {
+        return Vector<const uc16>();
+      }
+      tree = elements->at(0).atom();
+    } else if (tree->IsCapture()) {
+      tree = tree->AsCapture()->body();
+    } else if (tree->IsGroup()) {
+      tree = tree->AsGroup()->body();
+    } else if (tree->IsQuantifier() && tree->AsQuantifier()->min() > 0) {
+      // The body matches at least once, so its prefix is mandatory.
+      tree = tree->AsQuantifier()->body();
+    } else {
+      // Disjunctions, character classes, back references etc. have no
+      // single mandatory prefix.
+      return Vector<const uc16>();
+    }
+  }
+}
+
 // Generic RegExp methods. Dispatches to implementation specific methods.
 
 MaybeHandle<Object> RegExpImpl::Compile(Isolate* isolate, Handle<JSRegExp> re,
@@ -176,6 +220,22 @@ MaybeHandle<Object> RegExpImpl::Compile(Isolate* isolate, Handle<JSRegExp> re,
   }
   if (!has_been_compiled) {
     IrregexpInitialize(isolate, re, pattern, flags, parse_result.capture_count);
+    // If every match must start with a fixed literal, store it so that
+    // IrregexpExec can skip ahead with a string search. Sticky regexps
+    // must match exactly at last_index and start-anchored ones only at
+    // the start, so a prefilter would not help them.
+    if (!IgnoreCase(flags) && !IsSticky(flags) &&
+        !parse_result.tree->IsAnchoredAtStart()) {
+      Vector<const uc16> prefix = RequiredPrefix(parse_result.tree);
+      if (prefix.length() > 0) {
+        Handle<String> prefix_string;
+        ASSIGN_RETURN_ON_EXCEPTION(
+            isolate, prefix_string,
+            isolate->factory()->NewStringFromTwoByte(prefix), Object);
+        FixedArray::cast(re->data())->set(
+            JSRegExp::kIrregexpRequiredPrefixIndex, *prefix_string);
+      }
+    }
   }
   DCHECK(re->data()->IsFixedArray());
   // Compilation succeeded so the data is set on the regexp
@@ -304,10 +364,125 @@ bool RegExpImpl::EnsureCompiledIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   if (compiled_code->IsByteArray()) return true;
 #else  // V8_INTERPRETED_REGEXP (RegExp native code)
   if (compiled_code->IsCode()) return true;
+  // With --regexp-tier-up, regexps start out as bytecode. Keep the bytecode
+  // until the regexp has run hot; after that, fall through and recompile to
+  // native code.
+  if (compiled_code->IsByteArray() &&
+      IrregexpTierUpTicks(FixedArray::cast(re->data())) <
+          FLAG_regexp_tier_up_ticks) {
+    return true;
+  }
 #endif
   return CompileIrregexp(isolate, re, sample_subject, is_one_byte);
 }
 
+namespace {
+
+// Process-wide cache of compiled irregexp bytecode, so that isolates
+// compiling the same patterns do not redo work that the per-isolate
+// compilation cache already saved within a single isolate. Only the
+// bytecode tier can be shared: bytecode embeds all of its operands
+// (including character tables) inline and contains no heap pointers,
+// unlike generated native Code objects. Enabled with
+// --regexp-shared-cache.
+class SharedBytecodeCache {
+ public:
+  // Builds the key under which the compilation of {pattern} is stored. The
+  // subject representation is part of the key because one-byte and two-byte
+  // subjects compile to different bytecode.
+  static std::vector<uc16> Key(Handle<String> pattern, JSRegExp::Flags flags,
+                               bool is_one_byte) {
+    int length = pattern->length();
+    std::vector<uc16> key(length + 2);
+    for (int i = 0; i < length; i++) key[i] = pattern->Get(i);
+    key[length] = static_cast<uc16>(flags);
+    key[length + 1] = is_one_byte ? 1 : 0;
+    return key;
+  }
+
+  // Copies the cached compilation for {key} into {isolate}'s heap. Returns
+  // false on a miss.
+  bool Lookup(Isolate* isolate, const std::vector<uc16>& key,
+              Handle<ByteArray>* bytecode, Handle<FixedArray>* capture_name_map,
+              int* num_registers) {
+    Entry entry;
+    {
+      base::MutexGuard guard(&mutex_);
+      auto it = map_.find(key);
+      if (it == map_.end()) return false;
+      entry = it->second;
+    }
+    Handle<ByteArray> code = isolate->factory()->NewByteArray(
+        static_cast<int>(entry.bytecode.size()), TENURED);
+    MemCopy(code->GetDataStartAddress(), entry.bytecode.data(),
+            entry.bytecode.size());
+    *bytecode = code;
+    if (!entry.capture_names.empty()) {
+      int num_names = static_cast<int>(entry.capture_names.size());
+      Handle<FixedArray> names_map =
+          isolate->factory()->NewFixedArray(num_names * 2);
+      for (int i = 0; i < num_names; i++) {
+        const std::vector<uc16>& chars = entry.capture_names[i].first;
+        Handle<String> name =
+            isolate->factory()
+                ->NewStringFromTwoByte(Vector<const uc16>(
+                    chars.data(), static_cast<int>(chars.size())))
+                .ToHandleChecked();
+        names_map->set(i * 2, *name);
+        names_map->set(i * 2 + 1, Smi::FromInt(entry.capture_names[i].second));
+      }
+      *capture_name_map = names_map;
+    }
+    *num_registers = entry.num_registers;
+    return true;
+  }
+
+  // Stores a copy of freshly compiled bytecode. Insertions beyond the size
+  // cap are dropped; entries are never evicted.
+  void Insert(const std::vector<uc16>& key, ByteArray* bytecode,
+              Handle<FixedArray> capture_name_map, int num_registers) {
+    Entry entry;
+    entry.bytecode.assign(bytecode->GetDataStartAddress(),
+                          bytecode->GetDataStartAddress() + bytecode->length());
+    if (!capture_name_map.is_null()) {
+      for (int i = 0; i < capture_name_map->length(); i += 2) {
+        String* name = String::cast(capture_name_map->get(i));
+        std::vector<uc16> chars(name->length());
+        for (int j = 0; j < name->length(); j++) chars[j] = name->Get(j);
+        entry.capture_names.emplace_back(
+            std::move(chars), Smi::ToInt(capture_name_map->get(i + 1)));
+      }
+    }
+    entry.num_registers = num_registers;
+    base::MutexGuard guard(&mutex_);
+    if (map_.size() >= kMaxEntries && map_.count(key) == 0) return;
+    map_[key] = std::move(entry);
+  }
+
+ private:
+  struct Entry {
+    std::vector<byte> bytecode;
+    // Names and (1-based) indices of named capture groups, in the layout
+    // of the capture name map.
+    std::vector<std::pair<std::vector<uc16>, int>> capture_names;
+    int num_registers = 0;
+  };
+
+  static const size_t kMaxEntries = 1024;
+
+  base::Mutex mutex_;
+  std::map<std::vector<uc16>, Entry> map_;
+};
+
+base::LazyInstance<SharedBytecodeCache>::type shared_bytecode_cache =
+    LAZY_INSTANCE_INITIALIZER;
+
+SharedBytecodeCache* GetSharedBytecodeCache() {
+  return shared_bytecode_cache.Pointer();
+}
+
+}  // namespace
+
 bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
                                  Handle<String> sample_subject,
                                  bool is_one_byte) {
@@ -316,17 +491,48 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
   PostponeInterruptsScope postpone(isolate);
 #ifdef DEBUG
   Object* entry = re->DataAt(JSRegExp::code_index(is_one_byte));
-  // When arriving here entry can only be a smi representing an uncompiled
-  // regexp.
-  DCHECK(entry->IsSmi());
-  int entry_value = Smi::ToInt(entry);
-  DCHECK_EQ(JSRegExp::kUninitializedValue, entry_value);
+  // When arriving here entry is either a smi representing an uncompiled
+  // regexp, or bytecode that is being tiered up to native code.
+  DCHECK(entry->IsSmi() ? Smi::ToInt(entry) == JSRegExp::kUninitializedValue
+                        : (FLAG_regexp_tier_up && entry->IsByteArray()));
 #endif
 
   JSRegExp::Flags flags = re->GetFlags();
 
   Handle<String> pattern(re->Pattern(), isolate);
   pattern = String::Flatten(isolate, pattern);
+
+  // With --regexp-tier-up, start out as bytecode; the regexp tiers up to
+  // native code in a later call once it has run hot.
+#ifdef V8_INTERPRETED_REGEXP
+  const bool will_produce_bytecode = true;
+#else
+  const bool will_produce_bytecode =
+      FLAG_regexp_tier_up &&
+      IrregexpTierUpTicks(FixedArray::cast(re->data())) <
+          FLAG_regexp_tier_up_ticks;
+#endif
+
+  // When compiling to bytecode, consult the process-wide cache before doing
+  // any work; a hit replaces both parsing and compilation.
+  std::vector<uc16> shared_key;
+  if (FLAG_regexp_shared_cache && will_produce_bytecode) {
+    shared_key = SharedBytecodeCache::Key(pattern, flags, is_one_byte);
+    Handle<ByteArray> bytecode;
+    Handle<FixedArray> capture_name_map;
+    int num_registers;
+    if (GetSharedBytecodeCache()->Lookup(isolate, shared_key, &bytecode,
+                                         &capture_name_map, &num_registers)) {
+      Handle<FixedArray> data(FixedArray::cast(re->data()), isolate);
+      data->set(JSRegExp::code_index(is_one_byte), *bytecode);
+      SetIrregexpCaptureNameMap(*data, capture_name_map);
+      if (num_registers > IrregexpMaxRegisterCount(*data)) {
+        SetIrregexpMaxRegisterCount(*data, num_registers);
+      }
+      return true;
+    }
+  }
+
   RegExpCompileData compile_data;
   FlatStringReader reader(isolate, pattern);
   if (!RegExpParser::ParseRegExp(isolate, &zone, &reader, flags,
@@ -336,6 +542,7 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     USE(ThrowRegExpException(isolate, re, pattern, compile_data.error));
     return false;
   }
+  compile_data.compile_to_bytecode = will_produce_bytecode;
   RegExpEngine::CompilationResult result =
       RegExpEngine::Compile(isolate, &zone, &compile_data, flags, pattern,
                             sample_subject, is_one_byte);
@@ -360,6 +567,13 @@ bool RegExpImpl::CompileIrregexp(Isolate* isolate, Handle<JSRegExp> re,
     SetIrregexpMaxRegisterCount(*data, result.num_registers);
   }
 
+  if (FLAG_regexp_shared_cache && will_produce_bytecode) {
+    GetSharedBytecodeCache()->Insert(shared_key,
+                                     IrregexpByteCode(*data, is_one_byte),
+                                     compile_data.capture_name_map,
+                                     result.num_registers);
+  }
+
   return true;
 }
 
@@ -401,6 +615,20 @@ Code RegExpImpl::IrregexpNativeCode(FixedArray* re, bool is_one_byte) {
   return Code::cast(re->get(JSRegExp::code_index(is_one_byte)));
 }
 
+bool RegExpImpl::IrregexpHasBytecode(FixedArray* re, bool is_one_byte) {
+  return re->get(JSRegExp::code_index(is_one_byte))->IsByteArray();
+}
+
+int RegExpImpl::IrregexpTierUpTicks(FixedArray* re) {
+  return Smi::ToInt(re->get(JSRegExp::kIrregexpTierUpTicksIndex));
+}
+
+void RegExpImpl::IncrementIrregexpTierUpTicks(FixedArray* re) {
+  int ticks = IrregexpTierUpTicks(re);
+  if (ticks >= FLAG_regexp_tier_up_ticks) return;  // Saturate.
+  re->set(JSRegExp::kIrregexpTierUpTicksIndex, Smi::FromInt(ticks + 1));
+}
+
 void RegExpImpl::IrregexpInitialize(Isolate* isolate, Handle<JSRegExp> re,
                                     Handle<String> pattern,
                                     JSRegExp::Flags flags, int capture_count) {
@@ -413,22 +641,30 @@ int RegExpImpl::IrregexpPrepare(Isolate* isolate, Handle<JSRegExp> regexp,
                                 Handle<String> subject) {
   DCHECK(subject->IsFlat());
 
+#ifndef V8_INTERPRETED_REGEXP
+  // Count this execution for tiering purposes. Crossing the threshold makes
+  // EnsureCompiledIrregexp below replace the bytecode with native code.
+  if (FLAG_regexp_tier_up) {
+    IncrementIrregexpTierUpTicks(FixedArray::cast(regexp->data()));
+  }
+#endif  // V8_INTERPRETED_REGEXP
+
   // Check representation of the underlying storage.
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
   if (!EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte)) return -1;
 
-#ifdef V8_INTERPRETED_REGEXP
-  // Byte-code regexp needs space allocated for all its registers.
-  // The result captures are copied to the start of the registers array
-  // if the match succeeds.  This way those registers are not clobbered
-  // when we set the last match info from last successful match.
-  return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
-         (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#else  // V8_INTERPRETED_REGEXP
+  if (IrregexpHasBytecode(FixedArray::cast(regexp->data()), is_one_byte)) {
+    // Byte-code regexp needs space allocated for all its registers.
+    // The result captures are copied to the start of the registers array
+    // if the match succeeds.  This way those registers are not clobbered
+    // when we set the last match info from last successful match.
+    return IrregexpNumberOfRegisters(FixedArray::cast(regexp->data())) +
+           (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) *
+               2;
+  }
   // Native regexp only needs room to output captures. Registers are handled
   // internally.
   return (IrregexpNumberOfCaptures(FixedArray::cast(regexp->data())) + 1) * 2;
-#endif  // V8_INTERPRETED_REGEXP
 }
 
 int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
@@ -443,9 +679,12 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
   bool is_one_byte = subject->IsOneByteRepresentationUnderneath();
 
 #ifndef V8_INTERPRETED_REGEXP
-  DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
   do {
     EnsureCompiledIrregexp(isolate, regexp, subject, is_one_byte);
+    // With --regexp-tier-up, not-yet-hot regexps only have bytecode; run
+    // the interpreter below instead.
+    if (IrregexpHasBytecode(*irregexp, is_one_byte)) break;
+    DCHECK(output_size >= (IrregexpNumberOfCaptures(*irregexp) + 1) * 2);
     Handle<Code> code(IrregexpNativeCode(*irregexp, is_one_byte), isolate);
     // The stack is used to allocate registers for the compiled regexp code.
     // This means that in case of failure, the output registers array is left
@@ -478,9 +717,10 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     IrregexpPrepare(isolate, regexp, subject);
     is_one_byte = subject->IsOneByteRepresentationUnderneath();
   } while (true);
-  UNREACHABLE();
-#else  // V8_INTERPRETED_REGEXP
+#endif  // V8_INTERPRETED_REGEXP
 
+  // Interpreted path, either because this is an interpreted build or because
+  // the regexp has not run hot enough to tier up to native code yet.
   DCHECK(output_size >= IrregexpNumberOfRegisters(*irregexp));
   // We must have done EnsureCompiledIrregexp, so we can get the number of
   // registers.
@@ -510,7 +750,6 @@ int RegExpImpl::IrregexpExecRaw(Isolate* isolate, Handle<JSRegExp> regexp,
     isolate->StackOverflow();
   }
   return result;
-#endif  // V8_INTERPRETED_REGEXP
 }
 
 MaybeHandle<Object> RegExpImpl::IrregexpExec(
@@ -520,6 +759,17 @@ MaybeHandle<Object> RegExpImpl::IrregexpExec(
 
   subject = String::Flatten(isolate, subject);
 
+  // If compilation found a literal every match must start with, skip ahead
+  // to its first occurrence with a fast string search before entering the
+  // match engine, and fail immediately if there is none.
+  Object* required_prefix = FixedArray::cast(regexp->data())
+                                ->get(JSRegExp::kIrregexpRequiredPrefixIndex);
+  if (required_prefix->IsString()) {
+    Handle<String> prefix(String::cast(required_prefix), isolate);
+    previous_index = String::IndexOf(isolate, subject, prefix, previous_index);
+    if (previous_index < 0) return isolate->factory()->null_value();
+  }
+
   // Prepare space for the return values.
 #if defined(V8_INTERPRETED_REGEXP) && defined(DEBUG)
   if (FLAG_trace_regexp_bytecodes) {
@@ -622,6 +872,13 @@ RegExpImpl::GlobalCache::GlobalCache(Handle<JSRegExp> regexp,
       num_matches_ = -1;  // Signal exception.
       return;
     }
+#ifndef V8_INTERPRETED_REGEXP
+    // With --regexp-tier-up, a not-yet-hot regexp runs in the interpreter
+    // even in native builds.
+    interpreted = RegExpImpl::IrregexpHasBytecode(
+        FixedArray::cast(regexp_->data()),
+        subject_->IsOneByteRepresentationUnderneath());
+#endif  // V8_INTERPRETED_REGEXP
   }
 
   DCHECK(IsGlobal(regexp->GetFlags()));
@@ -1081,7 +1338,8 @@ RegExpEngine::CompilationResult RegExpCompiler::Assemble(
   isolate->IncreaseTotalRegexpCodeGenerated(code->Size());
   work_list_ = nullptr;
 #if defined(ENABLE_DISASSEMBLER) && !defined(V8_INTERPRETED_REGEXP)
-  if (FLAG_print_code) {
+  // With --regexp-tier-up the generated code can also be bytecode.
+  if (FLAG_print_code && code->IsCode()) {
     CodeTracer::Scope trace_scope(isolate->GetCodeTracer());
     OFStream os(trace_scope.file());
     Handle<Code>::cast(code)->Disassemble(pattern->ToCString().get(), os);
@@ -6701,56 +6959,62 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     return CompilationResult(isolate, error_message);
   }
 
-  // Create the correct assembler for the architecture.
+  // Create the correct assembler for the architecture. Storage for the
+  // bytecode assembler must outlive its use below.
+  std::unique_ptr<RegExpMacroAssembler> macro_assembler;
+  EmbeddedVector<byte, 1024> codes;
 #ifndef V8_INTERPRETED_REGEXP
-  // Native regexp implementation.
-
-  NativeRegExpMacroAssembler::Mode mode =
-      is_one_byte ? NativeRegExpMacroAssembler::LATIN1
-                  : NativeRegExpMacroAssembler::UC16;
+  if (data->compile_to_bytecode) {
+    // Interpreted regexp implementation (--regexp-tier-up).
+    macro_assembler.reset(
+        new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
+  } else {
+    // Native regexp implementation.
+    NativeRegExpMacroAssembler::Mode mode =
+        is_one_byte ? NativeRegExpMacroAssembler::LATIN1
+                    : NativeRegExpMacroAssembler::UC16;
 
 #if V8_TARGET_ARCH_IA32
-  RegExpMacroAssemblerIA32 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerIA32(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_X64
-  RegExpMacroAssemblerX64 macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerX64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM
-  RegExpMacroAssemblerARM macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerARM(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_ARM64
-  RegExpMacroAssemblerARM64 macro_assembler(isolate, zone, mode,
-                                            (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerARM64(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_S390
-  RegExpMacroAssemblerS390 macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerS390(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_PPC
-  RegExpMacroAssemblerPPC macro_assembler(isolate, zone, mode,
-                                          (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerPPC(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #elif V8_TARGET_ARCH_MIPS64
-  RegExpMacroAssemblerMIPS macro_assembler(isolate, zone, mode,
-                                           (data->capture_count + 1) * 2);
+    macro_assembler.reset(new RegExpMacroAssemblerMIPS(
+        isolate, zone, mode, (data->capture_count + 1) * 2));
 #else
 #error "Unsupported architecture"
 #endif
-
-#else  // V8_INTERPRETED_REGEXP
+  }
+#else   // V8_INTERPRETED_REGEXP
   // Interpreted regexp implementation.
-  EmbeddedVector<byte, 1024> codes;
-  RegExpMacroAssemblerIrregexp macro_assembler(isolate, codes, zone);
+  macro_assembler.reset(new RegExpMacroAssemblerIrregexp(isolate, codes, zone));
 #endif  // V8_INTERPRETED_REGEXP
 
-  macro_assembler.set_slow_safe(TooMuchRegExpCode(isolate, pattern));
+  macro_assembler->set_slow_safe(TooMuchRegExpCode(isolate, pattern));
 
   // Inserted here, instead of in Assembler, because it depends on information
   // in the AST that isn't replicated in the Node structure.
   static const int kMaxBacksearchLimit = 1024;
   if (is_end_anchored && !is_start_anchored && !is_sticky &&
       max_length < kMaxBacksearchLimit) {
-    macro_assembler.SetCurrentPositionFromEnd(max_length);
+    macro_assembler->SetCurrentPositionFromEnd(max_length);
   }
 
   if (is_global) {
@@ -6760,11 +7024,11 @@ RegExpEngine::CompilationResult RegExpEngine::Compile(
     } else if (is_unicode) {
       mode = RegExpMacroAssembler::GLOBAL_UNICODE;
     }
-    macro_assembler.set_global_mode(mode);
+    macro_assembler->set_global_mode(mode);
   }
 
-  return compiler.Assemble(isolate, &macro_assembler, node, data->capture_count,
-                           pattern);
+  return compiler.Assemble(isolate, macro_assembler.get(), node,
+                           data->capture_count, pattern);
 }
 
 bool RegExpEngine::TooMuchRegExpCode(Isolate* isolate, Handle<String> pattern) {
@@ -6790,10 +7054,13 @@ Object* RegExpResultsCache::Lookup(Heap* heap, String* key_string,
     DCHECK(key_pattern->IsString());
     if (!key_pattern->IsInternalizedString()) return Smi::kZero;
     cache = heap->string_split_cache();
-  } else {
-    DCHECK(type == REGEXP_MULTIPLE_INDICES);
+  } else if (type == REGEXP_MULTIPLE_INDICES) {
     DCHECK(key_pattern->IsFixedArray());
     cache = heap->regexp_multiple_cache();
+  } else {
+    DCHECK(type == REGEXP_REPLACE_PLAN);
+    DCHECK(key_pattern->IsFixedArray());
+    cache = heap->regexp_replace_plan_cache();
   }
 
   uint32_t hash = key_string->Hash();
@@ -6826,10 +7093,13 @@ void RegExpResultsCache::Enter(Isolate* isolate, Handle<String> key_string,
     DCHECK(key_pattern->IsString());
     if (!key_pattern->IsInternalizedString()) return;
     cache = factory->string_split_cache();
-  } else {
-    DCHECK(type == REGEXP_MULTIPLE_INDICES);
+  } else if (type == REGEXP_MULTIPLE_INDICES) {
     DCHECK(key_pattern->IsFixedArray());
     cache = factory->regexp_multiple_cache();
+  } else {
+    DCHECK(type == REGEXP_REPLACE_PLAN);
+    DCHECK(key_pattern->IsFixedArray());
+    cache = factory->regexp_replace_plan_cache();
   }
 
   uint32_t hash = key_string->Hash();
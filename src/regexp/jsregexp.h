@@ -177,6 +177,15 @@ class RegExpImpl {
   static ByteArray* IrregexpByteCode(FixedArray* re, bool is_one_byte);
   static Code IrregexpNativeCode(FixedArray* re, bool is_one_byte);
 
+  // Returns true if the compiled code for the given encoding is Irregexp
+  // bytecode to be run in the interpreter (always the case in interpreted
+  // builds, and for not-yet-hot regexps with --regexp-tier-up).
+  static bool IrregexpHasBytecode(FixedArray* re, bool is_one_byte);
+  // Execution tick count used by --regexp-tier-up (see
+  // JSRegExp::kIrregexpTierUpTicksIndex).
+  static int IrregexpTierUpTicks(FixedArray* re);
+  static void IncrementIrregexpTierUpTicks(FixedArray* re);
+
   // Limit the space regexps take up on the heap.  In order to limit this we
   // would like to keep track of the amount of regexp code on the heap.  This
   // is not tracked, however.  As a conservative approximation we track the
@@ -1490,11 +1499,15 @@ struct RegExpCompileData {
         node(nullptr),
         simple(true),
         contains_anchor(false),
+        compile_to_bytecode(false),
         capture_count(0) {}
   RegExpTree* tree;
   RegExpNode* node;
   bool simple;
   bool contains_anchor;
+  // Generate Irregexp bytecode rather than native code. Ignored in
+  // interpreted builds, which always generate bytecode.
+  bool compile_to_bytecode;
   Handle<FixedArray> capture_name_map;
   Handle<String> error;
   int capture_count;
@@ -1527,7 +1540,11 @@ class RegExpEngine: public AllStatic {
 
 class RegExpResultsCache : public AllStatic {
  public:
-  enum ResultsCacheType { REGEXP_MULTIPLE_INDICES, STRING_SPLIT_SUBSTRINGS };
+  enum ResultsCacheType {
+    REGEXP_MULTIPLE_INDICES,
+    STRING_SPLIT_SUBSTRINGS,
+    REGEXP_REPLACE_PLAN
+  };
 
   // Attempt to retrieve a cached result.  On failure, 0 is returned as a Smi.
   // On success, the returned result is guaranteed to be a COW-array.
@@ -257,6 +257,7 @@ class RootVisitor;
   V(FixedArray*, single_character_string_cache, SingleCharacterStringCache)   \
   V(FixedArray*, string_split_cache, StringSplitCache)                        \
   V(FixedArray*, regexp_multiple_cache, RegExpMultipleCache)                  \
+  V(FixedArray*, regexp_replace_plan_cache, RegExpReplacePlanCache)           \
   /* Lists and dictionaries */                                                \
   V(MicrotaskQueue*, default_microtask_queue, DefaultMicrotaskQueue)          \
   /* Indirection lists for isolate-independent builtins */                    \
@@ -138,7 +138,7 @@ void RuntimeProfiler::AttemptOnStackReplacement(InterpretedFrame* frame,
       Min(level + loop_nesting_levels, AbstractCode::kMaxLoopNestingMarker));
 }
 
-void RuntimeProfiler::MaybeOptimize(JSFunction* function,
+bool RuntimeProfiler::MaybeOptimize(JSFunction* function,
                                     InterpretedFrame* frame) {
   if (function->IsInOptimizationQueue()) {
     if (FLAG_trace_opt_verbose) {
@@ -146,24 +146,26 @@ void RuntimeProfiler::MaybeOptimize(JSFunction* function,
       function->PrintName();
       PrintF(" is already in optimization queue]\n");
     }
-    return;
+    return false;
   }
 
   if (FLAG_always_osr) {
     AttemptOnStackReplacement(frame, AbstractCode::kMaxLoopNestingMarker);
     // Fall through and do a normal optimized compile as well.
   } else if (MaybeOSR(function, frame)) {
-    return;
+    return false;
   }
 
-  if (function->shared()->optimization_disabled()) return;
+  if (function->shared()->optimization_disabled()) return false;
 
   OptimizationReason reason =
       ShouldOptimize(function, function->shared()->GetBytecodeArray());
 
   if (reason != OptimizationReason::kDoNotOptimize) {
     Optimize(function, reason);
+    return true;
   }
+  return false;
 }
 
 bool RuntimeProfiler::MaybeOSR(JSFunction* function, InterpretedFrame* frame) {
@@ -231,25 +233,57 @@ void RuntimeProfiler::MarkCandidatesForOptimization() {
   // (eagerly or lazily).
   int frame_count = 0;
   int frame_count_limit = FLAG_frame_count;
+  // Set while the frame below the current one (i.e. its callee) was just
+  // marked for optimization and is small enough to be inlined, in which case
+  // the caller is credited an extra tick; see --tierup-caller-boost.
+  bool callee_just_marked_small = false;
   for (JavaScriptFrameIterator it(isolate_);
        frame_count++ < frame_count_limit && !it.done();
        it.Advance()) {
     JavaScriptFrame* frame = it.frame();
-    if (!frame->is_interpreted()) continue;
+    if (!frame->is_interpreted()) {
+      callee_just_marked_small = false;
+      continue;
+    }
 
     JSFunction* function = frame->function();
     DCHECK(function->shared()->is_compiled());
-    if (!function->shared()->IsInterpreted()) continue;
+    if (!function->shared()->IsInterpreted()) {
+      callee_just_marked_small = false;
+      continue;
+    }
 
-    if (!function->has_feedback_vector()) continue;
+    if (!function->has_feedback_vector()) {
+      callee_just_marked_small = false;
+      continue;
+    }
 
-    MaybeOptimize(function, InterpretedFrame::cast(frame));
+    bool just_marked = MaybeOptimize(function, InterpretedFrame::cast(frame));
+
+    int tick_increment = 1;
+    if (FLAG_tierup_caller_boost) {
+      if (callee_just_marked_small) {
+        // The function we are looking at calls a small function that just
+        // became hot. Optimizing the caller will typically inline the callee
+        // and subsume its optimized code, so help the caller get there
+        // sooner.
+        tick_increment = 2;
+        if (FLAG_trace_opt_verbose) {
+          PrintF("[boosting ticks of ");
+          function->PrintName();
+          PrintF(", caller of a small hot function]\n");
+        }
+      }
+      callee_just_marked_small =
+          just_marked && function->shared()->GetBytecodeArray()->length() <=
+                             kMaxBytecodeSizeForEarlyOpt;
+    }
 
     // TODO(leszeks): Move this increment to before the maybe optimize checks,
     // and update the tests to assume the increment has already happened.
     int ticks = function->feedback_vector()->profiler_ticks();
-    if (ticks < Smi::kMaxValue) {
-      function->feedback_vector()->set_profiler_ticks(ticks + 1);
+    if (ticks < Smi::kMaxValue - tick_increment) {
+      function->feedback_vector()->set_profiler_ticks(ticks + tick_increment);
     }
   }
   any_ic_changed_ = false;
@@ -28,7 +28,8 @@ class RuntimeProfiler {
                                  int nesting_levels = 1);
 
  private:
-  void MaybeOptimize(JSFunction* function, InterpretedFrame* frame);
+  // Returns whether {function} was marked for optimization.
+  bool MaybeOptimize(JSFunction* function, InterpretedFrame* frame);
   // Potentially attempts OSR from and returns whether no other
   // optimization attempts should be made.
   bool MaybeOSR(JSFunction* function, InterpretedFrame* frame);
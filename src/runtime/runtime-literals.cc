@@ -151,7 +151,14 @@ MaybeHandle<JSObject> JSObjectWalkVisitor<ContextObject>::StructureWalk(
     if (copy->elements()->length() == 0) return copy;
   }
 
-  // Deep copy own elements.
+  // Deep copy own elements. Inner literal objects must be copied, not
+  // shared: each evaluation of a literal is required to produce inner
+  // arrays and objects with fresh identity, so a nested boilerplate like
+  // [[1, 2], [3, 4]] can never share its inner JSArrays between
+  // instances, regardless of whether they are ever written to. The
+  // copy-on-write treatment is therefore confined to the leaf element
+  // stores (the COW FixedArray case below), which hold no JSObjects and
+  // carry no observable identity of their own.
   switch (copy->GetElementsKind()) {
     case PACKED_ELEMENTS:
     case HOLEY_ELEMENTS: {
@@ -18,6 +18,95 @@
 namespace v8 {
 namespace internal {
 
+namespace {
+
+// Tries to answer a named load from the property lookup cache, which maps
+// (receiver map, name) to a fast data property on a prototype holder. A hit
+// is only valid while the receiver's prototype chain validity cell is intact;
+// anything that could change the lookup result invalidates the cell.
+MaybeHandle<Object> TryGetCachedProperty(Isolate* isolate,
+                                         Handle<Object> object,
+                                         Handle<Object> key) {
+  if (!object->IsJSObject() || !key->IsUniqueName()) {
+    return MaybeHandle<Object>();
+  }
+  Handle<JSObject> receiver = Handle<JSObject>::cast(object);
+  JSObject* raw_holder;
+  Cell* validity_cell;
+  int descriptor = isolate->property_lookup_cache()->Lookup(
+      receiver->map(), Name::cast(*key), &raw_holder, &validity_cell);
+  if (descriptor == PropertyLookupCache::kAbsent) return MaybeHandle<Object>();
+  if (validity_cell->value() != Smi::FromInt(Map::kPrototypeChainValid)) {
+    return MaybeHandle<Object>();
+  }
+  Handle<JSObject> holder(raw_holder, isolate);
+  Map holder_map = holder->map();
+  DescriptorArray* descriptors = holder_map->instance_descriptors();
+  if (descriptors->GetKey(descriptor) != Name::cast(*key)) {
+    return MaybeHandle<Object>();
+  }
+  // The details may have been generalized in place since the entry was
+  // cached, so re-read them rather than caching them.
+  PropertyDetails details = descriptors->GetDetails(descriptor);
+  if (details.kind() != kData || details.location() != kField) {
+    return MaybeHandle<Object>();
+  }
+  FieldIndex index = FieldIndex::ForDescriptor(holder_map, descriptor);
+  return JSObject::FastPropertyAt(holder, details.representation(), index);
+}
+
+// Caches the result of a successful lookup when it resolved to a fast data
+// field on an ordinary prototype, so that the next megamorphic load with the
+// same receiver map can skip the chain walk. Own properties are not cached,
+// since objects sharing a map do not share property values.
+void UpdatePropertyLookupCache(Isolate* isolate, LookupIterator* it) {
+  if (it->state() != LookupIterator::DATA) return;
+  if (it->IsElement()) return;
+  Handle<Object> receiver_obj = it->GetReceiver();
+  if (!receiver_obj->IsJSObject()) return;
+  Handle<JSObject> receiver = Handle<JSObject>::cast(receiver_obj);
+  Handle<JSObject> holder = it->GetHolder<JSObject>();
+  if (*holder == *receiver) return;
+  // Entries are cleared before mark-compact but survive scavenges, so the
+  // holder must not be movable by a scavenge.
+  if (Heap::InNewSpace(*holder)) return;
+  if (!holder->HasFastProperties()) return;
+  PropertyDetails details = it->property_details();
+  if (details.kind() != kData || details.location() != kField) return;
+  // Every map between the receiver and the holder must be an ordinary,
+  // interceptor- and access-check-free fast-mode object, so that the
+  // validity cell is the only thing that can change the lookup result.
+  Handle<Map> map(receiver->map(), isolate);
+  Map current_map = *map;
+  while (true) {
+    if (current_map->IsSpecialReceiverMap() ||
+        current_map->is_access_check_needed() ||
+        current_map->has_named_interceptor() ||
+        current_map->is_dictionary_map()) {
+      return;
+    }
+    Object* prototype = current_map->prototype();
+    if (prototype == *holder) break;
+    if (!prototype->IsJSObject()) return;
+    current_map = JSObject::cast(prototype)->map();
+  }
+  Map holder_map = holder->map();
+  if (holder_map->IsSpecialReceiverMap() ||
+      holder_map->is_access_check_needed() ||
+      holder_map->has_named_interceptor()) {
+    return;
+  }
+  Handle<Object> validity_cell =
+      Map::GetOrCreatePrototypeChainValidityCell(map, isolate);
+  // A Smi means there is nothing to guard the chain with.
+  if (!validity_cell->IsCell()) return;
+  isolate->property_lookup_cache()->Update(
+      *map, *it->name(), *holder, Cell::cast(*validity_cell),
+      it->GetFieldDescriptorIndex());
+}
+
+}  // namespace
+
 MaybeHandle<Object> Runtime::GetObjectProperty(Isolate* isolate,
                                                Handle<Object> object,
                                                Handle<Object> key,
@@ -32,6 +121,12 @@ MaybeHandle<Object> Runtime::GetObjectProperty(Isolate* isolate,
         Object);
   }
 
+  Handle<Object> cached_result;
+  if (TryGetCachedProperty(isolate, object, key).ToHandle(&cached_result)) {
+    if (is_found_out) *is_found_out = true;
+    return cached_result;
+  }
+
   bool success = false;
   LookupIterator it =
       LookupIterator::PropertyOrElement(isolate, object, key, &success);
@@ -39,6 +134,9 @@ MaybeHandle<Object> Runtime::GetObjectProperty(Isolate* isolate,
 
   MaybeHandle<Object> result = Object::GetProperty(&it);
   if (is_found_out) *is_found_out = it.IsFound();
+  if (!result.is_null() && it.IsFound()) {
+    UpdatePropertyLookupCache(isolate, &it);
+  }
 
   if (!it.IsFound() && key->IsSymbol() &&
       Symbol::cast(*key)->is_private_name()) {
@@ -71,12 +71,20 @@ class CompiledReplacement {
 
   // Return whether the replacement is simple.
   bool Compile(Isolate* isolate, Handle<JSRegExp> regexp,
-               Handle<String> replacement, int capture_count,
-               int subject_length);
+               Handle<String> replacement, int capture_count);
 
   // Use Apply only if Compile returned false.
   void Apply(ReplacementStringBuilder* builder, int match_from, int match_to,
-             int32_t* match);
+             int32_t* match, int subject_length);
+
+  // The compiled plan depends only on the regexp and the replacement
+  // pattern, so it can be stored on the heap and reused when the same
+  // replace runs repeatedly (see RegExpResultsCache::REGEXP_REPLACE_PLAN).
+  // The plan array holds the part count, the (tag, data) pairs of all parts,
+  // and the replacement substrings. An empty part list means the replacement
+  // is simple.
+  Handle<FixedArray> ToFixedArray(Isolate* isolate);
+  void FromFixedArray(Isolate* isolate, Handle<FixedArray> plan);
 
   // Number of distinct parts of the replacement pattern.
   int parts() { return static_cast<int>(parts_.size()); }
@@ -102,8 +110,8 @@ class CompiledReplacement {
     static inline ReplacementPart SubjectPrefix() {
       return ReplacementPart(SUBJECT_PREFIX, 0);
     }
-    static inline ReplacementPart SubjectSuffix(int subject_length) {
-      return ReplacementPart(SUBJECT_SUFFIX, subject_length);
+    static inline ReplacementPart SubjectSuffix() {
+      return ReplacementPart(SUBJECT_SUFFIX, 0);
     }
     static inline ReplacementPart ReplacementString() {
       return ReplacementPart(REPLACEMENT_STRING, 0);
@@ -144,8 +152,8 @@ class CompiledReplacement {
   template <typename Char>
   bool ParseReplacementPattern(ZoneChunkList<ReplacementPart>* parts,
                                Vector<Char> characters,
-                               FixedArray* capture_name_map, int capture_count,
-                               int subject_length) {
+                               FixedArray* capture_name_map,
+                               int capture_count) {
     // Equivalent to String::GetSubstitution, except that this method converts
     // the replacement string into an internal representation that avoids
     // repeated parsing when used repeatedly.
@@ -184,7 +192,7 @@ class CompiledReplacement {
             if (i > last) {
               parts->push_back(ReplacementPart::ReplacementSubString(last, i));
             }
-            parts->push_back(ReplacementPart::SubjectSuffix(subject_length));
+            parts->push_back(ReplacementPart::SubjectSuffix());
             i = next_index;
             last = i + 1;
             break;
@@ -312,8 +320,8 @@ class CompiledReplacement {
 };
 
 bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
-                                  Handle<String> replacement, int capture_count,
-                                  int subject_length) {
+                                  Handle<String> replacement,
+                                  int capture_count) {
   {
     DisallowHeapAllocation no_gc;
     String::FlatContent content = replacement->GetFlatContent();
@@ -331,13 +339,11 @@ bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
     bool simple;
     if (content.IsOneByte()) {
       simple = ParseReplacementPattern(&parts_, content.ToOneByteVector(),
-                                       capture_name_map, capture_count,
-                                       subject_length);
+                                       capture_name_map, capture_count);
     } else {
       DCHECK(content.IsTwoByte());
       simple = ParseReplacementPattern(&parts_, content.ToUC16Vector(),
-                                       capture_name_map, capture_count,
-                                       subject_length);
+                                       capture_name_map, capture_count);
     }
     if (simple) return true;
   }
@@ -363,9 +369,44 @@ bool CompiledReplacement::Compile(Isolate* isolate, Handle<JSRegExp> regexp,
   return false;
 }
 
+Handle<FixedArray> CompiledReplacement::ToFixedArray(Isolate* isolate) {
+  int part_count = parts();
+  int substring_count = static_cast<int>(replacement_substrings_.size());
+  Handle<FixedArray> plan =
+      isolate->factory()->NewFixedArray(1 + 2 * part_count + substring_count);
+  plan->set(0, Smi::FromInt(part_count));
+  int index = 1;
+  for (ReplacementPart& part : parts_) {
+    plan->set(index++, Smi::FromInt(part.tag));
+    plan->set(index++, Smi::FromInt(part.data));
+  }
+  for (Handle<String> substring : replacement_substrings_) {
+    plan->set(index++, *substring);
+  }
+  DCHECK_EQ(index, plan->length());
+  return plan;
+}
+
+void CompiledReplacement::FromFixedArray(Isolate* isolate,
+                                         Handle<FixedArray> plan) {
+  DCHECK_EQ(0, parts());
+  int part_count = Smi::ToInt(plan->get(0));
+  int index = 1;
+  for (int i = 0; i < part_count; i++) {
+    int tag = Smi::ToInt(plan->get(index++));
+    int data = Smi::ToInt(plan->get(index++));
+    parts_.push_back(ReplacementPart(tag, data));
+  }
+  for (; index < plan->length(); index++) {
+    replacement_substrings_.push_back(
+        handle(String::cast(plan->get(index)), isolate));
+  }
+}
+
 
 void CompiledReplacement::Apply(ReplacementStringBuilder* builder,
-                                int match_from, int match_to, int32_t* match) {
+                                int match_from, int match_to, int32_t* match,
+                                int subject_length) {
   DCHECK_LT(0, parts_.size());
   for (ReplacementPart& part : parts_) {
     switch (part.tag) {
@@ -373,7 +414,6 @@ void CompiledReplacement::Apply(ReplacementStringBuilder* builder,
         if (match_from > 0) builder->AddSubjectSlice(0, match_from);
         break;
       case SUBJECT_SUFFIX: {
-        int subject_length = part.data;
         if (match_to < subject_length) {
           builder->AddSubjectSlice(match_to, subject_length);
         }
@@ -623,8 +663,30 @@ V8_WARN_UNUSED_RESULT static Object* StringReplaceGlobalRegExpWithString(
   // CompiledReplacement uses zone allocation.
   Zone zone(isolate->allocator(), ZONE_NAME);
   CompiledReplacement compiled_replacement(&zone);
-  const bool simple_replace = compiled_replacement.Compile(
-      isolate, regexp, replacement, capture_count, subject_length);
+  bool simple_replace;
+  // The compiled plan depends only on the regexp and the replacement
+  // pattern, so look it up in the results cache first to avoid re-parsing
+  // the pattern when the same replace runs repeatedly.
+  FixedArray* ignored_last_match = nullptr;
+  Object* maybe_cached_plan = RegExpResultsCache::Lookup(
+      isolate->heap(), *replacement, regexp->data(), &ignored_last_match,
+      RegExpResultsCache::REGEXP_REPLACE_PLAN);
+  if (maybe_cached_plan->IsFixedArray()) {
+    Handle<FixedArray> cached_plan(FixedArray::cast(maybe_cached_plan),
+                                   isolate);
+    simple_replace = Smi::ToInt(cached_plan->get(0)) == 0;
+    if (!simple_replace) {
+      compiled_replacement.FromFixedArray(isolate, cached_plan);
+    }
+  } else {
+    simple_replace = compiled_replacement.Compile(isolate, regexp, replacement,
+                                                  capture_count);
+    RegExpResultsCache::Enter(isolate, replacement,
+                              handle(regexp->data(), isolate),
+                              compiled_replacement.ToFixedArray(isolate),
+                              isolate->factory()->empty_fixed_array(),
+                              RegExpResultsCache::REGEXP_REPLACE_PLAN);
+  }
 
   // Shortcut for simple non-regexp global replacements
   if (typeTag == JSRegExp::ATOM && simple_replace) {
@@ -672,7 +734,8 @@ V8_WARN_UNUSED_RESULT static Object* StringReplaceGlobalRegExpWithString(
     if (simple_replace) {
       builder.AddString(replacement);
     } else {
-      compiled_replacement.Apply(&builder, start, end, current_match);
+      compiled_replacement.Apply(&builder, start, end, current_match,
+                                 subject_length);
     }
     prev = end;
 
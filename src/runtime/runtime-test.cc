@@ -15,6 +15,7 @@
 #include "src/compiler.h"
 #include "src/counters.h"
 #include "src/deoptimizer.h"
+#include "src/feedback-vector-inl.h"
 #include "src/frames-inl.h"
 #include "src/isolate-inl.h"
 #include "src/objects/heap-object-inl.h"
@@ -434,6 +435,48 @@ RUNTIME_FUNCTION(Runtime_GetDeoptCount) {
   return Smi::FromInt(function->feedback_vector()->deopt_count());
 }
 
+RUNTIME_FUNCTION(Runtime_GetFeedbackStateHistogram) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  // Returns the counts of the function's load, store and call IC slots per
+  // InlineCacheState, indexed by the InlineCacheState enum value. All counts
+  // are zero for functions that have not gathered feedback yet.
+  Handle<FixedArray> histogram = isolate->factory()->NewFixedArray(GENERIC + 1);
+  for (int i = 0; i <= GENERIC; i++) histogram->set(i, Smi::kZero);
+  if (function->has_feedback_vector()) {
+    Handle<FeedbackVector> vector(function->feedback_vector(), isolate);
+    FeedbackMetadataIterator iter(handle(vector->metadata(), isolate));
+    while (iter.HasNext()) {
+      FeedbackSlot slot = iter.Next();
+      switch (iter.kind()) {
+        case FeedbackSlotKind::kCall:
+        case FeedbackSlotKind::kLoadProperty:
+        case FeedbackSlotKind::kLoadGlobalInsideTypeof:
+        case FeedbackSlotKind::kLoadGlobalNotInsideTypeof:
+        case FeedbackSlotKind::kLoadKeyed:
+        case FeedbackSlotKind::kStoreNamedSloppy:
+        case FeedbackSlotKind::kStoreNamedStrict:
+        case FeedbackSlotKind::kStoreOwnNamed:
+        case FeedbackSlotKind::kStoreGlobalSloppy:
+        case FeedbackSlotKind::kStoreGlobalStrict:
+        case FeedbackSlotKind::kStoreKeyedSloppy:
+        case FeedbackSlotKind::kStoreKeyedStrict:
+        case FeedbackSlotKind::kStoreInArrayLiteral: {
+          FeedbackNexus nexus(vector, slot);
+          InlineCacheState state = nexus.ic_state();
+          int count = Smi::ToInt(histogram->get(state));
+          histogram->set(state, Smi::FromInt(count + 1));
+          break;
+        }
+        default:
+          break;
+      }
+    }
+  }
+  return *isolate->factory()->NewJSArrayWithElements(histogram);
+}
+
 static void ReturnThis(const v8::FunctionCallbackInfo<v8::Value>& args) {
   args.GetReturnValue().Set(args.This());
 }
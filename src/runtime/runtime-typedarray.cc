@@ -2,6 +2,9 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+#include <vector>
+
 #include "src/arguments-inl.h"
 #include "src/counters.h"
 #include "src/elements.h"
@@ -102,6 +105,93 @@ bool CompareNum(T x, T y) {
   return false;
 }
 
+// Maps an element value to an unsigned integer key of the same width whose
+// unsigned order matches the element order produced by CompareNum: signed
+// integers have their sign bit flipped, floating point values use the usual
+// bit-flip trick, which also orders -0.0 before +0.0. NaNs are moved out of
+// the way before sorting and must not be passed here.
+inline uint8_t RadixSortKey(uint8_t value) { return value; }
+inline uint16_t RadixSortKey(uint16_t value) { return value; }
+inline uint32_t RadixSortKey(uint32_t value) { return value; }
+inline uint64_t RadixSortKey(uint64_t value) { return value; }
+inline uint8_t RadixSortKey(int8_t value) {
+  return static_cast<uint8_t>(value) ^ uint8_t{0x80};
+}
+inline uint16_t RadixSortKey(int16_t value) {
+  return static_cast<uint16_t>(value) ^ uint16_t{0x8000};
+}
+inline uint32_t RadixSortKey(int32_t value) {
+  return static_cast<uint32_t>(value) ^ (uint32_t{1} << 31);
+}
+inline uint64_t RadixSortKey(int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t{1} << 63);
+}
+inline uint32_t RadixSortKey(float value) {
+  uint32_t bits = bit_cast<uint32_t>(value);
+  return bits & (uint32_t{1} << 31) ? ~bits : bits | (uint32_t{1} << 31);
+}
+inline uint64_t RadixSortKey(double value) {
+  uint64_t bits = bit_cast<uint64_t>(value);
+  return bits & (uint64_t{1} << 63) ? ~bits : bits | (uint64_t{1} << 63);
+}
+
+// Least-significant-digit radix sort, one byte per pass, ping-ponging between
+// the backing store and a scratch buffer. Runs in O(sizeof(key) * length)
+// independent of the value distribution, which beats std::sort well before
+// the length threshold below. Passes in which all keys share the same byte
+// (e.g. the upper bytes of small integers) are skipped.
+template <typename T>
+void RadixSort(T* data, size_t length) {
+  std::vector<T> scratch(length);
+  T* from = data;
+  T* to = scratch.data();
+  for (size_t byte = 0; byte < sizeof(RadixSortKey(T())); byte++) {
+    const int shift = static_cast<int>(byte) * 8;
+    size_t counts[257] = {0};
+    for (size_t i = 0; i < length; i++) {
+      counts[((RadixSortKey(from[i]) >> shift) & 0xFF) + 1]++;
+    }
+    bool single_bucket = false;
+    for (size_t bucket = 1; bucket <= 256; bucket++) {
+      if (counts[bucket] == length) single_bucket = true;
+      counts[bucket] += counts[bucket - 1];
+    }
+    if (single_bucket) continue;
+    for (size_t i = 0; i < length; i++) {
+      to[counts[(RadixSortKey(from[i]) >> shift) & 0xFF]++] = from[i];
+    }
+    std::swap(from, to);
+  }
+  if (from != data) std::copy(from, from + length, data);
+}
+
+// std::sort is in-place and has smaller constant factors; radix sort needs a
+// length-sized scratch buffer but sorts large arrays several times faster.
+const size_t kMinRadixSortLength = 1 << 14;
+
+template <typename T>
+void SortIntegerElements(T* data, size_t length) {
+  if (length < kMinRadixSortLength) {
+    std::sort(data, data + length);
+  } else {
+    RadixSort(data, length);
+  }
+}
+
+template <typename T>
+void SortFloatElements(T* data, size_t length) {
+  // Move all NaNs to the end of the array first; they compare greater than
+  // any number and their relative order is not observable.
+  T* nan_begin = std::partition(
+      data, data + length, [](T value) { return !std::isnan(value); });
+  size_t number_count = static_cast<size_t>(nan_begin - data);
+  if (number_count < kMinRadixSortLength) {
+    std::sort(data, nan_begin, CompareNum<T>);
+  } else {
+    RadixSort(data, number_count);
+  }
+}
+
 }  // namespace
 
 RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
@@ -130,9 +220,9 @@ RUNTIME_FUNCTION(Runtime_TypedArraySortFast) {
     ctype* data = static_cast<ctype*>(elements->DataPtr()); \
     if (kExternal##Type##Array == kExternalFloat64Array ||  \
         kExternal##Type##Array == kExternalFloat32Array)    \
-      std::sort(data, data + length, CompareNum<ctype>);    \
+      SortFloatElements(data, length);                      \
     else                                                    \
-      std::sort(data, data + length);                       \
+      SortIntegerElements(data, length);                    \
     break;                                                  \
   }
 
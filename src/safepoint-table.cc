@@ -74,12 +74,29 @@ SafepointEntry SafepointTable::FindEntry(Address pc) const {
   CHECK_GT(len, 0);
   // If pc == kMaxUInt32, then this entry covers all call sites in the function.
   if (len == 1 && GetPcOffset(0) == kMaxUInt32) return GetEntry(0);
-  for (unsigned i = 0; i < len; i++) {
-    // TODO(kasperl): Replace the linear search with binary search.
-    if (GetPcOffset(i) == pc_offset ||
-        (has_deopt_ &&
-         GetTrampolinePcOffset(i) == static_cast<int>(pc_offset))) {
-      return GetEntry(i);
+  // Entries are emitted in increasing pc order (DefineSafepoint is called as
+  // the assembler advances through the body), so the return pc can be found
+  // with a binary search.
+  unsigned lo = 0;
+  unsigned hi = len;
+  while (lo < hi) {
+    unsigned mid = lo + (hi - lo) / 2;
+    if (GetPcOffset(mid) < pc_offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < len && GetPcOffset(lo) == pc_offset) return GetEntry(lo);
+  // Trampoline pcs replace return pcs only on lazily deoptimized frames and
+  // are not sorted with respect to the table, so they need a linear scan.
+  // This path is only taken for frames that have been patched for lazy
+  // deoptimization, which is rare compared to GC stack scans.
+  if (has_deopt_) {
+    for (unsigned i = 0; i < len; i++) {
+      if (GetTrampolinePcOffset(i) == static_cast<int>(pc_offset)) {
+        return GetEntry(i);
+      }
     }
   }
   UNREACHABLE();
@@ -187,7 +204,15 @@ void SafepointTableBuilder::Emit(Assembler* assembler, int bits_per_entry) {
   assembler->dd(bytes_per_entry);
 
   // Emit sorted table of pc offsets together with deoptimization indexes.
+#ifdef DEBUG
+  // FindEntry relies on the pc offsets being sorted.
+  unsigned last_pc = 0;
+#endif
   for (const DeoptimizationInfo& info : deoptimization_info_) {
+#ifdef DEBUG
+    DCHECK_LE(last_pc, info.pc);
+    last_pc = info.pc;
+#endif
     assembler->dd(info.pc);
     assembler->dd(EncodeExceptPC(info));
     assembler->dd(info.trampoline);
@@ -16,6 +16,10 @@
 #include "src/version.h"
 #include "src/visitors.h"
 
+#ifdef V8_SNAPSHOT_COMPRESSION
+#include "third_party/zlib/zlib.h"
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -63,6 +67,8 @@ ScriptCompiler::CachedData* CodeSerializer::Serialize(
   Handle<String> source(String::cast(script->source()), isolate);
   CodeSerializer cs(isolate, SerializedCodeData::SourceHash(
                                  source, script->origin_options()));
+  // Cache payloads are roughly proportional to the source size.
+  cs.ReserveCapacity(source->length());
   DisallowHeapAllocation no_gc;
   cs.reference_map()->AddAttachedReference(*source);
   ScriptData* script_data = cs.SerializeSharedFunctionInfo(info);
@@ -340,9 +346,32 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   uint32_t stub_keys_size = num_stub_keys * kUInt32Size;
   uint32_t payload_offset = kHeaderSize + reservation_size + stub_keys_size;
   uint32_t padded_payload_offset = POINTER_SIZE_ALIGN(payload_offset);
-  uint32_t size =
-      padded_payload_offset + static_cast<uint32_t>(payload->size());
-  DCHECK(IsAligned(size, kPointerAlignment));
+
+  // Optionally compress the payload. The compressed bytes are only stored
+  // if that actually shrinks them; otherwise the payload stays raw and the
+  // compressed payload length in the header remains 0.
+  const byte* payload_data = payload->data();
+  uint32_t payload_length = static_cast<uint32_t>(payload->size());
+  uint32_t stored_payload_length = payload_length;
+  uint32_t compressed_payload_length = 0;
+#ifdef V8_SNAPSHOT_COMPRESSION
+  std::vector<byte> compressed_payload;
+  if (FLAG_compress_code_cache && payload_length > 0) {
+    uLongf compressed_size = compressBound(payload_length);
+    compressed_payload.resize(compressed_size);
+    if (compress2(compressed_payload.data(), &compressed_size, payload->data(),
+                  payload_length, Z_BEST_SPEED) == Z_OK &&
+        compressed_size < payload_length) {
+      payload_data = compressed_payload.data();
+      compressed_payload_length = static_cast<uint32_t>(compressed_size);
+      stored_payload_length = compressed_payload_length;
+    }
+  }
+#endif  // V8_SNAPSHOT_COMPRESSION
+
+  uint32_t size = padded_payload_offset + stored_payload_length;
+  DCHECK_IMPLIES(compressed_payload_length == 0,
+                 IsAligned(size, kPointerAlignment));
 
   // Allocate backing store and create result data.
   AllocateData(size);
@@ -360,7 +389,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
   SetHeaderValue(kNumReservationsOffset,
                  static_cast<uint32_t>(reservations.size()));
   SetHeaderValue(kNumCodeStubKeysOffset, num_stub_keys);
-  SetHeaderValue(kPayloadLengthOffset, static_cast<uint32_t>(payload->size()));
+  SetHeaderValue(kPayloadLengthOffset, payload_length);
+  SetHeaderValue(kCompressedPayloadLengthOffset, compressed_payload_length);
 
   // Zero out any padding in the header.
   memset(data_ + kUnalignedHeaderSize, 0, kHeaderSize - kUnalignedHeaderSize);
@@ -375,8 +405,8 @@ SerializedCodeData::SerializedCodeData(const std::vector<byte>* payload,
             reinterpret_cast<const byte*>(stub_keys->data()), stub_keys_size);
 
   // Copy serialized data.
-  CopyBytes(data_ + padded_payload_offset, payload->data(),
-            static_cast<size_t>(payload->size()));
+  CopyBytes(data_ + padded_payload_offset, payload_data,
+            static_cast<size_t>(stored_payload_length));
 
   Checksum checksum(ChecksummedContent());
   SetHeaderValue(kChecksumPartAOffset, checksum.a());
@@ -393,6 +423,8 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
   uint32_t cpu_features = GetHeaderValue(kCpuFeaturesOffset);
   uint32_t flags_hash = GetHeaderValue(kFlagHashOffset);
   uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
+  uint32_t compressed_payload_length =
+      GetHeaderValue(kCompressedPayloadLengthOffset);
   uint32_t c1 = GetHeaderValue(kChecksumPartAOffset);
   uint32_t c2 = GetHeaderValue(kChecksumPartBOffset);
   if (version_hash != Version::Hash()) return VERSION_MISMATCH;
@@ -406,11 +438,43 @@ SerializedCodeData::SanityCheckResult SerializedCodeData::SanityCheck(
       POINTER_SIZE_ALIGN(kHeaderSize +
                          GetHeaderValue(kNumReservationsOffset) * kInt32Size +
                          GetHeaderValue(kNumCodeStubKeysOffset) * kInt32Size);
-  if (payload_length > max_payload_length) return LENGTH_MISMATCH;
+  uint32_t stored_payload_length = compressed_payload_length != 0
+                                       ? compressed_payload_length
+                                       : payload_length;
+  if (stored_payload_length > max_payload_length) return LENGTH_MISMATCH;
+#ifndef V8_SNAPSHOT_COMPRESSION
+  if (compressed_payload_length != 0) return UNSUPPORTED_COMPRESSION;
+#endif
   if (!Checksum(ChecksummedContent()).Check(c1, c2)) return CHECKSUM_MISMATCH;
   return CHECK_SUCCESS;
 }
 
+SerializedCodeData SerializedCodeData::Decompress() const {
+#ifdef V8_SNAPSHOT_COMPRESSION
+  uint32_t payload_length = GetHeaderValue(kPayloadLengthOffset);
+  uint32_t compressed_payload_length =
+      GetHeaderValue(kCompressedPayloadLengthOffset);
+  DCHECK_NE(0, compressed_payload_length);
+  // Everything up to the payload (header, reservations, code stub keys and
+  // padding) is stored raw and is copied over verbatim.
+  uint32_t prefix_length = size_ - compressed_payload_length;
+  SerializedCodeData result(nullptr, 0);
+  result.AllocateData(prefix_length + payload_length);
+  CopyBytes(result.data_, data_, prefix_length);
+  uLongf uncompressed_length = payload_length;
+  CHECK_EQ(Z_OK, uncompress(result.data_ + prefix_length, &uncompressed_length,
+                            data_ + prefix_length, compressed_payload_length));
+  CHECK_EQ(payload_length, uncompressed_length);
+  // The copy stores its payload raw.
+  result.SetHeaderValue(kCompressedPayloadLengthOffset, 0);
+  return result;
+#else
+  // The sanity check rejects compressed payloads when compression support
+  // is not compiled in.
+  UNREACHABLE();
+#endif  // V8_SNAPSHOT_COMPRESSION
+}
+
 uint32_t SerializedCodeData::SourceHash(Handle<String> source,
                                         ScriptOriginOptions origin_options) {
   const uint32_t source_length = source->length();
@@ -473,6 +537,9 @@ SerializedCodeData SerializedCodeData::FromCachedData(
     cached_data->Reject();
     return SerializedCodeData(nullptr, 0);
   }
+  if (scd.GetHeaderValue(kCompressedPayloadLengthOffset) != 0) {
+    return scd.Decompress();
+  }
   return scd;
 }
 
@@ -48,10 +48,21 @@ class CodeSerializer : public Serializer {
 
   ScriptData* SerializeSharedFunctionInfo(Handle<SharedFunctionInfo> info);
 
+  // Runs on the main thread by necessity: the deserializer materializes
+  // objects directly on the isolate's heap, which cannot be touched from a
+  // worker thread. Embedders who cannot afford the main-thread cost of
+  // consuming a large cache blob should compile on a background thread via
+  // ScriptCompiler::StartStreamingScript instead of shipping cached data.
   V8_WARN_UNUSED_RESULT static MaybeHandle<SharedFunctionInfo> Deserialize(
       Isolate* isolate, ScriptData* cached_data, Handle<String> source,
       ScriptOriginOptions origin_options);
 
+  // Pre-sizes the sink for the expected payload size, so that regenerating
+  // a cache for a large script does not repeatedly regrow the buffer.
+  void ReserveCapacity(int expected_payload_size) {
+    sink_.Reserve(expected_payload_size);
+  }
+
   const std::vector<uint32_t>* stub_keys() const { return &stub_keys_; }
 
   uint32_t source_hash() const { return source_hash_; }
@@ -97,7 +108,8 @@ class SerializedCodeData : public SerializedData {
     FLAGS_MISMATCH = 5,
     CHECKSUM_MISMATCH = 6,
     INVALID_HEADER = 7,
-    LENGTH_MISMATCH = 8
+    LENGTH_MISMATCH = 8,
+    UNSUPPORTED_COMPRESSION = 9
   };
 
   // The data header consists of uint32_t-sized entries:
@@ -109,8 +121,9 @@ class SerializedCodeData : public SerializedData {
   // [5] number of reservation size entries
   // [6] number of code stub keys
   // [7] payload length
-  // [8] payload checksum part A
-  // [9] payload checksum part B
+  // [8] compressed payload length (0 if the payload is stored raw)
+  // [9] payload checksum part A
+  // [10] payload checksum part B
   // ...  reservations
   // ...  code stub keys
   // ...  serialized payload
@@ -123,8 +136,10 @@ class SerializedCodeData : public SerializedData {
       kNumReservationsOffset + kUInt32Size;
   static const uint32_t kPayloadLengthOffset =
       kNumCodeStubKeysOffset + kUInt32Size;
-  static const uint32_t kChecksumPartAOffset =
+  static const uint32_t kCompressedPayloadLengthOffset =
       kPayloadLengthOffset + kUInt32Size;
+  static const uint32_t kChecksumPartAOffset =
+      kCompressedPayloadLengthOffset + kUInt32Size;
   static const uint32_t kChecksumPartBOffset =
       kChecksumPartAOffset + kUInt32Size;
   static const uint32_t kUnalignedHeaderSize =
@@ -157,6 +172,11 @@ class SerializedCodeData : public SerializedData {
   SerializedCodeData(const byte* data, int size)
       : SerializedData(const_cast<byte*>(data), size) {}
 
+  // Returns an owning copy of this data with the payload stored raw again.
+  // Only called on data that passed the sanity check with a non-zero
+  // compressed payload length, which requires compression support.
+  SerializedCodeData Decompress() const;
+
   Vector<const byte> ChecksummedContent() const {
     return Vector<const byte>(data_ + kHeaderSize, size_ - kHeaderSize);
   }
@@ -4,6 +4,8 @@
 
 #include "src/snapshot/embedded-data.h"
 
+#include <fstream>
+
 #include "src/assembler-inl.h"
 #include "src/callable.h"
 #include "src/macro-assembler.h"
@@ -28,24 +30,30 @@ Code InstructionStream::TryLookupCode(Isolate* isolate, Address address) {
   if (!PcIsOffHeap(isolate, address)) return Code();
 
   EmbeddedData d = EmbeddedData::FromBlob();
-  if (address < d.InstructionStartOfBuiltin(0)) return Code();
+  if (address < d.InstructionStartOfBuiltin(d.LayoutOrderedBuiltin(0))) {
+    return Code();
+  }
 
   // Note: Addresses within the padding section between builtins (i.e. within
   // start + size <= address < start + padded_size) are interpreted as belonging
   // to the preceding builtin.
 
+  // Builtin instruction streams are not necessarily laid out in builtin id
+  // order, so binary-search through the layout order table, in which offsets
+  // are monotonically increasing.
   int l = 0, r = Builtins::builtin_count;
   while (l < r) {
     const int mid = (l + r) / 2;
-    Address start = d.InstructionStartOfBuiltin(mid);
-    Address end = start + d.PaddedInstructionSizeOfBuiltin(mid);
+    const int builtin_index = d.LayoutOrderedBuiltin(mid);
+    Address start = d.InstructionStartOfBuiltin(builtin_index);
+    Address end = start + d.PaddedInstructionSizeOfBuiltin(builtin_index);
 
     if (address < start) {
       r = mid;
     } else if (address >= end) {
       l = mid + 1;
     } else {
-      return isolate->builtins()->builtin(mid);
+      return isolate->builtins()->builtin(builtin_index);
     }
   }
 
@@ -171,18 +179,60 @@ void FinalizeEmbeddedCodeTargets(Isolate* isolate, EmbeddedData* blob) {
   }
 }
 
+// Returns the order in which builtin instruction streams are laid out in
+// the blob. By default this is builtin id order. With
+// --embedded-builtins-profile, builtins named in the profile (one name per
+// line, hottest first) come first, so that code hot during startup shares
+// as few pages as possible with cold code; the remaining builtins follow
+// in id order.
+std::vector<int> BuiltinLayoutOrder() {
+  std::vector<int> order;
+  order.reserve(Builtins::builtin_count);
+  std::vector<bool> placed(Builtins::builtin_count, false);
+  if (FLAG_embedded_builtins_profile != nullptr) {
+    std::ifstream profile(FLAG_embedded_builtins_profile);
+    CHECK_WITH_MSG(profile.good(),
+                   "Cannot read --embedded-builtins-profile file.");
+    std::string name;
+    while (std::getline(profile, name)) {
+      if (name.empty() || name[0] == '#') continue;
+      int builtin_id = -1;
+      for (int i = 0; i < Builtins::builtin_count; i++) {
+        if (name == Builtins::name(i)) {
+          builtin_id = i;
+          break;
+        }
+      }
+      if (builtin_id < 0) {
+        fprintf(stderr, "Ignoring unknown builtin '%s' in profile.\n",
+                name.c_str());
+        continue;
+      }
+      if (placed[builtin_id]) continue;
+      placed[builtin_id] = true;
+      order.push_back(builtin_id);
+    }
+  }
+  for (int i = 0; i < Builtins::builtin_count; i++) {
+    if (!placed[i]) order.push_back(i);
+  }
+  DCHECK_EQ(Builtins::builtin_count, static_cast<int>(order.size()));
+  return order;
+}
+
 }  // namespace
 
 // static
 EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   Builtins* builtins = isolate->builtins();
 
-  // Store instruction stream lengths and offsets.
+  // Store instruction stream lengths and offsets, laid out in layout order.
+  const std::vector<int> layout_order = BuiltinLayoutOrder();
   std::vector<struct Metadata> metadata(kTableSize);
 
   bool saw_unsafe_builtin = false;
   uint32_t raw_data_size = 0;
-  for (int i = 0; i < Builtins::builtin_count; i++) {
+  for (int i : layout_order) {
     Code code = builtins->builtin(i);
 
     if (Builtins::IsIsolateIndependent(i)) {
@@ -238,6 +288,12 @@ EmbeddedData EmbeddedData::FromIsolate(Isolate* isolate) {
   DCHECK_EQ(MetadataSize(), sizeof(metadata[0]) * metadata.size());
   std::memcpy(blob + MetadataOffset(), metadata.data(), MetadataSize());
 
+  // Write the layout order table.
+  std::vector<uint32_t> layout_table(layout_order.begin(), layout_order.end());
+  DCHECK_EQ(LayoutOrderSize(), sizeof(layout_table[0]) * layout_table.size());
+  std::memcpy(blob + LayoutOrderOffset(), layout_table.data(),
+              LayoutOrderSize());
+
   // Write the raw data section.
   for (int i = 0; i < Builtins::builtin_count; i++) {
     if (!Builtins::IsIsolateIndependent(i)) continue;
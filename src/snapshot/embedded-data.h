@@ -90,7 +90,12 @@ class EmbeddedData final {
   // [0] hash of the remaining blob
   // [1] metadata of instruction stream 0
   // ... metadata
+  // ... layout order table (builtin ids in physical blob order)
   // ... instruction streams
+  //
+  // Instruction streams are not necessarily laid out in builtin id order;
+  // with --embedded-builtins-profile, builtins hot during startup come
+  // first. The layout order table records the physical order.
 
   static constexpr uint32_t kTableSize = Builtins::builtin_count;
   static constexpr uint32_t HashOffset() { return 0; }
@@ -101,8 +106,22 @@ class EmbeddedData final {
   static constexpr uint32_t MetadataSize() {
     return sizeof(struct Metadata) * kTableSize;
   }
+  static constexpr uint32_t LayoutOrderOffset() {
+    return MetadataOffset() + MetadataSize();
+  }
+  static constexpr uint32_t LayoutOrderSize() {
+    return kUInt32Size * kTableSize;
+  }
   static constexpr uint32_t RawDataOffset() {
-    return PadAndAlign(MetadataOffset() + MetadataSize());
+    return PadAndAlign(LayoutOrderOffset() + LayoutOrderSize());
+  }
+
+  // Returns the id of the builtin whose instruction stream is at the given
+  // position in the blob's physical layout. Instruction stream offsets are
+  // monotonically increasing in this order.
+  int LayoutOrderedBuiltin(int position) const {
+    DCHECK(Builtins::IsBuiltinId(position));
+    return static_cast<int>(LayoutOrder()[position]);
   }
 
  private:
@@ -114,6 +133,9 @@ class EmbeddedData final {
   const Metadata* Metadata() const {
     return reinterpret_cast<const struct Metadata*>(data_ + MetadataOffset());
   }
+  const uint32_t* LayoutOrder() const {
+    return reinterpret_cast<const uint32_t*>(data_ + LayoutOrderOffset());
+  }
   const uint8_t* RawData() const { return data_ + RawDataOffset(); }
 
   static constexpr int PadAndAlign(int size) {
@@ -129,8 +129,8 @@ class EmbeddedFileWriter {
     i::SNPrintF(i::Vector<char>(embedded_blob_data_symbol),
                 "v8_%s_embedded_blob_data_", embedded_variant_);
 
-    w->Comment("The embedded blob starts here. Metadata comes first, followed");
-    w->Comment("by builtin instruction streams.");
+    w->Comment("The embedded blob starts here. Metadata and the layout order");
+    w->Comment("table come first, followed by builtin instruction streams.");
     w->SectionText();
     w->AlignToCodeAlignment();
     w->DeclareLabel(embedded_blob_data_symbol);
@@ -144,7 +144,10 @@ class EmbeddedFileWriter {
     const bool is_default_variant =
         std::strcmp(embedded_variant_, kDefaultEmbeddedVariant) == 0;
 
-    for (int i = 0; i < i::Builtins::builtin_count; i++) {
+    // Emit builtins in the order they are laid out in the blob; the emitted
+    // byte stream must match blob->data() exactly.
+    for (int position = 0; position < i::Builtins::builtin_count; position++) {
+      const int i = blob->LayoutOrderedBuiltin(position);
       if (!blob->ContainsBuiltin(i)) continue;
 
       char builtin_symbol[kTemporaryStringLength];
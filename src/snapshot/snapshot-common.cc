@@ -6,6 +6,8 @@
 
 #include "src/snapshot/snapshot.h"
 
+#include <atomic>
+
 #include "src/base/platform/platform.h"
 #include "src/snapshot/partial-deserializer.h"
 #include "src/snapshot/startup-deserializer.h"
@@ -36,7 +38,17 @@ bool Snapshot::Initialize(Isolate* isolate) {
 
   const v8::StartupData* blob = isolate->snapshot_blob();
   CheckVersion(blob);
-  CHECK(VerifyChecksum(blob));
+
+  // All isolates in a process are almost always created from the same
+  // immutable blob. Remember the last blob whose checksum was verified so
+  // that only the first isolate pays for scanning the whole blob on the
+  // sequential startup path. Verification is idempotent, so a race between
+  // two threads verifying the same blob concurrently is harmless.
+  static std::atomic<const char*> last_verified_blob_data{nullptr};
+  if (last_verified_blob_data.load(std::memory_order_relaxed) != blob->data) {
+    CHECK(VerifyChecksum(blob));
+    last_verified_blob_data.store(blob->data, std::memory_order_relaxed);
+  }
   Vector<const byte> startup_data = ExtractStartupData(blob);
   SnapshotData startup_snapshot_data(startup_data);
   Vector<const byte> read_only_data = ExtractReadOnlyData(blob);
@@ -97,6 +97,10 @@ class SnapshotByteSink {
   void PutInt(uintptr_t integer, const char* description);
   void PutRaw(const byte* data, int number_of_bytes, const char* description);
 
+  // Pre-sizes the backing store for callers that can estimate how much data
+  // they are about to put, to avoid repeated regrowth.
+  void Reserve(int bytes) { data_.reserve(data_.size() + bytes); }
+
   void Append(const SnapshotByteSink& other);
   int Position() const { return static_cast<int>(data_.size()); }
 
@@ -23,6 +23,21 @@ namespace internal {
 // - we just stuff one bit for the type into the code offset,
 // - we write least-significant bits first,
 // - we use zig-zag encoding to encode both positive and negative numbers.
+//
+// Since the stream is delta-encoded, random access requires decoding from
+// the start. To bound the cost of lookups by code offset, a checkpoint
+// index is appended after the stream: every kCheckpointInterval-th entry is
+// recorded in absolute form together with the stream position following it,
+// so a lookup can binary search the checkpoints and decode linearly from
+// the closest one. A non-empty table has the layout
+//   [int32: index offset][delta-encoded stream][checkpoint records]
+// where the index offset is the byte position of the first checkpoint
+// record (equal to the table length if there are no checkpoints), and each
+// checkpoint record is
+//   [int32: code offset, sign bit encodes is_statement]
+//   [int32: stream position of the next entry]
+//   [int64: source position]
+// with all fixed-size values stored in little-endian byte order.
 
 namespace {
 
@@ -30,6 +45,10 @@ namespace {
 class MoreBit : public BitField8<bool, 7, 1> {};
 class ValueBits : public BitField8<unsigned, 0, 7> {};
 
+const int kHeaderSize = kInt32Size;
+const int kCheckpointInterval = 128;
+const int kCheckpointSize = 2 * kInt32Size + kInt64Size;
+
 // Helper: Add the offsets from 'other' to 'value'. Also set is_statement.
 void AddAndSetEntry(PositionTableEntry& value,
                     const PositionTableEntry& other) {
@@ -106,6 +125,55 @@ void DecodeEntry(Vector<const byte> bytes, int* index,
   entry->source_position = DecodeInt<int64_t>(bytes, index);
 }
 
+// Helper: Encode an integer as a fixed-size little-endian value.
+template <typename T>
+void EncodeFixed(std::vector<byte>& bytes, T value) {
+  auto encoded = static_cast<typename std::make_unsigned<T>::type>(value);
+  for (size_t i = 0; i < sizeof(T); i++) {
+    bytes.push_back(static_cast<byte>(encoded & 0xFF));
+    encoded >>= kBitsPerByte;
+  }
+}
+
+// Helper: Decode a fixed-size little-endian integer.
+template <typename T>
+T DecodeFixed(Vector<const byte> bytes, int index) {
+  typename std::make_unsigned<T>::type decoded = 0;
+  for (int i = 0; i < static_cast<int>(sizeof(T)); i++) {
+    decoded |= static_cast<decltype(decoded)>(bytes[index + i])
+               << (i * kBitsPerByte);
+  }
+  return static_cast<T>(decoded);
+}
+
+// Encode a checkpoint record for {entry}, which the stream decodes to at
+// stream position {stream_position}.
+void EncodeCheckpoint(std::vector<byte>& bytes, const PositionTableEntry& entry,
+                      int stream_position) {
+  DCHECK_GE(entry.code_offset, 0);
+  EncodeFixed<int32_t>(
+      bytes, entry.is_statement ? entry.code_offset : -entry.code_offset - 1);
+  EncodeFixed<int32_t>(bytes, stream_position);
+  EncodeFixed<int64_t>(bytes, entry.source_position);
+}
+
+// Decode the {index}-th checkpoint record of a table whose checkpoint index
+// starts at {index_offset}.
+void DecodeCheckpoint(Vector<const byte> bytes, int index_offset, int index,
+                      PositionTableEntry* entry, int* stream_position) {
+  int base = index_offset + index * kCheckpointSize;
+  int tmp = DecodeFixed<int32_t>(bytes, base);
+  if (tmp >= 0) {
+    entry->is_statement = true;
+    entry->code_offset = tmp;
+  } else {
+    entry->is_statement = false;
+    entry->code_offset = -(tmp + 1);
+  }
+  *stream_position = DecodeFixed<int32_t>(bytes, base + kInt32Size);
+  entry->source_position = DecodeFixed<int64_t>(bytes, base + 2 * kInt32Size);
+}
+
 Vector<const byte> VectorFromByteArray(ByteArray* byte_array) {
   return Vector<const byte>(byte_array->GetDataStartAddress(),
                             byte_array->length());
@@ -147,19 +215,41 @@ void SourcePositionTableBuilder::AddEntry(const PositionTableEntry& entry) {
   SubtractFromEntry(tmp, previous_);
   EncodeEntry(bytes_, tmp);
   previous_ = entry;
+  if (++entry_count_ % kCheckpointInterval == 0) {
+    // Record the absolute entry together with the stream position of the
+    // entry following it, so a lookup can resume decoding from here.
+    checkpoints_.push_back({entry, static_cast<int>(bytes_.size())});
+  }
 #ifdef ENABLE_SLOW_DCHECKS
   raw_entries_.push_back(entry);
 #endif
 }
 
+std::vector<byte> SourcePositionTableBuilder::PackTable() const {
+  std::vector<byte> packed;
+  packed.reserve(kHeaderSize + bytes_.size() +
+                 checkpoints_.size() * kCheckpointSize);
+  EncodeFixed<int32_t>(packed,
+                       kHeaderSize + static_cast<int>(bytes_.size()));
+  packed.insert(packed.end(), bytes_.begin(), bytes_.end());
+  for (const Checkpoint& checkpoint : checkpoints_) {
+    // Stream positions were recorded relative to the stream; the header
+    // shifts them in the packed table.
+    EncodeCheckpoint(packed, checkpoint.entry,
+                     kHeaderSize + checkpoint.stream_position);
+  }
+  return packed;
+}
+
 Handle<ByteArray> SourcePositionTableBuilder::ToSourcePositionTable(
     Isolate* isolate) {
   if (bytes_.empty()) return isolate->factory()->empty_byte_array();
   DCHECK(!Omit());
 
+  std::vector<byte> packed = PackTable();
   Handle<ByteArray> table = isolate->factory()->NewByteArray(
-      static_cast<int>(bytes_.size()), TENURED);
-  MemCopy(table->GetDataStartAddress(), bytes_.data(), bytes_.size());
+      static_cast<int>(packed.size()), TENURED);
+  MemCopy(table->GetDataStartAddress(), packed.data(), packed.size());
 
 #ifdef ENABLE_SLOW_DCHECKS
   // Brute force testing: Record all positions and decode
@@ -176,7 +266,7 @@ OwnedVector<byte> SourcePositionTableBuilder::ToSourcePositionTableVector() {
   if (bytes_.empty()) return OwnedVector<byte>();
   DCHECK(!Omit());
 
-  OwnedVector<byte> table = OwnedVector<byte>::Of(bytes_);
+  OwnedVector<byte> table = OwnedVector<byte>::Of(PackTable());
 
 #ifdef ENABLE_SLOW_DCHECKS
   // Brute force testing: Record all positions and decode
@@ -191,13 +281,13 @@ OwnedVector<byte> SourcePositionTableBuilder::ToSourcePositionTableVector() {
 
 SourcePositionTableIterator::SourcePositionTableIterator(ByteArray* byte_array)
     : raw_table_(VectorFromByteArray(byte_array)) {
-  Advance();
+  Initialize();
 }
 
 SourcePositionTableIterator::SourcePositionTableIterator(
     Handle<ByteArray> byte_array)
     : table_(byte_array) {
-  Advance();
+  Initialize();
 #ifdef DEBUG
   // We can enable allocation because we keep the table in a handle.
   no_gc.Release();
@@ -207,19 +297,68 @@ SourcePositionTableIterator::SourcePositionTableIterator(
 SourcePositionTableIterator::SourcePositionTableIterator(
     Vector<const byte> bytes)
     : raw_table_(bytes) {
-  Advance();
+  Initialize();
 #ifdef DEBUG
   // We can enable allocation because the underlying vector does not move.
   no_gc.Release();
 #endif  // DEBUG
 }
 
+void SourcePositionTableIterator::Initialize() {
+  Vector<const byte> bytes =
+      table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
+  if (bytes.length() == 0) {
+    index_offset_ = 0;
+  } else {
+    index_offset_ = DecodeFixed<int32_t>(bytes, 0);
+    DCHECK_GE(index_offset_, kHeaderSize);
+    DCHECK_LE(index_offset_, bytes.length());
+    DCHECK_EQ(0, (bytes.length() - index_offset_) % kCheckpointSize);
+    index_ = kHeaderSize;
+  }
+  Advance();
+}
+
+void SourcePositionTableIterator::SeekForward(int code_offset) {
+  if (done()) return;
+  Vector<const byte> bytes =
+      table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
+  int checkpoint_count = (bytes.length() - index_offset_) / kCheckpointSize;
+  if (checkpoint_count == 0) return;
+
+  // Binary search for the last checkpoint at or before {code_offset}; the
+  // checkpoint code offsets are ascending because the stream only accepts
+  // ascending code offsets.
+  PositionTableEntry entry;
+  int stream_position;
+  int left = -1;
+  int right = checkpoint_count;
+  while (right - left > 1) {
+    int mid = left + (right - left) / 2;
+    DecodeCheckpoint(bytes, index_offset_, mid, &entry, &stream_position);
+    if (entry.code_offset <= code_offset) {
+      left = mid;
+    } else {
+      right = mid;
+    }
+  }
+  if (left < 0) return;
+
+  DecodeCheckpoint(bytes, index_offset_, left, &entry, &stream_position);
+  DCHECK_LE(entry.code_offset, code_offset);
+  // Only ever move forwards; the caller may have advanced past this
+  // checkpoint already.
+  if (stream_position <= index_) return;
+  current_ = entry;
+  index_ = stream_position;
+}
+
 void SourcePositionTableIterator::Advance() {
   Vector<const byte> bytes =
       table_.is_null() ? raw_table_ : VectorFromByteArray(*table_);
   DCHECK(!done());
-  DCHECK(index_ >= 0 && index_ <= bytes.length());
-  if (index_ >= bytes.length()) {
+  DCHECK(index_ >= 0 && index_ <= index_offset_);
+  if (index_ >= index_offset_) {
     index_ = kDone;
   } else {
     PositionTableEntry tmp;
@@ -45,12 +45,22 @@ class V8_EXPORT_PRIVATE SourcePositionTableBuilder {
   OwnedVector<byte> ToSourcePositionTableVector();
 
  private:
+  // A checkpoint for seeking into the delta-encoded stream: the absolute
+  // values of an entry, plus the stream position of the entry after it.
+  struct Checkpoint {
+    PositionTableEntry entry;
+    int stream_position;
+  };
+
   void AddEntry(const PositionTableEntry& entry);
+  std::vector<byte> PackTable() const;
 
   inline bool Omit() const { return mode_ == OMIT_SOURCE_POSITIONS; }
 
   RecordingMode mode_;
   std::vector<byte> bytes_;
+  std::vector<Checkpoint> checkpoints_;
+  int entry_count_ = 0;
 #ifdef ENABLE_SLOW_DCHECKS
   std::vector<PositionTableEntry> raw_entries_;
 #endif
@@ -83,6 +93,13 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
 
   void Advance();
 
+  // Skips forward to the last checkpointed entry whose code offset is less
+  // than or equal to {code_offset}, using the binary-searchable checkpoint
+  // index appended to the table. Entries in between are skipped, so this is
+  // only useful when searching for the last entry with a code offset less
+  // than or equal to {code_offset}. Never moves backwards.
+  void SeekForward(int code_offset);
+
   int code_offset() const {
     DCHECK(!done());
     return current_.code_offset;
@@ -107,9 +124,12 @@ class V8_EXPORT_PRIVATE SourcePositionTableIterator {
  private:
   static const int kDone = -1;
 
+  void Initialize();
+
   Vector<const byte> raw_table_;
   Handle<ByteArray> table_;
   int index_ = 0;
+  int index_offset_ = 0;  // Byte position where the checkpoint index starts.
   PositionTableEntry current_;
   DISALLOW_HEAP_ALLOCATION(no_gc);
 };
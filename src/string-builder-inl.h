@@ -116,6 +116,22 @@ class IncrementalStringBuilder {
  public:
   explicit IncrementalStringBuilder(Isolate* isolate);
 
+  // In streaming mode, finished parts are handed to this callback instead of
+  // being accumulated into the result string.
+  typedef void (*PartCallback)(Handle<String> part, void* data);
+
+  // Switches the builder to streaming mode. Finish() then returns the empty
+  // string, and the total output is not limited by String::kMaxLength. The
+  // callback must not retain the part handle beyond the call: once the part
+  // has reached its maximum size, its backing store is reused for subsequent
+  // chunks.
+  void EnableStreaming(PartCallback callback, void* data) {
+    DCHECK_NULL(part_callback_);
+    DCHECK_NOT_NULL(callback);
+    part_callback_ = callback;
+    part_callback_data_ = data;
+  }
+
   V8_INLINE String::Encoding CurrentEncoding() { return encoding_; }
 
   template <typename SrcChar, typename DestChar>
@@ -276,12 +292,17 @@ class IncrementalStringBuilder {
   static const int kInitialPartLength = 32;
   static const int kMaxPartLength = 16 * 1024;
   static const int kPartLengthGrowthFactor = 2;
+  // Appended strings up to this length are copied into the current part
+  // instead of being recorded as separate cons-string segments.
+  static const int kMaxInlineCopyLength = 32;
 
   Isolate* isolate_;
   String::Encoding encoding_;
   bool overflowed_;
   int part_length_;
   int current_index_;
+  PartCallback part_callback_ = nullptr;
+  void* part_callback_data_ = nullptr;
   Handle<String> accumulator_;
   Handle<String> current_part_;
 };
@@ -247,6 +247,12 @@ int IncrementalStringBuilder::Length() const {
 }
 
 void IncrementalStringBuilder::Accumulate(Handle<String> new_part) {
+  if (part_callback_ != nullptr) {
+    // Streaming mode: hand the part to the callback instead of growing the
+    // accumulator. There is no overall length limit in this mode.
+    if (new_part->length() > 0) part_callback_(new_part, part_callback_data_);
+    return;
+  }
   Handle<String> new_accumulator;
   if (accumulator()->length() + new_part->length() > String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
@@ -265,6 +271,14 @@ void IncrementalStringBuilder::Extend() {
   Accumulate(current_part());
   if (part_length_ <= kMaxPartLength / kPartLengthGrowthFactor) {
     part_length_ *= kPartLengthGrowthFactor;
+  } else if (part_callback_ != nullptr &&
+             current_part()->length() == part_length_) {
+    // Streaming mode with a full-size part: the callback has consumed the
+    // chunk and may not retain it, so the backing store can be reused for
+    // the next chunk instead of allocating a fresh one. Truncated parts
+    // (AppendString, ChangeEncoding, Finish) still allocate below.
+    current_index_ = 0;
+    return;
   }
   Handle<String> new_part;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
@@ -289,6 +303,30 @@ MaybeHandle<String> IncrementalStringBuilder::Finish() {
 
 
 void IncrementalStringBuilder::AppendString(Handle<String> string) {
+  const int length = string->length();
+  // Very short strings are cheaper to copy into the current part than to
+  // record as separate segments: their bytes are touched again when the
+  // result is flattened anyway, whereas a segment costs a ConsString
+  // allocation plus a pointer chase per flattening step.
+  if (length <= kMaxInlineCopyLength && CurrentPartCanFit(length) &&
+      (encoding_ == String::TWO_BYTE_ENCODING ||
+       string->IsOneByteRepresentation())) {
+    DisallowHeapAllocation no_gc;
+    if (encoding_ == String::ONE_BYTE_ENCODING) {
+      String::WriteToFlat(
+          *string,
+          SeqOneByteString::cast(*current_part_)->GetChars() + current_index_,
+          0, length);
+    } else {
+      String::WriteToFlat(
+          *string,
+          SeqTwoByteString::cast(*current_part_)->GetChars() + current_index_,
+          0, length);
+    }
+    current_index_ += length;
+    DCHECK_LT(current_index_, part_length_);
+    return;
+  }
   ShrinkCurrentPart();
   part_length_ = kInitialPartLength;  // Allocate conservatively.
   Extend();  // Attach current part and allocate new part.
@@ -4,6 +4,12 @@
 
 #include "src/string-case.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+
 #include "src/assert-scope.h"
 #include "src/base/logging.h"
 #include "src/globals.h"
@@ -69,6 +75,62 @@ int FastAsciiConvert(char* dst, const char* src, int length,
   bool changed = false;
   const char* const limit = src + length;
 
+  // Process 16 bytes at a time where SIMD is available. Unlike the word loops
+  // below this needs no alignment, so it also covers inputs whose source is
+  // not word-aligned. As in the word loops, a chunk containing a non-ASCII
+  // byte makes the function return how far it got, at chunk granularity.
+#if defined(__SSE2__)
+  {
+    const __m128i lo_v = _mm_set1_epi8(lo);
+    const __m128i hi_v = _mm_set1_epi8(hi);
+    const __m128i case_bit = _mm_set1_epi8(1 << 5);
+    __m128i changed_bits = _mm_setzero_si128();
+    while (src <= limit - 16) {
+      const __m128i chunk =
+          _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+      if (_mm_movemask_epi8(chunk) != 0) {
+        // Contains a non-ASCII byte.
+        return static_cast<int>(src - saved_src);
+      }
+      // All bytes are ASCII, so the signed comparisons classify correctly.
+      const __m128i in_range = _mm_and_si128(_mm_cmpgt_epi8(chunk, lo_v),
+                                             _mm_cmplt_epi8(chunk, hi_v));
+      const __m128i to_flip = _mm_and_si128(in_range, case_bit);
+      changed_bits = _mm_or_si128(changed_bits, to_flip);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                       _mm_xor_si128(chunk, to_flip));
+      src += 16;
+      dst += 16;
+    }
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(changed_bits,
+                                         _mm_setzero_si128())) != 0xFFFF) {
+      changed = true;
+    }
+  }
+#elif defined(__aarch64__)
+  {
+    const uint8x16_t lo_v = vdupq_n_u8(lo + 1);
+    const uint8x16_t hi_v = vdupq_n_u8(hi - 1);
+    const uint8x16_t case_bit = vdupq_n_u8(1 << 5);
+    uint8x16_t changed_bits = vdupq_n_u8(0);
+    while (src <= limit - 16) {
+      const uint8x16_t chunk = vld1q_u8(reinterpret_cast<const uint8_t*>(src));
+      if (vmaxvq_u8(chunk) > 0x7F) {
+        // Contains a non-ASCII byte.
+        return static_cast<int>(src - saved_src);
+      }
+      const uint8x16_t in_range =
+          vandq_u8(vcgeq_u8(chunk, lo_v), vcleq_u8(chunk, hi_v));
+      const uint8x16_t to_flip = vandq_u8(in_range, case_bit);
+      changed_bits = vorrq_u8(changed_bits, to_flip);
+      vst1q_u8(reinterpret_cast<uint8_t*>(dst), veorq_u8(chunk, to_flip));
+      src += 16;
+      dst += 16;
+    }
+    if (vmaxvq_u8(changed_bits) != 0) changed = true;
+  }
+#endif
+
   // dst is newly allocated and always aligned.
   DCHECK(IsAligned(reinterpret_cast<intptr_t>(dst), sizeof(uintptr_t)));
   // Only attempt processing one word at a time if src is also aligned.
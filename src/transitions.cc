@@ -57,6 +57,9 @@ bool TransitionsAccessor::HasSimpleTransitionTo(Map map) {
 void TransitionsAccessor::Insert(Handle<Name> name, Handle<Map> target,
                                  SimpleTransitionFlag flag) {
   DCHECK(!map_handle_.is_null());
+  // An insertion may overwrite the target of an existing transition with the
+  // same key, so conservatively drop all cached lookups.
+  isolate_->transition_lookup_cache()->Clear();
   target->SetBackPointer(map_);
 
   // If the map doesn't have any transitions at all yet, install the new one.
@@ -219,9 +222,14 @@ Map TransitionsAccessor::SearchTransition(Name* name, PropertyKind kind,
       return map;
     }
     case kFullTransitionArray: {
+      TransitionLookupCache* cache = isolate_->transition_lookup_cache();
+      Map cached_target = cache->Lookup(map_, name, kind, attributes);
+      if (!cached_target.is_null()) return cached_target;
       int transition = transitions()->Search(kind, name, attributes);
       if (transition == kNotFound) return Map();
-      return transitions()->GetTarget(transition);
+      Map target = transitions()->GetTarget(transition);
+      cache->Update(map_, name, kind, attributes, target);
+      return target;
     }
   }
   UNREACHABLE();
@@ -240,7 +248,8 @@ bool TransitionsAccessor::IsSpecialTransition(ReadOnlyRoots roots, Name* name) {
   return name == roots.nonextensible_symbol() ||
          name == roots.sealed_symbol() || name == roots.frozen_symbol() ||
          name == roots.elements_transition_symbol() ||
-         name == roots.strict_function_transition_symbol();
+         name == roots.strict_function_transition_symbol() ||
+         name == roots.clone_object_transition_symbol();
 }
 
 MaybeHandle<Map> TransitionsAccessor::FindTransitionToDataProperty(
@@ -448,6 +457,7 @@ void TransitionArray::Zap(Isolate* isolate) {
 }
 
 void TransitionsAccessor::ReplaceTransitions(MaybeObject new_transitions) {
+  isolate_->transition_lookup_cache()->Clear();
   if (encoding() == kFullTransitionArray) {
     TransitionArray* old_transitions = transitions();
 #if DEBUG
@@ -170,11 +170,54 @@ bool IntoOneAndTwoByte(Handle<String> uri, bool is_uri,
   return true;
 }
 
+// Returns whether the string contains a '%'. One-byte strings are scanned a
+// machine word at a time; decoding inputs without any escape sequence is the
+// identity, so this check gates the common case.
+bool ContainsPercent(String::FlatContent* uri_content, int uri_length) {
+  if (uri_content->IsOneByte()) {
+    const uint8_t* data = uri_content->ToOneByteVector().start();
+    int i = 0;
+    // Word-wise scan using the usual zero-byte detection trick on the
+    // XOR with a word of '%' bytes.
+    const uintptr_t kOnes = ~static_cast<uintptr_t>(0) / 0xFF;
+    const uintptr_t kHighBits = kOnes << 7;
+    const uintptr_t kPercents = kOnes * '%';
+    const int kWordSize = static_cast<int>(sizeof(uintptr_t));
+    while (i < uri_length &&
+           !IsAligned(reinterpret_cast<Address>(data + i), kWordSize)) {
+      if (data[i++] == '%') return true;
+    }
+    for (; i + kWordSize <= uri_length; i += kWordSize) {
+      uintptr_t word =
+          *reinterpret_cast<const uintptr_t*>(data + i) ^ kPercents;
+      if ((word - kOnes) & ~word & kHighBits) return true;
+    }
+    for (; i < uri_length; i++) {
+      if (data[i] == '%') return true;
+    }
+    return false;
+  }
+  Vector<const uc16> chars = uri_content->ToUC16Vector();
+  for (int i = 0; i < uri_length; i++) {
+    if (chars[i] == '%') return true;
+  }
+  return false;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Decode(Isolate* isolate, Handle<String> uri,
                                 bool is_uri) {
   uri = String::Flatten(isolate, uri);
+
+  {
+    DisallowHeapAllocation no_gc;
+    String::FlatContent uri_content = uri->GetFlatContent();
+    // Without escape sequences decoding is the identity, which is the
+    // common case for query strings.
+    if (!ContainsPercent(&uri_content, uri->length())) return uri;
+  }
+
   std::vector<uint8_t> one_byte_buffer;
   std::vector<uc16> two_byte_buffer;
 
@@ -268,6 +311,37 @@ void EncodePair(uc16 cc1, uc16 cc2, std::vector<uint8_t>* buffer) {
   }
 }
 
+// Bit tables of the ASCII characters that encoding leaves unchanged, one bit
+// per character: IsUnescapePredicateInUriComponent for encodeURIComponent,
+// additionally IsUriSeparator for encodeURI.
+const uint32_t kUriComponentUnescapedMask[4] = {0x00000000, 0x03FF6782,
+                                                0x87FFFFFE, 0x47FFFFFE};
+const uint32_t kUriUnescapedMask[4] = {0x00000000, 0xAFFFFFDA, 0x87FFFFFF,
+                                       0x47FFFFFE};
+
+inline bool IsInAsciiBitTable(const uint32_t (&mask)[4], uc16 c) {
+  DCHECK_LT(c, 0x80);
+  return (mask[c >> 5] >> (c & 31)) & 1;
+}
+
+// Returns the length of the prefix that encoding passes through unchanged.
+// Encoding a typical URI component changes little or nothing, so the main
+// loop below with its per-character branching only runs on the rest.
+int UnescapedPrefixLength(String::FlatContent* uri_content, int uri_length,
+                          bool is_uri) {
+  const uint32_t(&mask)[4] =
+      is_uri ? kUriUnescapedMask : kUriComponentUnescapedMask;
+  int k = 0;
+  while (k < uri_length) {
+    uc16 c = uri_content->Get(k);
+    if (c >= 0x80 || !IsInAsciiBitTable(mask, c)) break;
+    DCHECK(IsUnescapePredicateInUriComponent(c) ||
+           (is_uri && IsUriSeparator(c)));
+    k++;
+  }
+  return k;
+}
+
 }  // anonymous namespace
 
 MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
@@ -281,7 +355,13 @@ MaybeHandle<String> Uri::Encode(Isolate* isolate, Handle<String> uri,
     DisallowHeapAllocation no_gc;
     String::FlatContent uri_content = uri->GetFlatContent();
 
-    for (int k = 0; k < uri_length; k++) {
+    int prefix_length = UnescapedPrefixLength(&uri_content, uri_length, is_uri);
+    if (prefix_length == uri_length) return uri;
+    for (int k = 0; k < prefix_length; k++) {
+      buffer.push_back(static_cast<uint8_t>(uri_content.Get(k)));
+    }
+
+    for (int k = prefix_length; k < uri_length; k++) {
       uc16 cc1 = uri_content.Get(k);
       if (unibrow::Utf16::IsLeadSurrogate(cc1)) {
         k++;
@@ -94,6 +94,8 @@ enum class SerializationTag : uint8_t {
   kUtf8String = 'S',
   kOneByteString = '"',
   kTwoByteString = 'c',
+  // String whose contents are transferred out of band. transferID:uint32_t
+  kStringTransfer = '%',
   // Reference to a serialized object. objectID:uint32_t
   kObjectReference = '^',
   // Beginning of a JS object.
@@ -191,7 +193,8 @@ ValueSerializer::ValueSerializer(Isolate* isolate,
       zone_(isolate->allocator(), ZONE_NAME),
       id_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)),
       array_buffer_transfer_map_(isolate->heap(),
-                                 ZoneAllocationPolicy(&zone_)) {}
+                                 ZoneAllocationPolicy(&zone_)),
+      string_transfer_map_(isolate->heap(), ZoneAllocationPolicy(&zone_)) {}
 
 ValueSerializer::~ValueSerializer() {
   if (buffer_) {
@@ -346,6 +349,13 @@ void ValueSerializer::TransferArrayBuffer(uint32_t transfer_id,
   array_buffer_transfer_map_.Set(array_buffer, transfer_id);
 }
 
+void ValueSerializer::TransferString(uint32_t transfer_id,
+                                     Handle<String> string) {
+  DCHECK(!string_transfer_map_.Find(string));
+  string_transfer_map_.Set(string, transfer_id);
+  has_transferred_strings_ = true;
+}
+
 Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
   out_of_memory_ = false;
   if (object->IsSmi()) {
@@ -386,6 +396,15 @@ Maybe<bool> ValueSerializer::WriteObject(Handle<Object> object) {
     }
     default:
       if (object->IsString()) {
+        if (V8_UNLIKELY(has_transferred_strings_)) {
+          uint32_t* transfer_entry =
+              string_transfer_map_.Find(Handle<String>::cast(object));
+          if (transfer_entry) {
+            WriteTag(SerializationTag::kStringTransfer);
+            WriteVarint(*transfer_entry);
+            return ThrowIfOutOfMemory();
+          }
+        }
         WriteString(Handle<String>::cast(object));
         return ThrowIfOutOfMemory();
       } else if (object->IsJSReceiver()) {
@@ -1014,6 +1033,11 @@ ValueDeserializer::~ValueDeserializer() {
   if (array_buffer_transfer_map_.ToHandle(&transfer_map_handle)) {
     GlobalHandles::Destroy(transfer_map_handle.location());
   }
+
+  Handle<Object> string_transfer_map_handle;
+  if (string_transfer_map_.ToHandle(&string_transfer_map_handle)) {
+    GlobalHandles::Destroy(string_transfer_map_handle.location());
+  }
 }
 
 Maybe<bool> ValueDeserializer::ReadHeader() {
@@ -1148,6 +1172,22 @@ void ValueDeserializer::TransferArrayBuffer(
   }
 }
 
+void ValueDeserializer::TransferString(uint32_t transfer_id,
+                                       Handle<String> string) {
+  if (string_transfer_map_.is_null()) {
+    string_transfer_map_ = isolate_->global_handles()->Create(
+        *SimpleNumberDictionary::New(isolate_, 0));
+  }
+  Handle<SimpleNumberDictionary> dictionary =
+      string_transfer_map_.ToHandleChecked();
+  Handle<SimpleNumberDictionary> new_dictionary =
+      SimpleNumberDictionary::Set(isolate_, dictionary, transfer_id, string);
+  if (!new_dictionary.is_identical_to(dictionary)) {
+    GlobalHandles::Destroy(dictionary.location());
+    string_transfer_map_ = isolate_->global_handles()->Create(*new_dictionary);
+  }
+}
+
 MaybeHandle<Object> ValueDeserializer::ReadObject() {
   DisallowJavascriptExecution no_js(isolate_);
   MaybeHandle<Object> result = ReadObjectInternal();
@@ -1211,6 +1251,8 @@ MaybeHandle<Object> ValueDeserializer::ReadObjectInternal() {
       return ReadOneByteString();
     case SerializationTag::kTwoByteString:
       return ReadTwoByteString();
+    case SerializationTag::kStringTransfer:
+      return ReadTransferredString();
     case SerializationTag::kObjectReference: {
       uint32_t id;
       if (!ReadVarint<uint32_t>().To(&id)) return MaybeHandle<Object>();
@@ -1339,6 +1381,20 @@ MaybeHandle<String> ValueDeserializer::ReadTwoByteString() {
   return string;
 }
 
+MaybeHandle<String> ValueDeserializer::ReadTransferredString() {
+  uint32_t transfer_id;
+  Handle<SimpleNumberDictionary> transfer_map;
+  if (!ReadVarint<uint32_t>().To(&transfer_id) ||
+      !string_transfer_map_.ToHandle(&transfer_map)) {
+    return MaybeHandle<String>();
+  }
+  int index = transfer_map->FindEntry(isolate_, transfer_id);
+  if (index == SimpleNumberDictionary::kNotFound) {
+    return MaybeHandle<String>();
+  }
+  return handle(String::cast(transfer_map->ValueAt(index)), isolate_);
+}
+
 bool ValueDeserializer::ReadExpectedString(Handle<String> expected) {
   DisallowHeapAllocation no_gc;
   // In the case of failure, the position in the stream is reset.
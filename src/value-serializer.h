@@ -34,6 +34,7 @@ class MutableHeapNumber;
 class Object;
 class Oddball;
 class Smi;
+class String;
 class WasmMemoryObject;
 class WasmModuleObject;
 
@@ -80,6 +81,13 @@ class ValueSerializer {
   void TransferArrayBuffer(uint32_t transfer_id,
                            Handle<JSArrayBuffer> array_buffer);
 
+  /*
+   * Marks a String as having its contents transferred out of band.
+   * Pass the corresponding String in the deserializing context to
+   * ValueDeserializer::TransferString.
+   */
+  void TransferString(uint32_t transfer_id, Handle<String> string);
+
   /*
    * Publicly exposed wire format writing methods.
    * These are intended for use within the delegate's WriteHostObject method.
@@ -175,6 +183,11 @@ class ValueSerializer {
   // A similar map, for transferred array buffers.
   IdentityMap<uint32_t, ZoneAllocationPolicy> array_buffer_transfer_map_;
 
+  // A similar map, for transferred strings. Only consulted if a string has
+  // actually been transferred, so that the common case pays no extra lookup.
+  IdentityMap<uint32_t, ZoneAllocationPolicy> string_transfer_map_;
+  bool has_transferred_strings_ = false;
+
   DISALLOW_COPY_AND_ASSIGN(ValueSerializer);
 };
 
@@ -222,6 +235,12 @@ class ValueDeserializer {
   void TransferArrayBuffer(uint32_t transfer_id,
                            Handle<JSArrayBuffer> array_buffer);
 
+  /*
+   * Accepts the string corresponding to the one passed previously to
+   * ValueSerializer::TransferString.
+   */
+  void TransferString(uint32_t transfer_id, Handle<String> string);
+
   /*
    * Publicly exposed wire format writing methods.
    * These are intended for use within the delegate's WriteHostObject method.
@@ -278,6 +297,7 @@ class ValueDeserializer {
       V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBuffer> ReadTransferredJSArrayBuffer()
       V8_WARN_UNUSED_RESULT;
+  MaybeHandle<String> ReadTransferredString() V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSArrayBufferView> ReadJSArrayBufferView(
       Handle<JSArrayBuffer> buffer) V8_WARN_UNUSED_RESULT;
   MaybeHandle<JSObject> ReadWasmModule() V8_WARN_UNUSED_RESULT;
@@ -310,6 +330,7 @@ class ValueDeserializer {
   // Always global handles.
   Handle<FixedArray> id_map_;
   MaybeHandle<SimpleNumberDictionary> array_buffer_transfer_map_;
+  MaybeHandle<SimpleNumberDictionary> string_transfer_map_;
 
   DISALLOW_COPY_AND_ASSIGN(ValueDeserializer);
 };
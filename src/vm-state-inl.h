@@ -46,6 +46,9 @@ VMState<Tag>::VMState(Isolate* isolate)
   if (FLAG_log_timer_events && previous_tag_ != EXTERNAL && Tag == EXTERNAL) {
     LOG(isolate_, TimerEvent(Logger::START, TimerEventExternal::name()));
   }
+  if (V8_UNLIKELY(FLAG_vm_state_times) && Tag != previous_tag_) {
+    isolate_->vm_state_time_stats()->BankTime(previous_tag_);
+  }
   isolate_->set_current_vm_state(Tag);
 }
 
@@ -55,6 +58,9 @@ VMState<Tag>::~VMState() {
   if (FLAG_log_timer_events && previous_tag_ != EXTERNAL && Tag == EXTERNAL) {
     LOG(isolate_, TimerEvent(Logger::END, TimerEventExternal::name()));
   }
+  if (V8_UNLIKELY(FLAG_vm_state_times) && Tag != previous_tag_) {
+    isolate_->vm_state_time_stats()->BankTime(Tag);
+  }
   isolate_->set_current_vm_state(previous_tag_);
 }
 
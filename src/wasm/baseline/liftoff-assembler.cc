@@ -7,6 +7,7 @@
 #include <sstream>
 
 #include "src/assembler-inl.h"
+#include "src/base/small-vector.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/wasm-compiler.h"
 #include "src/macro-assembler-inl.h"
@@ -127,8 +128,7 @@ class StackTransferRecipe {
           ++next_spill_slot;
           executed_moves = 1;
         }
-        register_moves_.erase(register_moves_.end() - executed_moves,
-                              register_moves_.end());
+        register_moves_.pop_back(executed_moves);
       }
     }
 
@@ -254,9 +254,10 @@ class StackTransferRecipe {
   }
 
  private:
-  // TODO(clemensh): Avoid unconditionally allocating on the heap.
-  std::vector<RegisterMove> register_moves_;
-  std::vector<RegisterLoad> register_loads_;
+  // Merge points move only a few registers in the common case, so keep the
+  // lists in inline storage to avoid heap allocations per merge.
+  base::SmallVector<RegisterMove, 8> register_moves_;
+  base::SmallVector<RegisterLoad, 8> register_loads_;
   LiftoffRegList move_dst_regs_;
   LiftoffRegList move_src_regs_;
   LiftoffAssembler* const asm_;
@@ -385,8 +386,6 @@ LiftoffRegister LiftoffAssembler::PopToRegister(LiftoffRegList pinned) {
 
 void LiftoffAssembler::MergeFullStackWith(CacheState& target) {
   DCHECK_EQ(cache_state_.stack_height(), target.stack_height());
-  // TODO(clemensh): Reuse the same StackTransferRecipe object to save some
-  // allocations.
   StackTransferRecipe transfers(this);
   for (uint32_t i = 0, e = cache_state_.stack_height(); i < e; ++i) {
     transfers.TransferStackSlot(target, i, i);
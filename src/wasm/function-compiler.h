@@ -46,6 +46,7 @@ class WasmCompilationUnit final {
                           Counters*, WasmFeatures* detected);
 
   NativeModule* native_module() const { return native_module_; }
+  int func_index() const { return func_index_; }
   ExecutionTier tier() const { return tier_; }
   bool failed() const { return result_ == nullptr; }  // TODO(clemensh): Remove.
   WasmCode* result() const { return result_; }
@@ -4,7 +4,11 @@
 
 #include "src/wasm/module-compiler.h"
 
+#include <algorithm>
+#include <atomic>
+
 #include "src/api.h"
+#include "src/base/platform/semaphore.h"
 #include "src/asmjs/asm-js.h"
 #include "src/base/template-utils.h"
 #include "src/base/utils/random-number-generator.h"
@@ -93,14 +97,19 @@ class CompilationStateImpl {
   void AddCompilationUnits(
       std::vector<std::unique_ptr<WasmCompilationUnit>>& baseline_units,
       std::vector<std::unique_ptr<WasmCompilationUnit>>& tiering_units);
-  std::unique_ptr<WasmCompilationUnit> GetNextCompilationUnit();
+  // Claims up to {max_units} units in a single critical section. Only cheap
+  // baseline units are batched; TurboFan units are always claimed one at a
+  // time to keep load balancing intact.
+  std::vector<std::unique_ptr<WasmCompilationUnit>> GetNextCompilationUnits(
+      size_t max_units);
   std::unique_ptr<WasmCompilationUnit> GetNextExecutedUnit();
 
   bool HasCompilationUnitToFinish();
 
   void OnFinishedUnit();
-  void ScheduleUnitForFinishing(std::unique_ptr<WasmCompilationUnit> unit,
-                                ExecutionTier tier);
+  void ScheduleUnitsForFinishing(
+      std::vector<std::unique_ptr<WasmCompilationUnit>> units,
+      const std::vector<ExecutionTier>& tiers);
   void ScheduleCodeLogging(WasmCode*);
 
   void OnBackgroundTaskStopped(const WasmFeatures& detected);
@@ -498,7 +507,15 @@ WasmCode* LazyCompileFunction(Isolate* isolate, NativeModule* native_module,
                          module_start + func->code.offset(),
                          module_start + func->code.end_offset()};
 
-  WasmCompilationUnit unit(isolate->wasm_engine(), native_module, func_index);
+  // Compile with Liftoff: cheap compilation keeps the first-call latency low,
+  // which is the point of compiling lazily. Liftoff falls back to TurboFan
+  // for constructs it does not support. Keep the default tier for asm.js,
+  // where deterministic semantics require the TurboFan pipeline.
+  ExecutionTier tier = native_module->module()->origin == kWasmOrigin
+                           ? ExecutionTier::kBaseline
+                           : WasmCompilationUnit::GetDefaultExecutionTier();
+  WasmCompilationUnit unit(isolate->wasm_engine(), native_module, func_index,
+                           tier);
   CompilationEnv env = native_module->CreateCompilationEnv();
   unit.ExecuteCompilation(
       &env, native_module->compilation_state()->GetWireBytesStorage(),
@@ -638,17 +655,23 @@ bool FetchAndExecuteCompilationUnit(CompilationEnv* env,
                                     Counters* counters) {
   DisallowHeapAccess no_heap_access;
 
-  std::unique_ptr<WasmCompilationUnit> unit =
-      compilation_state->GetNextCompilationUnit();
-  if (unit == nullptr) return false;
+  std::vector<std::unique_ptr<WasmCompilationUnit>> units =
+      compilation_state->GetNextCompilationUnits(
+          std::max<size_t>(1, FLAG_wasm_compilation_batch_size));
+  if (units.empty()) return false;
 
-  // Get the tier before starting compilation, as compilation can switch tiers
-  // if baseline bails out.
-  ExecutionTier tier = unit->tier();
-  unit->ExecuteCompilation(env, compilation_state->GetSharedWireBytesStorage(),
-                           counters, detected);
-  if (!unit->failed()) compilation_state->ScheduleCodeLogging(unit->result());
-  compilation_state->ScheduleUnitForFinishing(std::move(unit), tier);
+  std::vector<ExecutionTier> tiers;
+  tiers.reserve(units.size());
+  for (auto& unit : units) {
+    // Get the tier before starting compilation, as compilation can switch
+    // tiers if baseline bails out.
+    tiers.push_back(unit->tier());
+    unit->ExecuteCompilation(env,
+                             compilation_state->GetSharedWireBytesStorage(),
+                             counters, detected);
+    if (!unit->failed()) compilation_state->ScheduleCodeLogging(unit->result());
+  }
+  compilation_state->ScheduleUnitsForFinishing(std::move(units), tiers);
 
   return true;
 }
@@ -694,10 +717,10 @@ void CompileInParallel(Isolate* isolate, NativeModule* native_module,
   //    {compilation_state}. By adding units to the {compilation_state}, new
   //    {BackgroundCompileTasks} instances are spawned which run on
   //    the background threads.
-  // 2.a) The background threads and the main thread pick one compilation
-  //      unit at a time and execute the parallel phase of the compilation
+  // 2.a) The background threads and the main thread claim a batch of
+  //      compilation units at a time and execute the parallel phase of each
   //      unit. After finishing the execution of the parallel phase, the
-  //      result is enqueued in {baseline_finish_units_}.
+  //      results are enqueued in {baseline_finish_units_}.
   // 2.b) If {baseline_finish_units_} contains a compilation unit, the main
   //      thread dequeues it and finishes the compilation.
   // 3) After the parallel phase of all compilation units has started, the
@@ -728,10 +751,10 @@ void CompileInParallel(Isolate* isolate, NativeModule* native_module,
   //    background threads.
   InitializeCompilationUnits(native_module, isolate->wasm_engine());
 
-  // 2.a) The background threads and the main thread pick one compilation
-  //      unit at a time and execute the parallel phase of the compilation
+  // 2.a) The background threads and the main thread claim a batch of
+  //      compilation units at a time and execute the parallel phase of each
   //      unit. After finishing the execution of the parallel phase, the
-  //      result is enqueued in {baseline_finish_units_}.
+  //      results are enqueued in {baseline_finish_units_}.
   //      The foreground task bypasses waiting on memory threshold, because
   //      its results will immediately be converted to code (below).
   WasmFeatures detected_features;
@@ -795,41 +818,109 @@ void CompileSequentially(Isolate* isolate, NativeModule* native_module,
   UpdateFeatureUseCounts(isolate, detected);
 }
 
-void ValidateSequentially(Isolate* isolate, NativeModule* native_module,
-                          ErrorThrower* thrower) {
-  DCHECK(!thrower->error());
-
-  ModuleWireBytes wire_bytes(native_module->wire_bytes());
-  const WasmModule* module = native_module->module();
-  uint32_t start = module->num_imported_functions;
-  uint32_t end = start + module->num_declared_functions;
-  for (uint32_t i = start; i < end; ++i) {
-    const WasmFunction& func = module->functions[i];
+// Shared state of one module validation run; the function bodies are
+// independent, so they are distributed over background tasks plus the main
+// thread via a work-stealing counter.
+struct ValidationTaskState {
+  explicit ValidationTaskState(NativeModule* native_module)
+      : native_module(native_module),
+        wire_bytes(native_module->wire_bytes()),
+        module(native_module->module()),
+        next_function(module->num_imported_functions),
+        end_function(module->num_imported_functions +
+                     module->num_declared_functions),
+        first_error_function(end_function),
+        done_semaphore(0) {}
+
+  NativeModule* const native_module;
+  const ModuleWireBytes wire_bytes;
+  const WasmModule* const module;
+  std::atomic<uint32_t> next_function;
+  const uint32_t end_function;
+  // Lowest function index with a validation error found so far. Only ever
+  // decreases, so functions past it can be skipped without affecting which
+  // error gets reported.
+  std::atomic<uint32_t> first_error_function;
+  base::Mutex error_mutex;
+  DecodeResult first_error_result;
+  base::Semaphore done_semaphore;
+};
 
-    const byte* base = wire_bytes.start();
+void ValidateFunctionRange(AccountingAllocator* allocator, Counters* counters,
+                           ValidationTaskState* state) {
+  while (true) {
+    uint32_t i = state->next_function.fetch_add(1, std::memory_order_relaxed);
+    if (i >= state->end_function) return;
+    // Everything past an already discovered error can be skipped; lower
+    // indices are still validated, so the reported error stays the
+    // lowest-indexed one, exactly as with sequential validation.
+    if (i >= state->first_error_function.load(std::memory_order_relaxed)) {
+      return;
+    }
+    const WasmFunction& func = state->module->functions[i];
+    const byte* base = state->wire_bytes.start();
     FunctionBody body{func.sig, func.code.offset(), base + func.code.offset(),
                       base + func.code.end_offset()};
     DecodeResult result;
     {
-      auto time_counter = SELECT_WASM_COUNTER(
-          isolate->counters(), module->origin, wasm_decode, function_time);
+      auto time_counter = SELECT_WASM_COUNTER(counters, state->module->origin,
+                                              wasm_decode, function_time);
 
       TimedHistogramScope wasm_decode_function_time_scope(time_counter);
       WasmFeatures detected;
-      result = VerifyWasmCode(isolate->allocator(),
-                              native_module->enabled_features(), module,
-                              &detected, body);
+      result = VerifyWasmCode(allocator, state->native_module->enabled_features(),
+                              state->module, &detected, body);
     }
     if (result.failed()) {
-      TruncatedUserString<> name(wire_bytes.GetNameOrNull(&func, module));
-      thrower->CompileError("Compiling function #%d:%.*s failed: %s @+%u", i,
-                            name.length(), name.start(),
-                            result.error_msg().c_str(), result.error_offset());
-      break;
+      base::MutexGuard guard(&state->error_mutex);
+      if (i < state->first_error_function.load(std::memory_order_relaxed)) {
+        state->first_error_function.store(i, std::memory_order_relaxed);
+        state->first_error_result = std::move(result);
+      }
     }
   }
 }
 
+void ValidateSequentially(Isolate* isolate, NativeModule* native_module,
+                          ErrorThrower* thrower) {
+  DCHECK(!thrower->error());
+
+  ValidationTaskState state(native_module);
+  const WasmModule* module = state.module;
+
+  // Distribute the work over background tasks unless determinism was
+  // requested via --wasm-num-compilation-tasks=0; the main thread
+  // participates either way.
+  int num_background_tasks = 0;
+  if (FLAG_wasm_num_compilation_tasks > 0 &&
+      module->num_declared_functions > 1) {
+    num_background_tasks =
+        std::min(FLAG_wasm_num_compilation_tasks,
+                 V8::GetCurrentPlatform()->NumberOfWorkerThreads());
+  }
+  for (int i = 0; i < num_background_tasks; ++i) {
+    // Background tasks must use the isolate's async counters.
+    V8::GetCurrentPlatform()->CallOnWorkerThread(MakeCancelableTask(
+        isolate, [&state, allocator = isolate->allocator(),
+                  counters = isolate->async_counters()] {
+          ValidateFunctionRange(allocator, counters.get(), &state);
+          state.done_semaphore.Signal();
+        }));
+  }
+  ValidateFunctionRange(isolate->allocator(), isolate->counters(), &state);
+  for (int i = 0; i < num_background_tasks; ++i) state.done_semaphore.Wait();
+
+  uint32_t error_function = state.first_error_function.load();
+  if (error_function < state.end_function) {
+    const WasmFunction& func = module->functions[error_function];
+    TruncatedUserString<> name(state.wire_bytes.GetNameOrNull(&func, module));
+    thrower->CompileError("Compiling function #%d:%.*s failed: %s @+%u",
+                          error_function, name.length(), name.start(),
+                          state.first_error_result.error_msg().c_str(),
+                          state.first_error_result.error_offset());
+  }
+}
+
 void CompileNativeModule(Isolate* isolate, ErrorThrower* thrower,
                          Handle<WasmModuleObject> module_object,
                          const WasmModule* wasm_module) {
@@ -2426,6 +2517,8 @@ void AsyncCompileJob::AsyncCompileFailed(Handle<Object> error_reason) {
 }
 
 void AsyncCompileJob::AsyncCompileSucceeded(Handle<WasmModuleObject> result) {
+  isolate_->wasm_engine()->CacheNativeModule(
+      isolate_->wasm_engine()->ExportNativeModule(result));
   resolver_->OnCompilationSucceeded(result);
 }
 
@@ -3016,6 +3109,28 @@ void CompilationStateImpl::AddCompilationUnits(
     if (compile_mode_ == CompileMode::kTiering) {
       DCHECK_EQ(baseline_units.size(), tiering_units.size());
       DCHECK_EQ(tiering_units.back()->tier(), ExecutionTier::kOptimized);
+      // Tiering units are claimed from the back of the queue whenever the
+      // baseline queue runs dry, which in streaming compilation overlaps
+      // tier-up with a slow network. Order each batch so that the most
+      // promising candidates are tiered up first: small functions (quick
+      // wins, typically helpers called all over the module) and functions
+      // close to the imports, which tend to sit on the module's hot
+      // boundary. Lower score means higher priority; sort descending so the
+      // best candidates end up at the back.
+      const WasmModule* module = native_module_->module();
+      auto tiering_priority =
+          [module](const std::unique_ptr<WasmCompilationUnit>& unit) {
+            const WasmFunction& function = module->functions[unit->func_index()];
+            uint32_t distance_to_imports =
+                function.func_index - module->num_imported_functions;
+            return uint64_t{function.code.length()} + distance_to_imports;
+          };
+      std::stable_sort(tiering_units.begin(), tiering_units.end(),
+                       [&tiering_priority](
+                           const std::unique_ptr<WasmCompilationUnit>& a,
+                           const std::unique_ptr<WasmCompilationUnit>& b) {
+                         return tiering_priority(a) > tiering_priority(b);
+                       });
       tiering_compilation_units_.insert(
           tiering_compilation_units_.end(),
           std::make_move_iterator(tiering_units.begin()),
@@ -3033,21 +3148,25 @@ void CompilationStateImpl::AddCompilationUnits(
   RestartBackgroundTasks();
 }
 
-std::unique_ptr<WasmCompilationUnit>
-CompilationStateImpl::GetNextCompilationUnit() {
+std::vector<std::unique_ptr<WasmCompilationUnit>>
+CompilationStateImpl::GetNextCompilationUnits(size_t max_units) {
+  DCHECK_LE(1, max_units);
   base::MutexGuard guard(&mutex_);
 
   std::vector<std::unique_ptr<WasmCompilationUnit>>& units =
       baseline_compilation_units_.empty() ? tiering_compilation_units_
                                           : baseline_compilation_units_;
 
-  if (!units.empty()) {
-    std::unique_ptr<WasmCompilationUnit> unit = std::move(units.back());
+  // TurboFan units are expensive enough that claiming more than one at a time
+  // only hurts load balancing across tasks.
+  if (&units == &tiering_compilation_units_) max_units = 1;
+
+  std::vector<std::unique_ptr<WasmCompilationUnit>> result;
+  while (!units.empty() && result.size() < max_units) {
+    result.push_back(std::move(units.back()));
     units.pop_back();
-    return unit;
   }
-
-  return std::unique_ptr<WasmCompilationUnit>();
+  return result;
 }
 
 std::unique_ptr<WasmCompilationUnit>
@@ -3097,14 +3216,18 @@ void CompilationStateImpl::OnFinishedUnit() {
   }
 }
 
-void CompilationStateImpl::ScheduleUnitForFinishing(
-    std::unique_ptr<WasmCompilationUnit> unit, ExecutionTier tier) {
+void CompilationStateImpl::ScheduleUnitsForFinishing(
+    std::vector<std::unique_ptr<WasmCompilationUnit>> units,
+    const std::vector<ExecutionTier>& tiers) {
+  DCHECK_EQ(units.size(), tiers.size());
   base::MutexGuard guard(&mutex_);
-  if (compile_mode_ == CompileMode::kTiering &&
-      tier == ExecutionTier::kOptimized) {
-    tiering_finish_units_.push_back(std::move(unit));
-  } else {
-    baseline_finish_units_.push_back(std::move(unit));
+  for (size_t i = 0; i < units.size(); ++i) {
+    if (compile_mode_ == CompileMode::kTiering &&
+        tiers[i] == ExecutionTier::kOptimized) {
+      tiering_finish_units_.push_back(std::move(units[i]));
+    } else {
+      baseline_finish_units_.push_back(std::move(units[i]));
+    }
   }
 
   if (!finisher_is_running_ && !compile_error_) {
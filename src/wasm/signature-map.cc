@@ -4,27 +4,55 @@
 
 #include "src/wasm/signature-map.h"
 
+#include <algorithm>
+
+#include "src/base/bits.h"
+#include "src/base/functional.h"
 #include "src/signature.h"
 
 namespace v8 {
 namespace internal {
 namespace wasm {
 
+constexpr uint32_t SignatureMap::kEmptySlot;
+
 uint32_t SignatureMap::FindOrInsert(const FunctionSig& sig) {
   CHECK(!frozen_);
-  auto pos = map_.find(sig);
-  if (pos != map_.end()) return pos->second;
+  // Grow the probe table before it would exceed 3/4 occupancy.
+  if (values_.size() + 1 > slots_.size() - slots_.size() / 4) {
+    Rehash(std::max<size_t>(8, 2 * slots_.size()));
+  }
+  size_t slot = Slot(base::hash<FunctionSig>()(sig));
+  while (slots_[slot] != kEmptySlot) {
+    if (values_[slots_[slot]] == sig) return slots_[slot];
+    slot = Slot(slot + 1);
+  }
   // Indexes are returned as int32_t, thus check against their limit.
-  CHECK_GE(kMaxInt, map_.size());
-  uint32_t index = static_cast<uint32_t>(map_.size());
-  map_.insert(std::make_pair(sig, index));
+  CHECK_GE(kMaxInt, values_.size());
+  uint32_t index = static_cast<uint32_t>(values_.size());
+  values_.push_back(sig);
+  slots_[slot] = index;
   return index;
 }
 
 int32_t SignatureMap::Find(const FunctionSig& sig) const {
-  auto pos = map_.find(sig);
-  if (pos == map_.end()) return -1;
-  return static_cast<int32_t>(pos->second);
+  if (slots_.empty()) return -1;
+  size_t slot = Slot(base::hash<FunctionSig>()(sig));
+  while (slots_[slot] != kEmptySlot) {
+    if (values_[slots_[slot]] == sig) return static_cast<int32_t>(slots_[slot]);
+    slot = Slot(slot + 1);
+  }
+  return -1;
+}
+
+void SignatureMap::Rehash(size_t new_size) {
+  DCHECK(base::bits::IsPowerOfTwo(new_size));
+  slots_.assign(new_size, kEmptySlot);
+  for (size_t i = 0; i < values_.size(); ++i) {
+    size_t slot = Slot(base::hash<FunctionSig>()(values_[i]));
+    while (slots_[slot] != kEmptySlot) slot = Slot(slot + 1);
+    slots_[slot] = static_cast<uint32_t>(i);
+  }
 }
 
 }  // namespace wasm
@@ -5,7 +5,7 @@
 #ifndef V8_WASM_SIGNATURE_MAP_H_
 #define V8_WASM_SIGNATURE_MAP_H_
 
-#include <unordered_map>
+#include <vector>
 
 #include "src/signature.h"
 #include "src/wasm/value-type.h"
@@ -35,8 +35,20 @@ class V8_EXPORT_PRIVATE SignatureMap {
   void Freeze() { frozen_ = true; }
 
  private:
+  static constexpr uint32_t kEmptySlot = ~uint32_t{0};
+
+  size_t Slot(size_t hash) const { return hash & (slots_.size() - 1); }
+
+  // Rebuilds the probe table at the given power-of-two size.
+  void Rehash(size_t new_size);
+
   bool frozen_ = false;
-  std::unordered_map<FunctionSig, uint32_t, base::hash<FunctionSig>> map_;
+  // Canonical signatures, indexed by their canonical id.
+  std::vector<FunctionSig> values_;
+  // Open-addressed probe table of indices into {values_}, using linear
+  // probing. The size is always a power of two and at most 3/4 occupied, so
+  // lookups are a single hash plus a short scan of a flat array.
+  std::vector<uint32_t> slots_;
 };
 
 }  // namespace wasm
@@ -4,6 +4,7 @@
 
 #include "src/wasm/wasm-engine.h"
 
+#include "src/base/functional.h"
 #include "src/code-tracer.h"
 #include "src/compilation-statistics.h"
 #include "src/objects-inl.h"
@@ -57,6 +58,11 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompileTranslatedAsmJs(
 MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
     Isolate* isolate, const WasmFeatures& enabled, ErrorThrower* thrower,
     const ModuleWireBytes& bytes) {
+  if (std::shared_ptr<NativeModule> cached =
+          MaybeGetCachedNativeModule(enabled, bytes)) {
+    return ImportNativeModule(isolate, std::move(cached));
+  }
+
   ModuleResult result =
       DecodeWasmModule(enabled, bytes.start(), bytes.end(), false, kWasmOrigin,
                        isolate->counters(), allocator());
@@ -67,9 +73,15 @@ MaybeHandle<WasmModuleObject> WasmEngine::SyncCompile(
 
   // Transfer ownership of the WasmModule to the {Managed<WasmModule>} generated
   // in {CompileToModuleObject}.
-  return CompileToModuleObject(isolate, enabled, thrower,
-                               std::move(result).value(), bytes,
-                               Handle<Script>(), Vector<const byte>());
+  MaybeHandle<WasmModuleObject> module_object = CompileToModuleObject(
+      isolate, enabled, thrower, std::move(result).value(), bytes,
+      Handle<Script>(), Vector<const byte>());
+
+  Handle<WasmModuleObject> module;
+  if (module_object.ToHandle(&module)) {
+    CacheNativeModule(ExportNativeModule(module));
+  }
+  return module_object;
 }
 
 MaybeHandle<WasmInstanceObject> WasmEngine::SyncInstantiate(
@@ -142,6 +154,13 @@ void WasmEngine::AsyncCompile(
     return;
   }
 
+  if (std::shared_ptr<NativeModule> cached =
+          MaybeGetCachedNativeModule(enabled, bytes)) {
+    resolver->OnCompilationSucceeded(
+        ImportNativeModule(isolate, std::move(cached)));
+    return;
+  }
+
   if (FLAG_wasm_test_streaming) {
     std::shared_ptr<StreamingDecoder> streaming_decoder =
         StartStreamingCompilation(isolate, enabled,
@@ -198,6 +217,38 @@ Handle<WasmModuleObject> WasmEngine::ImportNativeModule(
   return module_object;
 }
 
+std::shared_ptr<NativeModule> WasmEngine::MaybeGetCachedNativeModule(
+    const WasmFeatures& enabled, const ModuleWireBytes& bytes) {
+  if (!FLAG_wasm_native_module_cache) return {};
+  base::MutexGuard guard(&mutex_);
+  auto it = native_module_cache_.find(
+      base::hash_range(bytes.start(), bytes.end()));
+  if (it == native_module_cache_.end()) return {};
+  std::shared_ptr<NativeModule> candidate = it->second.lock();
+  if (candidate == nullptr) {
+    native_module_cache_.erase(it);
+    return {};
+  }
+  // The enabled features influence compilation, so reuse only an exact match.
+  if (!(candidate->enabled_features() == enabled)) return {};
+  // Different modules can collide on the hash; compare the actual bytes.
+  Vector<const byte> cached_bytes = candidate->wire_bytes();
+  if (bytes.length() != cached_bytes.size() ||
+      memcmp(bytes.start(), cached_bytes.start(), cached_bytes.size()) != 0) {
+    return {};
+  }
+  return candidate;
+}
+
+void WasmEngine::CacheNativeModule(
+    const std::shared_ptr<NativeModule>& native_module) {
+  if (!FLAG_wasm_native_module_cache) return;
+  Vector<const byte> wire_bytes = native_module->wire_bytes();
+  base::MutexGuard guard(&mutex_);
+  native_module_cache_[base::hash_range(
+      wire_bytes.start(), wire_bytes.end())] = native_module;
+}
+
 CompilationStatistics* WasmEngine::GetOrCreateTurboStatistics() {
   base::MutexGuard guard(&mutex_);
   if (compilation_stats_ == nullptr) {
@@ -6,6 +6,7 @@
 #define V8_WASM_WASM_ENGINE_H_
 
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 
 #include "src/wasm/wasm-code-manager.h"
@@ -110,6 +111,17 @@ class V8_EXPORT_PRIVATE WasmEngine {
   Handle<WasmModuleObject> ImportNativeModule(
       Isolate* isolate, std::shared_ptr<NativeModule> shared_module);
 
+  // Returns a previously compiled {NativeModule} for the same wire bytes and
+  // enabled features if the engine still holds one alive, or an empty pointer
+  // otherwise. Only active with --wasm-native-module-cache.
+  std::shared_ptr<NativeModule> MaybeGetCachedNativeModule(
+      const WasmFeatures& enabled, const ModuleWireBytes& bytes);
+
+  // Makes the given module available for reuse by later compilations of the
+  // same wire bytes, including from other isolates using this engine. The
+  // cache holds weak references, so it never extends a module's lifetime.
+  void CacheNativeModule(const std::shared_ptr<NativeModule>& native_module);
+
   WasmCodeManager* code_manager() { return &code_manager_; }
 
   WasmMemoryTracker* memory_tracker() { return &memory_tracker_; }
@@ -177,6 +189,10 @@ class V8_EXPORT_PRIVATE WasmEngine {
   // Set of isolates which use this WasmEngine. Used for cross-isolate GCs.
   std::unordered_set<Isolate*> isolates_;
 
+  // Weak cache of compiled modules, keyed by a hash of their wire bytes.
+  // Lookups compare the full wire bytes to rule out hash collisions.
+  std::unordered_map<size_t, std::weak_ptr<NativeModule>> native_module_cache_;
+
   // End of fields protected by {mutex_}.
   //////////////////////////////////////////////////////////////////////////////
 
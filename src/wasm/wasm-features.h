@@ -35,6 +35,17 @@ struct WasmFeatures {
       : FOREACH_WASM_FEATURE(DO_INIT, COMMA) {}
 };
 
+#define CMP_FIELD(feat, desc, val) lhs.feat == rhs.feat
+#define AND &&
+
+inline constexpr bool operator==(const WasmFeatures& lhs,
+                                 const WasmFeatures& rhs) {
+  return FOREACH_WASM_FEATURE(CMP_FIELD, AND);
+}
+
+#undef CMP_FIELD
+#undef AND
+
 static constexpr WasmFeatures kAllWasmFeatures{
     FOREACH_WASM_FEATURE(JUST_TRUE, COMMA)};
 
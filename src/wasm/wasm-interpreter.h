@@ -39,7 +39,9 @@ struct ControlTransferEntry {
   uint32_t target_arity;
 };
 
-using ControlTransferMap = ZoneMap<pc_t, ControlTransferEntry>;
+// Looked up once per executed control transfer, so use a hash map rather than
+// an ordered one; iteration order does not matter.
+using ControlTransferMap = ZoneUnorderedMap<pc_t, ControlTransferEntry>;
 
 // Representation of frames within the interpreter.
 //
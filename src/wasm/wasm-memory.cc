@@ -21,6 +21,12 @@ namespace {
 
 constexpr size_t kNegativeGuardSize = 1u << 31;  // 2GiB
 
+// The length of every reservation with full guard regions. Being a single
+// per-process value is what makes pooling released reservations possible.
+size_t FullGuardRegionSize() {
+  return RoundUp(kWasmMaxHeapOffset + kNegativeGuardSize, CommitPageSize());
+}
+
 void AddAllocationStatusSample(Isolate* isolate,
                                WasmMemoryTracker::AllocationStatus status) {
   isolate->counters()->wasm_memory_allocation_result()->AddSample(
@@ -53,13 +59,22 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
     // TODO(7881): do not use static_cast<uint32_t>() here
     *allocation_length =
         require_full_guard_regions
-            ? RoundUp(kWasmMaxHeapOffset + kNegativeGuardSize, CommitPageSize())
+            ? FullGuardRegionSize()
             : RoundUp(base::bits::RoundUpToPowerOfTwo32(
                           static_cast<uint32_t>(size)),
                       kWasmPageSize);
     DCHECK_GE(*allocation_length, size);
     DCHECK_GE(*allocation_length, kWasmPageSize);
 
+    // A pooled guard region is already accounted for in the reservation
+    // counter, so reuse neither checks the limit nor hits the platform
+    // allocator below.
+    if (require_full_guard_regions &&
+        memory_tracker->TryReuseGuardRegion(*allocation_length,
+                                            allocation_base)) {
+      break;
+    }
+
     auto limit = require_full_guard_regions ? WasmMemoryTracker::kSoftLimit
                                             : WasmMemoryTracker::kHardLimit;
     if (memory_tracker->ReserveAddressSpace(*allocation_length, limit)) break;
@@ -92,20 +107,22 @@ void* TryAllocateBackingStore(WasmMemoryTracker* memory_tracker, Heap* heap,
     heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
   }
 
-  // The Reserve makes the whole region inaccessible by default.
-  DCHECK_NULL(*allocation_base);
-  for (int trial = 0;; ++trial) {
-    *allocation_base =
-        AllocatePages(GetPlatformPageAllocator(), nullptr, *allocation_length,
-                      kWasmPageSize, PageAllocator::kNoAccess);
-    if (*allocation_base != nullptr) break;
-    if (trial == kAllocationRetries) {
-      memory_tracker->ReleaseReservation(*allocation_length);
-      AddAllocationStatusSample(heap->isolate(),
-                                AllocationStatus::kOtherFailure);
-      return nullptr;
+  // The Reserve makes the whole region inaccessible by default. A reused
+  // guard region is already in that state.
+  if (*allocation_base == nullptr) {
+    for (int trial = 0;; ++trial) {
+      *allocation_base =
+          AllocatePages(GetPlatformPageAllocator(), nullptr, *allocation_length,
+                        kWasmPageSize, PageAllocator::kNoAccess);
+      if (*allocation_base != nullptr) break;
+      if (trial == kAllocationRetries) {
+        memory_tracker->ReleaseReservation(*allocation_length);
+        AddAllocationStatusSample(heap->isolate(),
+                                  AllocationStatus::kOtherFailure);
+        return nullptr;
+      }
+      heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
     }
-    heap->MemoryPressureNotification(MemoryPressureLevel::kCritical, true);
   }
   byte* memory = reinterpret_cast<byte*>(*allocation_base);
   if (require_full_guard_regions) {
@@ -148,6 +165,12 @@ constexpr size_t kAddressSpaceHardLimit = 0xC0000000;  // 3 GiB
 }  // namespace
 
 WasmMemoryTracker::~WasmMemoryTracker() {
+  // Unmap pooled guard regions and give up their reservations.
+  for (void* base : guard_region_pool_) {
+    CHECK(FreePages(GetPlatformPageAllocator(), base, FullGuardRegionSize()));
+    ReleaseReservation(FullGuardRegionSize());
+  }
+  guard_region_pool_.clear();
   // All reserved address space should be released before the allocation tracker
   // is destroyed.
   DCHECK_EQ(reserved_address_space_, 0u);
@@ -175,6 +198,42 @@ void WasmMemoryTracker::ReleaseReservation(size_t num_bytes) {
   DCHECK_LE(num_bytes, old_reserved);
 }
 
+bool WasmMemoryTracker::TryReuseGuardRegion(size_t allocation_length,
+                                            void** allocation_base) {
+  DCHECK_EQ(FullGuardRegionSize(), allocation_length);
+  base::MutexGuard scope_lock(&mutex_);
+  if (guard_region_pool_.empty()) return false;
+  *allocation_base = guard_region_pool_.back();
+  guard_region_pool_.pop_back();
+  return true;
+}
+
+bool WasmMemoryTracker::PoolGuardRegion(const AllocationData& allocation) {
+  // Only reservations with full guard regions are pooled; they all have the
+  // same length, so any pooled region can back any new guarded memory.
+  if (allocation.allocation_length != FullGuardRegionSize()) return false;
+  base::MutexGuard scope_lock(&mutex_);
+  if (guard_region_pool_.size() >= FLAG_wasm_guard_region_pool_size) {
+    return false;
+  }
+  // Keep the reservation accounted for while the region sits in the pool, so
+  // pooled regions still count against the address space limit.
+  if (!ReserveAddressSpace(allocation.allocation_length, kSoftLimit)) {
+    return false;
+  }
+  // Drop the access protection and the committed pages, but keep the
+  // reservation. On POSIX this remaps the region inaccessible, which returns
+  // the pages to the kernel in a single call.
+  if (!SetPermissions(GetPlatformPageAllocator(), allocation.allocation_base,
+                      allocation.allocation_length,
+                      PageAllocator::kNoAccess)) {
+    ReleaseReservation(allocation.allocation_length);
+    return false;
+  }
+  guard_region_pool_.push_back(allocation.allocation_base);
+  return true;
+}
+
 void WasmMemoryTracker::RegisterAllocation(Isolate* isolate,
                                            void* allocation_base,
                                            size_t allocation_length,
@@ -249,6 +308,7 @@ bool WasmMemoryTracker::FreeMemoryIfIsWasmMemory(Isolate* isolate,
                                                  const void* buffer_start) {
   if (IsWasmMemory(buffer_start)) {
     const AllocationData allocation = ReleaseAllocation(isolate, buffer_start);
+    if (PoolGuardRegion(allocation)) return true;
     CHECK(FreePages(GetPlatformPageAllocator(), allocation.allocation_base,
                     allocation.allocation_length));
     return true;
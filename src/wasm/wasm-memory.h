@@ -7,6 +7,7 @@
 
 #include <atomic>
 #include <unordered_map>
+#include <vector>
 
 #include "src/base/platform/mutex.h"
 #include "src/flags.h"
@@ -69,6 +70,12 @@ class WasmMemoryTracker {
   // Decreases the amount of reserved address space.
   void ReleaseReservation(size_t num_bytes);
 
+  // Takes a pooled full guard region reservation of the given length, if one
+  // is available. On success, {allocation_base} points to an inaccessible
+  // reservation which is already accounted for in the reservation counter, so
+  // the caller must not call {ReserveAddressSpace} for it.
+  bool TryReuseGuardRegion(size_t allocation_length, void** allocation_base);
+
   // Removes an allocation from the tracker.
   AllocationData ReleaseAllocation(Isolate* isolate, const void* buffer_start);
 
@@ -104,6 +111,13 @@ class WasmMemoryTracker {
  private:
   void AddAddressSpaceSample(Isolate* isolate);
 
+  // Puts a released full guard region into the pool instead of unmapping it.
+  // The committed pages are returned to the kernel, but the reservation is
+  // kept (and stays accounted for), so a later allocation can reuse it
+  // without going through the platform allocator. Returns false if the
+  // region was not pooled; the caller must then free it.
+  bool PoolGuardRegion(const AllocationData& allocation);
+
   // Clients use a two-part process. First they "reserve" the address space,
   // which signifies an intent to actually allocate it. This determines whether
   // doing the allocation would put us over our limit. Once there is a
@@ -124,6 +138,11 @@ class WasmMemoryTracker {
   // buffer, rather than by the start of the allocation.
   std::unordered_map<const void*, AllocationData> allocations_;
 
+  // Pool of released full guard region reservations kept for reuse (see
+  // --wasm-guard-region-pool-size). All entries have the same length, so any
+  // of them can back any new guarded wasm memory.
+  std::vector<void*> guard_region_pool_;
+
   DISALLOW_COPY_AND_ASSIGN(WasmMemoryTracker);
 };
 
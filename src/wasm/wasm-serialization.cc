@@ -196,8 +196,35 @@ constexpr size_t kCodeHeaderSize =
     sizeof(size_t) +         // reloc size
     sizeof(size_t) +         // source positions size
     sizeof(size_t) +         // protected instructions size
+    sizeof(uint32_t) +       // patch table entry count
     sizeof(WasmCode::Tier);  // tier
 
+// The set of relocations that need to be resolved against the target address
+// space on deserialization. The serialized instruction stream is position
+// independent: call and reference targets are replaced by tags (see
+// {SetWasmCalleeTag}), so all the deserializer needs per relocation is its
+// position and mode. These are stored in a patch table after the code, which
+// avoids decoding the full reloc info stream on the load path.
+constexpr int kRelocModeMask =
+    RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
+    RelocInfo::ModeMask(RelocInfo::WASM_STUB_CALL) |
+    RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
+    RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE) |
+    RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE_ENCODED);
+
+constexpr size_t kPatchEntrySize = sizeof(uint32_t) +  // position in the code
+                                   sizeof(uint8_t);    // reloc mode
+
+uint32_t CountPatchEntries(const WasmCode* code) {
+  uint32_t count = 0;
+  for (RelocIterator iter(code->instructions(), code->reloc_info(),
+                          code->constant_pool(), kRelocModeMask);
+       !iter.done(); iter.next()) {
+    ++count;
+  }
+  return count;
+}
+
 }  // namespace
 
 class V8_EXPORT_PRIVATE NativeModuleSerializer {
@@ -256,7 +283,8 @@ size_t NativeModuleSerializer::MeasureCode(const WasmCode* code) const {
   return kCodeHeaderSize + code->instructions().size() +
          code->reloc_info().size() + code->source_positions().size() +
          code->protected_instructions().size() *
-             sizeof(trap_handler::ProtectedInstructionData);
+             sizeof(trap_handler::ProtectedInstructionData) +
+         CountPatchEntries(code) * kPatchEntrySize;
 }
 
 size_t NativeModuleSerializer::Measure() const {
@@ -291,6 +319,8 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   writer->Write(code->reloc_info().size());
   writer->Write(code->source_positions().size());
   writer->Write(code->protected_instructions().size());
+  uint32_t patch_entry_count = CountPatchEntries(code);
+  writer->Write(patch_entry_count);
   writer->Write(code->tier());
 
   // Get a pointer to the destination buffer, to hold relocated code.
@@ -313,20 +343,22 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
   }
 #endif
   memcpy(code_start, code->instructions().start(), code_size);
-  // Relocate the code.
-  int mask = RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
-             RelocInfo::ModeMask(RelocInfo::WASM_STUB_CALL) |
-             RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
-             RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE) |
-             RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE_ENCODED);
+  // Relocate the code, and record each relocation in the patch table. The tags
+  // are encoded in the instruction stream itself, so the patch table only
+  // stores positions and modes.
+  uint32_t patch_entries_written = 0;
   RelocIterator orig_iter(code->instructions(), code->reloc_info(),
-                          code->constant_pool(), mask);
+                          code->constant_pool(), kRelocModeMask);
   for (RelocIterator iter(
            {code_start, code->instructions().size()}, code->reloc_info(),
            reinterpret_cast<Address>(code_start) + code->constant_pool_offset(),
-           mask);
+           kRelocModeMask);
        !iter.done(); iter.next(), orig_iter.next()) {
     RelocInfo::Mode mode = orig_iter.rinfo()->rmode();
+    writer->Write(static_cast<uint32_t>(iter.rinfo()->pc() -
+                                        reinterpret_cast<Address>(code_start)));
+    writer->Write(static_cast<uint8_t>(mode));
+    ++patch_entries_written;
     switch (mode) {
       case RelocInfo::WASM_CALL: {
         Address orig_target = orig_iter.rinfo()->wasm_call_address();
@@ -359,6 +391,8 @@ void NativeModuleSerializer::WriteCode(const WasmCode* code, Writer* writer) {
         UNREACHABLE();
     }
   }
+  DCHECK_EQ(patch_entry_count, patch_entries_written);
+  USE(patch_entries_written);
   // If we copied to an aligned buffer, copy code into serialized buffer.
   if (code_start != serialized_code_start) {
     memcpy(serialized_code_start, code_start, code_size);
@@ -455,6 +489,7 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
   size_t reloc_size = reader->Read<size_t>();
   size_t source_position_size = reader->Read<size_t>();
   size_t protected_instructions_size = reader->Read<size_t>();
+  uint32_t patch_entry_count = reader->Read<uint32_t>();
   WasmCode::Tier tier = reader->Read<WasmCode::Tier>();
 
   Vector<const byte> code_buffer = {reader->current_location(), code_size};
@@ -475,45 +510,44 @@ bool NativeModuleDeserializer::ReadCode(uint32_t fn_index, Reader* reader) {
       std::move(protected_instructions), std::move(reloc_info),
       std::move(source_pos), tier);
 
-  // Relocate the code.
-  int mask = RelocInfo::ModeMask(RelocInfo::WASM_CALL) |
-             RelocInfo::ModeMask(RelocInfo::WASM_STUB_CALL) |
-             RelocInfo::ModeMask(RelocInfo::EXTERNAL_REFERENCE) |
-             RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE) |
-             RelocInfo::ModeMask(RelocInfo::INTERNAL_REFERENCE_ENCODED);
-  for (RelocIterator iter(code->instructions(), code->reloc_info(),
-                          code->constant_pool(), mask);
-       !iter.done(); iter.next()) {
-    RelocInfo::Mode mode = iter.rinfo()->rmode();
+  // Relocate the code by walking the patch table. The tags to resolve are
+  // encoded in the instruction stream itself, so this does not need to decode
+  // the reloc info stream.
+  for (uint32_t i = 0; i < patch_entry_count; ++i) {
+    uint32_t pc_offset = reader->Read<uint32_t>();
+    RelocInfo::Mode mode =
+        static_cast<RelocInfo::Mode>(reader->Read<uint8_t>());
+    RelocInfo rinfo(code->instruction_start() + pc_offset, mode, 0, Code(),
+                    code->constant_pool());
     switch (mode) {
       case RelocInfo::WASM_CALL: {
-        uint32_t tag = GetWasmCalleeTag(iter.rinfo());
+        uint32_t tag = GetWasmCalleeTag(&rinfo);
         Address target = native_module_->GetCallTargetForFunction(tag);
-        iter.rinfo()->set_wasm_call_address(target, SKIP_ICACHE_FLUSH);
+        rinfo.set_wasm_call_address(target, SKIP_ICACHE_FLUSH);
         break;
       }
       case RelocInfo::WASM_STUB_CALL: {
-        uint32_t tag = GetWasmCalleeTag(iter.rinfo());
+        uint32_t tag = GetWasmCalleeTag(&rinfo);
         DCHECK_LT(tag, WasmCode::kRuntimeStubCount);
         Address target =
             native_module_
                 ->runtime_stub(static_cast<WasmCode::RuntimeStubId>(tag))
                 ->instruction_start();
-        iter.rinfo()->set_wasm_stub_call_address(target, SKIP_ICACHE_FLUSH);
+        rinfo.set_wasm_stub_call_address(target, SKIP_ICACHE_FLUSH);
         break;
       }
       case RelocInfo::EXTERNAL_REFERENCE: {
-        uint32_t tag = GetWasmCalleeTag(iter.rinfo());
+        uint32_t tag = GetWasmCalleeTag(&rinfo);
         Address address = isolate_->external_reference_table()->address(tag);
-        iter.rinfo()->set_target_external_reference(address, SKIP_ICACHE_FLUSH);
+        rinfo.set_target_external_reference(address, SKIP_ICACHE_FLUSH);
         break;
       }
       case RelocInfo::INTERNAL_REFERENCE:
       case RelocInfo::INTERNAL_REFERENCE_ENCODED: {
-        Address offset = iter.rinfo()->target_internal_reference();
+        Address offset = rinfo.target_internal_reference();
         Address target = code->instruction_start() + offset;
         Assembler::deserialization_set_target_internal_reference_at(
-            iter.rinfo()->pc(), target, mode);
+            rinfo.pc(), target, mode);
         break;
       }
       default:
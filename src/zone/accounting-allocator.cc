@@ -64,7 +64,7 @@ void AccountingAllocator::ConfigureSegmentPool(const size_t max_pool_size) {
     if (total_size + (size_t(1) << (power + kMinSegmentSizePower)) <=
         max_pool_size) {
       unused_segments_max_sizes_[power] = fits_fully + 1;
-      total_size += size_t(1) << power;
+      total_size += size_t(1) << (power + kMinSegmentSizePower);
     } else {
       unused_segments_max_sizes_[power] = fits_fully;
     }
@@ -130,6 +130,12 @@ Segment* AccountingAllocator::GetSegmentFromPool(size_t requested_size) {
     return nullptr;
   }
 
+  // Skip the mutex when the pool is empty. A stale read at worst sends one
+  // request to the allocator that could have been served from the pool.
+  if (base::Relaxed_Load(&current_pool_size_) == 0) {
+    return nullptr;
+  }
+
   size_t power = kMinSegmentSizePower;
   while (requested_size > (static_cast<size_t>(1) << power)) power++;
 
@@ -21,7 +21,12 @@ namespace internal {
 
 class V8_EXPORT_PRIVATE AccountingAllocator {
  public:
-  static const size_t kMaxPoolSize = 8ul * KB;
+  // The default budget covers eight complete sets of segment sizes (one
+  // segment of each size class is ~512KB in total). The previous 8KB budget
+  // was below the smallest segment size, so the pool effectively held a
+  // single minimal segment and parse/compile-heavy workloads churned
+  // through malloc for every larger segment.
+  static const size_t kMaxPoolSize = 4ul * MB;
 
   AccountingAllocator();
   virtual ~AccountingAllocator();
@@ -5,6 +5,7 @@
 #ifndef V8_ZONE_ZONE_CONTAINERS_H_
 #define V8_ZONE_ZONE_CONTAINERS_H_
 
+#include <algorithm>
 #include <deque>
 #include <forward_list>
 #include <list>
@@ -17,11 +18,92 @@
 #include <vector>
 
 #include "src/base/functional.h"
+#include "src/base/macros.h"
 #include "src/zone/zone-allocator.h"
 
 namespace v8 {
 namespace internal {
 
+// A vector with inline storage for its first {kSize} elements that spills
+// into the zone when it grows beyond that. The compiler allocates large
+// numbers of vectors that rarely hold more than a handful of elements;
+// keeping those inline avoids a zone allocation per vector. Elements must
+// be trivially copyable because growing relocates them bitwise and the
+// zone never runs destructors.
+template <typename T, size_t kSize>
+class ZoneSmallVector {
+ public:
+  ASSERT_TRIVIALLY_COPYABLE(T);
+  STATIC_ASSERT(kSize > 0);
+
+  // Constructs an empty vector using the inline storage.
+  explicit ZoneSmallVector(Zone* zone)
+      : begin_(inline_storage()),
+        end_(begin_),
+        capacity_(kSize),
+        zone_(zone) {}
+
+  T* begin() { return begin_; }
+  T* end() { return end_; }
+  const T* begin() const { return begin_; }
+  const T* end() const { return end_; }
+
+  size_t size() const { return static_cast<size_t>(end_ - begin_); }
+  bool empty() const { return begin_ == end_; }
+
+  T& operator[](size_t index) {
+    DCHECK_LT(index, size());
+    return begin_[index];
+  }
+  const T& operator[](size_t index) const {
+    DCHECK_LT(index, size());
+    return begin_[index];
+  }
+
+  T& front() {
+    DCHECK(!empty());
+    return begin_[0];
+  }
+  T& back() {
+    DCHECK(!empty());
+    return end_[-1];
+  }
+
+  void push_back(const T& value) {
+    if (V8_UNLIKELY(end_ == begin_ + capacity_)) Grow();
+    *end_++ = value;
+  }
+
+  void pop_back() {
+    DCHECK(!empty());
+    --end_;
+  }
+
+  // Drops all elements. The spilled backing, if any, is kept; the zone
+  // reclaims it when it dies.
+  void clear() { end_ = begin_; }
+
+ private:
+  void Grow() {
+    size_t length = size();
+    T* new_storage = zone_->NewArray<T>(capacity_ * 2);
+    std::copy(begin_, end_, new_storage);
+    begin_ = new_storage;
+    end_ = new_storage + length;
+    capacity_ *= 2;
+  }
+
+  T* inline_storage() { return reinterpret_cast<T*>(inline_storage_); }
+
+  T* begin_;
+  T* end_;
+  size_t capacity_;
+  Zone* zone_;
+  alignas(T) char inline_storage_[kSize * sizeof(T)];
+
+  DISALLOW_COPY_AND_ASSIGN(ZoneSmallVector);
+};
+
 // A wrapper subclass for std::vector to make it easy to construct one
 // that uses a zone allocator.
 template <typename T>
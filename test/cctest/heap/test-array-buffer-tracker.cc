@@ -379,6 +379,35 @@ TEST(ArrayBuffer_ExternalBackingStoreSizeDecreases) {
   CHECK_EQ(0, backing_store_after - backing_store_before);
 }
 
+TEST(ArrayBuffer_BackingStorePool) {
+  FLAG_array_buffer_pooling = true;
+  // Free garbage backing stores on the main thread so that the pool is
+  // populated deterministically.
+  FLAG_concurrent_array_buffer_freeing = false;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+
+  const size_t kLength = 64 * KB;
+  void* backing_store = nullptr;
+  {
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kLength);
+    backing_store = v8::Utils::OpenHandle(*ab)->backing_store();
+  }
+  // Collect the buffer. Its backing store ends up in the pool instead of
+  // going back to the embedder allocator.
+  heap::GcAndSweep(heap, OLD_SPACE);
+  heap::GcAndSweep(heap, OLD_SPACE);
+  {
+    v8::HandleScope handle_scope(isolate);
+    Local<v8::ArrayBuffer> ab = v8::ArrayBuffer::New(isolate, kLength);
+    CHECK_EQ(backing_store, v8::Utils::OpenHandle(*ab)->backing_store());
+  }
+}
+
 TEST(ArrayBuffer_ExternalBackingStoreSizeIncreasesMarkCompact) {
   if (FLAG_never_compact) return;
   ManualGCScope manual_gc_scope;
@@ -378,6 +378,60 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithStoreBufferEntries) {
   }
 }
 
+HEAP_TEST(CompactionPinnedPageIsNotEvacuated) {
+  if (FLAG_never_compact) return;
+  // Test that a page pinned through the Heap pinning API is never selected as
+  // an evacuation candidate, even when it is explicitly forced, and that the
+  // page becomes movable again after unpinning.
+
+  ManualGCScope manual_gc_scope;
+  FLAG_manual_evacuation_candidates_selection = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  {
+    HandleScope scope1(isolate);
+
+    heap::SealCurrentObjects(heap);
+
+    HandleScope scope2(isolate);
+    CHECK(heap->old_space()->Expand());
+    auto pinned_page_handles = heap::CreatePadding(
+        heap,
+        static_cast<int>(MemoryChunkLayout::AllocatableMemoryInDataPage()),
+        TENURED);
+    Page* pinned_page =
+        Page::FromAddress(pinned_page_handles.front()->address());
+    CheckAllObjectsOnPage(pinned_page_handles, pinned_page);
+
+    heap->PinObject(*pinned_page_handles.front());
+    CHECK(pinned_page->IsPinned());
+    pinned_page->SetFlag(MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+    // The pinned page must have been skipped during candidate selection, so
+    // all objects are still on it.
+    for (Handle<FixedArray> object : pinned_page_handles) {
+      CHECK_EQ(pinned_page, Page::FromAddress(object->address()));
+    }
+    CHECK(!pinned_page->IsEvacuationCandidate());
+
+    heap->UnpinObject(*pinned_page_handles.front());
+    CHECK(!pinned_page->IsPinned());
+    pinned_page->SetFlag(MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+
+    CcTest::CollectAllGarbage();
+    heap->mark_compact_collector()->EnsureSweepingCompleted();
+
+    // After unpinning the page is compacted away as usual.
+    for (Handle<FixedArray> object : pinned_page_handles) {
+      CHECK_NE(pinned_page, Page::FromAddress(object->address()));
+    }
+  }
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
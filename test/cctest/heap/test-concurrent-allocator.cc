@@ -0,0 +1,71 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/base/platform/platform.h"
+#include "src/heap/concurrent-allocator-inl.h"
+#include "src/heap/factory.h"
+#include "src/heap/heap-inl.h"
+#include "src/isolate.h"
+#include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace heap {
+
+namespace {
+
+const int kNumStrings = 1000;
+const int kStringLength = 40;
+
+class BackgroundAllocationThread final : public base::Thread {
+ public:
+  BackgroundAllocationThread(Isolate* isolate, ConcurrentAllocator* allocator)
+      : base::Thread(Options("BackgroundAllocationThread")),
+        isolate_(isolate),
+        allocator_(allocator) {}
+
+  void Run() override {
+    for (int i = 0; i < kNumStrings; i++) {
+      SeqOneByteString* string =
+          isolate_->factory()->NewRawOneByteStringInBackground(allocator_,
+                                                               kStringLength);
+      CHECK_NOT_NULL(string);
+      CHECK(Heap::InOldSpace(string));
+      for (int j = 0; j < kStringLength; j++) {
+        string->SeqOneByteStringSet(j, 'a');
+      }
+    }
+  }
+
+ private:
+  Isolate* isolate_;
+  ConcurrentAllocator* allocator_;
+};
+
+}  // namespace
+
+UNINITIALIZED_TEST(ConcurrentAllocatorBackgroundStrings) {
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+
+  {
+    ConcurrentAllocator allocator(i_isolate->heap());
+    BackgroundAllocationThread thread(i_isolate, &allocator);
+    CHECK(thread.Start());
+    thread.Join();
+    allocator.Finalize();
+    CcTest::CollectAllGarbage(i_isolate);
+  }
+
+  isolate->Dispose();
+}
+
+}  // namespace heap
+}  // namespace internal
+}  // namespace v8
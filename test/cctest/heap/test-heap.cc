@@ -1336,6 +1336,59 @@ TEST(TestUseOfIncrementalBarrierOnCompileLazy) {
   CHECK(g_function->is_compiled());
 }
 
+TEST(BytecodeFlushing) {
+  FLAG_opt = false;
+  FLAG_always_opt = false;
+  i::FLAG_optimize_for_size = false;
+  i::FLAG_incremental_marking = true;
+  i::FLAG_flush_bytecode = true;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  Isolate* i_isolate = CcTest::i_isolate();
+  Factory* factory = i_isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  const char* source =
+      "function foo() {"
+      "  var x = 42;"
+      "  var y = 42;"
+      "  var z = x + y;"
+      "};"
+      "foo()";
+  CompileRun(source);
+
+  // Check function is compiled.
+  Handle<String> foo_name = factory->InternalizeUtf8String("foo");
+  Handle<Object> func_value =
+      Object::GetProperty(i_isolate, i_isolate->global_object(), foo_name)
+          .ToHandleChecked();
+  CHECK(func_value->IsJSFunction());
+  Handle<JSFunction> function = Handle<JSFunction>::cast(func_value);
+  CHECK(function->shared()->is_compiled());
+
+  // The code will survive at least two GCs.
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  CHECK(function->shared()->is_compiled());
+
+  // Simulate several GCs that use full marking.
+  const int kAgingThreshold = 6;
+  for (int i = 0; i < kAgingThreshold; i++) {
+    CcTest::CollectAllGarbage();
+  }
+
+  // The bytecode array should have been flushed. The closure still points at
+  // the interpreter entry trampoline, which recompiles through CompileLazy on
+  // the next call.
+  CHECK(!function->shared()->is_compiled());
+
+  // Call foo to get it recompiled.
+  CompileRun("foo()");
+  CHECK(function->shared()->is_compiled());
+  CHECK(function->is_compiled());
+}
+
 TEST(CompilationCacheCachingBehavior) {
   // If we do not have the compilation cache turned off, this test is invalid.
   if (!FLAG_compilation_cache) {
@@ -1356,7 +1409,6 @@ TEST(CompilationCacheCachingBehavior) {
       "};"
       "foo();";
   Handle<String> source = factory->InternalizeUtf8String(raw_source);
-  Handle<Context> native_context = isolate->native_context();
 
   {
     v8::HandleScope scope(CcTest::isolate());
@@ -1369,7 +1421,7 @@ TEST(CompilationCacheCachingBehavior) {
     MaybeHandle<SharedFunctionInfo> cached_script =
         compilation_cache->LookupScript(source, Handle<Object>(), 0, 0,
                                         v8::ScriptOriginOptions(true, false),
-                                        native_context, language_mode);
+                                        language_mode);
     CHECK(!cached_script.is_null());
   }
 
@@ -1380,7 +1432,7 @@ TEST(CompilationCacheCachingBehavior) {
     MaybeHandle<SharedFunctionInfo> cached_script =
         compilation_cache->LookupScript(source, Handle<Object>(), 0, 0,
                                         v8::ScriptOriginOptions(true, false),
-                                        native_context, language_mode);
+                                        language_mode);
     CHECK(!cached_script.is_null());
 
     // Progress code age until it's old and ready for GC.
@@ -1400,7 +1452,7 @@ TEST(CompilationCacheCachingBehavior) {
     MaybeHandle<SharedFunctionInfo> cached_script =
         compilation_cache->LookupScript(source, Handle<Object>(), 0, 0,
                                         v8::ScriptOriginOptions(true, false),
-                                        native_context, language_mode);
+                                        language_mode);
     CHECK(cached_script.is_null());
   }
 }
@@ -6050,6 +6102,32 @@ UNINITIALIZED_TEST(ReinitializeStringHashSeed) {
   }
 }
 
+UNINITIALIZED_TEST(PerContextAccounting) {
+  // The accounting observer is installed during heap setup, so the flag has
+  // to be set before the isolate is created.
+  i::FLAG_per_context_accounting = true;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    CHECK_EQ(0u, context->GetAllocatedBytesEstimate());
+    // Allocate well past the sampling interval and check that the bytes got
+    // attributed to the entered context.
+    CompileRun(
+        "var a = [];"
+        "for (var i = 0; i < 10000; i++) a.push(new Array(100));");
+    CHECK_LT(0u, context->GetAllocatedBytesEstimate());
+    // A second context in the same isolate starts with a fresh counter.
+    v8::Local<v8::Context> other = v8::Context::New(isolate);
+    CHECK_EQ(0u, other->GetAllocatedBytesEstimate());
+  }
+  isolate->Dispose();
+}
+
 const int kHeapLimit = 100 * MB;
 Isolate* oom_isolate = nullptr;
 
@@ -6293,6 +6371,23 @@ TEST(Regress8014) {
   CHECK_LE(heap->ms_count(), ms_count + 10);
 }
 
+HEAP_TEST(GCPauseBudgetDefersFullGC) {
+  if (!FLAG_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  heap->SetGCPauseBudget(1);
+  CHECK(heap->incremental_marking()->IsStopped());
+  // A heuristic full GC is turned into incremental marking progress while a
+  // pause budget is active.
+  heap->CollectGarbage(OLD_SPACE, GarbageCollectionReason::kMemoryReducer);
+  CHECK(!heap->incremental_marking()->IsStopped());
+  // Clearing the budget makes full GCs atomic again.
+  heap->SetGCPauseBudget(0);
+  CcTest::CollectAllGarbage();
+  CHECK(heap->incremental_marking()->IsStopped());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
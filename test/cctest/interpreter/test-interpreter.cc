@@ -4775,6 +4775,39 @@ TEST(InterpreterClassAndSuperClass) {
   }
 }
 
+TEST(InterpreterInObjectPropertyLoad) {
+  HandleAndZoneScope handles;
+  Isolate* isolate = handles.main_isolate();
+  Factory* factory = isolate->factory();
+
+  // Named loads whose receiver is a constant-shaped object literal are
+  // emitted as direct in-object loads (LdaInObjectProperty); the other cases
+  // must keep taking the generic LoadIC path and still return the right
+  // value.
+  std::pair<const char*, Handle<Object>> loads[] = {
+      {"return ({a: 'x'}).a;", factory->NewStringFromStaticChars("x")},
+      {"return ({a: 'x', b: 'y'}).b;", factory->NewStringFromStaticChars("y")},
+      {"return ({a: true, b: null}).a;", factory->true_value()},
+      {"return ({a: null}).a;", factory->null_value()},
+      {"return ({a: undefined}).a;", factory->undefined_value()},
+      // Numeric values stay on the IC path (the field may have Double
+      // representation).
+      {"return ({a: 1.5}).a;", factory->NewNumber(1.5)},
+      // Missing and shadowed properties fall back to the IC path.
+      {"return ({a: 'x'}).b;", factory->undefined_value()},
+      {"return ({a: 'x', a: 'y'}).a;", factory->NewStringFromStaticChars("y")},
+  };
+
+  for (size_t i = 0; i < arraysize(loads); i++) {
+    std::string source(InterpreterTester::SourceForBody(loads[i].first));
+    InterpreterTester tester(isolate, source.c_str());
+    auto callable = tester.GetCallable<>();
+
+    Handle<i::Object> return_value = callable().ToHandleChecked();
+    CHECK(return_value->SameValue(*loads[i].second));
+  }
+}
+
 TEST(InterpreterConstDeclaration) {
   HandleAndZoneScope handles;
   Isolate* isolate = handles.main_isolate();
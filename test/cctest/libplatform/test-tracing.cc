@@ -1,6 +1,7 @@
 // Copyright 2016 the V8 project authors. All rights reserved.
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
+#include <cstring>
 #include <limits>
 
 #include "include/libplatform/v8-tracing.h"
@@ -190,6 +191,88 @@ TEST(TestJSONTraceWriterWithCustomtag) {
   CHECK_EQ(expected_trace_str, trace_str);
 }
 
+namespace {
+
+// Reads a host-endian value of type T from |data| at |*pos|, advancing |*pos|.
+template <typename T>
+T ReadBinaryValue(const std::string& data, size_t* pos) {
+  CHECK_LE(*pos + sizeof(T), data.size());
+  T value;
+  memcpy(&value, data.data() + *pos, sizeof(T));
+  *pos += sizeof(T);
+  return value;
+}
+
+std::string ReadBinaryString(const std::string& data, size_t* pos) {
+  uint32_t length = ReadBinaryValue<uint32_t>(data, pos);
+  CHECK_LE(*pos + length, data.size());
+  std::string str = data.substr(*pos, length);
+  *pos += length;
+  return str;
+}
+
+}  // namespace
+
+TEST(TestBinaryTraceWriter) {
+  std::ostringstream stream;
+  TraceWriter* writer = TraceWriter::CreateBinaryTraceWriter(stream);
+  PopulateJSONWriter(writer);
+  std::string data = stream.str();
+  size_t pos = 0;
+
+  CHECK_EQ(std::string("V8TR"), data.substr(0, 4));
+  pos = 4;
+  CHECK_EQ(1u, ReadBinaryValue<uint32_t>(data, &pos));  // Version.
+
+  // "v8-cat" and "Test0" are interned before the first event record.
+  CHECK_EQ(1u, ReadBinaryValue<uint8_t>(data, &pos));  // kStringRecord
+  CHECK_EQ(1u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(std::string("v8-cat"), ReadBinaryString(data, &pos));
+  CHECK_EQ(1u, ReadBinaryValue<uint8_t>(data, &pos));  // kStringRecord
+  CHECK_EQ(2u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(std::string("Test0"), ReadBinaryString(data, &pos));
+
+  CHECK_EQ(2u, ReadBinaryValue<uint8_t>(data, &pos));  // kEventRecord
+  CHECK_EQ(11, ReadBinaryValue<int32_t>(data, &pos));
+  CHECK_EQ(22, ReadBinaryValue<int32_t>(data, &pos));
+  CHECK_EQ('X', static_cast<char>(ReadBinaryValue<uint8_t>(data, &pos)));
+  CHECK_EQ(static_cast<uint32_t>(TRACE_EVENT_FLAG_HAS_ID),
+           ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(100, ReadBinaryValue<int64_t>(data, &pos));
+  CHECK_EQ(50, ReadBinaryValue<int64_t>(data, &pos));
+  CHECK_EQ(33u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(44u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(42u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(123u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(1u, ReadBinaryValue<uint32_t>(data, &pos));  // Category id.
+  CHECK_EQ(2u, ReadBinaryValue<uint32_t>(data, &pos));  // Name id.
+  CHECK_EQ(0u, ReadBinaryValue<uint32_t>(data, &pos));  // Global scope.
+  CHECK_EQ(0u, ReadBinaryValue<uint8_t>(data, &pos));   // No args.
+
+  // The second event only adds "Test1"; "v8-cat" is reused by id.
+  CHECK_EQ(1u, ReadBinaryValue<uint8_t>(data, &pos));  // kStringRecord
+  CHECK_EQ(3u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(std::string("Test1"), ReadBinaryString(data, &pos));
+
+  CHECK_EQ(2u, ReadBinaryValue<uint8_t>(data, &pos));  // kEventRecord
+  CHECK_EQ(55, ReadBinaryValue<int32_t>(data, &pos));
+  CHECK_EQ(66, ReadBinaryValue<int32_t>(data, &pos));
+  CHECK_EQ('Y', static_cast<char>(ReadBinaryValue<uint8_t>(data, &pos)));
+  CHECK_EQ(0u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(110, ReadBinaryValue<int64_t>(data, &pos));
+  CHECK_EQ(55, ReadBinaryValue<int64_t>(data, &pos));
+  CHECK_EQ(77u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(88u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(43u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(456u, ReadBinaryValue<uint64_t>(data, &pos));
+  CHECK_EQ(1u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(3u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(0u, ReadBinaryValue<uint32_t>(data, &pos));
+  CHECK_EQ(0u, ReadBinaryValue<uint8_t>(data, &pos));
+
+  CHECK_EQ(pos, data.size());
+}
+
 TEST(TestTracingController) {
   v8::Platform* old_platform = i::V8::GetCurrentPlatform();
   std::unique_ptr<v8::Platform> default_platform(
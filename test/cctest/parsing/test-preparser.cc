@@ -10,6 +10,7 @@
 #include "src/parsing/parsing.h"
 #include "src/parsing/preparsed-scope-data-impl.h"
 #include "src/parsing/preparsed-scope-data.h"
+#include "src/snapshot/code-serializer.h"
 
 #include "test/cctest/cctest.h"
 #include "test/cctest/scope-test-helper.h"
@@ -902,3 +903,91 @@ TEST(ProducingAndConsumingByteData) {
     CHECK_EQ(bytes_for_reading.ReadQuarter(), 2);
   }
 }
+
+TEST(PreParseDataSerializerRoundTrip) {
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::Factory* factory = isolate->factory();
+  LocalContext env;
+  i::HandleScope scope(isolate);
+
+  // Build a small synthetic tree: a root with one null child and one child
+  // that itself has no children.
+  i::Handle<i::PodArray<uint8_t>> root_bytes =
+      i::PodArray<uint8_t>::New(isolate, 5);
+  for (int i = 0; i < 5; i++) root_bytes->set(i, static_cast<uint8_t>(i + 1));
+  i::Handle<i::PreParsedScopeData> child = factory->NewPreParsedScopeData(0);
+  i::Handle<i::PodArray<uint8_t>> child_bytes =
+      i::PodArray<uint8_t>::New(isolate, 3);
+  for (int i = 0; i < 3; i++) child_bytes->set(i, static_cast<uint8_t>(42 + i));
+  child->set_scope_data(*child_bytes);
+  i::Handle<i::PreParsedScopeData> root = factory->NewPreParsedScopeData(2);
+  root->set_scope_data(*root_bytes);
+  root->set_child_data(1, *child);
+
+  i::Handle<i::String> source =
+      factory->NewStringFromAsciiChecked("function f() {}");
+  std::unique_ptr<i::ScriptData> serialized(
+      i::PreParseDataSerializer::Serialize(isolate, root, source));
+
+  i::Handle<i::PreParsedScopeData> deserialized =
+      i::PreParseDataSerializer::Deserialize(isolate, serialized.get(), source)
+          .ToHandleChecked();
+  CHECK_EQ(5, deserialized->scope_data()->length());
+  for (int i = 0; i < 5; i++) {
+    CHECK_EQ(i + 1, deserialized->scope_data()->get(i));
+  }
+  CHECK_EQ(2, deserialized->length());
+  CHECK(deserialized->child_data(0)->IsNull());
+  i::PreParsedScopeData* deserialized_child =
+      i::PreParsedScopeData::cast(deserialized->child_data(1));
+  CHECK_EQ(3, deserialized_child->scope_data()->length());
+  CHECK_EQ(0, deserialized_child->length());
+
+  // A buffer produced for one script must be rejected for another.
+  i::Handle<i::String> other_source =
+      factory->NewStringFromAsciiChecked("function g() {}");
+  CHECK(i::PreParseDataSerializer::Deserialize(isolate, serialized.get(),
+                                               other_source)
+            .is_null());
+  CHECK(serialized->rejected());
+}
+
+namespace {
+void AppendUint32(std::vector<uint8_t>* out, uint32_t value) {
+  const uint8_t* start = reinterpret_cast<const uint8_t*>(&value);
+  out->insert(out->end(), start, start + i::kUInt32Size);
+}
+}  // anonymous namespace
+
+TEST(PreParseDataSerializerRejectsDeepNesting) {
+  i::Isolate* isolate = CcTest::i_isolate();
+  i::Factory* factory = isolate->factory();
+  LocalContext env;
+  i::HandleScope scope(isolate);
+
+  // Serialize a trivial tree just to obtain a valid header.
+  i::Handle<i::String> source =
+      factory->NewStringFromAsciiChecked("function f() {}");
+  i::Handle<i::PreParsedScopeData> root = factory->NewPreParsedScopeData(0);
+  root->set_scope_data(*i::PodArray<uint8_t>::New(isolate, 0));
+  std::unique_ptr<i::ScriptData> valid(
+      i::PreParseDataSerializer::Serialize(isolate, root, source));
+
+  // Replace the payload with a chain of nested scopes far deeper than any
+  // parser-produced tree. The deserializer must reject the buffer instead
+  // of overflowing the stack.
+  std::vector<uint8_t> buffer(
+      valid->data(), valid->data() + i::PreParseDataSerializer::kHeaderSize);
+  const int kDepth = 100000;
+  for (int i = 0; i < kDepth; i++) {
+    AppendUint32(&buffer, 0);  // Scope data length.
+    AppendUint32(&buffer, 1);  // Child count.
+    AppendUint32(&buffer, 1);  // Child present.
+  }
+  AppendUint32(&buffer, 0);  // Innermost scope data length.
+  AppendUint32(&buffer, 0);  // Innermost child count.
+  i::ScriptData hostile(buffer.data(), static_cast<int>(buffer.size()));
+  CHECK(i::PreParseDataSerializer::Deserialize(isolate, &hostile, source)
+            .is_null());
+  CHECK(hostile.rejected());
+}
@@ -2048,6 +2048,49 @@ THREADED_TEST(ObjectTemplate) {
             ->BooleanValue(isolate));
 }
 
+
+THREADED_TEST(ObjectTemplateNewInstanceBatch) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  // A template without properties takes the contiguous-block fast path.
+  Local<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  Local<v8::Array> batch =
+      templ->NewInstanceBatch(env.local(), 100).ToLocalChecked();
+  CHECK_EQ(100u, batch->Length());
+  Local<v8::Object> first =
+      batch->Get(env.local(), 0).ToLocalChecked().As<v8::Object>();
+  for (uint32_t i = 1; i < 100; i++) {
+    Local<v8::Object> instance =
+        batch->Get(env.local(), i).ToLocalChecked().As<v8::Object>();
+    CHECK(!instance->SameValue(first));
+    CHECK(instance->GetPrototype()->SameValue(first->GetPrototype()));
+    CHECK(instance->Set(env.local(), v8_str("x"),
+                        v8::Integer::New(isolate, i))
+              .FromJust());
+  }
+
+  // A template with data properties falls back to per-instance creation
+  // and still delivers fully initialized instances.
+  Local<v8::ObjectTemplate> templ_with_data = v8::ObjectTemplate::New(isolate);
+  templ_with_data->Set(isolate, "answer", v8::Integer::New(isolate, 42));
+  Local<v8::Array> fallback_batch =
+      templ_with_data->NewInstanceBatch(env.local(), 3).ToLocalChecked();
+  CHECK_EQ(3u, fallback_batch->Length());
+  for (uint32_t i = 0; i < 3; i++) {
+    Local<v8::Object> instance =
+        fallback_batch->Get(env.local(), i).ToLocalChecked().As<v8::Object>();
+    CHECK_EQ(42, instance->Get(env.local(), v8_str("answer"))
+                     .ToLocalChecked()
+                     ->Int32Value(env.local())
+                     .FromJust());
+  }
+
+  CHECK_EQ(0u,
+           templ->NewInstanceBatch(env.local(), 0).ToLocalChecked()->Length());
+}
+
 THREADED_TEST(IntegerValue) {
   LocalContext env;
   v8::Isolate* isolate = CcTest::isolate();
@@ -12192,6 +12235,36 @@ THREADED_TEST(HandleIteration) {
 }
 
 
+TEST(BulkHandleCreation) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  v8::HandleScope scope(isolate);
+  i::Isolate* i_isolate = CcTest::i_isolate();
+  i::HandleScope i_scope(i_isolate);
+  static const int kBatchSize = 500;
+  i::Handle<i::FixedArray> array =
+      i_isolate->factory()->NewFixedArray(kBatchSize);
+  for (int i = 0; i < kBatchSize; i++) array->set(i, i::Smi::FromInt(i));
+  i::Handle<i::String> marker =
+      i_isolate->factory()->NewStringFromAsciiChecked("bulk-handle-marker");
+  array->set(0, *marker);
+  int before = v8::HandleScope::NumberOfHandles(isolate);
+  // Create several batches to force the scope through multiple block
+  // extensions, exercising the gap filling in CreateHandles.
+  for (int batch = 0; batch < 5; batch++) {
+    i::Address* base = i::HandleScope::CreateHandles(i_isolate, *array,
+                                                     kBatchSize);
+    CHECK_NOT_NULL(base);
+    for (int i = 0; i < kBatchSize; i += 37) {
+      i::Handle<i::Object> handle(base + i);
+      CHECK_EQ(*handle, array->get(i));
+    }
+  }
+  // Gap slots at block boundaries are counted, so only check a lower bound.
+  CHECK_LE(before + 5 * kBatchSize, v8::HandleScope::NumberOfHandles(isolate));
+}
+
+
 static void InterceptorCallICFastApi(
     Local<Name> name, const v8::PropertyCallbackInfo<v8::Value>& info) {
   ApiTestFuzzer::Fuzz();
@@ -15150,6 +15223,39 @@ TEST(ExternalAllocatedMemory) {
 }
 
 
+namespace {
+
+int external_memory_pressure_calls = 0;
+
+void ExternalMemoryPressureEvictor(void* data, int64_t external_memory,
+                                   int64_t external_memory_limit) {
+  external_memory_pressure_calls++;
+  CHECK_GT(external_memory, external_memory_limit);
+  v8::Isolate* isolate = static_cast<v8::Isolate*>(data);
+  // Behave like an embedder evicting its caches: release enough external
+  // memory to get back under the limit, so that no GC is needed.
+  isolate->AdjustAmountOfExternalAllocatedMemory(external_memory_limit -
+                                                 external_memory);
+}
+
+}  // namespace
+
+TEST(ExternalMemoryPressureCallback) {
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope outer(isolate);
+  v8::Local<Context> env(Context::New(isolate));
+  CHECK(!env.IsEmpty());
+  isolate->SetExternalMemoryPressureCallback(ExternalMemoryPressureEvictor,
+                                             isolate);
+  const int64_t kTriggerSize =
+      CcTest::i_isolate()->heap()->external_memory_hard_limit() + 1;
+  isolate->AdjustAmountOfExternalAllocatedMemory(kTriggerSize);
+  CHECK_GT(external_memory_pressure_calls, 0);
+  isolate->AdjustAmountOfExternalAllocatedMemory(0);
+  isolate->SetExternalMemoryPressureCallback(nullptr, nullptr);
+}
+
+
 TEST(Regress51719) {
   i::FLAG_incremental_marking = false;
   CcTest::InitializeVM();
@@ -19228,6 +19334,22 @@ TEST(TestIdleNotification) {
   CHECK_LT(final_size, initial_size + 1);
 }
 
+// Test that a pooled isolate can be reset between workloads: caches are
+// dropped, garbage is reclaimed, and the isolate keeps working afterwards.
+TEST(ClearCachesForReuse) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun("var a = []; for (var i = 0; i < 100; i++) a.push({x: i});");
+  CreateGarbageInOldSpace();
+  intptr_t size_with_garbage = CcTest::heap()->SizeOfObjects();
+  isolate->ClearCachesForReuse();
+  CHECK_LT(CcTest::heap()->SizeOfObjects(), size_with_garbage);
+  // The isolate is still fully functional for the next workload.
+  v8::Local<v8::Value> result = CompileRun("6 * 7");
+  CHECK_EQ(42, result->Int32Value(env.local()).FromJust());
+}
+
 TEST(TestMemorySavingsMode) {
   LocalContext context;
   v8::Isolate* isolate = context->GetIsolate();
@@ -23778,6 +23900,41 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+namespace {
+
+void AppendStringifyChunk(Local<String> chunk, void* data) {
+  std::string* out = static_cast<std::string*>(data);
+  v8::String::Utf8Value utf8(CcTest::isolate(), chunk);
+  out->append(*utf8, utf8.length());
+}
+
+}  // namespace
+
+THREADED_TEST(JSONStringifyStreaming) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  // An array of objects sharing one shape, large enough to span several
+  // chunks.
+  Local<Value> value = CompileRun(
+      "var a = [];"
+      "for (var i = 0; i < 1000; i++) a.push({alpha: i, beta: 'b' + i});"
+      "a");
+  Local<String> expected =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  std::string streamed;
+  CHECK(v8::JSON::Stringify(context.local(), value, Local<String>(),
+                            AppendStringifyChunk, &streamed)
+            .FromJust());
+  v8::String::Utf8Value utf8(context->GetIsolate(), expected);
+  CHECK_EQ(0, strcmp(*utf8, streamed.c_str()));
+  // Non-serializable values produce no output.
+  std::string empty;
+  CHECK(!v8::JSON::Stringify(context.local(), CompileRun("undefined"),
+                             Local<String>(), AppendStringifyChunk, &empty)
+             .FromJust());
+  CHECK(empty.empty());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
@@ -412,6 +412,31 @@ TEST(OptimizedCodeSharing1) {
   }
 }
 
+TEST(CompilationCacheCrossContext) {
+  // The script compilation cache key contains nothing native-context
+  // dependent, so the same source compiled in several contexts must reuse
+  // one SharedFunctionInfo.
+  if (!FLAG_compilation_cache) return;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  const char* source =
+      "function f(a, b) { return a + b; }"
+      "f(1, 2);";
+  Handle<SharedFunctionInfo> first_shared;
+  for (int i = 0; i < 3; i++) {
+    LocalContext env;
+    CompileRun(source);
+    Handle<JSFunction> fun = Handle<JSFunction>::cast(
+        v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+            env->Global()->Get(env.local(), v8_str("f")).ToLocalChecked())));
+    if (i == 0) {
+      first_shared = handle(fun->shared(), CcTest::i_isolate());
+    } else {
+      CHECK_EQ(*first_shared, fun->shared());
+    }
+  }
+}
+
 TEST(CompileFunctionInContext) {
   if (i::FLAG_always_opt) return;
   CcTest::InitializeVM();
@@ -4246,6 +4246,42 @@ TEST(DebugEvaluateNoSideEffect) {
   DisableDebugger(env->GetIsolate());
 }
 
+namespace {
+int CountScriptsWithSource(i::Isolate* isolate, v8::Local<v8::String> source) {
+  i::Handle<i::String> i_source = v8::Utils::OpenHandle(*source);
+  int count = 0;
+  i::DisallowHeapAllocation no_gc;
+  i::Script::Iterator iterator(isolate);
+  i::Script* script;
+  while ((script = iterator.Next()) != nullptr) {
+    if (!script->source()->IsString()) continue;
+    if (i_source->Equals(i::String::cast(script->source()))) ++count;
+  }
+  return count;
+}
+}  // anonymous namespace
+
+TEST(DebugEvaluateGlobalReusesCompilation) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  // Attaching the debugger disables the compilation cache; repeated global
+  // debug-evaluates of the same expression must still reuse the compiled
+  // script instead of recompiling on every evaluation.
+  EnableDebugger(isolate);
+
+  v8::Local<v8::String> source = v8_str(isolate, "'debug_evaluate_' + 42");
+  v8::Local<v8::Value> first =
+      v8::debug::EvaluateGlobal(isolate, source, false).ToLocalChecked();
+  v8::Local<v8::Value> second =
+      v8::debug::EvaluateGlobal(isolate, source, false).ToLocalChecked();
+  CHECK(first->StrictEquals(second));
+  CHECK_EQ(1, CountScriptsWithSource(CcTest::i_isolate(), source));
+
+  DisableDebugger(isolate);
+  CheckDebuggerUnloaded();
+}
+
 namespace {
 i::MaybeHandle<i::Script> FindScript(
     i::Isolate* isolate, const std::vector<i::Handle<i::Script>>& scripts,
@@ -748,6 +748,45 @@ TEST(StoreOwnIC) {
   CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
 }
 
+TEST(VectorOsrCodeCache) {
+  if (!i::FLAG_opt) return;
+  i::FLAG_allow_natives_syntax = true;
+
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+  // Compile some optimized code to stand in for an OSR compilation result.
+  CompileRun(
+      "function f(a) { return a + 1; }"
+      "f(1); f(2);"
+      "%OptimizeFunctionOnNextCall(f);"
+      "f(3);");
+  Handle<JSFunction> f = GetFunction("f");
+  if (!f->IsOptimized()) return;
+  Handle<Code> code(f->code(), isolate);
+  Handle<FeedbackVector> vector(f->feedback_vector(), isolate);
+
+  // The cache starts out empty and misses for any entry offset.
+  CHECK(!vector->has_osr_code());
+  CHECK(vector->osr_code(BailoutId(13)).is_null());
+
+  // An inserted entry hits for its entry offset only.
+  FeedbackVector::SetOsrCode(vector, BailoutId(13), code);
+  CHECK(vector->has_osr_code());
+  CHECK_EQ(*code, vector->osr_code(BailoutId(13)));
+  CHECK(vector->osr_code(BailoutId(14)).is_null());
+
+  // A new entry for a different loop replaces the old one.
+  FeedbackVector::SetOsrCode(vector, BailoutId(29), code);
+  CHECK(vector->osr_code(BailoutId(13)).is_null());
+  CHECK_EQ(*code, vector->osr_code(BailoutId(29)));
+
+  vector->ClearOsrCode();
+  CHECK(!vector->has_osr_code());
+  CHECK(vector->osr_code(BailoutId(29)).is_null());
+}
+
 }  // namespace
 
 }  // namespace internal
@@ -1390,6 +1390,76 @@ TEST(HeapSnapshotObjectsStats) {
 }
 
 
+namespace {
+
+class TestObjectUpdatesStream : public v8::OutputStream {
+ public:
+  void EndOfStream() override { ++eos_signaled_; }
+  WriteResult WriteAsciiChunk(char* buffer, int chars_written) override {
+    UNREACHABLE();
+  }
+  WriteResult WriteHeapObjectUpdateChunk(v8::HeapObjectUpdate* buffer,
+                                         int updates_written) override {
+    CHECK(updates_written);
+    for (int i = 0; i < updates_written; ++i) {
+      if (buffer[i].size == 0) {
+        ++removed_count_;
+      } else {
+        ++updated_count_;
+      }
+    }
+    return kContinue;
+  }
+  int eos_signaled() const { return eos_signaled_; }
+  int updated_count() const { return updated_count_; }
+  int removed_count() const { return removed_count_; }
+
+ private:
+  int eos_signaled_ = 0;
+  int updated_count_ = 0;
+  int removed_count_ = 0;
+};
+
+}  // namespace
+
+TEST(HeapObjectUpdatesStream) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  heap_profiler->StartTrackingHeapObjects();
+
+  {
+    // The first call reports every live object as the baseline.
+    TestObjectUpdatesStream stream;
+    heap_profiler->GetHeapObjectUpdates(&stream);
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_LT(0, stream.updated_count());
+    CHECK_EQ(0, stream.removed_count());
+  }
+
+  {
+    // New allocations show up as added objects.
+    CompileRun("var a = []; for (var i = 0; i < 1000; ++i) a.push({});");
+    TestObjectUpdatesStream stream;
+    heap_profiler->GetHeapObjectUpdates(&stream);
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_LT(0, stream.updated_count());
+  }
+
+  {
+    // Dropping the only reference reports the objects as gone.
+    CompileRun("a = null;");
+    TestObjectUpdatesStream stream;
+    heap_profiler->GetHeapObjectUpdates(&stream);
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_LT(0, stream.removed_count());
+  }
+
+  heap_profiler->StopTrackingHeapObjects();
+}
+
+
 TEST(HeapObjectIds) {
   LocalContext env;
   v8::Isolate* isolate = env->GetIsolate();
@@ -3825,6 +3895,39 @@ TEST(SamplingHeapProfilerLargeInterval) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerAdaptiveSiteRates) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(
+      1024, 256, v8::HeapProfiler::kSamplingAdaptiveSiteRates);
+
+  // Allocate enough from a single site that its sample rate decays.
+  for (int i = 0; i < 8 * 1024; ++i) {
+    CcTest::i_isolate()->factory()->NewFixedArray(1024);
+  }
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  const char* names[] = {"(EXTERNAL)"};
+  auto node = FindAllocationProfileNode(env->GetIsolate(), *profile,
+                                        ArrayVector(names));
+  CHECK(node);
+  // Despite decayed retention, the weighted counts must still account for
+  // roughly all fired samples.
+  CHECK(!node->allocations.empty());
+  unsigned int total = 0;
+  for (auto& allocation : node->allocations) total += allocation.count;
+  CHECK_LT(0u, total);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(HeapSnapshotPrototypeNotJSReceiver) {
   LocalContext env;
   v8::HandleScope scope(env->GetIsolate());
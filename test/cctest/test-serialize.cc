@@ -1330,6 +1330,45 @@ UNINITIALIZED_TEST(CustomSnapshotDataBlobWithWarmup) {
   FreeCurrentEmbeddedBlob();
 }
 
+UNINITIALIZED_TEST(CaptureContextSnapshotDataBlob) {
+  DisableAlwaysOpt();
+  const char* init =
+      "var tenant = { id: 42 };\n"
+      "function f() { return tenant.id; }";
+
+  v8::StartupData cold = CreateSnapshotDataBlob();
+  v8::StartupData captured = v8::V8::CaptureContextSnapshotDataBlob(cold, init);
+  delete[] cold.data;
+
+  v8::Isolate::CreateParams params;
+  params.snapshot_blob = &captured;
+  params.array_buffer_allocator = CcTest::array_buffer_allocator();
+
+  // Test-appropriate equivalent of v8::Isolate::New.
+  v8::Isolate* isolate = TestSerializer::NewIsolate(params);
+  {
+    v8::Isolate::Scope i_scope(isolate);
+    v8::HandleScope h_scope(isolate);
+    // The captured context deserializes with the initialization script's
+    // state intact.
+    v8::Local<v8::Context> context =
+        v8::Context::FromSnapshot(isolate, 0).ToLocalChecked();
+    {
+      v8::Context::Scope c_scope(context);
+      CHECK_EQ(42, CompileRun("f()")->Int32Value(context).FromJust());
+    }
+    // The default context is not polluted by the initialization script.
+    v8::Local<v8::Context> default_context = v8::Context::New(isolate);
+    {
+      v8::Context::Scope c_scope(default_context);
+      CHECK(CompileRun("this.tenant")->IsUndefined());
+    }
+  }
+  isolate->Dispose();
+  delete[] captured.data;
+  FreeCurrentEmbeddedBlob();
+}
+
 UNINITIALIZED_TEST(CustomSnapshotDataBlobImmortalImmovableRoots) {
   DisableAlwaysOpt();
   // Flood the startup snapshot with shared function infos. If they are
@@ -1507,8 +1546,7 @@ TEST(CodeSerializerPromotedToCompilationCache) {
 
   MaybeHandle<SharedFunctionInfo> shared =
       isolate->compilation_cache()->LookupScript(
-          src, src, 0, 0, v8::ScriptOriginOptions(), isolate->native_context(),
-          LanguageMode::kSloppy);
+          src, src, 0, 0, v8::ScriptOriginOptions(), LanguageMode::kSloppy);
 
   CHECK(*shared.ToHandleChecked() == *copy);
 
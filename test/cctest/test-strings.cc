@@ -38,6 +38,7 @@
 #include "src/heap/factory.h"
 #include "src/messages.h"
 #include "src/objects-inl.h"
+#include "src/objects/string-table.h"
 #include "src/unicode-decoder.h"
 #include "test/cctest/cctest.h"
 #include "test/cctest/heap/heap-utils.h"
@@ -1373,6 +1374,36 @@ TEST(TrivialSlice) {
 }
 
 
+TEST(SliceTrimming) {
+  // Short substrings of disproportionately large strings must be copied
+  // instead of sliced, so that they do not keep the large string alive.
+  if (!FLAG_string_slices) return;
+  CcTest::InitializeVM();
+  Factory* factory = CcTest::i_isolate()->factory();
+  v8::HandleScope scope(CcTest::isolate());
+
+  CompileRun("var big = 'abcdefghij'.repeat(1000);");
+  v8::Local<v8::Value> result;
+  Handle<String> string;
+
+  // Runtime path.
+  result = CompileRun("big");
+  Handle<String> big = v8::Utils::OpenHandle(v8::String::Cast(*result));
+  string = factory->NewSubString(big, 0, 100);
+  CHECK(!string->IsSlicedString());
+  CHECK(string->IsSeqString());
+  string = factory->NewSubString(big, 0, 5000);
+  CHECK(string->IsSlicedString());
+
+  // Builtin path.
+  result = CompileRun("big.slice(1, 101)");
+  string = v8::Utils::OpenHandle(v8::String::Cast(*result));
+  CHECK(!string->IsSlicedString());
+  result = CompileRun("big.slice(1, 5001)");
+  string = v8::Utils::OpenHandle(v8::String::Cast(*result));
+  CHECK(string->IsSlicedString());
+}
+
 TEST(SliceFromSlice) {
   // This tests whether a slice that contains the entire parent string
   // actually creates a new string (it should not).
@@ -1402,6 +1433,26 @@ TEST(SliceFromSlice) {
 }
 
 
+TEST(GCStringDeduplication) {
+  // With --gc-string-dedup, a full GC forwards duplicates of internalized
+  // strings to their string table twin via ThinString.
+  FLAG_gc_string_dedup = true;
+  if (!FLAG_thin_strings) return;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  v8::HandleScope scope(CcTest::isolate());
+  Handle<String> internalized =
+      factory->InternalizeUtf8String("dedup_candidate_string");
+  Handle<String> duplicate =
+      factory->NewStringFromAsciiChecked("dedup_candidate_string");
+  CHECK(!duplicate->IsInternalizedString());
+  duplicate->Hash();  // The pass only considers strings with cached hashes.
+  CcTest::CollectAllGarbage();
+  CHECK(duplicate->IsThinString());
+  CHECK_EQ(*internalized, ThinString::cast(*duplicate)->actual());
+}
+
 UNINITIALIZED_TEST(OneByteArrayJoin) {
   v8::Isolate::CreateParams create_params;
   // Set heap limits.
@@ -1843,6 +1894,28 @@ TEST(Regress876759) {
   CHECK(!sliced->IsTwoByteRepresentationUnderneath());
 }
 
+TEST(StringTableTryLookupConcurrent) {
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  HandleScope scope(isolate);
+  Factory* factory = isolate->factory();
+
+  const char* raw = "try-lookup-concurrent";
+  Handle<String> internalized = factory->InternalizeUtf8String(raw);
+  CHECK(internalized->IsInternalizedString());
+
+  DisallowHeapAllocation no_gc;
+  uint64_t seed = isolate->heap()->HashSeed();
+  OneByteStringKey key(Vector<const uint8_t>::cast(CStrVector(raw)), seed);
+  CHECK_EQ(*internalized, StringTable::TryLookupConcurrent(isolate, &key));
+
+  OneByteStringKey missing_key(
+      Vector<const uint8_t>::cast(CStrVector("try-lookup-concurrent-missing")),
+      seed);
+  CHECK_EQ(Smi::FromInt(ResultSentinel::kNotFound),
+           StringTable::TryLookupConcurrent(isolate, &missing_key));
+}
+
 }  // namespace test_strings
 }  // namespace internal
 }  // namespace v8
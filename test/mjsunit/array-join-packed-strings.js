@@ -0,0 +1,34 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the join fast path for PACKED_ELEMENTS arrays of strings, which
+// copies directly from the elements without an intermediate buffer.
+
+assertSame('a,b,c', ['a', 'b', 'c'].join());
+assertSame('abc', ['a', 'b', 'c'].join(''));
+assertSame('a--b--c', ['a', 'b', 'c'].join('--'));
+assertSame('a', ['a'].join('--'));
+assertSame(',,', ['', '', ''].join());
+assertSame('', ['', '', ''].join(''));
+assertSame('a,,b', ['a', '', 'b'].join());
+
+// Two-byte elements and separators.
+assertSame('ΑΩΒ', ['Α', 'Β'].join('Ω'));
+assertSame('aΩb', ['a', 'b'].join('Ω'));
+assertSame('Α-Β', ['Α', 'Β'].join('-'));
+
+// Mixed element types fall back to the generic path.
+assertSame('a,1,b', ['a', 1, 'b'].join());
+assertSame('a,1.5,true', ['a', 1.5, true].join());
+
+// Holey arrays are not eligible for the fast path.
+var holey = ['a', 'b', 'c'];
+delete holey[1];
+assertSame('a,,c', holey.join());
+
+// Cons strings produced by concatenation still join correctly.
+var parts = [];
+for (var i = 0; i < 10; i++) parts.push('x'.repeat(3) + i);
+assertSame('xxx0.xxx1.xxx2.xxx3.xxx4.xxx5.xxx6.xxx7.xxx8.xxx9',
+           parts.join('.'));
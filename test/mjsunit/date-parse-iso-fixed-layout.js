@@ -0,0 +1,43 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the fixed-layout fast path for "YYYY-MM-DDTHH:mm:ss.sssZ"
+// timestamps, including the edge cases where it must agree with the general
+// parser or reject the input.
+
+// Round trip through toISOString, which produces exactly the fast-path
+// layout.
+var times = [0, 1, 999, -62167219200000, 8640000000000000 - 1, 1548248385679];
+for (var i = 0; i < times.length; i++) {
+  var iso = new Date(times[i]).toISOString();
+  if (iso.length == 24) {
+    assertEquals(times[i], Date.parse(iso), iso);
+  }
+}
+
+// Hour 24 denotes midnight at the end of the day, but only with zero
+// minutes, seconds and milliseconds.
+assertEquals(Date.parse('2019-01-02T00:00:00.000Z'),
+             Date.parse('2019-01-01T24:00:00.000Z'));
+assertTrue(isNaN(Date.parse('2019-01-01T24:00:00.001Z')));
+assertTrue(isNaN(Date.parse('2019-01-01T24:01:00.000Z')));
+
+// Out-of-range fields are rejected.
+assertTrue(isNaN(Date.parse('2019-00-01T00:00:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-13-01T00:00:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-01-00T00:00:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-01-32T00:00:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-01-01T25:00:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-01-01T00:60:00.000Z')));
+assertTrue(isNaN(Date.parse('2019-01-01T00:00:60.000Z')));
+
+// Off-layout strings still go through the general parser.
+assertEquals(Date.parse('2019-01-01T00:00:00.000Z'),
+             Date.parse('2019-01-01T00:00:00Z'));
+assertEquals(Date.parse('2019-01-01T00:00:00.000Z'),
+             Date.parse('2019-01-01T00:00:00.000+00:00'));
+
+// Two-byte strings take the same fast path.
+var two_byte = ('2019-01-22T12:34:56.789Z☺').slice(0, 24);
+assertEquals(Date.parse('2019-01-22T12:34:56.789Z'), Date.parse(two_byte));
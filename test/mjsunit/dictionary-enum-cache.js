@@ -0,0 +1,57 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the cached iteration order of dictionary-mode objects, in
+// particular its invalidation when properties are added or removed between
+// iterations.
+
+function dictionaryModeObject() {
+  const o = {a: 1, b: 2, c: 3};
+  delete o.b;  // Normalizes the object into dictionary mode.
+  return o;
+}
+
+const o = dictionaryModeObject();
+for (let i = 0; i < 20; i++) o['p' + i] = i;
+
+const expected = ['a', 'c'];
+for (let i = 0; i < 20; i++) expected.push('p' + i);
+
+// Repeated iteration returns the same (insertion-ordered) keys; the second
+// and later rounds are served from the cache.
+for (let round = 0; round < 3; round++) {
+  assertArrayEquals(expected, Object.keys(o));
+  const forInKeys = [];
+  for (const key in o) forInKeys.push(key);
+  assertArrayEquals(expected, forInKeys);
+}
+
+// Deleting a property invalidates the cached order.
+delete o.p3;
+expected.splice(expected.indexOf('p3'), 1);
+assertArrayEquals(expected, Object.keys(o));
+
+// Re-adding it appends at the end of the enumeration order.
+o.p3 = 'again';
+expected.push('p3');
+assertArrayEquals(expected, Object.keys(o));
+
+// Non-enumerable properties stay visible to getOwnPropertyNames but are
+// skipped by Object.keys and for-in, without disturbing the cached order.
+Object.defineProperty(o, 'hidden', {value: 1, enumerable: false});
+assertArrayEquals(expected, Object.keys(o));
+assertArrayEquals(expected.concat('hidden'), Object.getOwnPropertyNames(o));
+
+// Reconfiguring attributes keeps the enumeration position.
+Object.defineProperty(o, 'a', {value: 'changed', writable: false});
+assertArrayEquals(expected, Object.keys(o));
+assertEquals('changed', o.a);
+
+// Symbols are excluded from string key iteration but keep their own order.
+const s1 = Symbol('s1');
+const s2 = Symbol('s2');
+o[s1] = 1;
+o[s2] = 2;
+assertArrayEquals(expected, Object.keys(o));
+assertArrayEquals([s1, s2], Object.getOwnPropertySymbols(o));
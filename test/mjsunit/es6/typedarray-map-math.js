@@ -0,0 +1,65 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the %TypedArray%.prototype.map fast path for Math builtin
+// callbacks over Float64Arrays, including its special values and bailouts.
+
+const values = [
+  0, -0, 1, -1, 0.5, 2, 1024, 1e-300, 1e300, 0.1, Math.E, Math.PI,
+  Infinity, -Infinity, NaN, Number.MIN_VALUE, Number.MAX_VALUE
+];
+
+for (const fn of [Math.sqrt, Math.exp, Math.log]) {
+  const source = new Float64Array(values);
+  const mapped = source.map(fn);
+  assertInstanceof(mapped, Float64Array);
+  assertFalse(source === mapped);
+  for (let i = 0; i < values.length; i++) {
+    assertTrue(Object.is(fn(values[i]), mapped[i]),
+               fn.name + ' of ' + values[i]);
+    // The source must be untouched.
+    assertTrue(Object.is(values[i], source[i]));
+  }
+}
+
+// Large arrays hit the same path.
+const large = new Float64Array(1000);
+for (let i = 0; i < large.length; i++) large[i] = i * 1.5;
+const roots = large.map(Math.sqrt);
+for (let i = 0; i < large.length; i++) {
+  assertEquals(Math.sqrt(i * 1.5), roots[i]);
+}
+
+// Offset views map only their own elements.
+const buffer = new ArrayBuffer(64);
+const whole = new Float64Array(buffer);
+for (let i = 0; i < whole.length; i++) whole[i] = i + 1;
+const view = new Float64Array(buffer, 16, 4);
+assertArrayEquals([Math.sqrt(3), Math.sqrt(4), Math.sqrt(5), Math.sqrt(6)],
+                  Array.from(view.map(Math.sqrt)));
+
+// Ordinary callbacks still see (value, index, array).
+let callCount = 0;
+const source = new Float64Array([4, 9, 16]);
+const doubled = source.map(function(value, index, array) {
+  assertEquals(source[index], value);
+  assertSame(source, array);
+  callCount++;
+  return value * 2;
+});
+assertEquals(3, callCount);
+assertArrayEquals([8, 18, 32], Array.from(doubled));
+
+// Subclasses with a custom species constructor take the generic path.
+class MyFloat64Array extends Float64Array {
+  static get [Symbol.species]() {
+    return Float64Array;
+  }
+}
+const subclassed = new MyFloat64Array([1, 4, 9]).map(Math.sqrt);
+assertEquals(Float64Array, subclassed.constructor);
+assertArrayEquals([1, 2, 3], Array.from(subclassed));
+
+// Other element kinds keep their conversion semantics.
+assertArrayEquals([1, 2, 3], Array.from(new Int32Array([1, 4, 9]).map(Math.sqrt)));
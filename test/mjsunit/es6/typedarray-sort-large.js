@@ -0,0 +1,81 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// The default sort switches to radix sort above a length threshold; use
+// arrays comfortably beyond it so the large-array code path is exercised.
+const kLength = 1 << 15;
+
+// Simple deterministic pseudo-random generator.
+let seed = 49734321;
+function nextRandom() {
+  seed = (seed * 69069 + 12345) >>> 0;
+  return seed;
+}
+
+const typedArrayConstructors = [
+  Uint8Array,
+  Int8Array,
+  Uint16Array,
+  Int16Array,
+  Uint32Array,
+  Int32Array,
+  Uint8ClampedArray,
+  Float32Array,
+  Float64Array
+];
+
+for (const constructor of typedArrayConstructors) {
+  const array = new constructor(kLength);
+  for (let i = 0; i < kLength; i++) {
+    // Store a mix of positive and negative values; each element kind clamps
+    // or wraps as usual on store.
+    array[i] = nextRandom() - 0x80000000;
+  }
+  const expected = Array.from(array).sort((a, b) => a - b);
+  array.sort();
+  for (let i = 0; i < kLength; i++) {
+    assertEquals(expected[i], array[i], constructor.name + ' at ' + i);
+  }
+}
+
+// Floating point special values: NaNs sort to the end, -0 before +0, and
+// infinities order correctly.
+for (const constructor of [Float32Array, Float64Array]) {
+  const array = new constructor(kLength);
+  for (let i = 0; i < kLength; i++) {
+    array[i] = (nextRandom() - 0x80000000) / 0x10000;
+  }
+  array[100] = NaN;
+  array[kLength - 1] = NaN;
+  array[200] = -0;
+  array[300] = +0;
+  array[400] = Infinity;
+  array[500] = -Infinity;
+  array.sort();
+  assertEquals(-Infinity, array[0]);
+  assertTrue(isNaN(array[kLength - 1]));
+  assertTrue(isNaN(array[kLength - 2]));
+  for (let i = 0; i < kLength - 3; i++) {
+    assertTrue(array[i] <= array[i + 1] || isNaN(array[i + 1]),
+               constructor.name + ' at ' + i);
+  }
+  // Use Object.is to find the -0/+0 boundary.
+  const firstZero = array.indexOf(0);
+  assertTrue(Object.is(array[firstZero], -0));
+  assertTrue(Object.is(array[firstZero + 1], 0));
+}
+
+// 64-bit integer kinds.
+for (const constructor of [BigUint64Array, BigInt64Array]) {
+  const array = new constructor(kLength);
+  for (let i = 0; i < kLength; i++) {
+    array[i] = BigInt.asIntN(64,
+        (BigInt(nextRandom()) << 32n) | BigInt(nextRandom()));
+  }
+  const expected = Array.from(array).sort((a, b) => a < b ? -1 : a > b ? 1 : 0);
+  array.sort();
+  for (let i = 0; i < kLength; i++) {
+    assertEquals(expected[i], array[i], constructor.name + ' at ' + i);
+  }
+}
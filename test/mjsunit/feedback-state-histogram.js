@@ -0,0 +1,38 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --no-stress-opt --no-always-opt
+
+// Indices into the histogram, matching the InlineCacheState enum.
+const UNINITIALIZED = 0;
+const PREMONOMORPHIC = 1;
+const MONOMORPHIC = 2;
+const POLYMORPHIC = 4;
+const MEGAMORPHIC = 5;
+
+function load(o) { return o.x; }
+
+// The load slot transitions to monomorphic after repeated accesses on the
+// same map.
+load({x: 1});
+load({x: 1});
+let histogram = %GetFeedbackStateHistogram(load);
+assertEquals(1, histogram[MONOMORPHIC]);
+assertEquals(0, histogram[POLYMORPHIC]);
+
+// A handful of different maps makes the slot polymorphic.
+load({x: 1, a: 1});
+load({x: 1, b: 1});
+histogram = %GetFeedbackStateHistogram(load);
+assertEquals(0, histogram[MONOMORPHIC]);
+assertEquals(1, histogram[POLYMORPHIC]);
+
+// Many different maps make it megamorphic.
+load({x: 1, c: 1});
+load({x: 1, d: 1});
+load({x: 1, e: 1});
+load({x: 1, f: 1});
+histogram = %GetFeedbackStateHistogram(load);
+assertEquals(0, histogram[POLYMORPHIC]);
+assertEquals(1, histogram[MEGAMORPHIC]);
@@ -0,0 +1,97 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Re-binding a bound function that is not a constructor collapses the bound
+// chain into a single bound function internally. None of this may be
+// observable: this test pins down the spec'd behavior of bound chains.
+
+// Bound arguments accumulate in order, innermost first.
+const f = (...args) => args;
+const b1 = f.bind(null, 1, 2);
+const b2 = b1.bind(null, 3);
+const b3 = b2.bind(null, 4, 5);
+assertEquals([1, 2, 3, 4, 5, 6], b3(6));
+assertEquals([1, 2, 3], b2());
+
+// Every layer contributes one "bound " prefix to the name.
+assertEquals('bound f', b1.name);
+assertEquals('bound bound f', b2.name);
+assertEquals('bound bound bound f', b3.name);
+
+// The length is the target's length minus all bound arguments, clamped.
+const g = (a, b, c, d) => 0;
+const gb = g.bind(null, 1).bind(null, 2).bind(null, 3);
+assertEquals(1, gb.length);
+assertEquals(0, gb.bind(null, 4, 5, 6).length);
+
+// The innermost bound receiver wins; re-binding cannot change it.
+const innerThis = {};
+const o = {m() { return this; }};
+const m2 = o.m.bind(innerThis).bind({});
+assertSame(innerThis, m2());
+assertSame(innerThis, m2.call({}));
+
+// Builtins are not constructors and take the same path.
+const max2 = Math.max.bind(null, 10).bind(null, 20);
+assertEquals(30, max2(30));
+assertEquals(20, max2(5));
+assertEquals('bound bound max', max2.name);
+
+// Long chains keep argument order and stay callable.
+const cat = (...a) => a.join('');
+let chained = cat;
+for (let i = 0; i < 10; i++) chained = chained.bind(null, i);
+assertEquals('0123456789x', chained('x'));
+assertEquals(0, chained.length);
+
+// The [[Prototype]] of the result comes from the function being re-bound,
+// not from the ultimate target.
+const base = () => 0;
+const inner = base.bind(null);
+Object.setPrototypeOf(inner, null);
+const outer = inner.bind(null);
+assertEquals(null, Object.getPrototypeOf(outer));
+assertEquals(Function.prototype, Object.getPrototypeOf(base));
+
+// Constructor chains are never collapsed; new and new.target still see the
+// whole chain.
+function C(a, b) {
+  this.a = a;
+  this.b = b;
+}
+C.prototype.tag = 'C';
+const CB = C.bind(null, 1).bind(null, 2);
+const instance = new CB();
+assertEquals(1, instance.a);
+assertEquals(2, instance.b);
+assertEquals('C', instance.tag);
+assertTrue(instance instanceof C);
+assertTrue(instance instanceof CB);
+
+let observed;
+function E() {
+  observed = new.target;
+}
+const EB = E.bind(null).bind(null);
+new EB();
+assertSame(E, observed);
+const NT = function() {};
+Reflect.construct(EB, [], NT);
+assertSame(NT, observed);
+
+// An own @@hasInstance on the function being re-bound must still be
+// consulted: OrdinaryHasInstance walks the bound chain one level at a
+// time, so the hooked wrapper may not be flattened away.
+let hookCalls = 0;
+const hooked = (() => 0).bind(null);
+Object.defineProperty(hooked, Symbol.hasInstance, {
+  value(v) {
+    hookCalls++;
+    return v === 42;
+  }
+});
+const rebound = hooked.bind(null);
+assertTrue(42 instanceof rebound);
+assertFalse({} instanceof rebound);
+assertEquals(2, hookCalls);
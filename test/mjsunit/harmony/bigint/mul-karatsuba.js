@@ -0,0 +1,38 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the Karatsuba multiplication path, which kicks in above a
+// digit-count threshold, and cross-checks its results against division
+// (which takes an independent code path).
+
+function PseudoRandom(bits) {
+  let state = 0x2545F4914F6CDD1Dn;
+  let result = 0n;
+  for (let i = 0; i < bits; i += 32) {
+    state = (state * 6364136223846793005n + 1442695040888963407n) &
+            0xFFFFFFFFFFFFFFFFn;
+    result = (result << 32n) | (state >> 32n);
+  }
+  return result;
+}
+
+for (const [a_bits, b_bits] of [[4096, 4096], [8192, 2048], [5000, 3333]]) {
+  const a = PseudoRandom(a_bits) | (1n << BigInt(a_bits));
+  const b = PseudoRandom(b_bits) | (1n << BigInt(b_bits));
+  const product = a * b;
+  assertEquals(a, product / b);
+  assertEquals(0n, product % b);
+  assertEquals(product - a, a * (b - 1n));
+  assertEquals(-product, a * -b);
+}
+
+// Operands straddling the threshold, with a closed-form expected result:
+// (2**n - 1)**2 == 2**(2*n) - 2**(n+1) + 1.
+for (let bits = 2048; bits < 2560; bits += 64) {
+  const a = (1n << BigInt(bits)) - 1n;
+  const square = a * a;
+  assertEquals(
+      (1n << BigInt(2 * bits)) - (1n << BigInt(bits + 1)) + 1n, square);
+  assertEquals(a, square / a);
+}
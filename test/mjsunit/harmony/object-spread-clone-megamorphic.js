@@ -0,0 +1,60 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Exercises the bulk-clone path taken once the clone-object feedback goes
+// megamorphic, including the clone-map cache on the source maps.
+
+function clone(o) {
+  return {...o};
+}
+
+// Drive the feedback past the polymorphic limit with distinct shapes.
+const sources = [];
+for (let i = 0; i < 10; i++) {
+  const o = {x: i, y: i * 0.5, z: 'str' + i};
+  o['k' + i] = i;
+  sources.push(o);
+}
+
+for (let round = 0; round < 3; round++) {
+  for (let i = 0; i < sources.length; i++) {
+    const c = clone(sources[i]);
+    assertEquals(i, c.x);
+    assertEquals(i * 0.5, c.y);
+    assertEquals('str' + i, c.z);
+    assertEquals(i, c['k' + i]);
+    assertEquals(Object.prototype, Object.getPrototypeOf(c));
+  }
+}
+
+// Double fields must not be aliased between clone and source.
+const src = {d: 1.5};
+for (let i = 0; i < 10; i++) clone({['p' + i]: i});  // Stay megamorphic.
+const c = clone(src);
+c.d = 2.5;
+assertEquals(1.5, src.d);
+src.d = 3.5;
+assertEquals(2.5, c.d);
+
+// Many out-of-object properties.
+const big = {};
+for (let i = 0; i < 40; i++) big['p' + i] = i;
+const bigClone = clone(big);
+for (let i = 0; i < 40; i++) assertEquals(i, bigClone['p' + i]);
+assertFalse(Object.is(big, bigClone));
+
+// Indexed properties come along as well.
+const withElements = {0: 'a', 1: 'b', x: 42};
+const elementsClone = clone(withElements);
+assertEquals('a', elementsClone[0]);
+assertEquals('b', elementsClone[1]);
+assertEquals(42, elementsClone.x);
+
+// Clones are independent objects.
+const base = {a: 1};
+const c1 = clone(base);
+const c2 = clone(base);
+c1.a = 2;
+assertEquals(1, base.a);
+assertEquals(1, c2.a);
@@ -0,0 +1,158 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/node.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/vector-slot-pair.h"
+#include "test/unittests/compiler/graph-unittest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoopInvariantCodeMotionTest : public GraphTest {
+ public:
+  LoopInvariantCodeMotionTest() : GraphTest(1), simplified_(zone()) {}
+  ~LoopInvariantCodeMotionTest() override = default;
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds a while loop with an effect phi at the header and returns the
+  // loop node; {*effect_phi} is initialized with both effect inputs set to
+  // the loop-entry effect and must be wired up by the caller.
+  Node* NewLoopWithEffectPhi(Node** effect_phi) {
+    Node* cond = Parameter(0);
+    Node* loop = graph()->NewNode(common()->Loop(2), start(), start());
+    Node* branch = graph()->NewNode(common()->Branch(), cond, loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    loop->ReplaceInput(1, if_true);
+    *effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), loop);
+    return loop;
+  }
+
+  void Run() {
+    Zone temp_zone(isolate()->allocator(), ZONE_NAME);
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), &temp_zone);
+    LoopInvariantCodeMotion(graph(), loop_tree, &temp_zone).Run();
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+TEST_F(LoopInvariantCodeMotionTest, HoistInvariantLoad) {
+  Node* effect_phi;
+  Node* loop = NewLoopWithEffectPhi(&effect_phi);
+  Node* load = graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                                Parameter(0), effect_phi, loop);
+  effect_phi->ReplaceInput(1, load);
+
+  Run();
+
+  // The load must end up on the loop entry path, spliced in right before the
+  // effect phi.
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(load));
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(load, effect_phi->InputAt(0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, DontHoistLoadPastStore) {
+  Node* effect_phi;
+  Node* loop = NewLoopWithEffectPhi(&effect_phi);
+  Node* load = graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                                Parameter(0), effect_phi, loop);
+  Node* store =
+      graph()->NewNode(simplified()->StoreField(AccessBuilder::ForMap()),
+                       Parameter(0), Parameter(0), load, loop);
+  effect_phi->ReplaceInput(1, store);
+
+  Run();
+
+  // The store could invalidate the load, so neither may move.
+  EXPECT_EQ(loop, NodeProperties::GetControlInput(load));
+  EXPECT_EQ(effect_phi, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(start(), effect_phi->InputAt(0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, DontHoistLoadAboveItsGuard) {
+  Node* effect_phi;
+  Node* loop = NewLoopWithEffectPhi(&effect_phi);
+  // The map check depends on a loop phi and has to stay inside the loop. The
+  // load is ordered after it purely via the effect chain, so even though all
+  // of its value inputs are invariant it must not float above its guard.
+  Node* phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                               Parameter(0), Parameter(0), loop);
+  Node* check = graph()->NewNode(
+      simplified()->CheckMaps(
+          CheckMapsFlag::kNone,
+          ZoneHandleSet<Map>(isolate()->factory()->meta_map())),
+      phi, effect_phi, loop);
+  Node* load = graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                                Parameter(0), check, loop);
+  effect_phi->ReplaceInput(1, load);
+
+  Run();
+
+  EXPECT_EQ(loop, NodeProperties::GetControlInput(check));
+  EXPECT_EQ(loop, NodeProperties::GetControlInput(load));
+  EXPECT_EQ(check, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(start(), effect_phi->InputAt(0));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistPreservesGuardOrder) {
+  Node* effect_phi;
+  Node* loop = NewLoopWithEffectPhi(&effect_phi);
+  Node* check = graph()->NewNode(
+      simplified()->CheckMaps(
+          CheckMapsFlag::kNone,
+          ZoneHandleSet<Map>(isolate()->factory()->meta_map())),
+      Parameter(0), effect_phi, loop);
+  Node* load = graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                                Parameter(0), check, loop);
+  effect_phi->ReplaceInput(1, load);
+
+  Run();
+
+  // Both nodes move, and the load stays ordered after its guard on the loop
+  // entry effect chain.
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(check));
+  EXPECT_EQ(check, NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(load, effect_phi->InputAt(0));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(check));
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(load));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistCheckBoundsPastStore) {
+  Node* effect_phi;
+  Node* loop = NewLoopWithEffectPhi(&effect_phi);
+  Node* check =
+      graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()),
+                       Int32Constant(0), Int32Constant(10), effect_phi, loop);
+  Node* store =
+      graph()->NewNode(simplified()->StoreField(AccessBuilder::ForMap()),
+                       Parameter(0), Parameter(0), check, loop);
+  effect_phi->ReplaceInput(1, store);
+
+  Run();
+
+  // The bounds check only depends on its invariant inputs and may move even
+  // out of a loop with stores; the store stays put.
+  EXPECT_EQ(start(), NodeProperties::GetControlInput(check));
+  EXPECT_EQ(start(), NodeProperties::GetEffectInput(check));
+  EXPECT_EQ(check, effect_phi->InputAt(0));
+  EXPECT_EQ(loop, NodeProperties::GetControlInput(store));
+  EXPECT_EQ(effect_phi, NodeProperties::GetEffectInput(store));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -327,5 +327,23 @@ TEST(WorkListTest, MergeGlobalPool) {
   EXPECT_TRUE(worklist2.IsEmpty());
 }
 
+TEST(WorkListTest, FlushPushSegmentToGlobalAllowsStealing) {
+  TestWorklist worklist;
+  TestWorklist::View worklist_view1(&worklist, 0);
+  TestWorklist::View worklist_view2(&worklist, 1);
+  SomeObject dummy;
+  SomeObject* retrieved = nullptr;
+  EXPECT_TRUE(worklist_view1.Push(&dummy));
+  EXPECT_EQ(0U, worklist.StolenSegments());
+  // A partially filled push segment is invisible to other tasks until it is
+  // explicitly published.
+  EXPECT_FALSE(worklist_view2.Pop(&retrieved));
+  worklist_view1.FlushPushSegmentToGlobal();
+  EXPECT_TRUE(worklist_view2.Pop(&retrieved));
+  EXPECT_EQ(&dummy, retrieved);
+  EXPECT_EQ(1U, worklist.StolenSegments());
+  EXPECT_TRUE(worklist.IsEmpty());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -12,6 +12,7 @@
 #include "src/interpreter/bytecode-register.h"
 #include "src/interpreter/bytecode-source-info.h"
 #include "src/interpreter/constant-array-builder.h"
+#include "src/interpreter/handler-table-builder.h"
 #include "src/isolate.h"
 #include "src/objects-inl.h"
 #include "src/source-position-table.h"
@@ -53,6 +54,9 @@ class BytecodeArrayWriterUnittest : public TestWithIsolateAndZone {
                      BytecodeSourceInfo info = BytecodeSourceInfo());
 
   BytecodeArrayWriter* writer() { return &bytecode_array_writer_; }
+  void EnableSuperinstructionFusion() {
+    writer()->fuse_superinstructions_ = true;
+  }
   ZoneVector<unsigned char>* bytecodes() { return writer()->bytecodes(); }
   SourcePositionTableBuilder* source_position_table_builder() {
     return writer()->source_position_table_builder();
@@ -299,6 +303,62 @@ TEST_F(BytecodeArrayWriterUnittest, ElideNoneffectfulBytecodes) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, SuperinstructionFusion) {
+  EnableSuperinstructionFusion();
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 10 E> */ B(StackCheck),
+      /*  1 55 S> */ B(ReturnSmi), U8(42),
+      /*  3       */ B(ReturnUndefined),
+      /*  4 60 S> */ B(LdaZero),
+      /*  5 65 S> */ B(Return),
+      /*  6       */ B(LdaUndefined),
+      /*  7 70 S> */ B(Return),
+      // clang-format on
+  };
+
+  static const PositionTableEntry expected_positions[] = {
+      {0, 10, false}, {1, 55, true}, {4, 60, true}, {5, 65, true},
+      {7, 70, true}};
+
+  BytecodeLabel label_1, label_2, label_3;
+  Write(Bytecode::kStackCheck, {10, false});
+  Write(Bytecode::kLdaSmi, 42, {55, true});
+  Write(Bytecode::kReturn);  // Fused into ReturnSmi.
+  writer()->BindLabel(&label_1);
+  Write(Bytecode::kLdaUndefined);
+  Write(Bytecode::kReturn);  // Fused into ReturnUndefined.
+  writer()->BindLabel(&label_2);
+  Write(Bytecode::kLdaZero, {60, true});
+  Write(Bytecode::kReturn, {65, true});  // Not fused: both have source info.
+  writer()->BindLabel(&label_3);
+  Write(Bytecode::kLdaUndefined);
+  BytecodeLabel label_4;
+  writer()->BindLabel(&label_4);
+  Write(Bytecode::kReturn, {70, true});  // Not fused across a jump target.
+
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+
+  Handle<BytecodeArray> bytecode_array =
+      writer()->ToBytecodeArray(isolate(), 0, 0, factory()->empty_byte_array());
+  SourcePositionTableIterator source_iterator(
+      bytecode_array->SourcePositionTable());
+  for (size_t i = 0; i < arraysize(expected_positions); ++i) {
+    const PositionTableEntry& expected = expected_positions[i];
+    CHECK_EQ(source_iterator.code_offset(), expected.code_offset);
+    CHECK_EQ(source_iterator.source_position().ScriptOffset(),
+             expected.source_position);
+    CHECK_EQ(source_iterator.is_statement(), expected.is_statement);
+    source_iterator.Advance();
+  }
+  CHECK(source_iterator.done());
+}
+
 TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   static const uint8_t expected_bytes[] = {
       // clang-format off
@@ -365,6 +425,38 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, CompactRegisterFrame) {
+  // Registers 0 and 1 are fixed; the temporaries leave gaps at indices 2, 3,
+  // 5 and 9, and registers 6..8 form a contiguous triple.
+  Write(Bytecode::kStar, R(4));
+  Write(Bytecode::kForInPrepare, R(6), U8(1));
+  Write(Bytecode::kLdar, Register(160).ToOperand());
+  Write(Bytecode::kReturn);
+
+  HandlerTableBuilder handler_table_builder(zone());
+  int handler_id = handler_table_builder.NewHandlerEntry();
+  handler_table_builder.SetContextRegister(handler_id, Register(10));
+
+  int register_count =
+      writer()->CompactRegisterFrame(2, 161, &handler_table_builder);
+  CHECK_EQ(register_count, 8);
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 */ B(Star), R8(2),
+      /*  2 */ B(ForInPrepare), R8(3), U8(1),
+      /*  5 */ B(Wide), B(Ldar), R16(7),
+      /*  9 */ B(Return),
+      // clang-format on
+  };
+  CHECK_EQ(bytecodes()->size(), arraysize(expected_bytes));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(static_cast<int>(bytecodes()->at(i)),
+             static_cast<int>(expected_bytes[i]));
+  }
+  CHECK_EQ(handler_table_builder.GetContextRegister(handler_id).index(), 6);
+}
+
 #undef B
 #undef R
 
@@ -87,6 +87,36 @@ TEST_F(SourcePositionTableTest, EncodeAscending) {
   CHECK(!builder.ToSourcePositionTable(isolate()).is_null());
 }
 
+TEST_F(SourcePositionTableTest, SeekForwardMatchesLinearScan) {
+  // Use enough entries to cross several checkpoint intervals.
+  static const int kEntryCount = 1000;
+  SourcePositionTableBuilder builder;
+  for (int i = 0; i < kEntryCount; i++) {
+    builder.AddPosition(i * 3, toPos(i * 7 + 1), i % 5 == 0);
+  }
+  Handle<ByteArray> table = builder.ToSourcePositionTable(isolate());
+
+  static int targets[] = {0, 1, 2, 3, 100, 383, 384, 385, 1000, 2997, 5000};
+  for (size_t i = 0; i < arraysize(targets); i++) {
+    int target = targets[i];
+
+    int expected = -1;
+    for (SourcePositionTableIterator it(*table);
+         !it.done() && it.code_offset() <= target; it.Advance()) {
+      expected = it.source_position().ScriptOffset();
+    }
+
+    int actual = -1;
+    SourcePositionTableIterator it(*table);
+    it.SeekForward(target);
+    for (; !it.done() && it.code_offset() <= target; it.Advance()) {
+      actual = it.source_position().ScriptOffset();
+    }
+
+    CHECK_EQ(expected, actual);
+  }
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -1685,6 +1685,55 @@ TEST_F(ValueSerializerTestWithArrayBufferTransfer,
   ExpectScriptTrue("new Uint8Array(result.a).toString() === '0,1,128,255'");
 }
 
+// Includes a string marked for transfer from the serialization context to the
+// deserialization context, so that its contents never enter the buffer.
+class ValueSerializerTestWithStringTransfer : public ValueSerializerTest {
+ protected:
+  ValueSerializerTestWithStringTransfer() {
+    input_string_ = StringFromUtf8("a string travelling out of band");
+    output_string_ = StringFromUtf8("a string delivered out of band");
+  }
+
+  const Local<String>& input_string() { return input_string_; }
+  const Local<String>& output_string() { return output_string_; }
+
+  void BeforeEncode(ValueSerializer* serializer) override {
+    serializer->TransferString(0, input_string_);
+  }
+
+  void BeforeDecode(ValueDeserializer* deserializer) override {
+    deserializer->TransferString(0, output_string_);
+  }
+
+ private:
+  Local<String> input_string_;
+  Local<String> output_string_;
+};
+
+TEST_F(ValueSerializerTestWithStringTransfer, RoundTripStringTransfer) {
+  Local<Value> value = RoundTripTest(input_string());
+  ASSERT_TRUE(value->IsString());
+  EXPECT_EQ(output_string(), value);
+  ExpectScriptTrue("result === 'a string delivered out of band'");
+
+  // Other strings are unaffected and serialized inline as usual.
+  value = RoundTripTest(StringFromUtf8("inline"));
+  ExpectScriptTrue("result === 'inline'");
+
+  // Transferred strings nested inside objects are substituted as well.
+  Local<Object> object;
+  {
+    Context::Scope scope(serialization_context());
+    object = Object::New(isolate());
+    EXPECT_TRUE(object
+                    ->CreateDataProperty(serialization_context(),
+                                         StringFromUtf8("a"), input_string())
+                    .FromMaybe(false));
+  }
+  value = RoundTripTest(object);
+  ExpectScriptTrue("result.a === 'a string delivered out of band'");
+}
+
 TEST_F(ValueSerializerTest, RoundTripTypedArray) {
   // Check that the right type comes out the other side for every kind of typed
   // array.
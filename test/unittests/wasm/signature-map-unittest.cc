@@ -0,0 +1,88 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "test/unittests/test-utils.h"
+
+#include <algorithm>
+#include <initializer_list>
+#include <vector>
+
+#include "src/signature.h"
+#include "src/wasm/signature-map.h"
+#include "src/wasm/value-type.h"
+
+namespace v8 {
+namespace internal {
+namespace wasm {
+
+class SignatureMapTest : public TestWithZone {
+ public:
+  FunctionSig* MakeSig(std::initializer_list<ValueType> returns,
+                       std::initializer_list<ValueType> params) {
+    ValueType* reps =
+        zone()->NewArray<ValueType>(returns.size() + params.size());
+    ValueType* ptr = reps;
+    for (ValueType t : returns) *ptr++ = t;
+    for (ValueType t : params) *ptr++ = t;
+    return new (zone()) FunctionSig(returns.size(), params.size(), reps);
+  }
+};
+
+TEST_F(SignatureMapTest, CanonicalizesEqualSignatures) {
+  SignatureMap map;
+  FunctionSig* i_ii = MakeSig({kWasmI32}, {kWasmI32, kWasmI32});
+  FunctionSig* i_ii_copy = MakeSig({kWasmI32}, {kWasmI32, kWasmI32});
+  FunctionSig* d_d = MakeSig({kWasmF64}, {kWasmF64});
+
+  uint32_t index_i_ii = map.FindOrInsert(*i_ii);
+  uint32_t index_d_d = map.FindOrInsert(*d_d);
+  EXPECT_NE(index_i_ii, index_d_d);
+
+  // Distinct {FunctionSig} instances with the same contents canonicalize to
+  // the same index.
+  EXPECT_EQ(index_i_ii, map.FindOrInsert(*i_ii_copy));
+  EXPECT_EQ(static_cast<int32_t>(index_i_ii), map.Find(*i_ii_copy));
+  EXPECT_EQ(static_cast<int32_t>(index_d_d), map.Find(*d_d));
+}
+
+TEST_F(SignatureMapTest, FindMissesUnknownSignatures) {
+  SignatureMap map;
+  FunctionSig* v_i = MakeSig({}, {kWasmI32});
+  FunctionSig* v_f = MakeSig({}, {kWasmF32});
+
+  EXPECT_EQ(-1, map.Find(*v_i));
+  map.FindOrInsert(*v_i);
+  EXPECT_EQ(-1, map.Find(*v_f));
+
+  // Signatures differing only in parameter order do not collide.
+  FunctionSig* v_if = MakeSig({}, {kWasmI32, kWasmF32});
+  FunctionSig* v_fi = MakeSig({}, {kWasmF32, kWasmI32});
+  uint32_t index_v_if = map.FindOrInsert(*v_if);
+  uint32_t index_v_fi = map.FindOrInsert(*v_fi);
+  EXPECT_NE(index_v_if, index_v_fi);
+}
+
+TEST_F(SignatureMapTest, DenseIndicesAcrossGrowth) {
+  SignatureMap map;
+  // Insert enough distinct signatures to force the probe table to grow
+  // several times, and check that indices stay dense and stable.
+  constexpr int kNumSigs = 100;
+  std::vector<FunctionSig*> sigs;
+  for (int i = 0; i < kNumSigs; ++i) {
+    // Distinct signatures by parameter count: i32 func(i32, ..., i32).
+    ValueType* reps = zone()->NewArray<ValueType>(i + 1);
+    std::fill(reps, reps + i + 1, kWasmI32);
+    sigs.push_back(new (zone()) FunctionSig(1, i, reps));
+  }
+  std::vector<uint32_t> indices;
+  for (FunctionSig* sig : sigs) indices.push_back(map.FindOrInsert(*sig));
+  for (int i = 0; i < kNumSigs; ++i) {
+    EXPECT_EQ(static_cast<int32_t>(indices[i]), map.Find(*sigs[i]));
+    EXPECT_LT(indices[i], static_cast<uint32_t>(kNumSigs));
+  }
+}
+
+}  // namespace wasm
+}  // namespace internal
+}  // namespace v8
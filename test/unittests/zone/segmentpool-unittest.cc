@@ -22,7 +22,8 @@ TEST(Zone, SegmentPoolConstraints) {
     for (size_t power = 0; power < AccountingAllocator::kNumberBuckets;
          ++power) {
       total_size +=
-          allocator.unused_segments_max_sizes_[power] * (size_t(1) << power);
+          allocator.unused_segments_max_sizes_[power] *
+          (size_t(1) << (power + AccountingAllocator::kMinSegmentSizePower));
     }
     EXPECT_LE(total_size, size);
   }
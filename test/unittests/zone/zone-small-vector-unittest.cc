@@ -0,0 +1,81 @@
+// Copyright 2019 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/zone/zone-containers.h"
+
+#include "src/zone/accounting-allocator.h"
+#include "src/zone/zone.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+TEST(ZoneSmallVector, InlineStorage) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  ZoneSmallVector<int, 8> vector(&zone);
+  EXPECT_TRUE(vector.empty());
+
+  size_t zone_size_before = zone.allocation_size();
+  for (int i = 0; i < 8; ++i) {
+    vector.push_back(i);
+  }
+  // Elements within the inline capacity must not touch the zone.
+  EXPECT_EQ(zone_size_before, zone.allocation_size());
+  EXPECT_EQ(8u, vector.size());
+  for (int i = 0; i < 8; ++i) {
+    EXPECT_EQ(i, vector[i]);
+  }
+}
+
+TEST(ZoneSmallVector, SpillToZone) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  ZoneSmallVector<size_t, 4> vector(&zone);
+  const size_t kItemCount = size_t(1) << 10;
+  for (size_t i = 0; i < kItemCount; ++i) {
+    vector.push_back(i);
+  }
+  EXPECT_EQ(kItemCount, vector.size());
+
+  size_t count = 0;
+  for (size_t item : vector) {
+    EXPECT_EQ(count, item);
+    count++;
+  }
+  EXPECT_EQ(kItemCount, count);
+
+  EXPECT_EQ(size_t(0), vector.front());
+  EXPECT_EQ(kItemCount - 1, vector.back());
+
+  vector.pop_back();
+  EXPECT_EQ(kItemCount - 2, vector.back());
+
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+}
+
+TEST(ZoneSmallVector, ClearKeepsSpilledStorage) {
+  AccountingAllocator allocator;
+  Zone zone(&allocator, ZONE_NAME);
+
+  ZoneSmallVector<int, 2> vector(&zone);
+  for (int i = 0; i < 100; ++i) {
+    vector.push_back(i);
+  }
+  vector.clear();
+
+  // Refilling to the same size must not grow the zone again.
+  size_t zone_size_before = zone.allocation_size();
+  for (int i = 0; i < 100; ++i) {
+    vector.push_back(i);
+  }
+  EXPECT_EQ(zone_size_before, zone.allocation_size());
+  EXPECT_EQ(42, vector[42]);
+}
+
+}  // namespace internal
+}  // namespace v8